@@ -7,6 +7,7 @@ using System.Linq;
 using System.Net.Http;
 using System.Net.Http.Headers;
 using System.Threading;
+using System.Threading.Tasks;
 using Microsoft.Extensions.Configuration;
 using Microsoft.Extensions.Logging;
 using QuantConnect;
@@ -22,6 +23,8 @@ using StrategyOptionChain = Alaris.Strategy.Model.STDT002A;
 using AlarisTimeProvider = Alaris.Core.Time.ITimeProvider;
 using Alaris.Core.Time;
 using Alaris.Core.Options;
+using Alaris.Core.Vectorized;
+using Alaris.Infrastructure.Data;
 using Alaris.Infrastructure.Data.Bridge;
 using Alaris.Infrastructure.Data.Model;
 using Alaris.Infrastructure.Data.Provider;
@@ -234,6 +237,7 @@ public sealed class STLN001A : QCAlgorithm
         Log($"  Min Dollar Volume: {_strategySettings.MinimumDollarVolume:C}");
         Log($"  Max Portfolio Allocation: {_strategySettings.PortfolioAllocationLimit:P0}");
         Log($"  Max Position Allocation: {_strategySettings.MaxPositionAllocation:P0}");
+        Log($"  SIMD Path: {CRVT002A.ActivePath}");
         Log("═══════════════════════════════════════════════════════════════════");
     }
 
@@ -651,7 +655,8 @@ public sealed class STLN001A : QCAlgorithm
             MinIvRvRatio: GetRequiredDouble(configuration, "Alaris:Strategy:MinIvRvRatio"),
             MaxTermSlope: GetRequiredDouble(configuration, "Alaris:Strategy:MaxTermSlope"),
             MinimumAverageVolume: GetRequiredLong(configuration, "Alaris:Strategy:MinimumAverageVolume"),
-            DefaultImpliedVolatility: GetRequiredDouble(configuration, "Alaris:Strategy:DefaultImpliedVolatility"));
+            DefaultImpliedVolatility: GetRequiredDouble(configuration, "Alaris:Strategy:DefaultImpliedVolatility"),
+            EvaluationParallelism: GetRequiredInt(configuration, "Alaris:Strategy:EvaluationParallelism"));
         _strategySettings.Validate();
 
         _backtestSettings = new BacktestSettings(
@@ -722,6 +727,13 @@ public sealed class STLN001A : QCAlgorithm
     /// Main strategy evaluation logic.
     /// Called daily at 9:31 AM ET.
     /// </summary>
+    /// <remarks>
+    /// Runs in two phases. Phase one fetches snapshots, generates signals, sizes and validates
+    /// every symbol concurrently, bounded by <see cref="StrategySettings.EvaluationParallelism"/>;
+    /// it reads shared state only. Phase two walks the results in ticker order on the algorithm
+    /// thread, replays each symbol's log and audit entries, applies the allocation and position-count limits and
+    /// submits orders, so backtests stay reproducible whatever the degree of parallelism.
+    /// </remarks>
     private void EvaluatePositions()
     {
         if (!AreComponentsInitialised())
@@ -750,45 +762,59 @@ public sealed class STLN001A : QCAlgorithm
                 return;
             }
             
-            // Get symbols from current universe
+            // Get symbols from current universe, in the order orders will be placed
             var symbols = Securities.Keys
                 .Where(s => s.SecurityType == SecurityType.Equity)
                 .Where(s => !_activePositions.Contains(s))
+                .OrderBy(s => s.Value, StringComparer.Ordinal)
                 .ToList();
             
             Log($"STLN001A: Evaluating {symbols.Count} symbols from universe");
             
-            // Evaluate each symbol
+            // Phase one: evaluate every symbol concurrently against a fixed view of the day
+            var evaluationDate = Time;
+            var portfolioValue = Portfolio.TotalPortfolioValue;
+            var useExecutionQuoteProvider = LiveMode;
+            _marketDataAdapter!.SetEvaluationDate(evaluationDate);
+            _dataBridge!.ImpliedVolatilityHistory.Evict(
+                evaluationDate.Date.AddDays(-_validationSettings.VegaCorrelationLookbackDays));
+
+            var evaluations = new SymbolEvaluation[symbols.Count];
+            Parallel.For(
+                0,
+                symbols.Count,
+                new ParallelOptions { MaxDegreeOfParallelism = _strategySettings.EvaluationParallelism },
+                i => evaluations[i] = EvaluateSymbol(symbols[i], evaluationDate, portfolioValue, useExecutionQuoteProvider));
+
+            // Phase two: apply limits and submit orders serially, in ticker order
             int evaluated = 0;
             int signalsGenerated = 0;
             int ordersSubmitted = 0;
             
-            foreach (var symbol in symbols)
+            foreach (var evaluation in evaluations)
             {
-                try
+                foreach (var message in evaluation.Messages)
+                {
+                    Log(message);
+                }
+
+                foreach (var entry in evaluation.AuditEntries)
+                {
+                    _auditLogger?.LogAsync(entry);
+                }
+
+                if (evaluation.Failure != null)
                 {
-                    var result = EvaluateSymbol(symbol);
-                    evaluated++;
-                    
-                    if (result.SignalGenerated) signalsGenerated++;
-                    if (result.OrderSubmitted) ordersSubmitted++;
+                    ReportEvaluationFailure(evaluation.Symbol, evaluation.Failure);
+                    continue;
                 }
-                catch (Exception ex)
+
+                evaluated++;
+                if (evaluation.SignalGenerated) signalsGenerated++;
+
+                if (evaluation.Order != null && SubmitOrder(evaluation.Symbol, evaluation.Order))
                 {
-                    Error($"STLN001A: Error evaluating {symbol}: {ex.Message}");
-                    // Log error to audit trail
-                    _auditLogger?.LogAsync(new Alaris.Infrastructure.Events.Core.AuditEntry
-                    {
-                        AuditId = Guid.NewGuid(),
-                        OccurredAtUtc = DateTime.UtcNow,
-                        Action = "EvaluationError",
-                        EntityType = "Symbol",
-                        EntityId = symbol.Value,
-                        InitiatedBy = "STLN001A",
-                        Description = $"Evaluation failed for {symbol}: {ex.Message}",
-                        Severity = Alaris.Infrastructure.Events.Core.AuditSeverity.Error,
-                        Outcome = Alaris.Infrastructure.Events.Core.AuditOutcome.Failure
-                    });
+                    ordersSubmitted++;
                 }
             }
             
@@ -797,6 +823,9 @@ public sealed class STLN001A : QCAlgorithm
             Log($"  Symbols evaluated: {evaluated}");
             Log($"  Signals generated: {signalsGenerated}");
             Log($"  Orders submitted: {ordersSubmitted}");
+            var snapshotCache = _dataBridge.SnapshotCache;
+            Log($"  Snapshot cache: {snapshotCache.Count} cached, {snapshotCache.Hits} hits, " +
+                $"{snapshotCache.Misses} misses, {snapshotCache.Coalesced} coalesced, {snapshotCache.Evictions} evicted");
             Log("═══════════════════════════════════════════════════════════════════");
         }
         catch (Exception ex)
@@ -819,58 +848,101 @@ public sealed class STLN001A : QCAlgorithm
     }
 
     /// <summary>
-    /// Evaluates a single symbol for trading opportunity.
-    /// Implements complete Alaris strategy workflow.
+    /// Reports a symbol whose evaluation threw.
+    /// </summary>
+    private void ReportEvaluationFailure(Symbol symbol, Exception ex)
+    {
+        Error($"STLN001A: Error evaluating {symbol}: {ex.Message}");
+        // Log error to audit trail
+        _auditLogger?.LogAsync(new Alaris.Infrastructure.Events.Core.AuditEntry
+        {
+            AuditId = Guid.NewGuid(),
+            OccurredAtUtc = DateTime.UtcNow,
+            Action = "EvaluationError",
+            EntityType = "Symbol",
+            EntityId = symbol.Value,
+            InitiatedBy = "STLN001A",
+            Description = $"Evaluation failed for {symbol}: {ex.Message}",
+            Severity = Alaris.Infrastructure.Events.Core.AuditSeverity.Error,
+            Outcome = Alaris.Infrastructure.Events.Core.AuditOutcome.Failure
+        });
+    }
+
+    /// <summary>
+    /// Evaluates a single symbol for trading opportunity (phase one).
+    /// Implements the Alaris strategy workflow up to, but not including, order submission.
     /// </summary>
     /// <param name="symbol">The symbol to evaluate.</param>
-    /// <returns>Evaluation result summary.</returns>
-    private EvaluationResult EvaluateSymbol(Symbol symbol)
+    /// <param name="evaluationDate">Algorithm time at the start of the daily evaluation.</param>
+    /// <param name="portfolioValue">Portfolio value at the start of the daily evaluation.</param>
+    /// <param name="useExecutionQuoteProvider">Whether to price the spread from the execution quote provider.</param>
+    /// <returns>Evaluation outcome, with its buffered log and any order to submit.</returns>
+    /// <remarks>
+    /// Runs concurrently with other symbols: it must not touch the portfolio, the active
+    /// position set, the algorithm log or the audit trail, and reports through the returned
+    /// evaluation instead.
+    /// </remarks>
+    private SymbolEvaluation EvaluateSymbol(
+        Symbol symbol,
+        DateTime evaluationDate,
+        decimal portfolioValue,
+        bool useExecutionQuoteProvider)
     {
-        var result = new EvaluationResult();
+        var evaluation = new SymbolEvaluation(symbol);
         var ticker = symbol.Value;
-        
-        Log($"STLN001A: Evaluating {ticker}...");
-
-        // Phase 1: Market Data Acquisition
 
-        MarketDataSnapshot snapshot;
         try
         {
-            using var cts = new CancellationTokenSource(_dataProviderSettings.MarketDataTimeout);
-            var evaluationDate = Time;
-            _marketDataAdapter?.SetEvaluationDate(evaluationDate);
-            snapshot = _marketDataAdapter!.GetSnapshot(ticker, evaluationDate, cts.Token);
-        }
-        catch (OperationCanceledException)
-        {
-            Log($"  {ticker}: Market data timeout");
-            return result;
-        }
-        catch (InvalidOperationException ex)
-        {
-            Log($"  {ticker}: Data quality validation failed - {ex.Message}");
-            return result;
-        }
+            evaluation.Log($"STLN001A: Evaluating {ticker}...");
 
-        if (_requireOptionChainCache && snapshot.OptionChain.Contracts.Count == 0)
-        {
-            Log($"  {ticker}: No cached options data available (backtest mode), skipping evaluation");
-            return result;
+            // Phase 1: Market Data Acquisition
+
+            MarketDataSnapshot snapshot;
+            try
+            {
+                using var cts = new CancellationTokenSource(_dataProviderSettings.MarketDataTimeout);
+                snapshot = _marketDataAdapter!.GetSnapshot(ticker, evaluationDate, cts.Token);
+            }
+            catch (OperationCanceledException)
+            {
+                evaluation.Log($"  {ticker}: Market data timeout");
+                return evaluation;
+            }
+            catch (InvalidOperationException ex)
+            {
+                evaluation.Log($"  {ticker}: Data quality validation failed - {ex.Message}");
+                return evaluation;
+            }
+
+            if (_requireOptionChainCache && snapshot.OptionChain.Contracts.Count == 0)
+            {
+                evaluation.Log($"  {ticker}: No cached options data available (backtest mode), skipping evaluation");
+                return evaluation;
+            }
+            
+            if (snapshot.NextEarnings == null)
+            {
+                evaluation.Log($"  {ticker}: No upcoming earnings found");
+                return evaluation;
+            }
+
+            EvaluateSnapshot(evaluation, snapshot, portfolioValue, useExecutionQuoteProvider);
         }
-        
-        if (snapshot.NextEarnings == null)
+        catch (Exception ex)
         {
-            Log($"  {ticker}: No upcoming earnings found");
-            return result;
+            evaluation.Failure = ex;
         }
 
-        return EvaluateSnapshot(symbol, snapshot, useExecutionQuoteProvider: LiveMode);
+        return evaluation;
     }
 
-    private EvaluationResult EvaluateSnapshot(Symbol symbol, MarketDataSnapshot snapshot, bool useExecutionQuoteProvider)
+    private void EvaluateSnapshot(
+        SymbolEvaluation evaluation,
+        MarketDataSnapshot snapshot,
+        decimal portfolioValue,
+        bool useExecutionQuoteProvider)
     {
-        var result = new EvaluationResult();
-        var ticker = symbol.Value;
+        var ticker = evaluation.Symbol.Value;
 
         // Phase 2: Realised Volatility Calculation
 
@@ -878,12 +950,12 @@ public sealed class STLN001A : QCAlgorithm
         var minimumBars = _strategySettings.RealisedVolatilityWindowDays + 1;
         if (priceBars.Count < minimumBars)
         {
-            Log($"  {ticker}: Insufficient price history ({priceBars.Count} bars, need {minimumBars}+)");
-            return result;
+            evaluation.Log($"  {ticker}: Insufficient price history ({priceBars.Count} bars, need {minimumBars}+)");
+            return;
         }
 
         var rv = _yangZhangEstimator!.Calculate(priceBars, _strategySettings.RealisedVolatilityWindowDays, true);
-        Log($"  {ticker}: {_strategySettings.RealisedVolatilityWindowDays}-day RV = {rv:P2}");
+        evaluation.Log($"  {ticker}: {_strategySettings.RealisedVolatilityWindowDays}-day RV = {rv:P2}");
 
         // Phase 3: Term Structure Analysis
 
@@ -891,11 +963,11 @@ public sealed class STLN001A : QCAlgorithm
         if (termPoints.Count >= 2)
         {
             var termStructure = _termStructureAnalyzer!.Analyze(termPoints);
-            Log($"  {ticker}: Term structure = {termStructure.GetIVAt(30):P2} / {termStructure.GetIVAt(60):P2} / {termStructure.GetIVAt(90):P2}");
+            evaluation.Log($"  {ticker}: Term structure = {termStructure.GetIVAt(30):P2} / {termStructure.GetIVAt(60):P2} / {termStructure.GetIVAt(90):P2}");
         }
         else
         {
-            Log($"  {ticker}: Insufficient term structure points for analysis");
+            evaluation.Log($"  {ticker}: Insufficient term structure points for analysis");
         }
 
         // Phase 4: Signal Generation
@@ -910,53 +982,52 @@ public sealed class STLN001A : QCAlgorithm
             snapshot.Timestamp,
             historicalEarningsDates);
 
-        Log($"  {ticker}: Signal = {signal.Strength} (IV/RV = {signal.IVRVRatio:F3})");
-        result.SignalGenerated = true;
+        evaluation.Log($"  {ticker}: Signal = {signal.Strength} (IV/RV = {signal.IVRVRatio:F3})");
+        evaluation.SignalGenerated = true;
 
         if (signal.Strength != STCR004AStrength.Recommended)
         {
-            Log($"  {ticker}: Signal not recommended, skipping");
-            return result;
+            evaluation.Log($"  {ticker}: Signal not recommended, skipping");
+            return;
         }
 
         if (!TrySelectCalendarSpread(snapshot, signal.EarningsDate, _strategySettings.OptionRight, out var selection, out var selectionDetail))
         {
-            Log($"  {ticker}: {selectionDetail}");
-            return result;
+            evaluation.Log($"  {ticker}: {selectionDetail}");
+            return;
         }
 
         PopulateSignalLegs(signal, selection);
 
         if (selection.BackLeg.Volume <= 0 || selection.BackLeg.OpenInterest <= 0)
         {
-            Log($"  {ticker}: Back leg liquidity unavailable (vol={selection.BackLeg.Volume}, OI={selection.BackLeg.OpenInterest})");
-            return result;
+            evaluation.Log($"  {ticker}: Back leg liquidity unavailable (vol={selection.BackLeg.Volume}, OI={selection.BackLeg.OpenInterest})");
+            return;
         }
 
         // Phase 5: Execution Pricing
 
-        DTmd002A? spreadQuote = GetSpreadQuote(selection, useExecutionQuoteProvider);
+        DTmd002A? spreadQuote = GetSpreadQuote(evaluation, selection, useExecutionQuoteProvider);
         if (spreadQuote == null)
         {
-            Log($"  {ticker}: No execution quote available");
-            return result;
+            evaluation.Log($"  {ticker}: No execution quote available");
+            return;
         }
         if (spreadQuote.SpreadAsk <= 0m || spreadQuote.SpreadAsk < spreadQuote.SpreadBid)
         {
-            Log($"  {ticker}: Invalid spread quote (bid/ask: ${spreadQuote.SpreadBid:F4}/${spreadQuote.SpreadAsk:F4})");
-            return result;
+            evaluation.Log($"  {ticker}: Invalid spread quote (bid/ask: ${spreadQuote.SpreadBid:F4}/${spreadQuote.SpreadAsk:F4})");
+            return;
         }
         if (spreadQuote.SpreadMid <= 0m)
         {
-            Log($"  {ticker}: Invalid spread mid price ({spreadQuote.SpreadMid:F4})");
-            return result;
+            evaluation.Log($"  {ticker}: Invalid spread mid price ({spreadQuote.SpreadMid:F4})");
+            return;
         }
 
-        Log($"  {ticker}: Spread quote = ${spreadQuote.SpreadMid:F2} (bid/ask: ${spreadQuote.SpreadBid:F2}/${spreadQuote.SpreadAsk:F2})");
+        evaluation.Log($"  {ticker}: Spread quote = ${spreadQuote.SpreadMid:F2} (bid/ask: ${spreadQuote.SpreadBid:F2}/${spreadQuote.SpreadAsk:F2})");
 
         // Phase 6: Position Sizing
 
-        var portfolioValue = Portfolio.TotalPortfolioValue;
         var spreadMid = spreadQuote.SpreadMid;
         var sizing = _positionSizer!.CalculateFromHistory(
             portfolioValue: (double)portfolioValue,
@@ -966,8 +1037,8 @@ public sealed class STLN001A : QCAlgorithm
 
         if (sizing.Contracts <= 0)
         {
-            Log($"  {ticker}: Position sizing returned 0 contracts");
-            return result;
+            evaluation.Log($"  {ticker}: Position sizing returned 0 contracts");
+            return;
         }
 
         var allocationPercent = sizing.AllocationPercent;
@@ -981,8 +1052,8 @@ public sealed class STLN001A : QCAlgorithm
 
         if (proposedContracts <= 0)
         {
-            Log($"  {ticker}: Position sizing reduced to 0 contracts by allocation limits");
-            return result;
+            evaluation.Log($"  {ticker}: Position sizing reduced to 0 contracts by allocation limits");
+            return;
         }
 
         // Phase 7: Production Validation
@@ -994,23 +1065,23 @@ public sealed class STLN001A : QCAlgorithm
         }
         catch (InvalidOperationException ex)
         {
-            Log($"  {ticker}: Production validation error - {ex.Message}");
-            return result;
+            evaluation.Log($"  {ticker}: Production validation error - {ex.Message}");
+            return;
         }
         catch (ArgumentException ex)
         {
-            Log($"  {ticker}: Production validation error - {ex.Message}");
-            return result;
+            evaluation.Log($"  {ticker}: Production validation error - {ex.Message}");
+            return;
         }
 
         if (!validation.ProductionReady)
         {
-            Log($"  {ticker}: Failed production validation");
+            evaluation.Log($"  {ticker}: Failed production validation");
             foreach (var check in validation.Checks.Where(c => !c.Passed))
             {
-                Log($"    - {check.Name}: {check.Detail}");
+                evaluation.Log($"    - {check.Name}: {check.Detail}");
             }
-            _auditLogger?.LogAsync(new Alaris.Infrastructure.Events.Core.AuditEntry
+            evaluation.Audit(new Alaris.Infrastructure.Events.Core.AuditEntry
             {
                 AuditId = Guid.NewGuid(),
                 OccurredAtUtc = DateTime.UtcNow,
@@ -1022,14 +1093,14 @@ public sealed class STLN001A : QCAlgorithm
                 Severity = Alaris.Infrastructure.Events.Core.AuditSeverity.Warning,
                 Outcome = Alaris.Infrastructure.Events.Core.AuditOutcome.Failure
             });
-            return result;
+            return;
         }
 
         var finalContracts = Math.Min(proposedContracts, validation.RecommendedContracts);
         if (finalContracts <= 0)
         {
-            Log($"  {ticker}: Position sizing reduced to 0 contracts by validation limits");
-            return result;
+            evaluation.Log($"  {ticker}: Position sizing reduced to 0 contracts by validation limits");
+            return;
         }
 
         var effectiveAllocationPercent = allocationPercent;
@@ -1038,51 +1109,77 @@ public sealed class STLN001A : QCAlgorithm
             effectiveAllocationPercent = allocationPercent * ((double)finalContracts / proposedContracts);
         }
 
-        Log($"  {ticker}: Position size = {finalContracts} contracts ({effectiveAllocationPercent:P2} of portfolio)");
-        Log($"  {ticker}: Passed all production validation checks");
+        evaluation.Log($"  {ticker}: Position size = {finalContracts} contracts ({effectiveAllocationPercent:P2} of portfolio)");
+        evaluation.Log($"  {ticker}: Passed all production validation checks");
+
+        evaluation.Order = new PendingOrder(selection, spreadQuote, finalContracts);
+    }
+
+    /// <summary>
+    /// Submits a validated calendar spread (phase two), subject to the portfolio limits.
+    /// </summary>
+    /// <param name="symbol">The underlying symbol.</param>
+    /// <param name="order">The order produced by <see cref="EvaluateSymbol"/>.</param>
+    /// <returns>True if the order was submitted.</returns>
+    private bool SubmitOrder(Symbol symbol, PendingOrder order)
+    {
+        var ticker = symbol.Value;
+
+        // Limits reflect every order placed earlier in this evaluation
+        if (_activePositions.Count >= _strategySettings.MaxConcurrentPositions)
+        {
+            Log($"  {ticker}: Maximum concurrent positions reached, order not submitted");
+            return false;
+        }
+
+        if (GetCurrentAllocation() >= _strategySettings.PortfolioAllocationLimit)
+        {
+            Log($"  {ticker}: Portfolio allocation limit reached, order not submitted");
+            return false;
+        }
 
         // Phase 8: Order Execution
 
+        var selection = order.Selection;
+        var spreadQuote = order.Quote;
+        var finalContracts = order.Contracts;
         var orderResult = ExecuteCalendarSpread(
             symbol,
             selection,
             spreadQuote,
             finalContracts);
 
-        if (orderResult.Success)
+        if (!orderResult.Success)
         {
-            result.OrderSubmitted = true;
-            _activePositions.Add(symbol);
-            _positionEntryDates[symbol] = Time;
+            Log($"  {ticker}: Order submission failed - {orderResult.Message}");
+            return false;
+        }
 
-            _auditLogger?.LogAsync(new Alaris.Infrastructure.Events.Core.AuditEntry
-            {
-                AuditId = Guid.NewGuid(),
-                OccurredAtUtc = DateTime.UtcNow,
-                Action = "TradeOpened",
-                EntityType = "CalendarSpread",
-                EntityId = ticker,
-                InitiatedBy = "STLN001A",
-                Description = $"Opened calendar spread: {finalContracts} contracts @ ${spreadQuote.SpreadMid:F2}",
-                Severity = Alaris.Infrastructure.Events.Core.AuditSeverity.Information,
-                Outcome = Alaris.Infrastructure.Events.Core.AuditOutcome.Success,
-                AdditionalData = new Dictionary<string, string>
-                {
-                    ["Contracts"] = finalContracts.ToString(),
-                    ["Price"] = spreadQuote.SpreadMid.ToString(),
-                    ["FrontExpiry"] = selection.FrontExpiry.ToString("O"),
-                    ["BackExpiry"] = selection.BackExpiry.ToString("O")
-                }
-            });
+        _activePositions.Add(symbol);
+        _positionEntryDates[symbol] = Time;
 
-            Log($"  {ticker}: Order submitted successfully");
-        }
-        else
+        _auditLogger?.LogAsync(new Alaris.Infrastructure.Events.Core.AuditEntry
         {
-            Log($"  {ticker}: Order submission failed - {orderResult.Message}");
-        }
+            AuditId = Guid.NewGuid(),
+            OccurredAtUtc = DateTime.UtcNow,
+            Action = "TradeOpened",
+            EntityType = "CalendarSpread",
+            EntityId = ticker,
+            InitiatedBy = "STLN001A",
+            Description = $"Opened calendar spread: {finalContracts} contracts @ ${spreadQuote.SpreadMid:F2}",
+            Severity = Alaris.Infrastructure.Events.Core.AuditSeverity.Information,
+            Outcome = Alaris.Infrastructure.Events.Core.AuditOutcome.Success,
+            AdditionalData = new Dictionary<string, string>
+            {
+                ["Contracts"] = finalContracts.ToString(),
+                ["Price"] = spreadQuote.SpreadMid.ToString(),
+                ["FrontExpiry"] = selection.FrontExpiry.ToString("O"),
+                ["BackExpiry"] = selection.BackExpiry.ToString("O")
+            }
+        });
 
-        return result;
+        Log($"  {ticker}: Order submitted successfully");
+        return true;
     }
 
     // Helper Methods
@@ -1311,7 +1408,10 @@ public sealed class STLN001A : QCAlgorithm
         signal.UsingSyntheticIV = selection.UsesSyntheticIv;
     }
 
-    private DTmd002A? GetSpreadQuote(CalendarSpreadSelection selection, bool useExecutionQuoteProvider)
+    private DTmd002A? GetSpreadQuote(
+        SymbolEvaluation evaluation,
+        CalendarSpreadSelection selection,
+        bool useExecutionQuoteProvider)
     {
         if (useExecutionQuoteProvider)
         {
@@ -1334,7 +1434,7 @@ public sealed class STLN001A : QCAlgorithm
             }
             catch (Exception ex)
             {
-                Log($"  {selection.Symbol}: Execution quote provider failed - {ex.Message}");
+                evaluation.Log($"  {selection.Symbol}: Execution quote provider failed - {ex.Message}");
             }
         }
 
@@ -1364,65 +1464,64 @@ public sealed class STLN001A : QCAlgorithm
         };
     }
 
+    /// <summary>
+    /// Builds the paired front/back implied-volatility history of a spread, oldest first.
+    /// </summary>
+    /// <remarks>
+    /// Reads each leg with one range query on the bridge's session volatility history; only
+    /// look-back days the history does not hold yet are loaded, as bare option chains. Days
+    /// are paired newest first until enough observations are found, and volatilities solved
+    /// from mid prices are written back so later candidates reuse them.
+    /// </remarks>
     private (IReadOnlyList<double> FrontIVHistory, IReadOnlyList<double> BackIVHistory) BuildIvHistory(
         CalendarSpreadSelection selection,
         MarketDataSnapshot snapshot)
     {
         var requiredLevels = _validationSettings.MinimumVegaObservations + 1;
         var lookbackDays = _validationSettings.VegaCorrelationLookbackDays;
+        var to = snapshot.Timestamp.Date;
+        var from = to.AddDays(-lookbackDays);
+
+        _dataBridge!.LoadImpliedVolatilityHistoryAsync(selection.Symbol, from, to)
+            .GetAwaiter().GetResult();
+
+        var history = _dataBridge.ImpliedVolatilityHistory;
+        var frontKey = new IvSeriesKey(selection.Symbol, selection.FrontExpiry.Date, selection.Strike, selection.Right);
+        var backKey = new IvSeriesKey(selection.Symbol, selection.BackExpiry.Date, selection.Strike, selection.Right);
+        var frontObservations = new List<IvObservation>();
+        var backObservations = new List<IvObservation>();
+        history.GetRange(frontKey, from, to, frontObservations);
+        history.GetRange(backKey, from, to, backObservations);
 
         var frontLevels = new List<double>(requiredLevels);
         var backLevels = new List<double>(requiredLevels);
 
-        for (int offset = 0; offset <= lookbackDays && frontLevels.Count < requiredLevels; offset++)
+        // Walk both date-sorted series from the newest day, pairing equal dates
+        int f = frontObservations.Count - 1;
+        int b = backObservations.Count - 1;
+        while (f >= 0 && b >= 0 && frontLevels.Count < requiredLevels)
         {
-            var date = snapshot.Timestamp.Date.AddDays(-offset);
-
-            MarketDataSnapshot dailySnapshot;
-            try
+            var frontObservation = frontObservations[f];
+            var backObservation = backObservations[b];
+            if (frontObservation.Date > backObservation.Date)
             {
-                dailySnapshot = _dataBridge!.GetMarketDataSnapshotAsync(selection.Symbol, date)
-                    .GetAwaiter().GetResult();
+                f--;
+                continue;
             }
-            catch
+            if (backObservation.Date > frontObservation.Date)
             {
+                b--;
                 continue;
             }
 
-            var chain = dailySnapshot.OptionChain;
-            if (chain.Contracts.Count == 0)
-                continue;
+            f--;
+            b--;
 
-            if (!TryGetContractForStrike(chain, selection.FrontExpiry, selection.Strike, selection.Right, out var front))
+            if (!history.TryGetDay(selection.Symbol, frontObservation.Date, out var day) || day.SpotPrice <= 0m)
                 continue;
-            if (!TryGetContractForStrike(chain, selection.BackExpiry, selection.Strike, selection.Right, out var back))
+            if (!TryResolveObservedVolatility(history, frontKey, frontObservation, day, out var frontIv))
                 continue;
-
-            var spotPrice = Convert.ToDouble(chain.SpotPrice);
-            if (spotPrice <= 0)
-                continue;
-
-            var riskFreeRate = Convert.ToDouble(dailySnapshot.RiskFreeRate);
-            var dividendYield = Convert.ToDouble(dailySnapshot.DividendYield);
-            if (!TryResolveImpliedVolatility(
-                front,
-                spotPrice,
-                riskFreeRate,
-                dividendYield,
-                dailySnapshot.Timestamp,
-                selection.Right,
-                out var frontIv,
-                out _))
-                continue;
-            if (!TryResolveImpliedVolatility(
-                back,
-                spotPrice,
-                riskFreeRate,
-                dividendYield,
-                dailySnapshot.Timestamp,
-                selection.Right,
-                out var backIv,
-                out _))
+            if (!TryResolveObservedVolatility(history, backKey, backObservation, day, out var backIv))
                 continue;
 
             frontLevels.Add(frontIv);
@@ -1435,6 +1534,41 @@ public sealed class STLN001A : QCAlgorithm
         return (frontLevels, backLevels);
     }
 
+    /// <summary>
+    /// Resolves the implied volatility of a history observation, solving it from the mid
+    /// price at most once per session.
+    /// </summary>
+    private bool TryResolveObservedVolatility(
+        DTiv001A history,
+        IvSeriesKey key,
+        IvObservation observation,
+        IvDayContext day,
+        out double impliedVolatility)
+    {
+        if (!observation.IsResolved)
+        {
+            if (!TrySolveImpliedVolatility(
+                observation.Mid,
+                key.Strike,
+                key.Expiry,
+                Convert.ToDouble(day.SpotPrice),
+                Convert.ToDouble(day.RiskFreeRate),
+                Convert.ToDouble(day.DividendYield),
+                observation.Date,
+                key.Right,
+                out var solved))
+            {
+                solved = double.NaN;
+            }
+
+            history.SetImpliedVolatility(key, observation.Date, solved);
+            observation = observation with { ImpliedVolatility = solved, IsResolved = true };
+        }
+
+        impliedVolatility = observation.ImpliedVolatility;
+        return impliedVolatility > 0;
+    }
+
     private static STCS002A BuildOptionParams(
         OptionContract contract,
         Alaris.Strategy.Cost.OrderDirection direction,
@@ -1516,84 +1650,80 @@ public sealed class STLN001A : QCAlgorithm
             return true;
         }
 
-        if (contract.Mid <= 0m)
+        usedSynthetic = TrySolveImpliedVolatility(
+            contract.Mid,
+            contract.Strike,
+            contract.Expiration,
+            spotPrice,
+            riskFreeRate,
+            dividendYield,
+            valuationDate,
+            right,
+            out impliedVolatility);
+        return usedSynthetic;
+    }
+
+    /// <summary>
+    /// Solves the implied volatility of an option from its mid price.
+    /// </summary>
+    private bool TrySolveImpliedVolatility(
+        decimal midPrice,
+        decimal strike,
+        DateTime expiration,
+        double spotPrice,
+        double riskFreeRate,
+        double dividendYield,
+        DateTime valuationDate,
+        AlarisOptionRight right,
+        out double impliedVolatility)
+    {
+        if (midPrice <= 0m)
         {
             impliedVolatility = 0;
-            usedSynthetic = false;
             return false;
         }
 
         try
         {
             var valuation = CRTM005A.FromDateTime(valuationDate);
-            var expiry = CRTM005A.FromDateTime(contract.Expiration);
+            var expiry = CRTM005A.FromDateTime(expiration);
             if (expiry.SerialNumber <= valuation.SerialNumber)
             {
                 impliedVolatility = 0;
-                usedSynthetic = false;
                 return false;
             }
 
             var parameters = new Alaris.Strategy.Model.STDT003A
             {
                 UnderlyingPrice = spotPrice,
-                Strike = Convert.ToDouble(contract.Strike),
-                Expiry = CRTM005A.FromDateTime(contract.Expiration),
+                Strike = Convert.ToDouble(strike),
+                Expiry = expiry,
                 ImpliedVolatility = 0,
                 RiskFreeRate = riskFreeRate,
                 DividendYield = dividendYield,
                 OptionType = ToOptionType(right),
-                ValuationDate = CRTM005A.FromDateTime(valuationDate)
+                ValuationDate = valuation
             };
 
-            impliedVolatility = _pricingEngine!.CalculateImpliedVolatility((double)contract.Mid, parameters)
+            impliedVolatility = _pricingEngine!.CalculateImpliedVolatility((double)midPrice, parameters)
                 .GetAwaiter()
                 .GetResult();
-            usedSynthetic = true;
         }
         catch
         {
             impliedVolatility = 0;
-            usedSynthetic = false;
             return false;
         }
 
         if (double.IsNaN(impliedVolatility) || impliedVolatility <= 0)
         {
             impliedVolatility = 0;
-            usedSynthetic = false;
             return false;
         }
 
         return true;
     }
 
-    private static bool TryGetContractForStrike(
-        OptionChainSnapshot chain,
-        DateTime expiry,
-        decimal strike,
-        AlarisOptionRight right,
-        out OptionContract contract)
-    {
-        const decimal strikeTolerance = 0.0001m;
-
-        foreach (var candidate in chain.Contracts)
-        {
-            if (candidate.Right != right)
-                continue;
-            if (candidate.Expiration.Date != expiry.Date)
-                continue;
-            if (Math.Abs(candidate.Strike - strike) > strikeTolerance)
-                continue;
-
-            contract = candidate;
-            return true;
-        }
-
-        contract = null!;
-        return false;
-    }
-
     private static bool IsQuoteValid(OptionContract contract)
     {
         return contract.Bid > 0m && contract.Ask > 0m && contract.Ask >= contract.Bid;
@@ -1824,13 +1954,43 @@ public sealed class STLN001A : QCAlgorithm
         double FrontIV,
         double BackIV);
 
-    /// <summary>Result of symbol evaluation.</summary>
-    private sealed class EvaluationResult
+    /// <summary>Result of evaluating one symbol in the concurrent phase.</summary>
+    private sealed class SymbolEvaluation
     {
+        private readonly List<string> _messages = new();
+        private readonly List<Alaris.Infrastructure.Events.Core.AuditEntry> _auditEntries = new();
+
+        public SymbolEvaluation(Symbol symbol)
+        {
+            Symbol = symbol;
+        }
+
+        public Symbol Symbol { get; }
         public bool SignalGenerated { get; set; }
-        public bool OrderSubmitted { get; set; }
+
+        /// <summary>Order to submit in the serial phase, if the symbol passed validation.</summary>
+        public PendingOrder? Order { get; set; }
+
+        /// <summary>Unexpected exception that ended the evaluation, if any.</summary>
+        public Exception? Failure { get; set; }
+
+        /// <summary>Log lines, replayed in symbol order once every evaluation has finished.</summary>
+        public IReadOnlyList<string> Messages => _messages;
+
+        /// <summary>Audit entries, written in symbol order with the log.</summary>
+        public IReadOnlyList<Alaris.Infrastructure.Events.Core.AuditEntry> AuditEntries => _auditEntries;
+
+        public void Log(string message) => _messages.Add(message);
+
+        public void Audit(Alaris.Infrastructure.Events.Core.AuditEntry entry) => _auditEntries.Add(entry);
     }
 
+    /// <summary>Validated calendar spread awaiting the portfolio limits.</summary>
+    private sealed record PendingOrder(
+        CalendarSpreadSelection Selection,
+        DTmd002A Quote,
+        int Contracts);
+
     /// <summary>Result of order execution attempt.</summary>
     private sealed class OrderExecutionResult
     {
@@ -1856,10 +2016,11 @@ public sealed class STLN001A : QCAlgorithm
         double MinIvRvRatio,
         double MaxTermSlope,
         long MinimumAverageVolume,
-        double DefaultImpliedVolatility)
+        double DefaultImpliedVolatility,
+        int EvaluationParallelism)
     {
         public static StrategySettings Empty => new(
-            0, 0, 0m, 0m, 0m, 0m, 0, 0, 0, 0, 0, AlarisOptionRight.Call, 0, 0.0, 0.0, 0, 0.0);
+            0, 0, 0m, 0m, 0m, 0m, 0, 0, 0, 0, 0, AlarisOptionRight.Call, 0, 0.0, 0.0, 0, 0.0, 0);
 
         public void Validate()
         {
@@ -1899,6 +2060,8 @@ public sealed class STLN001A : QCAlgorithm
                 throw new InvalidOperationException("MinimumAverageVolume must be positive.");
             if (DefaultImpliedVolatility <= 0)
                 throw new InvalidOperationException("DefaultImpliedVolatility must be positive.");
+            if (EvaluationParallelism <= 0)
+                throw new InvalidOperationException("EvaluationParallelism must be positive.");
         }
     }
 
@@ -2220,9 +2383,6 @@ internal sealed class DataBridgeMarketDataAdapter : STDT001A
 {
     private readonly AlarisDataBridge _bridge;
     private DateTime _evaluationDate = DateTime.UtcNow;
-    private string? _cachedSymbol;
-    private DateTime _cachedEvaluationDate;
-    private MarketDataSnapshot? _cachedSnapshot;
 
     public DataBridgeMarketDataAdapter(AlarisDataBridge bridge)
     {
@@ -2232,16 +2392,13 @@ internal sealed class DataBridgeMarketDataAdapter : STDT001A
     /// <summary>
     /// Sets the evaluation date for market data queries (use LEAN's Time for backtests).
     /// </summary>
+    /// <remarks>
+    /// Snapshots cached by the bridge for any other date are dropped.
+    /// </remarks>
     public void SetEvaluationDate(DateTime date)
     {
-        if (_evaluationDate == date)
-        {
-            return;
-        }
-
         _evaluationDate = date;
-        _cachedSnapshot = null;
-        _cachedSymbol = null;
+        _bridge.SnapshotCache.Invalidate(key => key.EvaluationDate != date);
     }
 
     public MarketDataSnapshot GetSnapshot(string symbol, DateTime evaluationDate, CancellationToken cancellationToken)
@@ -2376,19 +2533,9 @@ internal sealed class DataBridgeMarketDataAdapter : STDT001A
     private MarketDataSnapshot GetSnapshotInternal(string symbol, DateTime evaluationDate, CancellationToken cancellationToken)
     {
         _evaluationDate = evaluationDate;
-        if (_cachedSnapshot != null && _cachedSymbol == symbol && _cachedEvaluationDate == evaluationDate)
-        {
-            return _cachedSnapshot;
-        }
-
-        var snapshot = _bridge.GetMarketDataSnapshotAsync(symbol, evaluationDate, cancellationToken)
+        return _bridge.GetMarketDataSnapshotAsync(symbol, evaluationDate, cancellationToken)
             .GetAwaiter()
             .GetResult();
-
-        _cachedSnapshot = snapshot;
-        _cachedSymbol = symbol;
-        _cachedEvaluationDate = evaluationDate;
-        return snapshot;
     }
 
     private async Task<MarketDataSnapshot> GetSnapshotInternalAsync(
@@ -2397,17 +2544,7 @@ internal sealed class DataBridgeMarketDataAdapter : STDT001A
         CancellationToken cancellationToken)
     {
         _evaluationDate = evaluationDate;
-        if (_cachedSnapshot != null && _cachedSymbol == symbol && _cachedEvaluationDate == evaluationDate)
-        {
-            return _cachedSnapshot;
-        }
-
-        var snapshot = await _bridge.GetMarketDataSnapshotAsync(symbol, evaluationDate, cancellationToken)
+        return await _bridge.GetMarketDataSnapshotAsync(symbol, evaluationDate, cancellationToken)
             .ConfigureAwait(false);
-
-        _cachedSnapshot = snapshot;
-        _cachedSymbol = symbol;
-        _cachedEvaluationDate = evaluationDate;
-        return snapshot;
     }
 }
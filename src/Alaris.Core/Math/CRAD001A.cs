@@ -0,0 +1,188 @@
+// CRAD001A.cs - Forward-mode dual numbers for option sensitivities
+// Component ID: CRAD001A
+//
+// A value carried together with its tangents along volatility, time to expiry
+// and rate, so a single evaluation yields ∂/∂σ, ∂/∂τ and ∂/∂r alongside the value.
+//
+// References:
+// - Griewank & Walther (2008) "Evaluating Derivatives", Ch. 3 (tangent mode)
+
+using System.Runtime.CompilerServices;
+
+namespace Alaris.Core.Math;
+
+/// <summary>
+/// Dual number with three tangent directions (σ, τ, r).
+/// </summary>
+/// <remarks>
+/// The value part of every operation is computed with exactly the same floating-point
+/// operation as the scalar expression it replaces, so a dual evaluation reproduces the
+/// scalar result bit for bit while propagating first derivatives.
+/// </remarks>
+internal readonly struct CRAD001A
+{
+    public CRAD001A(double value, double dSigma, double dTau, double dRate)
+    {
+        Value = value;
+        DSigma = dSigma;
+        DTau = dTau;
+        DRate = dRate;
+    }
+
+    /// <summary>Primal value.</summary>
+    public double Value { get; }
+
+    /// <summary>Tangent with respect to volatility.</summary>
+    public double DSigma { get; }
+
+    /// <summary>Tangent with respect to time to expiry.</summary>
+    public double DTau { get; }
+
+    /// <summary>Tangent with respect to the risk-free rate.</summary>
+    public double DRate { get; }
+
+    /// <summary>Creates a constant (all tangents zero).</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A Constant(double value)
+    {
+        return new CRAD001A(value, 0.0, 0.0, 0.0);
+    }
+
+    /// <summary>
+    /// Creates a time point t = u·τ, whose τ-tangent is t/τ.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A TimePoint(double t, double tau)
+    {
+        return new CRAD001A(t, 0.0, t / tau, 0.0);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator +(CRAD001A a, CRAD001A b)
+    {
+        return new CRAD001A(a.Value + b.Value, a.DSigma + b.DSigma, a.DTau + b.DTau, a.DRate + b.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator +(CRAD001A a, double b)
+    {
+        return new CRAD001A(a.Value + b, a.DSigma, a.DTau, a.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator +(double a, CRAD001A b)
+    {
+        return new CRAD001A(a + b.Value, b.DSigma, b.DTau, b.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator -(CRAD001A a, CRAD001A b)
+    {
+        return new CRAD001A(a.Value - b.Value, a.DSigma - b.DSigma, a.DTau - b.DTau, a.DRate - b.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator -(CRAD001A a, double b)
+    {
+        return new CRAD001A(a.Value - b, a.DSigma, a.DTau, a.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator -(double a, CRAD001A b)
+    {
+        return new CRAD001A(a - b.Value, -b.DSigma, -b.DTau, -b.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator -(CRAD001A a)
+    {
+        return new CRAD001A(-a.Value, -a.DSigma, -a.DTau, -a.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator *(CRAD001A a, CRAD001A b)
+    {
+        return new CRAD001A(
+            a.Value * b.Value,
+            (a.DSigma * b.Value) + (a.Value * b.DSigma),
+            (a.DTau * b.Value) + (a.Value * b.DTau),
+            (a.DRate * b.Value) + (a.Value * b.DRate));
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator *(CRAD001A a, double b)
+    {
+        return new CRAD001A(a.Value * b, a.DSigma * b, a.DTau * b, a.DRate * b);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator *(double a, CRAD001A b)
+    {
+        return new CRAD001A(a * b.Value, a * b.DSigma, a * b.DTau, a * b.DRate);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator /(CRAD001A a, CRAD001A b)
+    {
+        double value = a.Value / b.Value;
+        double inverse = 1.0 / b.Value;
+        return new CRAD001A(
+            value,
+            (a.DSigma - (value * b.DSigma)) * inverse,
+            (a.DTau - (value * b.DTau)) * inverse,
+            (a.DRate - (value * b.DRate)) * inverse);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator /(CRAD001A a, double b)
+    {
+        return new CRAD001A(a.Value / b, a.DSigma / b, a.DTau / b, a.DRate / b);
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A operator /(double a, CRAD001A b)
+    {
+        double value = a / b.Value;
+        double scale = -value / b.Value;
+        return new CRAD001A(value, scale * b.DSigma, scale * b.DTau, scale * b.DRate);
+    }
+
+    /// <summary>Natural logarithm.</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A Log(CRAD001A x)
+    {
+        return x.Chain(System.Math.Log(x.Value), 1.0 / x.Value);
+    }
+
+    /// <summary>Exponential.</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A Exp(CRAD001A x)
+    {
+        double value = System.Math.Exp(x.Value);
+        return x.Chain(value, value);
+    }
+
+    /// <summary>Square root.</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A Sqrt(CRAD001A x)
+    {
+        double value = System.Math.Sqrt(x.Value);
+        return x.Chain(value, 0.5 / value);
+    }
+
+    /// <summary>Standard normal CDF Φ(x), with derivative φ(x).</summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static CRAD001A NormalCDF(CRAD001A x)
+    {
+        return x.Chain(CRMF001A.NormalCDF(x.Value), CRMF001A.NormalPDF(x.Value));
+    }
+
+    /// <summary>
+    /// Applies the chain rule: returns f(x) with tangents scaled by f'(x).
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public CRAD001A Chain(double value, double derivative)
+    {
+        return new CRAD001A(value, derivative * DSigma, derivative * DTau, derivative * DRate);
+    }
+}
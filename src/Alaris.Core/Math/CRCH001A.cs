@@ -3,13 +3,17 @@
 //
 // Provides Chebyshev nodes, barycentric interpolation, and polynomial evaluation
 // for spectral collocation methods in American option pricing.
+// Nodes and weights up to order 64 are read from the generated CRCH002A tables.
 //
 // References:
 // - Berrut & Trefethen (2004) "Barycentric Lagrange Interpolation"
+// - Makhoul (1980) "A Fast Cosine Transform in One and Two Dimensions"
 // - Andersen, Lake & Offengenden (2016) "High Performance American Option Pricing"
 
 using System;
 using System.Runtime.CompilerServices;
+using System.Runtime.Intrinsics;
+using Alaris.Core.Vectorized;
 
 namespace Alaris.Core.Math;
 
@@ -20,6 +24,18 @@ public static class CRCH001A
 {
     private const double NodeMatchTolerance = 1e-14;
 
+    // Points per Vector256 lane group in the batched Clenshaw evaluation
+    private const int LaneCount = 4;
+
+    // Twiddle table resolution: FFTs up to 128 points and DCT-II phases up to n = 64
+    private const int FftTableSize = 256;
+
+    // Largest direct-transform size whose cosine quarter wave is kept on the stack
+    private const int MaxStackQuarterWave = 256;
+
+    private static readonly double[] FftCos = CreateFftTable(System.Math.Cos);
+    private static readonly double[] FftSin = CreateFftTable(System.Math.Sin);
+
     /// <summary>
     /// Generates Chebyshev nodes of the first kind on interval [a, b].
     /// </summary>
@@ -44,6 +60,17 @@ public static class CRCH001A
         double mid = (a + b) / 2.0;
         double halfWidth = (b - a) / 2.0;
 
+        if (n <= CRCH002A.MaxOrder)
+        {
+            ReadOnlySpan<double> cosines = ChebyshevCosines(n);
+            for (int k = 0; k < n; k++)
+            {
+                nodes[k] = mid + (halfWidth * cosines[k]);
+            }
+
+            return nodes;
+        }
+
         for (int k = 0; k < n; k++)
         {
             double theta = (2.0 * k + 1.0) * System.Math.PI / (2.0 * n);
@@ -56,6 +83,18 @@ public static class CRCH001A
         return nodes;
     }
 
+    /// <summary>
+    /// Chebyshev nodes of the first kind on [-1, 1] in ascending order, without copying.
+    /// </summary>
+    /// <param name="n">Number of nodes (1 to 64).</param>
+    /// <returns>cos((2k+1)π/(2n)) for k = n-1, ..., 0.</returns>
+    public static ReadOnlySpan<double> ChebyshevCosines(int n)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(n, 1);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(n, CRCH002A.MaxOrder);
+        return CRCH002A.NodeCosines.Slice(CRCH002A.Offset(n), n);
+    }
+
     /// <summary>
     /// Generates Chebyshev-Lobatto nodes (extrema of T_n) including endpoints.
     /// </summary>
@@ -80,6 +119,17 @@ public static class CRCH001A
         double mid = (a + b) / 2.0;
         double halfWidth = (b - a) / 2.0;
 
+        if (n <= CRCH002A.MaxOrder)
+        {
+            ReadOnlySpan<double> cosines = ChebyshevLobattoCosines(n);
+            for (int k = 0; k < n; k++)
+            {
+                nodes[k] = mid + (halfWidth * cosines[k]);
+            }
+
+            return nodes;
+        }
+
         for (int k = 0; k < n; k++)
         {
             double theta = k * System.Math.PI / (n - 1);
@@ -92,6 +142,18 @@ public static class CRCH001A
         return nodes;
     }
 
+    /// <summary>
+    /// Chebyshev-Lobatto nodes on [-1, 1] in ascending order, without copying.
+    /// </summary>
+    /// <param name="n">Number of nodes (2 to 64).</param>
+    /// <returns>cos(kπ/(n-1)) for k = n-1, ..., 0.</returns>
+    public static ReadOnlySpan<double> ChebyshevLobattoCosines(int n)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(n, 2);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(n, CRCH002A.MaxOrder);
+        return CRCH002A.LobattoCosines.Slice(CRCH002A.LobattoOffset(n), n);
+    }
+
     /// <summary>
     /// Evaluates the Chebyshev polynomial T_n(x) using the recurrence relation.
     /// </summary>
@@ -142,6 +204,11 @@ public static class CRCH001A
     {
         ArgumentOutOfRangeException.ThrowIfLessThan(n, 1);
 
+        if (n <= CRCH002A.MaxOrder)
+        {
+            return ChebyshevBarycentricWeights(n).ToArray();
+        }
+
         double[] weights = new double[n];
 
         for (int k = 0; k < n; k++)
@@ -157,6 +224,18 @@ public static class CRCH001A
         return weights;
     }
 
+    /// <summary>
+    /// Barycentric weights for first-kind Chebyshev nodes, as <see cref="BarycentricWeights"/>
+    /// returns them, without copying.
+    /// </summary>
+    /// <param name="n">Number of nodes (1 to 64).</param>
+    public static ReadOnlySpan<double> ChebyshevBarycentricWeights(int n)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(n, 1);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(n, CRCH002A.MaxOrder);
+        return CRCH002A.BarycentricWeights.Slice(CRCH002A.Offset(n), n);
+    }
+
     /// <summary>
     /// Computes barycentric weights for Chebyshev-Lobatto nodes.
     /// </summary>
@@ -199,6 +278,20 @@ public static class CRCH001A
         ArgumentNullException.ThrowIfNull(values);
         ArgumentNullException.ThrowIfNull(weights);
 
+        return Interpolate(nodes.AsSpan(), values.AsSpan(), weights.AsSpan(), x);
+    }
+
+    /// <summary>
+    /// Interpolates a function at an arbitrary point using barycentric formula (span overload).
+    /// </summary>
+    /// <param name="nodes">Interpolation nodes (in ascending order).</param>
+    /// <param name="values">Function values at nodes.</param>
+    /// <param name="weights">Barycentric weights.</param>
+    /// <param name="x">Evaluation point.</param>
+    /// <returns>Interpolated value at x.</returns>
+    public static double Interpolate(
+        ReadOnlySpan<double> nodes, ReadOnlySpan<double> values, ReadOnlySpan<double> weights, double x)
+    {
         int n = nodes.Length;
         if (n == 0)
         {
@@ -238,6 +331,12 @@ public static class CRCH001A
     public static double Interpolate(double[] nodes, double[] values, double x)
     {
         ArgumentNullException.ThrowIfNull(nodes);
+        ArgumentNullException.ThrowIfNull(values);
+        if (nodes.Length >= 1 && nodes.Length <= CRCH002A.MaxOrder)
+        {
+            return Interpolate(nodes.AsSpan(), values.AsSpan(), ChebyshevBarycentricWeights(nodes.Length), x);
+        }
+
         double[] weights = BarycentricWeights(nodes.Length);
         return Interpolate(nodes, values, weights, x);
     }
@@ -332,33 +431,155 @@ public static class CRCH001A
     public static double[] ValuesToCoefficients(double[] values)
     {
         ArgumentNullException.ThrowIfNull(values);
+        double[] coeffs = new double[values.Length];
+        ValuesToCoefficients(values, coeffs);
+        return coeffs;
+    }
+
+    /// <summary>
+    /// Computes Chebyshev coefficients from function values at Lobatto nodes (span overload).
+    /// </summary>
+    /// <param name="values">Function values at the Lobatto nodes cos(jπ/(n-1)), j = 0..n-1.</param>
+    /// <param name="coefficients">Receives n coefficients with half-weighted endpoints.</param>
+    /// <remarks>
+    /// The DCT-I runs as a radix-2 FFT of the even extension when 2(n-1) is a power of two
+    /// up to 128, in O(n log n); other sizes sum directly over cosines read from one
+    /// quarter wave, in O(n²) with n trigonometric calls.
+    /// </remarks>
+    public static void ValuesToCoefficients(ReadOnlySpan<double> values, Span<double> coefficients)
+    {
         int n = values.Length;
         if (n == 0)
         {
             throw new ArgumentException("Values must not be empty.", nameof(values));
         }
 
+        if (coefficients.Length < n)
+        {
+            throw new ArgumentException("Coefficient span must hold one coefficient per value.", nameof(coefficients));
+        }
+
         if (n == 1)
         {
-            return new[] { values[0] };
+            coefficients[0] = values[0];
+            return;
         }
 
-        double[] coeffs = new double[n];
+        int m = n - 1;
+        double scale = 2.0 / m;
+        int length = 2 * m;
+
+        if (length <= FftTableSize / 2 && IsPowerOfTwo(length))
+        {
+            // Even extension y_j = y_(2m-j) makes the FFT real: Y_k = 2·Σ' y_j cos(πjk/m)
+            Span<double> re = stackalloc double[length];
+            Span<double> im = stackalloc double[length];
+            for (int j = 0; j <= m; j++)
+            {
+                re[j] = values[j];
+            }
+
+            for (int j = 1; j < m; j++)
+            {
+                re[length - j] = values[j];
+            }
 
+            im.Clear();
+            Fft(re, im);
+
+            for (int k = 0; k < n; k++)
+            {
+                coefficients[k] = 0.5 * scale * re[k];
+            }
+
+            return;
+        }
+
+        // cos(πjk/m) = cos(π·2jk/(2m)), read from one quarter wave
+        Span<double> quarter = m < MaxStackQuarterWave ? stackalloc double[m + 1] : new double[m + 1];
+        FillQuarterWave(quarter);
         for (int k = 0; k < n; k++)
         {
             double sum = 0.0;
             for (int j = 0; j < n; j++)
             {
-                double theta = j * System.Math.PI / (n - 1);
-                double weight = (j == 0 || j == n - 1) ? 0.5 : 1.0;
-                sum += weight * values[j] * System.Math.Cos(k * theta);
+                double weight = (j == 0 || j == m) ? 0.5 : 1.0;
+                sum += weight * values[j] * QuarterWaveCosine(quarter, 2 * j * k);
             }
 
-            coeffs[k] = (2.0 / (n - 1)) * sum;
+            coefficients[k] = scale * sum;
         }
+    }
 
-        return coeffs;
+    /// <summary>
+    /// Computes Chebyshev coefficients of the interpolant through values at first-kind nodes (DCT-II).
+    /// </summary>
+    /// <param name="values">Function values at the n first-kind nodes, in the ascending order of <see cref="ChebyshevNodes"/>.</param>
+    /// <param name="coefficients">
+    /// Receives n + 1 coefficients in the half-weighted-endpoint convention of <see cref="EvaluateSeries(double[], double)"/>;
+    /// the last is zero, so the interpolant is 0.5a_0 + Σ_(k&lt;n) a_k T_k(x).
+    /// </param>
+    /// <remarks>
+    /// The interpolant is the one <see cref="Interpolate(double[], double[], double)"/> evaluates,
+    /// but once the coefficients exist each evaluation is a Clenshaw recurrence with no divisions.
+    /// Power-of-two n up to 64 uses Makhoul's FFT form of the DCT-II, in O(n log n); other sizes
+    /// sum directly over cosines read from one quarter wave.
+    /// </remarks>
+    public static void NodeValuesToCoefficients(ReadOnlySpan<double> values, Span<double> coefficients)
+    {
+        int n = values.Length;
+        if (n == 0)
+        {
+            throw new ArgumentException("Values must not be empty.", nameof(values));
+        }
+
+        if (coefficients.Length < n + 1)
+        {
+            throw new ArgumentException("Coefficient span must hold n + 1 coefficients.", nameof(coefficients));
+        }
+
+        double scale = 2.0 / n;
+        coefficients[n] = 0.0;
+
+        if (n >= 2 && n <= FftTableSize / 4 && IsPowerOfTwo(n))
+        {
+            // Node m (descending, θ_m = (2m+1)π/2n) carries values[n-1-m]. Makhoul: even nodes
+            // forward, odd nodes reversed, then X_k = Re(e^(-iπk/2n)·FFT_k).
+            Span<double> re = stackalloc double[n];
+            Span<double> im = stackalloc double[n];
+            for (int m = 0; m < n / 2; m++)
+            {
+                re[m] = values[n - 1 - (2 * m)];
+                re[n - 1 - m] = values[n - 2 - (2 * m)];
+            }
+
+            im.Clear();
+            Fft(re, im);
+
+            int stride = FftTableSize / (4 * n);
+            for (int k = 0; k < n; k++)
+            {
+                double cos = FftCos[k * stride];
+                double sin = FftSin[k * stride];
+                coefficients[k] = scale * ((re[k] * cos) + (im[k] * sin));
+            }
+
+            return;
+        }
+
+        // cos(kθ_m) = cos(π·k(2m+1)/(2n)), read from one quarter wave
+        Span<double> quarter = n < MaxStackQuarterWave ? stackalloc double[n + 1] : new double[n + 1];
+        FillQuarterWave(quarter);
+        for (int k = 0; k < n; k++)
+        {
+            double sum = 0.0;
+            for (int m = 0; m < n; m++)
+            {
+                sum += values[n - 1 - m] * QuarterWaveCosine(quarter, k * ((2 * m) + 1));
+            }
+
+            coefficients[k] = scale * sum;
+        }
     }
 
     /// <summary>
@@ -373,6 +594,67 @@ public static class CRCH001A
     public static double EvaluateSeries(double[] coeffs, double x)
     {
         ArgumentNullException.ThrowIfNull(coeffs);
+        return EvaluateSeries(coeffs.AsSpan(), x);
+    }
+
+    /// <summary>
+    /// Evaluates a Chebyshev series at every point of <paramref name="points"/>.
+    /// </summary>
+    /// <param name="coefficients">Chebyshev coefficients with half-weighted endpoints.</param>
+    /// <param name="points">Evaluation points in [-1, 1].</param>
+    /// <param name="destination">Receives the series value at each point.</param>
+    /// <remarks>
+    /// Runs the Clenshaw recurrence for four points at a time on <see cref="Vector256{T}"/>
+    /// lanes, with the same operation order as the scalar overload, so both agree bit for bit.
+    /// </remarks>
+    public static void EvaluateSeries(ReadOnlySpan<double> coefficients, ReadOnlySpan<double> points, Span<double> destination)
+    {
+        int count = points.Length;
+        if (destination.Length < count)
+        {
+            throw new ArgumentException("Destination must hold one value per point.", nameof(destination));
+        }
+
+        int n = coefficients.Length;
+        if (n <= 1)
+        {
+            destination[..count].Fill(n == 0 ? 0.0 : coefficients[0]);
+            return;
+        }
+
+        int vectorEnd = CRVT002A.IsAvx2Supported ? count - (count % LaneCount) : 0;
+        if (vectorEnd > 0)
+        {
+            Vector256<double> two = Vector256.Create(2.0);
+            Vector256<double> leading = Vector256.Create(0.5 * coefficients[0]);
+            Vector256<double> last = Vector256.Create(0.5 * coefficients[n - 1]);
+
+            for (int i = 0; i < vectorEnd; i += LaneCount)
+            {
+                Vector256<double> x = Vector256.Create(points.Slice(i, LaneCount));
+                Vector256<double> twoX = two * x;
+                Vector256<double> bk1 = last;
+                Vector256<double> bk2 = Vector256<double>.Zero;
+
+                for (int k = n - 2; k >= 1; k--)
+                {
+                    Vector256<double> bk = Vector256.Create(coefficients[k]) + (twoX * bk1) - bk2;
+                    bk2 = bk1;
+                    bk1 = bk;
+                }
+
+                (leading + (x * bk1) - bk2).CopyTo(destination.Slice(i, LaneCount));
+            }
+        }
+
+        for (int i = vectorEnd; i < count; i++)
+        {
+            destination[i] = EvaluateSeries(coefficients, points[i]);
+        }
+    }
+
+    private static double EvaluateSeries(ReadOnlySpan<double> coeffs, double x)
+    {
         int n = coeffs.Length;
         if (n == 0)
         {
@@ -384,17 +666,109 @@ public static class CRCH001A
             return coeffs[0];
         }
 
-        double bk1 = 0.0;
+        double twoX = 2.0 * x;
+        double bk1 = 0.5 * coeffs[n - 1];
         double bk2 = 0.0;
 
-        for (int k = n - 1; k >= 1; k--)
+        for (int k = n - 2; k >= 1; k--)
         {
-            double coeff = k == n - 1 ? 0.5 * coeffs[k] : coeffs[k];
-            double bk = coeff + (2.0 * x * bk1) - bk2;
+            double bk = coeffs[k] + (twoX * bk1) - bk2;
             bk2 = bk1;
             bk1 = bk;
         }
 
         return (0.5 * coeffs[0]) + (x * bk1) - bk2;
     }
+
+    /// <summary>
+    /// Fills quarter[i] = cos(πi/(2N)) for i = 0..N, where N = quarter.Length - 1.
+    /// </summary>
+    private static void FillQuarterWave(Span<double> quarter)
+    {
+        int n = quarter.Length - 1;
+        for (int i = 0; i <= n; i++)
+        {
+            quarter[i] = System.Math.Cos(System.Math.PI * i / (2.0 * n));
+        }
+    }
+
+    /// <summary>
+    /// cos(π·index/(2N)) for any non-negative index, by quarter-wave symmetry.
+    /// </summary>
+    private static double QuarterWaveCosine(ReadOnlySpan<double> quarter, int index)
+    {
+        int n = quarter.Length - 1;
+        int i = index % (4 * n);
+        if (i <= n)
+        {
+            return quarter[i];
+        }
+
+        if (i <= 2 * n)
+        {
+            return -quarter[(2 * n) - i];
+        }
+
+        return i <= 3 * n ? -quarter[i - (2 * n)] : quarter[(4 * n) - i];
+    }
+
+    private static bool IsPowerOfTwo(int n) => (n & (n - 1)) == 0;
+
+    /// <summary>
+    /// In-place radix-2 decimation-in-time FFT, e^(-2πijk/N) kernel, for power-of-two N up to 128.
+    /// </summary>
+    private static void Fft(Span<double> re, Span<double> im)
+    {
+        int n = re.Length;
+
+        for (int i = 1, j = 0; i < n; i++)
+        {
+            int bit = n >> 1;
+            for (; (j & bit) != 0; bit >>= 1)
+            {
+                j ^= bit;
+            }
+
+            j ^= bit;
+            if (i < j)
+            {
+                (re[i], re[j]) = (re[j], re[i]);
+                (im[i], im[j]) = (im[j], im[i]);
+            }
+        }
+
+        for (int length = 2; length <= n; length <<= 1)
+        {
+            int half = length >> 1;
+            int stride = FftTableSize / length;
+            for (int start = 0; start < n; start += length)
+            {
+                for (int k = 0; k < half; k++)
+                {
+                    double wr = FftCos[k * stride];
+                    double wi = -FftSin[k * stride];
+                    int u = start + k;
+                    int v = u + half;
+                    double tr = (re[v] * wr) - (im[v] * wi);
+                    double ti = (re[v] * wi) + (im[v] * wr);
+                    re[v] = re[u] - tr;
+                    im[v] = im[u] - ti;
+                    re[u] += tr;
+                    im[u] += ti;
+                }
+            }
+        }
+    }
+
+    private static double[] CreateFftTable(Func<double, double> trig)
+    {
+        // Angles 2πm/FftTableSize over the half circle the transforms index
+        double[] table = new double[FftTableSize / 2];
+        for (int m = 0; m < table.Length; m++)
+        {
+            table[m] = trig(2.0 * System.Math.PI * m / FftTableSize);
+        }
+
+        return table;
+    }
 }
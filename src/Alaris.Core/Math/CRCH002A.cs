@@ -0,0 +1,1874 @@
+// CRCH002A.cs - Generated Chebyshev node and barycentric weight tables
+// Component ID: CRCH002A
+//
+// <auto-generated>
+// Round-trip ("R") output of the cosine and sine formulas in CRCH001A for orders up to 64,
+// so each entry is bit-identical to the value it replaces.
+// Do not edit by hand; TSUN063A checks every table against its formula.
+// </auto-generated>
+//
+// Layout: order n starts at n(n-1)/2 (first-kind tables) or n(n-1)/2 - 1 (Lobatto, n >= 2).
+
+namespace Alaris.Core.Math;
+
+/// <summary>
+/// Generated Chebyshev node and barycentric weight tables backing <see cref="CRCH001A"/>.
+/// </summary>
+/// <remarks>
+/// Each table is a static array built once at type initialization: reading one
+/// allocates nothing and evaluates no trigonometric functions.
+/// </remarks>
+internal static class CRCH002A
+{
+    /// <summary>Largest tabulated order.</summary>
+    public const int MaxOrder = 64;
+
+    /// <summary>Start of the order-n entries in a first-kind table.</summary>
+    public static int Offset(int n) => n * (n - 1) / 2;
+
+    /// <summary>Start of the order-n entries in the Lobatto table.</summary>
+    public static int LobattoOffset(int n) => (n * (n - 1) / 2) - 1;
+
+    /// <summary>cos((2k+1)π/2n), k = n-1..0: first-kind Chebyshev nodes on [-1, 1], ascending.</summary>
+    public static ReadOnlySpan<double> NodeCosines => NodeCosinesTable;
+
+    private static readonly double[] NodeCosinesTable =
+    {
+        // n = 1
+        6.123233995736766E-17,
+        // n = 2
+        -0.7071067811865475, 0.7071067811865476,
+        // n = 3
+        -0.8660254037844387, 6.123233995736766E-17, 0.8660254037844387,
+        // n = 4
+        -0.9238795325112867, -0.3826834323650897, 0.38268343236508984, 0.9238795325112867,
+        // n = 5
+        -0.9510565162951535, -0.587785252292473, 6.123233995736766E-17, 0.5877852522924731,
+        0.9510565162951535,
+        // n = 6
+        -0.9659258262890682, -0.7071067811865475, -0.25881904510252063, 0.25881904510252074,
+        0.7071067811865476, 0.9659258262890683,
+        // n = 7
+        -0.9749279121818237, -0.7818314824680295, -0.43388373911755806, 6.123233995736766E-17,
+        0.4338837391175582, 0.7818314824680298, 0.9749279121818236,
+        // n = 8
+        -0.9807852804032304, -0.8314696123025453, -0.555570233019602, -0.1950903220161282,
+        0.19509032201612833, 0.5555702330196023, 0.8314696123025452, 0.9807852804032304,
+        // n = 9
+        -0.984807753012208, -0.8660254037844385, -0.6427876096865394, -0.3420201433256685,
+        6.123233995736766E-17, 0.3420201433256688, 0.6427876096865394, 0.8660254037844387,
+        0.984807753012208,
+        // n = 10
+        -0.9876883405951377, -0.8910065241883678, -0.7071067811865475, -0.4539904997395467,
+        -0.1564344650402306, 0.15643446504023092, 0.4539904997395468, 0.7071067811865476,
+        0.8910065241883679, 0.9876883405951378,
+        // n = 11
+        -0.9898214418809327, -0.9096319953545182, -0.7557495743542582, -0.5406408174555972,
+        -0.28173255684142967, 2.83276944882399E-16, 0.2817325568414298, 0.5406408174555977,
+        0.7557495743542583, 0.9096319953545184, 0.9898214418809327,
+        // n = 12
+        -0.9914448613738104, -0.9238795325112867, -0.793353340291235, -0.6087614290087207,
+        -0.3826834323650895, -0.1305261922200516, 0.1305261922200517, 0.38268343236508984,
+        0.6087614290087207, 0.7933533402912352, 0.9238795325112867, 0.9914448613738104,
+        // n = 13
+        -0.992708874098054, -0.9350162426854147, -0.8229838658936564, -0.663122658240795,
+        -0.4647231720437685, -0.2393156642875575, -1.6081226496766364E-16, 0.23931566428755804,
+        0.4647231720437686, 0.6631226582407953, 0.8229838658936564, 0.9350162426854148,
+        0.992708874098054,
+        // n = 14
+        -0.9937122098932426, -0.9438833303083676, -0.8467241992282841, -0.7071067811865475,
+        -0.5320320765153365, -0.3302790619551672, -0.11196447610330758, 0.11196447610330769,
+        0.3302790619551673, 0.5320320765153366, 0.7071067811865476, 0.8467241992282841,
+        0.9438833303083676, 0.9937122098932426,
+        // n = 15
+        -0.9945218953682734, -0.9510565162951535, -0.8660254037844387, -0.743144825477394,
+        -0.587785252292473, -0.40673664307580004, -0.20791169081775934, 2.83276944882399E-16,
+        0.20791169081775923, 0.4067366430758004, 0.5877852522924731, 0.7431448254773942,
+        0.8660254037844387, 0.9510565162951535, 0.9945218953682733,
+        // n = 16
+        -0.9951847266721968, -0.9569403357322088, -0.8819212643483549, -0.773010453362737,
+        -0.6343932841636454, -0.4713967368259977, -0.29028467725446216, -0.09801714032956065,
+        0.09801714032956077, 0.29028467725446233, 0.4713967368259978, 0.6343932841636455,
+        0.773010453362737, 0.881921264348355, 0.9569403357322088, 0.9951847266721969,
+        // n = 17
+        -0.9957341762950346, -0.961825643172819, -0.8951632913550622, -0.7980172272802395,
+        -0.6736956436465572, -0.5264321628773555, -0.3612416661871529, -0.18374951781657017,
+        6.123233995736766E-17, 0.18374951781657053, 0.36124166618715287, 0.5264321628773561,
+        0.6736956436465572, 0.7980172272802396, 0.8951632913550623, 0.961825643172819,
+        0.9957341762950345,
+        // n = 18
+        -0.9961946980917455, -0.9659258262890683, -0.9063077870366499, -0.8191520442889919,
+        -0.7071067811865475, -0.5735764363510462, -0.42261826174069933, -0.25881904510252085,
+        -0.08715574274765801, 0.08715574274765814, 0.25881904510252096, 0.42261826174069944,
+        0.5735764363510462, 0.7071067811865476, 0.8191520442889918, 0.9063077870366499,
+        0.9659258262890683, 0.9961946980917455,
+        // n = 19
+        -0.9965844930066698, -0.9694002659393304, -0.9157733266550575, -0.8371664782625283,
+        -0.7357239106731316, -0.6142127126896678, -0.47594739303707356, -0.32469946920468323,
+        -0.16459459028073384, 6.123233995736766E-17, 0.16459459028073375, 0.32469946920468357,
+        0.47594739303707345, 0.6142127126896679, 0.7357239106731317, 0.8371664782625287,
+        0.9157733266550574, 0.9694002659393304, 0.9965844930066698,
+        // n = 20
+        -0.996917333733128, -0.9723699203976766, -0.9238795325112867, -0.8526401643540922,
+        -0.7604059656000309, -0.6494480483301835, -0.5224985647159488, -0.3826834323650897,
+        -0.23344536385590534, -0.07845909572784487, 0.078459095727845, 0.23344536385590547,
+        0.38268343236508984, 0.5224985647159489, 0.6494480483301838, 0.7604059656000309,
+        0.8526401643540922, 0.9238795325112867, 0.9723699203976766, 0.996917333733128,
+        // n = 21
+        -0.9972037971811801, -0.9749279121818236, -0.9308737486442044, -0.8660254037844385,
+        -0.7818314824680298, -0.6801727377709192, -0.5633200580636221, -0.43388373911755806,
+        -0.2947551744109042, -0.1490422661761743, 6.123233995736766E-17, 0.14904226617617464,
+        0.2947551744109041, 0.4338837391175582, 0.563320058063622, 0.6801727377709195,
+        0.7818314824680298, 0.8660254037844387, 0.9308737486442042, 0.9749279121818236,
+        0.9972037971811801,
+        // n = 22
+        -0.9974521146102535, -0.9771468659711594, -0.9369497249997616, -0.8776789895672557,
+        -0.8005412409243603, -0.7071067811865475, -0.599277666511347, -0.4792489867200569,
+        -0.3494641795990983, -0.2125652895529767, -0.07133918319923224, 0.07133918319923235,
+        0.21256528955297682, 0.3494641795990984, 0.479248986720057, 0.599277666511347,
+        0.7071067811865476, 0.8005412409243604, 0.8776789895672557, 0.9369497249997617,
+        0.9771468659711595, 0.9974521146102535,
+        // n = 23
+        -0.9976687691905393, -0.9790840876823228, -0.9422609221188204, -0.8878852184023752,
+        -0.816969893010442, -0.7308359642781241, -0.6310879443260529, -0.5195839500354333,
+        -0.39840108984624145, -0.2697967711570241, -0.13616664909624668, 6.123233995736766E-17,
+        0.1361666490962466, 0.26979677115702444, 0.39840108984624134, 0.5195839500354336,
+        0.6310879443260528, 0.7308359642781241, 0.8169698930104421, 0.8878852184023752,
+        0.9422609221188205, 0.9790840876823229, 0.9976687691905392,
+        // n = 24
+        -0.9978589232386035, -0.9807852804032304, -0.9469301294951056, -0.8968727415326881,
+        -0.831469612302545, -0.7518398074789773, -0.6593458151000688, -0.5555702330196023,
+        -0.44228869021900113, -0.3214394653031616, -0.1950903220161282, -0.06540312923014314,
+        0.06540312923014327, 0.19509032201612833, 0.3214394653031617, 0.44228869021900125,
+        0.5555702330196024, 0.6593458151000688, 0.7518398074789774, 0.8314696123025452,
+        0.8968727415326884, 0.9469301294951057, 0.9807852804032304, 0.9978589232386035,
+        // n = 25
+        -0.9980267284282716, -0.9822872507286887, -0.9510565162951535, -0.9048270524660194,
+        -0.8443279255020149, -0.7705132427757891, -0.6845471059286887, -0.587785252292473,
+        -0.48175367410171543, -0.36812455268467775, -0.24868988716485485, -0.12533323356430415,
+        6.123233995736766E-17, 0.12533323356430448, 0.24868988716485474, 0.3681245526846781,
+        0.48175367410171516, 0.5877852522924732, 0.6845471059286886, 0.7705132427757893,
+        0.8443279255020151, 0.9048270524660196, 0.9510565162951535, 0.9822872507286887,
+        0.9980267284282716,
+        // n = 26
+        -0.9981755542233175, -0.9836199069471435, -0.9547208665085456, -0.9118998459920901,
+        -0.8557812723014474, -0.7871834806090501, -0.7071067811865475, -0.6167188726285431,
+        -0.5173378141776565, -0.4104128054527568, -0.29750305385520287, -0.18025503781390573,
+        -0.06037849742228594, 0.060378497422286063, 0.18025503781390587, 0.297503053855203,
+        0.41041280545275693, 0.5173378141776568, 0.6167188726285432, 0.7071067811865475,
+        0.7871834806090503, 0.8557812723014475, 0.9118998459920901, 0.9547208665085456,
+        0.9836199069471436, 0.9981755542233175,
+        // n = 27
+        -0.9983081582712682, -0.984807753012208, -0.9579895123154888, -0.918216106880274,
+        -0.8660254037844387, -0.8021231927550438, -0.7273736415730484, -0.6427876096865394,
+        -0.549508978070806, -0.44879918020046217, -0.3420201433256687, -0.23061587074244014,
+        -0.11609291412523018, 6.123233995736766E-17, 0.1160929141252303, 0.23061587074244025,
+        0.3420201433256686, 0.4487991802004623, 0.549508978070806, 0.6427876096865395,
+        0.7273736415730486, 0.8021231927550438, 0.8660254037844387, 0.918216106880274,
+        0.9579895123154889, 0.984807753012208, 0.9983081582712682,
+        // n = 28
+        -0.9984268150178166, -0.9858710185182359, -0.9609173219450995, -0.9238795325112867,
+        -0.8752234219087537, -0.8155608689592602, -0.7456421648831656, -0.6663465779520039,
+        -0.5786712961798057, -0.48371888710523975, -0.3826834323650897, -0.2768355114248493,
+        -0.16750622330473633, -0.05607044723719173, 0.056070447237191845, 0.16750622330473647,
+        0.2768355114248494, 0.38268343236508984, 0.4837188871052398, 0.5786712961798057,
+        0.666346577952004, 0.7456421648831656, 0.8155608689592603, 0.8752234219087537,
+        0.9238795325112867, 0.9609173219450996, 0.9858710185182359, 0.9984268150178166,
+        // n = 29
+        -0.9985334138511238, -0.9868265225415261, -0.9635499925192229, -0.9289767198167914,
+        -0.8835120444460228, -0.8276889981568905, -0.7621620551276364, -0.6876994588534231,
+        -0.6051742151937649, -0.5155538571770215, -0.41988910156026465, -0.31930153013597984,
+        -0.2149704402110241, -0.10811901842394174, 6.123233995736766E-17, 0.10811901842394187,
+        0.214970440211024, 0.31930153013598017, 0.4198891015602646, 0.5155538571770217,
+        0.6051742151937651, 0.6876994588534234, 0.7621620551276365, 0.8276889981568906,
+        0.8835120444460229, 0.9289767198167914, 0.9635499925192229, 0.9868265225415261,
+        0.9985334138511238,
+        // n = 30
+        -0.9986295347545738, -0.9876883405951377, -0.9659258262890683, -0.9335804264972017,
+        -0.8910065241883678, -0.8386705679454239, -0.7771459614569709, -0.7071067811865475,
+        -0.6293203910498373, -0.5446390350150268, -0.4539904997395467, -0.35836794954530027,
+        -0.25881904510252063, -0.1564344650402308, -0.05233595624294362, 0.052335956242943744,
+        0.15643446504023092, 0.25881904510252074, 0.3583679495453004, 0.4539904997395468,
+        0.5446390350150272, 0.6293203910498375, 0.7071067811865476, 0.7771459614569709,
+        0.838670567945424, 0.8910065241883679, 0.9335804264972017, 0.9659258262890683,
+        0.9876883405951378, 0.9986295347545738,
+        // n = 31
+        -0.9987165071710528, -0.9884683243281114, -0.9680771188662042, -0.9377521321470805,
+        -0.8978045395707416, -0.8486442574947508, -0.7907757369376984, -0.7247927872291201,
+        -0.651372482722222, -0.5712682150947921, -0.4853019625310809, -0.39435585511331844,
+        -0.2993631229733578, -0.20129852008865998, -0.1011683219874321, 6.123233995736766E-17,
+        0.10116832198743222, 0.20129852008866012, 0.299363122973358, 0.3943558551133188,
+        0.485301962531081, 0.5712682150947923, 0.6513724827222221, 0.7247927872291201,
+        0.7907757369376985, 0.848644257494751, 0.8978045395707417, 0.9377521321470804,
+        0.9680771188662043, 0.9884683243281114, 0.9987165071710528,
+        // n = 32
+        -0.9987954562051724, -0.989176509964781, -0.970031253194544, -0.9415440651830207,
+        -0.9039892931234433, -0.857728610000272, -0.8032075314806448, -0.7409511253549589,
+        -0.6715589548470184, -0.5956993044924334, -0.5141027441932217, -0.42755509343028186,
+        -0.33688985339221994, -0.24298017990326387, -0.14673047445536164, -0.04906767432741801,
+        0.049067674327418126, 0.14673047445536175, 0.24298017990326398, 0.33688985339222005,
+        0.4275550934302822, 0.5141027441932217, 0.5956993044924335, 0.6715589548470183,
+        0.7409511253549591, 0.8032075314806449, 0.8577286100002721, 0.9039892931234433,
+        0.9415440651830208, 0.970031253194544, 0.989176509964781, 0.9987954562051724,
+        // n = 33
+        -0.998867339183008, -0.9898214418809327, -0.9718115683235417, -0.9450008187146685,
+        -0.9096319953545182, -0.8660254037844387, -0.8145759520503357, -0.7557495743542582,
+        -0.6900790114821118, -0.6181589862206053, -0.5406408174555977, -0.45822652172741035,
+        -0.3716624556603274, -0.28173255684142945, -0.1892512443604101, -0.09505604330418248,
+        6.123233995736766E-17, 0.09505604330418281, 0.18925124436041021, 0.2817325568414298,
+        0.3716624556603275, 0.45822652172741046, 0.5406408174555976, 0.6181589862206053,
+        0.690079011482112, 0.7557495743542584, 0.8145759520503357, 0.8660254037844387,
+        0.9096319953545184, 0.9450008187146685, 0.9718115683235417, 0.9898214418809327,
+        0.998867339183008,
+        // n = 34
+        -0.9989329748023724, -0.9904104308752051, -0.9734380543606929, -0.9481606475909659,
+        -0.9147938684880209, -0.8736223906463694, -0.8249974745983024, -0.7693339709828789,
+        -0.7071067811865475, -0.6388468056519611, -0.5651364144225919, -0.4866044785668561,
+        -0.4039210048718948, -0.3177914195819013, -0.22895054995013403, -0.1381563549518822,
+        -0.046183458645739396, 0.04618345864573952, 0.1381563549518823, 0.22895054995013414,
+        0.31779141958190166, 0.4039210048718949, 0.4866044785668564, 0.5651364144225919,
+        0.6388468056519614, 0.7071067811865476, 0.7693339709828789, 0.8249974745983023,
+        0.8736223906463696, 0.914793868488021, 0.9481606475909659, 0.9734380543606929,
+        0.9904104308752052, 0.9989329748023724,
+        // n = 35
+        -0.9989930665413146, -0.9909497617679347, -0.9749279121818236, -0.9510565162951535,
+        -0.9195277725514506, -0.880595531856738, -0.8345732537213026, -0.7818314824680298,
+        -0.7227948638273914, -0.6579387259397126, -0.587785252292473, -0.512899277405906,
+        -0.43388373911755806, -0.35137482408134263, -0.26603684556667484, -0.17855689479863657,
+        -0.08963930890343344, 6.123233995736766E-17, 0.08963930890343355, 0.1785568947986367,
+        0.2660368455666752, 0.35137482408134274, 0.4338837391175582, 0.5128992774059061,
+        0.5877852522924731, 0.6579387259397126, 0.7227948638273916, 0.7818314824680298,
+        0.8345732537213026, 0.880595531856738, 0.9195277725514507, 0.9510565162951535,
+        0.9749279121818236, 0.9909497617679348, 0.9989930665413147,
+        // n = 36
+        -0.9990482215818578, -0.9914448613738104, -0.9762960071199333, -0.9537169507482268,
+        -0.9238795325112867, -0.8870108331782217, -0.8433914458128855, -0.793353340291235,
+        -0.737277336810124, -0.6755902076156602, -0.6087614290087207, -0.5372996083468236,
+        -0.4617486132350342, -0.3826834323650897, -0.30070579950427295, -0.21643961393810257,
+        -0.13052619222005138, -0.04361938736533589, 0.04361938736533601, 0.1305261922200515,
+        0.2164396139381029, 0.30070579950427306, 0.38268343236508984, 0.46174861323503386,
+        0.5372996083468239, 0.6087614290087207, 0.6755902076156604, 0.737277336810124,
+        0.7933533402912353, 0.8433914458128857, 0.8870108331782217, 0.9238795325112867,
+        0.9537169507482269, 0.9762960071199334, 0.9914448613738104, 0.9990482215818578,
+        // n = 37
+        -0.9990989662046814, -0.991900435258877, -0.9775552389476861, -0.9561667347392508,
+        -0.9278890272965093, -0.8929258581495686, -0.8515291377333113, -0.8039971303669404,
+        -0.7506723052527241, -0.6919388689775461, -0.6282199972956424, -0.5599747861375953,
+        -0.4876949438136343, -0.41190124824399266, -0.33313979474205757, -0.251978061385125,
+        -0.16900082032184896, -0.0848059244755091, 6.123233995736766E-17, 0.08480592447550922,
+        0.16900082032184907, 0.25197806138512535, 0.3331397947420575, 0.41190124824399277,
+        0.4876949438136346, 0.5599747861375954, 0.6282199972956424, 0.6919388689775463,
+        0.7506723052527243, 0.8039971303669405, 0.8515291377333113, 0.8929258581495685,
+        0.9278890272965093, 0.956166734739251, 0.9775552389476861, 0.9919004352588768,
+        0.9990989662046815,
+        // n = 38
+        -0.999145758387301, -0.992320579737045, -0.9787168453273545, -0.9584274824582527,
+        -0.9315910880512789, -0.8983909818919789, -0.8590539543698853, -0.8138487172701949,
+        -0.7630840681998063, -0.7071067811865475, -0.646299237860941, -0.5810768154019382,
+        -0.5118850490896008, -0.43919658884737023, -0.36350797056382994, -0.2853362242491054,
+        -0.20521534219563414, -0.12369263126934746, -0.04132497424881305, 0.041324974248813165,
+        0.1236926312693478, 0.20521534219563425, 0.2853362242491055, 0.36350797056382983,
+        0.43919658884737034, 0.511885049089601, 0.5810768154019383, 0.6462992378609409,
+        0.7071067811865476, 0.7630840681998065, 0.813848717270195, 0.8590539543698852,
+        0.8983909818919789, 0.931591088051279, 0.9584274824582527, 0.9787168453273545,
+        0.992320579737045, 0.999145758387301,
+        // n = 39
+        -0.9991889981715696, -0.992708874098054, -0.9797906520422677, -0.9605181116313722,
+        -0.9350162426854147, -0.9034504346103821, -0.8660254037844385, -0.8229838658936564,
+        -0.7746049618276545, -0.7212024473438144, -0.663122658240795, -0.600742264237979,
+        -0.5344658261278011, -0.4647231720437685, -0.391966609860075, -0.31666799380147254,
+        -0.2393156642875577, -0.1604112808577601, -0.08046656871672568, 6.123233995736766E-17,
+        0.08046656871672579, 0.16041128085776024, 0.23931566428755782, 0.31666799380147265,
+        0.3919666098600751, 0.4647231720437686, 0.534465826127801, 0.600742264237979,
+        0.6631226582407952, 0.7212024473438146, 0.7746049618276546, 0.8229838658936565,
+        0.8660254037844386, 0.9034504346103823, 0.9350162426854148, 0.9605181116313724,
+        0.9797906520422677, 0.992708874098054, 0.9991889981715696,
+        // n = 40
+        -0.9992290362407229, -0.9930684569549263, -0.9807852804032304, -0.9624552364536472,
+        -0.9381913359224842, -0.9081431738250814, -0.872496007072797, -0.831469612302545,
+        -0.7853169308807451, -0.7343225094356857, -0.6788007455329416, -0.6190939493098337,
+        -0.5555702330196023, -0.48862124149695507, -0.4186597375374278, -0.3461170570774927,
+        -0.2714404498650744, -0.1950903220161282, -0.11753739745783758, -0.039259815759068326,
+        0.039259815759068666, 0.1175373974578377, 0.19509032201612833, 0.2714404498650743,
+        0.346117057077493, 0.41865973753742813, 0.48862124149695496, 0.5555702330196023,
+        0.619093949309834, 0.6788007455329418, 0.7343225094356856, 0.785316930880745,
+        0.8314696123025452, 0.8724960070727972, 0.9081431738250814, 0.9381913359224842,
+        0.9624552364536473, 0.9807852804032304, 0.9930684569549263, 0.9992290362407229,
+        // n = 41
+        -0.99926618105081, -0.993402089759675, -0.9817083199968549, -0.9642534954531409,
+        -0.9411400479795614, -0.91250361647655, -0.8785122509109424, -0.83936542613195,
+        -0.7952928712734263, -0.7465532216119627, -0.6934325007922416, -0.6362424423265596,
+        -0.5753186602186205, -0.5110186794471105, -0.44371983786695973, -0.3738170718407687,
+        -0.30172059859519207, -0.22785350890313757, -0.15264928421887455, -0.07654925283649554,
+        2.83276944882399E-16, 0.07654925283649566, 0.15264928421887447, 0.2278535089031377,
+        0.3017205985951924, 0.3738170718407688, 0.4437198378669597, 0.5110186794471104,
+        0.5753186602186205, 0.6362424423265599, 0.6934325007922417, 0.7465532216119627,
+        0.7952928712734264, 0.83936542613195, 0.8785122509109424, 0.9125036164765501,
+        0.9411400479795615, 0.964253495453141, 0.9817083199968549, 0.993402089759675,
+        0.99926618105081,
+        // n = 42
+        -0.9993007047883986, -0.9937122098932426, -0.9825664732332883, -0.9659258262890682,
+        -0.9438833303083676, -0.916562255869976, -0.8841153935046099, -0.8467241992282841,
+        -0.8045977797666684, -0.7579717231454528, -0.7071067811865475, -0.6522874112781212,
+        -0.5938201855735015, -0.5320320765153365, -0.46726862827306204, -0.39989202431974097,
+        -0.330279061955167, -0.25881904510252063, -0.18591160716291458, -0.1119644761033078,
+        -0.037391194276325486, 0.037391194276325826, 0.11196447610330791, 0.1859116071629145,
+        0.25881904510252096, 0.33027906195516715, 0.3998920243197411, 0.467268628273062,
+        0.5320320765153366, 0.5938201855735016, 0.6522874112781212, 0.7071067811865476,
+        0.757971723145453, 0.8045977797666684, 0.8467241992282841, 0.8841153935046098,
+        0.9165622558699762, 0.9438833303083676, 0.9659258262890683, 0.9825664732332883,
+        0.9937122098932426, 0.9993007047883985,
+        // n = 43
+        -0.9993328483702394, -0.9940009752399459, -0.9833656768294661, -0.9674836970574252,
+        -0.9464397731576094, -0.9203461835691593, -0.8893421488825188, -0.8535930890373464,
+        -0.8132897407355654, -0.7686471397785318, -0.7199034737579957, -0.6673188112222393,
+        -0.6111737140978493, -0.551767740770446, -0.48941784781108527, -0.42445669887581533,
+        -0.3572308898011327, -0.28809909936523737, -0.21743017558155683, -0.14560116773500484,
+        -0.07299531466090758, 6.123233995736766E-17, 0.07299531466090771, 0.14560116773500498,
+        0.21743017558155697, 0.2880990993652377, 0.3572308898011328, 0.4244566988758152,
+        0.48941784781108555, 0.551767740770446, 0.6111737140978493, 0.6673188112222395,
+        0.7199034737579959, 0.768647139778532, 0.8132897407355654, 0.8535930890373464,
+        0.8893421488825188, 0.9203461835691594, 0.9464397731576093, 0.9674836970574252,
+        0.9833656768294661, 0.9940009752399459, 0.9993328483702394,
+        // n = 44
+        -0.9993628256569916, -0.9942703017718972, -0.9841112043361161, -0.9689373017815073,
+        -0.9488259168373195, -0.9238795325112867, -0.8942252698597113, -0.8600142402077006,
+        -0.8214207751204916, -0.7786415380497552, -0.7318945221817252, -0.6814179395938909,
+        -0.6274690073808521, -0.5703226369349639, -0.5102700330608995, -0.44761721006271243,
+        -0.3826834323650899, -0.31579958761502486, -0.2473065005542153, -0.1775531962543031,
+        -0.10689512156511288, -0.03569233383898037, 0.035692333838980496, 0.10689512156511301,
+        0.17755319625430344, 0.2473065005542154, 0.315799587615025, 0.38268343236508984,
+        0.44761721006271254, 0.5102700330608996, 0.5703226369349641, 0.627469007380852,
+        0.6814179395938912, 0.7318945221817255, 0.7786415380497552, 0.8214207751204916,
+        0.8600142402077006, 0.8942252698597113, 0.9238795325112867, 0.9488259168373196,
+        0.9689373017815074, 0.9841112043361161, 0.9942703017718973, 0.9993628256569916,
+        // n = 45
+        -0.9993908270190958, -0.9945218953682733, -0.984807753012208, -0.9702957262759965,
+        -0.9510565162951535, -0.9271838545667873, -0.898794046299167, -0.8660254037844387,
+        -0.8290375725550416, -0.7880107536067219, -0.743144825477394, -0.694658370458997,
+        -0.6427876096865394, -0.587785252292473, -0.5299192642332048, -0.46947156278589053,
+        -0.40673664307580004, -0.3420201433256687, -0.27563735581699905, -0.20791169081775912,
+        -0.13917310096006535, -0.06975647374412533, 6.123233995736766E-17, 0.06975647374412546,
+        0.1391731009600657, 0.20791169081775945, 0.27563735581699916, 0.3420201433256688,
+        0.4067366430758002, 0.46947156278589086, 0.5299192642332049, 0.5877852522924731,
+        0.6427876096865394, 0.6946583704589974, 0.7431448254773942, 0.788010753606722,
+        0.8290375725550416, 0.8660254037844387, 0.898794046299167, 0.9271838545667874,
+        0.9510565162951535, 0.9702957262759965, 0.984807753012208, 0.9945218953682733,
+        0.9993908270190958,
+        // n = 46
+        -0.999417022366174, -0.9947572788580948, -0.9854595177171969, -0.9715670893979415,
+        -0.9531447668141609, -0.930278443337833, -0.9030747323245327, -0.8716604700327512,
+        -0.8361821242547108, -0.7968051114159045, -0.7537130253273612, -0.7071067811865475,
+        -0.6572036788179723, -0.6042363895210945, -0.5484518712493189, -0.4901102171780173,
+        -0.42948344303008174, -0.3668542188130564, -0.3025145508810759, -0.2367644204664467,
+        -0.16991038502866662, -0.10226414894203402, -0.03414111018596793, 0.03414111018596783,
+        0.10226414894203437, 0.16991038502866676, 0.2367644204664468, 0.3025145508810758,
+        0.3668542188130565, 0.42948344303008185, 0.49011021717801734, 0.5484518712493187,
+        0.6042363895210946, 0.6572036788179724, 0.7071067811865476, 0.7537130253273611,
+        0.7968051114159046, 0.8361821242547108, 0.8716604700327513, 0.9030747323245327,
+        0.9302784433378332, 0.9531447668141608, 0.9715670893979415, 0.9854595177171969,
+        0.9947572788580948, 0.999417022366174,
+        // n = 47
+        -0.9994415637302546, -0.9949778150885041, -0.9860702539900286, -0.9727586637650371,
+        -0.9551024972069124, -0.9331806110416025, -0.9070909137343407, -0.8769499282066715,
+        -0.842892271416797, -0.8050700531275629, -0.763652196547332, -0.7188236838779292,
+        -0.6707847301392232, -0.6197498889602447, -0.565947094330595, -0.5096166425919175,
+        -0.45101011921610196, -0.3903892751634947, -0.328024857839569, -0.26419540187128604,
+        -0.19918598510383612, -0.13328695537377883, -0.0667926337451213, -1.6081226496766364E-16,
+        0.06679263374512164, 0.13328695537377896, 0.19918598510383623, 0.26419540187128615,
+        0.3280248578395691, 0.3903892751634948, 0.45101011921610185, 0.5096166425919175,
+        0.5659470943305951, 0.619749888960245, 0.6707847301392235, 0.7188236838779294,
+        0.763652196547332, 0.805070053127563, 0.842892271416797, 0.8769499282066715,
+        0.9070909137343407, 0.9331806110416025, 0.9551024972069124, 0.9727586637650372,
+        0.9860702539900286, 0.994977815088504, 0.9994415637302546,
+        // n = 48
+        -0.9994645874763657, -0.9951847266721968, -0.986643332084879, -0.9738769792773336,
+        -0.9569403357322087, -0.9359059267573258, -0.9108638249211759, -0.8819212643483549,
+        -0.8492021815265788, -0.8128466845916151, -0.773010453362737, -0.7298640726978354,
+        -0.6835923020228714, -0.6343932841636454, -0.582477696867802, -0.528067850650368,
+        -0.4713967368259977, -0.4127070298043946, -0.3522500479212335, -0.29028467725446216,
+        -0.2270762630343733, -0.1628954733945887, -0.09801714032956042, -0.03271908282177604,
+        0.032719082821776165, 0.09801714032956055, 0.16289547339458882, 0.22707626303437345,
+        0.2902846772544625, 0.3522500479212336, 0.4127070298043947, 0.4713967368259976,
+        0.5280678506503681, 0.5824776968678022, 0.6343932841636455, 0.6835923020228712,
+        0.7298640726978357, 0.773010453362737, 0.8128466845916152, 0.8492021815265789,
+        0.881921264348355, 0.9108638249211758, 0.9359059267573258, 0.9569403357322088,
+        0.9738769792773336, 0.986643332084879, 0.9951847266721969, 0.9994645874763657,
+        // n = 49
+        -0.9994862162006879, -0.9953791129491982, -0.9871817834144501, -0.9749279121818236,
+        -0.9586678530366607, -0.9384684220497602, -0.9144126230158124, -0.8865993063730001,
+        -0.8551427630053461, -0.820172254596956, -0.7818314824680298, -0.7402779970753154,
+        -0.6956825506034864, -0.6482283953077885, -0.598110530491216, -0.5455349012105486,
+        -0.4907175520039376, -0.43388373911755806, -0.3752670048793741, -0.31510821802362066,
+        -0.2536545839095072, -0.19115862870137235, -0.12787716168450589, -0.06407021998071283,
+        6.123233995736766E-17, 0.06407021998071295, 0.127877161684506, 0.19115862870137248,
+        0.2536545839095075, 0.31510821802362077, 0.3752670048793742, 0.4338837391175582,
+        0.4907175520039379, 0.5455349012105487, 0.598110530491216, 0.6482283953077884,
+        0.6956825506034864, 0.7402779970753156, 0.7818314824680298, 0.820172254596956,
+        0.8551427630053462, 0.8865993063730001, 0.9144126230158125, 0.9384684220497604,
+        0.9586678530366606, 0.9749279121818236, 0.9871817834144502, 0.9953791129491982,
+        0.9994862162006879,
+        // n = 50
+        -0.9995065603657316, -0.99556196460308, -0.9876883405951377, -0.9759167619387473,
+        -0.960293685676943, -0.9408807689542255, -0.9177546256839809, -0.8910065241883678,
+        -0.8607420270039438, -0.8270805742745617, -0.7901550123756904, -0.7501110696304596,
+        -0.7071067811865475, -0.6613118653236517, -0.6129070536529766, -0.5620833778521307,
+        -0.5090414157503713, -0.4539904997395467, -0.3971478906347807, -0.33873792024529137,
+        -0.27899110603922916, -0.21814324139654234, -0.1564344650402308, -0.09410831331851438,
+        -0.03141075907812828, 0.031410759078128396, 0.09410831331851428, 0.15643446504023092,
+        0.2181432413965427, 0.2789911060392295, 0.3387379202452915, 0.39714789063478056,
+        0.4539904997395468, 0.5090414157503712, 0.5620833778521307, 0.6129070536529765,
+        0.6613118653236519, 0.7071067811865476, 0.7501110696304596, 0.7901550123756903,
+        0.8270805742745618, 0.8607420270039436, 0.8910065241883679, 0.9177546256839811,
+        0.9408807689542255, 0.9602936856769431, 0.9759167619387474, 0.9876883405951378,
+        0.99556196460308, 0.9995065603657316,
+        // n = 51
+        -0.9995257197133659, -0.9957341762950346, -0.9881654720812594, -0.9768483177596007,
+        -0.961825643172819, -0.9431544344712774, -0.9209055179449537, -0.8951632913550622,
+        -0.8660254037844387, -0.8336023852211196, -0.7980172272802395, -0.7594049166547072,
+        -0.7179119230644418, -0.6736956436465572, -0.6269238058941062, -0.5777738314082511,
+        -0.526432162877356, -0.47309355683600995, -0.41796034488678346, -0.3612416661871529,
+        -0.3031526741130435, -0.24391372010837706, -0.18374951781657017, -0.12288829066471416,
+        -0.06156090613394282, 6.123233995736766E-17, 0.061560906133942946, 0.12288829066471406,
+        0.1837495178165703, 0.24391372010837717, 0.3031526741130436, 0.36124166618715303,
+        0.41796034488678335, 0.47309355683601007, 0.5264321628773558, 0.5777738314082511,
+        0.6269238058941065, 0.6736956436465572, 0.717911923064442, 0.7594049166547071,
+        0.7980172272802395, 0.8336023852211195, 0.8660254037844386, 0.8951632913550623,
+        0.9209055179449536, 0.9431544344712774, 0.961825643172819, 0.9768483177596007,
+        0.9881654720812594, 0.9957341762950345, 0.9995257197133659,
+        // n = 52
+        -0.9995437844895334, -0.995896557617091, -0.9886154122075342, -0.9777269163708469,
+        -0.9632708010475163, -0.9452998150346401, -0.9238795325112867, -0.8990881137654261,
+        -0.8710160199955154, -0.8397656832273979, -0.805451132550946, -0.7681975780402804,
+        -0.7281409538757886, -0.6854274223350398, -0.6402128404624879, -0.5926621913640167,
+        -0.5429489822014787, -0.4912546110838772, -0.4377677051653406, -0.3826834323650897,
+        -0.3262027892208693, -0.2685318674743768, -0.20988110206484742, -0.15046450327478292,
+        -0.0904988758296378, -0.03020302780088887, 0.03020302780088899, 0.09049887582963792,
+        0.15046450327478306, 0.20988110206484756, 0.2685318674743769, 0.3262027892208694,
+        0.38268343236508984, 0.43776770516534047, 0.4912546110838775, 0.5429489822014787,
+        0.5926621913640169, 0.640212840462488, 0.6854274223350398, 0.7281409538757884,
+        0.7681975780402805, 0.8054511325509459, 0.839765683227398, 0.8710160199955156,
+        0.899088113765426, 0.9238795325112867, 0.9452998150346403, 0.9632708010475163,
+        0.9777269163708469, 0.9886154122075342, 0.995896557617091, 0.9995437844895334,
+        // n = 53
+        -0.9995608365087943, -0.9960498426152169, -0.989040187322164, -0.978556492299504,
+        -0.9646355819083586, -0.9473263538541914, -0.9266896074318334, -0.9027978299657434,
+        -0.8757349421956367, -0.845596003501826, -0.8124868780056813, -0.7765238627180426,
+        -0.7378332790417271, -0.696551029062997, -0.6528221181905215, -0.6068001458185934,
+        -0.5586467658036524, -0.5085311186492206, -0.4566292373937131, -0.40312342928797207,
+        -0.3482016354343987, -0.2920567706369757, -0.23488604578098365, -0.17689027512257277,
+        -0.11827317092136565, -0.0592406278937144, 6.123233995736766E-17, 0.0592406278937143,
+        0.118273170921366, 0.17689027512257288, 0.23488604578098377, 0.2920567706369759,
+        0.34820163543439897, 0.40312342928797235, 0.4566292373937132, 0.5085311186492205,
+        0.5586467658036525, 0.6068001458185934, 0.6528221181905216, 0.6965510290629972,
+        0.7378332790417274, 0.7765238627180425, 0.8124868780056812, 0.8455960035018261,
+        0.8757349421956367, 0.9027978299657435, 0.9266896074318335, 0.9473263538541914,
+        0.9646355819083586, 0.978556492299504, 0.989040187322164, 0.9960498426152169,
+        0.9995608365087943,
+        // n = 54
+        -0.9995769500822006, -0.9961946980917455, -0.9894416385809445, -0.9793406217655515,
+        -0.9659258262890683, -0.9492426435730339, -0.9293475242268225, -0.9063077870366497,
+        -0.880201391180111, -0.8511166724369997, -0.8191520442889916, -0.7844156649195757,
+        -0.747025071240996, -0.7071067811865475, -0.6647958656139379, -0.6202354912682599,
+        -0.5735764363510458, -0.5249765803345601, -0.47460036974764047, -0.42261826174069933,
+        -0.3692061473126843, -0.31454475615161354, -0.25881904510252085, -0.202217572332038,
+        -0.14493185930724659, -0.08715574274765801, -0.02908471874311146, 0.02908471874311136,
+        0.08715574274765836, 0.14493185930724692, 0.2022175723320379, 0.25881904510252074,
+        0.31454475615161365, 0.36920614731268464, 0.42261826174069944, 0.4746003697476404,
+        0.5249765803345602, 0.5735764363510462, 0.62023549126826, 0.6647958656139379,
+        0.7071067811865476, 0.747025071240996, 0.7844156649195757, 0.8191520442889918,
+        0.8511166724369997, 0.8802013911801111, 0.9063077870366499, 0.9293475242268224,
+        0.9492426435730339, 0.9659258262890683, 0.9793406217655515, 0.9894416385809445,
+        0.9961946980917455, 0.9995769500822006,
+        // n = 55
+        -0.9995921928281892, -0.9963317308626913, -0.9898214418809327, -0.9800825610923933,
+        -0.967146854701957, -0.9510565162951536, -0.9318640292114523, -0.9096319953545184,
+        -0.8844329309978143, -0.8563490302515889, -0.825471896962774, -0.791902245922275,
+        -0.7557495743542582, -0.7171318047589634, -0.6761749002740192, -0.6330124538088703,
+        -0.587785252292473, -0.5406408174555977, -0.49173292464560353, -0.44122110124322117,
+        -0.38927010631739145, -0.33604939321543, -0.28173255684142945, -0.2264967674257645,
+        -0.1705221926326238, -0.11399140989054055, -0.0570888108627678, 6.123233995736766E-17,
+        0.05708881086276792, 0.11399140989054066, 0.17052219263262391, 0.22649676742576438,
+        0.2817325568414298, 0.3360493932154301, 0.38927010631739156, 0.44122110124322145,
+        0.4917329246456038, 0.5406408174555977, 0.5877852522924731, 0.6330124538088704,
+        0.6761749002740195, 0.7171318047589635, 0.7557495743542583, 0.7919022459222751,
+        0.8254718969627739, 0.856349030251589, 0.8844329309978143, 0.9096319953545184,
+        0.9318640292114523, 0.9510565162951536, 0.9671468547019572, 0.9800825610923934,
+        0.9898214418809327, 0.9963317308626913, 0.9995921928281892,
+        // n = 56
+        -0.9996066263830529, -0.9964614941176191, -0.9901811253364455, -0.9807852804032304,
+        -0.9683035221222613, -0.9527751227228963, -0.9342489402945999, -0.9127832650613188,
+        -0.8884456359788724, -0.8613126282324087, -0.831469612302545, -0.7990104853582491,
+        -0.7640373758216072, -0.7266603220340271, -0.6869969260349017, -0.6451719835420874,
+        -0.6013170912984059, -0.5555702330196023, -0.5080753452465292, -0.4589818644675374,
+        -0.40844425693599606, -0.35662153266231295, -0.3036767451096147, -0.24977647816722678,
+        -0.1950903220161282, -0.1397903395354994, -0.08405052492924749, -0.028046256275868896,
+        0.028046256275869017, 0.0840505249292476, 0.13979033953549952, 0.19509032201612833,
+        0.2497764781672269, 0.3036767451096148, 0.35662153266231306, 0.4084442569359962,
+        0.4589818644675377, 0.5080753452465295, 0.5555702330196023, 0.6013170912984058,
+        0.6451719835420877, 0.6869969260349017, 0.7266603220340271, 0.7640373758216075,
+        0.799010485358249, 0.8314696123025452, 0.861312628232409, 0.8884456359788723,
+        0.9127832650613189, 0.9342489402945998, 0.9527751227228963, 0.9683035221222615,
+        0.9807852804032304, 0.9901811253364456, 0.9964614941176192, 0.9996066263830529,
+        // n = 57
+        -0.9996203070249514, -0.9965844930066698, -0.9905220846375032, -0.9814514932524179,
+        -0.9694002659393305, -0.9544050018795073, -0.9365112411970548, -0.9157733266550575,
+        -0.8922542386183938, -0.8660254037844387, -0.8371664782625283, -0.8057651056609781,
+        -0.7719166509163209, -0.7357239106731314, -0.6972968010939954, -0.6567520240477344,
+        -0.6142127126896678, -0.5698080575102662, -0.5236729139878779, -0.47594739303707356,
+        -0.42677643549640365, -0.3763093719478354, -0.32469946920468346, -0.272103464845335,
+        -0.21868109120637555, -0.16459459028073384, -0.11000822099407924, -0.055087760355865385,
+        6.123233995736766E-17, 0.05508776035586551, 0.11000822099407936, 0.16459459028073398,
+        0.21868109120637588, 0.2721034648453349, 0.32469946920468357, 0.37630937194783554,
+        0.42677643549640376, 0.4759473930370736, 0.523672913987878, 0.5698080575102663,
+        0.6142127126896678, 0.6567520240477345, 0.6972968010939954, 0.7357239106731317,
+        0.7719166509163209, 0.8057651056609781, 0.8371664782625285, 0.8660254037844387,
+        0.892254238618394, 0.9157733266550575, 0.9365112411970548, 0.9544050018795074,
+        0.9694002659393304, 0.9814514932524179, 0.9905220846375032, 0.9965844930066698,
+        0.9996203070249514,
+        // n = 58
+        -0.999633286223284, -0.9967011895602227, -0.9908455965788068, -0.9820836827421559,
+        -0.9704411482532114, -0.9559521426716115, -0.9386591647471504, -0.9186129377636217,
+        -0.895872260758688, -0.870503836056172, -0.842582073616649, -0.812188872780211,
+        -0.7794133820415916, -0.7443517375622704, -0.7071067811865475, -0.6677877587886957,
+        -0.6265099998359869, -0.5833945791074936, -0.5385679615609041, -0.49216163138900737,
+        -0.4443117063539034, -0.39515853853015526, -0.3448463026279704, -0.2935225731039347,
+        -0.24133789129970556, -0.1884453238783182, -0.13500001385329022, -0.08115872552743113,
+        -0.027079384676134334, 0.027079384676134678, 0.08115872552743125, 0.1350000138532901,
+        0.1884453238783183, 0.24133789129970568, 0.2935225731039348, 0.3448463026279705,
+        0.39515853853015553, 0.44431170635390366, 0.4921616313890075, 0.5385679615609043,
+        0.583394579107494, 0.6265099998359867, 0.6677877587886957, 0.7071067811865476,
+        0.7443517375622704, 0.7794133820415916, 0.8121888727802112, 0.842582073616649,
+        0.8705038360561721, 0.895872260758688, 0.9186129377636219, 0.9386591647471505,
+        0.9559521426716117, 0.9704411482532114, 0.982083682742156, 0.9908455965788068,
+        0.9967011895602228, 0.999633286223284,
+        // n = 59
+        -0.9996456111234526, -0.9968120070307501, -0.9911528310040071, -0.982684124592521,
+        -0.9714298932647099, -0.9574220383620055, -0.9407002666710333, -0.921311977870413,
+        -0.8993121301712191, -0.8747630845319613, -0.8477344278896709, -0.818302775908169,
+        -0.7865515558026421, -0.7525707698561385, -0.7164567402983152, -0.6783118362696158,
+        -0.6382441836448202, -0.5963673585385015, -0.5528000653611931, -0.5076658003388401,
+        -0.461092501449326, -0.41321218576837815, -0.36416057525282197, -0.3140767120219488,
+        -0.26310256422752126, -0.21138262362962418, -0.1590634960190719, -0.10629348564736552,
+        -0.05322217484217857, 6.123233995736766E-17, 0.053222174842178914, 0.10629348564736542,
+        0.15906349601907205, 0.2113826236296245, 0.26310256422752143, 0.31407671202194876,
+        0.3641605752528223, 0.41321218576837826, 0.4610925014493259, 0.50766580033884,
+        0.5528000653611934, 0.5963673585385015, 0.63824418364482, 0.6783118362696161,
+        0.7164567402983152, 0.7525707698561386, 0.7865515558026425, 0.8183027759081691,
+        0.8477344278896709, 0.8747630845319613, 0.8993121301712192, 0.921311977870413,
+        0.9407002666710332, 0.9574220383620055, 0.97142989326471, 0.982684124592521,
+        0.9911528310040072, 0.9968120070307501, 0.9996456111234526,
+        // n = 60
+        -0.9996573249755573, -0.996917333733128, -0.9914448613738104, -0.9832549075639545,
+        -0.9723699203976766, -0.9588197348681929, -0.9426414910921783, -0.9238795325112867,
+        -0.9025852843498604, -0.8788171126619653, -0.8526401643540922, -0.8241261886220155,
+        -0.7933533402912353, -0.7604059656000309, -0.7253743710122876, -0.6883545756937541,
+        -0.6494480483301835, -0.6087614290087207, -0.566406236924833, -0.5224985647159488,
+        -0.47715876025960846, -0.4305110968082949, -0.3826834323650897, -0.3338068592337708,
+        -0.28401534470392265, -0.23344536385590534, -0.1822355254921473, -0.13052619222005138,
+        -0.07845909572784487, -0.026176948307873017, 0.02617694830787314, 0.078459095727845,
+        0.1305261922200515, 0.18223552549214744, 0.23344536385590547, 0.28401534470392276,
+        0.3338068592337709, 0.38268343236508984, 0.43051109680829525, 0.47715876025960857,
+        0.5224985647159489, 0.5664062369248328, 0.6087614290087207, 0.6494480483301837,
+        0.688354575693754, 0.7253743710122876, 0.7604059656000309, 0.7933533402912352,
+        0.8241261886220157, 0.8526401643540922, 0.8788171126619654, 0.9025852843498606,
+        0.9238795325112867, 0.9426414910921784, 0.958819734868193, 0.9723699203976766,
+        0.9832549075639546, 0.9914448613738104, 0.996917333733128, 0.9996573249755573,
+        // n = 61
+        -0.999668467514313, -0.9970175264485266, -0.9917226741361015, -0.9837979515735163,
+        -0.9732643737003824, -0.9601498736716018, -0.9444892287836611, -0.926323968251495,
+        -0.9057022630804714, -0.8826787983255473, -0.8573146280763322, -0.8296770135526189,
+        -0.7998392447397193, -0.7678804460366, -0.733885366432199, -0.6979441547663434,
+        -0.6601521206712319, -0.6206094818274225, -0.5794210982045637, -0.5366961939916004,
+        -0.49254806795386424, -0.4470937929851141, -0.4004539056512664, -0.3527520865490946,
+        -0.3041148323275176, -0.25467112024122884, -0.20455206612620086, -0.15389057670406175,
+        -0.10282099713736027, -0.05147875477034655, 6.123233995736766E-17, 0.05147875477034667,
+        0.10282099713736062, 0.15389057670406187, 0.20455206612620075, 0.25467112024122873,
+        0.30411483232751796, 0.35275208654909473, 0.4004539056512665, 0.447093792985114,
+        0.4925480679538646, 0.5366961939916005, 0.5794210982045637, 0.6206094818274228,
+        0.6601521206712317, 0.6979441547663435, 0.7338853664321991, 0.7678804460366001,
+        0.7998392447397195, 0.8296770135526189, 0.8573146280763323, 0.8826787983255474,
+        0.9057022630804715, 0.926323968251495, 0.9444892287836613, 0.9601498736716018,
+        0.9732643737003825, 0.9837979515735163, 0.9917226741361015, 0.9970175264485267,
+        0.999668467514313,
+        // n = 62
+        -0.9996790752964305, -0.9971129134476475, -0.9919871770507429, -0.9843150237975341,
+        -0.974116147995387, -0.9614167300122124, -0.9462493690718369, -0.9286529995722621,
+        -0.9086727911416249, -0.8863600326884081, -0.8617720007435494, -0.8349718124324073,
+        -0.8060282634540051, -0.7750156514834587, -0.7420135854509109, -0.7071067811865475,
+        -0.6703848439562783, -0.6319420384463039, -0.591877046787017, -0.5502927152373913,
+        -0.5072957901801075, -0.46299664410512076, -0.4175089922850633, -0.37094960086976775,
+        -0.3234379871492381, -0.2750961127544779, -0.22604807058373486, -0.17641976625780847,
+        -0.12633859492212898, -0.07593311422524611, -0.02533271431318797, 0.02533271431318787,
+        0.07593311422524644, 0.12633859492212934, 0.17641976625780836, 0.22604807058373497,
+        0.2750961127544782, 0.3234379871492382, 0.3709496008697677, 0.4175089922850632,
+        0.46299664410512087, 0.5072957901801074, 0.5502927152373914, 0.5918770467870174,
+        0.631942038446304, 0.6703848439562785, 0.7071067811865476, 0.7420135854509108,
+        0.7750156514834587, 0.806028263454005, 0.8349718124324075, 0.8617720007435496,
+        0.8863600326884082, 0.9086727911416249, 0.9286529995722622, 0.9462493690718369,
+        0.9614167300122125, 0.974116147995387, 0.9843150237975341, 0.991987177050743,
+        0.9971129134476474, 0.9996790752964305,
+        // n = 63
+        -0.9996891820008162, -0.9972037971811801, -0.9922392066001721, -0.984807753012208,
+        -0.9749279121818236, -0.9626242469500121, -0.9479273461671317, -0.9308737486442044,
+        -0.9115058523116729, -0.8898718088114685, -0.8660254037844387, -0.8400259231507714,
+        -0.8119380057158565, -0.7818314824680298, -0.749781202967734, -0.7158668492597184,
+        -0.6801727377709192, -0.6427876096865394, -0.6038044103254776, -0.5633200580636217,
+        -0.521435203379498, -0.4782539786213183, -0.43388373911755806, -0.3884347962746947,
+        -0.3420201433256687, -0.2947551744109042, -0.24675739769029345, -0.19814614319939763,
+        -0.1490422661761743, -0.09956784659581654, -0.04984588566069707, 6.123233995736766E-17,
+        0.0498458856606972, 0.09956784659581666, 0.14904226617617464, 0.19814614319939755,
+        0.24675739769029356, 0.2947551744109043, 0.3420201433256688, 0.3884347962746948,
+        0.4338837391175582, 0.47825397862131824, 0.5214352033794982, 0.5633200580636221,
+        0.6038044103254774, 0.6427876096865394, 0.6801727377709194, 0.7158668492597184,
+        0.7497812029677342, 0.7818314824680298, 0.8119380057158565, 0.8400259231507715,
+        0.8660254037844386, 0.8898718088114687, 0.9115058523116731, 0.9308737486442042,
+        0.9479273461671318, 0.962624246950012, 0.9749279121818236, 0.984807753012208,
+        0.9922392066001721, 0.9972037971811801, 0.9996891820008162,
+        // n = 64
+        -0.9996988186962042, -0.9972904566786902, -0.99247953459871, -0.9852776423889412,
+        -0.9757021300385285, -0.9637760657954398, -0.9495281805930367, -0.9329927988347388,
+        -0.9142097557035307, -0.8932243011955152, -0.8700869911087113, -0.8448535652497071,
+        -0.8175848131515836, -0.7883464276266062, -0.7572088465064846, -0.7242470829514668,
+        -0.6895405447370669, -0.6531728429537765, -0.6152315905806267, -0.5758081914178453,
+        -0.534997619887097, -0.492898192229784, -0.4496113296546067, -0.40524131400498975,
+        -0.35989503653498817, -0.3136817403988914, -0.2667127574748983, -0.21910124015686966,
+        -0.17096188876030124, -0.12241067519921615, -0.07356456359966733, -0.024541228522912142,
+        0.024541228522912264, 0.07356456359966745, 0.12241067519921628, 0.17096188876030136,
+        0.21910124015686977, 0.2667127574748984, 0.3136817403988916, 0.3598950365349883,
+        0.40524131400498986, 0.4496113296546066, 0.4928981922297841, 0.5349976198870973,
+        0.5758081914178453, 0.6152315905806268, 0.6531728429537768, 0.6895405447370669,
+        0.724247082951467, 0.7572088465064846, 0.7883464276266063, 0.8175848131515837,
+        0.8448535652497071, 0.8700869911087115, 0.8932243011955153, 0.9142097557035307,
+        0.932992798834739, 0.9495281805930367, 0.9637760657954398, 0.9757021300385286,
+        0.9852776423889412, 0.99247953459871, 0.9972904566786902, 0.9996988186962042,
+    };
+
+    /// <summary>First-kind barycentric weights (-1)^k·sin((2k+1)π/2n), as returned by <see cref="CRCH001A.BarycentricWeights"/>.</summary>
+    public static ReadOnlySpan<double> BarycentricWeights => BarycentricWeightsTable;
+
+    private static readonly double[] BarycentricWeightsTable =
+    {
+        // n = 1
+        1,
+        // n = 2
+        0.7071067811865475, -0.7071067811865476,
+        // n = 3
+        0.49999999999999994, -1, 0.49999999999999994,
+        // n = 4
+        0.3826834323650898, -0.9238795325112867, 0.9238795325112867, -0.3826834323650899,
+        // n = 5
+        0.3090169943749474, -0.8090169943749475, 1, -0.8090169943749475,
+        0.3090169943749475,
+        // n = 6
+        0.25881904510252074, -0.7071067811865475, 0.9659258262890683, -0.9659258262890683,
+        0.7071067811865476, -0.258819045102521,
+        // n = 7
+        0.2225209339563144, -0.6234898018587335, 0.9009688679024191, -1,
+        0.9009688679024191, -0.6234898018587339, 0.2225209339563141,
+        // n = 8
+        0.19509032201612825, -0.5555702330196022, 0.8314696123025452, -0.9807852804032304,
+        0.9807852804032304, -0.8314696123025455, 0.5555702330196022, -0.1950903220161286,
+        // n = 9
+        0.17364817766693033, -0.49999999999999994, 0.766044443118978, -0.9396926207859083,
+        1, -0.9396926207859084, 0.766044443118978, -0.5000000000000003,
+        0.17364817766693028,
+        // n = 10
+        0.15643446504023087, -0.45399049973954675, 0.7071067811865475, -0.8910065241883678,
+        0.9876883405951378, -0.9876883405951378, 0.8910065241883679, -0.7071067811865476,
+        0.45399049973954686, -0.15643446504023098,
+        // n = 11
+        0.14231483827328514, -0.4154150130018864, 0.6548607339452851, -0.8412535328311811,
+        0.9594929736144974, -1, 0.9594929736144974, -0.8412535328311814,
+        0.6548607339452852, -0.4154150130018867, 0.14231483827328517,
+        // n = 12
+        0.13052619222005157, -0.3826834323650898, 0.6087614290087207, -0.7933533402912352,
+        0.9238795325112867, -0.9914448613738104, 0.9914448613738104, -0.9238795325112868,
+        0.7933533402912352, -0.6087614290087209, 0.3826834323650899, -0.130526192220052,
+        // n = 13
+        0.12053668025532305, -0.3546048870425356, 0.5680647467311558, -0.7485107481711011,
+        0.8854560256532099, -0.970941817426052, 1, -0.9709418174260521,
+        0.8854560256532099, -0.7485107481711013, 0.5680647467311558, -0.35460488704253584,
+        0.12053668025532308,
+        // n = 14
+        0.11196447610330786, -0.3302790619551671, 0.5320320765153366, -0.7071067811865475,
+        0.8467241992282841, -0.9438833303083675, 0.9937122098932426, -0.9937122098932426,
+        0.9438833303083675, -0.8467241992282842, 0.7071067811865476, -0.5320320765153367,
+        0.3302790619551672, -0.11196447610330798,
+        // n = 15
+        0.10452846326765346, -0.3090169943749474, 0.49999999999999994, -0.6691306063588582,
+        0.8090169943749475, -0.9135454576426009, 0.9781476007338057, -1,
+        0.9781476007338057, -0.913545457642601, 0.8090169943749475, -0.6691306063588583,
+        0.49999999999999994, -0.3090169943749475, 0.10452846326765329,
+        // n = 16
+        0.0980171403295606, -0.29028467725446233, 0.47139673682599764, -0.6343932841636455,
+        0.773010453362737, -0.8819212643483549, 0.9569403357322089, -0.9951847266721968,
+        0.9951847266721969, -0.9569403357322089, 0.881921264348355, -0.7730104533627371,
+        0.6343932841636455, -0.47139673682599786, 0.2902846772544624, -0.09801714032956083,
+        // n = 17
+        0.09226835946330199, -0.27366299007208283, 0.44573835577653825, -0.6026346363792563,
+        0.7390089172206591, -0.850217135729614, 0.9324722294043558, -0.9829730996839018,
+        1, -0.9829730996839018, 0.9324722294043558, -0.8502171357296143,
+        0.7390089172206591, -0.6026346363792564, 0.44573835577653836, -0.27366299007208306,
+        0.09226835946330185,
+        // n = 18
+        0.08715574274765817, -0.25881904510252074, 0.42261826174069944, -0.573576436351046,
+        0.7071067811865475, -0.8191520442889917, 0.9063077870366499, -0.9659258262890682,
+        0.9961946980917455, -0.9961946980917455, 0.9659258262890683, -0.90630778703665,
+        0.8191520442889917, -0.7071067811865476, 0.5735764363510459, -0.4226182617406995,
+        0.2588190451025206, -0.0871557427476582,
+        // n = 19
+        0.08257934547233232, -0.24548548714079915, 0.4016954246529694, -0.5469481581224268,
+        0.6772815716257411, -0.7891405093963936, 0.8794737512064891, -0.9458172417006346,
+        0.9863613034027224, -1, 0.9863613034027224, -0.9458172417006347,
+        0.8794737512064891, -0.7891405093963936, 0.6772815716257411, -0.5469481581224273,
+        0.4016954246529694, -0.2454854871407995, 0.08257934547233223,
+        // n = 20
+        0.07845909572784494, -0.2334453638559054, 0.3826834323650898, -0.5224985647159488,
+        0.6494480483301837, -0.7604059656000308, 0.8526401643540922, -0.9238795325112867,
+        0.9723699203976766, -0.996917333733128, 0.996917333733128, -0.9723699203976767,
+        0.9238795325112867, -0.8526401643540923, 0.760405965600031, -0.6494480483301838,
+        0.5224985647159489, -0.3826834323650899, 0.23344536385590553, -0.07845909572784507,
+        // n = 21
+        0.07473009358642425, -0.2225209339563144, 0.365341024366395, -0.49999999999999994,
+        0.6234898018587335, -0.7330518718298262, 0.8262387743159949, -0.9009688679024191,
+        0.9555728057861408, -0.9888308262251285, 1, -0.9888308262251285,
+        0.9555728057861407, -0.9009688679024191, 0.8262387743159948, -0.7330518718298265,
+        0.6234898018587336, -0.5000000000000003, 0.3653410243663948, -0.2225209339563145,
+        0.07473009358642467,
+        // n = 22
+        0.07133918319923234, -0.21256528955297666, 0.34946417959909837, -0.47924898672005684,
+        0.5992776665113468, -0.7071067811865475, 0.8005412409243604, -0.8776789895672555,
+        0.9369497249997617, -0.9771468659711595, 0.9974521146102535, -0.9974521146102535,
+        0.9771468659711595, -0.9369497249997617, 0.8776789895672555, -0.8005412409243604,
+        0.7071067811865476, -0.5992776665113471, 0.47924898672005667, -0.34946417959909865,
+        0.2125652895529771, -0.07133918319923242,
+        // n = 23
+        0.06824241336467098, -0.20345601305263378, 0.33487961217098616, -0.46006503773115215,
+        0.5766803221148671, -0.682553143218654, 0.7757112907044198, -0.8544194045464886,
+        0.917211301505453, -0.9629172873477992, 0.9906859460363308, -1,
+        0.9906859460363308, -0.9629172873477994, 0.917211301505453, -0.8544194045464887,
+        0.7757112907044198, -0.6825531432186541, 0.5766803221148672, -0.46006503773115226,
+        0.33487961217098633, -0.20345601305263403, 0.06824241336467085,
+        // n = 24
+        0.06540312923014306, -0.19509032201612825, 0.3214394653031616, -0.44228869021900125,
+        0.5555702330196022, -0.6593458151000688, 0.7518398074789774, -0.8314696123025451,
+        0.8968727415326884, -0.9469301294951056, 0.9807852804032304, -0.9978589232386035,
+        0.9978589232386035, -0.9807852804032304, 0.9469301294951057, -0.8968727415326884,
+        0.8314696123025451, -0.7518398074789774, 0.659345815100069, -0.5555702330196025,
+        0.4422886902190017, -0.32143946530316175, 0.19509032201612816, -0.06540312923014312,
+        // n = 25
+        0.06279051952931337, -0.1873813145857246, 0.3090169943749474, -0.42577929156507266,
+        0.5358267949789967, -0.6374239897486896, 0.7289686274214116, -0.8090169943749473,
+        0.8763066800438637, -0.9297764858882513, 0.9685831611286311, -0.9921147013144778,
+        1, -0.9921147013144779, 0.9685831611286311, -0.9297764858882515,
+        0.8763066800438635, -0.8090169943749475, 0.7289686274214114, -0.6374239897486899,
+        0.535826794978997, -0.4257792915650729, 0.3090169943749475, -0.18738131458572457,
+        0.06279051952931358,
+        // n = 26
+        0.06037849742228605, -0.18025503781390576, 0.297503053855203, -0.41041280545275677,
+        0.5173378141776568, -0.616718872628543, 0.7071067811865476, -0.7871834806090501,
+        0.8557812723014475, -0.9118998459920901, 0.9547208665085456, -0.9836199069471435,
+        0.9981755542233175, -0.9981755542233175, 0.9836199069471436, -0.9547208665085457,
+        0.9118998459920901, -0.8557812723014477, 0.7871834806090502, -0.7071067811865476,
+        0.6167188726285432, -0.517337814177657, 0.41041280545275677, -0.29750305385520304,
+        0.18025503781390592, -0.06037849742228634,
+        // n = 27
+        0.05814482891047583, -0.17364817766693033, 0.2868032327110902, -0.3960797660391568,
+        0.49999999999999994, -0.5971585917027862, 0.6862416378687336, -0.7660444431189779,
+        0.8354878114129364, -0.8936326403234122, 0.9396926207859084, -0.9730448705798238,
+        0.993238357741943, -1, 0.993238357741943, -0.9730448705798238,
+        0.9396926207859084, -0.8936326403234123, 0.8354878114129364, -0.766044443118978,
+        0.6862416378687339, -0.5971585917027862, 0.49999999999999994, -0.3960797660391568,
+        0.2868032327110906, -0.1736481776669307, 0.05814482891047573,
+        // n = 28
+        0.05607044723719179, -0.1675062233047364, 0.27683551142484936, -0.3826834323650898,
+        0.48371888710523975, -0.5786712961798056, 0.666346577952004, -0.7456421648831655,
+        0.8155608689592602, -0.8752234219087537, 0.9238795325112867, -0.9609173219450995,
+        0.9858710185182359, -0.9984268150178166, 0.9984268150178166, -0.9858710185182359,
+        0.9609173219450996, -0.9238795325112867, 0.8752234219087537, -0.8155608689592602,
+        0.7456421648831657, -0.666346577952004, 0.5786712961798058, -0.48371888710523986,
+        0.3826834323650899, -0.27683551142484947, 0.16750622330473652, -0.05607044723719191,
+        // n = 29
+        0.054138908585417526, -0.16178199655276473, 0.2675283385292208, -0.37013815533991434,
+        0.4684084406997901, -0.5611870653623823, 0.6473862847818277, -0.7259954919231307,
+        0.7960930657056438, -0.8568571761675893, 0.907575419670957, -0.9476531711828023,
+        0.9766205557100867, -0.9941379571543596, 1, -0.9941379571543596,
+        0.9766205557100867, -0.9476531711828025, 0.907575419670957, -0.8568571761675894,
+        0.7960930657056439, -0.725995491923131, 0.6473862847818278, -0.5611870653623825,
+        0.4684084406997902, -0.3701381553399144, 0.2675283385292208, -0.16178199655276468,
+        0.054138908585417894,
+        // n = 30
+        0.05233595624294383, -0.15643446504023087, 0.25881904510252074, -0.35836794954530027,
+        0.45399049973954675, -0.544639035015027, 0.6293203910498375, -0.7071067811865475,
+        0.7771459614569709, -0.8386705679454239, 0.8910065241883678, -0.9335804264972017,
+        0.9659258262890683, -0.9876883405951378, 0.9986295347545738, -0.9986295347545738,
+        0.9876883405951378, -0.9659258262890683, 0.9335804264972017, -0.8910065241883679,
+        0.8386705679454243, -0.777145961456971, 0.7071067811865476, -0.6293203910498374,
+        0.5446390350150273, -0.45399049973954686, 0.3583679495453002, -0.2588190451025206,
+        0.15643446504023098, -0.05233595624294381,
+        // n = 31
+        0.05064916883871271, -0.15142777750457667, 0.25065253225872053, -0.3473052528448203,
+        0.4403941515576343, -0.5289640103269624, 0.6121059825476628, -0.6889669190756865,
+        0.758758122692791, -0.8207634412072763, 0.8743466161445821, -0.9189578116202305,
+        0.9541392564000488, -0.9795299412524945, 0.9948693233918952, -1,
+        0.9948693233918952, -0.9795299412524945, 0.9541392564000489, -0.9189578116202307,
+        0.8743466161445822, -0.8207634412072764, 0.758758122692791, -0.6889669190756864,
+        0.612105982547663, -0.5289640103269627, 0.44039415155763456, -0.3473052528448201,
+        0.2506525322587208, -0.15142777750457698, 0.0506491688387126,
+        // n = 32
+        0.049067674327418015, -0.14673047445536175, 0.24298017990326387, -0.33688985339222005,
+        0.4275550934302821, -0.5141027441932217, 0.5956993044924334, -0.6715589548470183,
+        0.7409511253549591, -0.8032075314806448, 0.8577286100002721, -0.9039892931234433,
+        0.9415440651830208, -0.970031253194544, 0.989176509964781, -0.9987954562051724,
+        0.9987954562051724, -0.989176509964781, 0.970031253194544, -0.9415440651830208,
+        0.9039892931234434, -0.8577286100002721, 0.8032075314806449, -0.740951125354959,
+        0.6715589548470186, -0.5956993044924335, 0.5141027441932218, -0.42755509343028203,
+        0.33688985339222033, -0.24298017990326407, 0.1467304744553618, -0.049067674327417966,
+        // n = 33
+        0.04758191582374229, -0.14231483827328514, 0.23575893550942723, -0.3270679633174216,
+        0.4154150130018864, -0.49999999999999994, 0.5800569095711982, -0.654860733945285,
+        0.7237340381050702, -0.7860530947427874, 0.8412535328311812, -0.8888354486549235,
+        0.9283679330160726, -0.9594929736144974, 0.9819286972627067, -0.9954719225730846,
+        1, -0.9954719225730846, 0.9819286972627067, -0.9594929736144975,
+        0.9283679330160727, -0.8888354486549235, 0.8412535328311811, -0.7860530947427874,
+        0.7237340381050703, -0.6548607339452852, 0.5800569095711983, -0.49999999999999994,
+        0.4154150130018867, -0.32706796331742183, 0.23575893550942736, -0.14231483827328517,
+        0.04758191582374269,
+        // n = 34
+        0.04618345864573959, -0.1381563549518822, 0.22895054995013409, -0.3177914195819016,
+        0.4039210048718949, -0.4866044785668562, 0.5651364144225919, -0.6388468056519613,
+        0.7071067811865475, -0.7693339709828788, 0.8249974745983023, -0.8736223906463695,
+        0.914793868488021, -0.9481606475909659, 0.9734380543606929, -0.9904104308752052,
+        0.9989329748023724, -0.9989329748023724, 0.9904104308752052, -0.9734380543606929,
+        0.948160647590966, -0.914793868488021, 0.8736223906463696, -0.8249974745983023,
+        0.769333970982879, -0.7071067811865476, 0.6388468056519613, -0.5651364144225917,
+        0.4866044785668567, -0.4039210048718952, 0.3177914195819017, -0.22895054995013397,
+        0.13815635495188236, -0.046183458645739583,
+        // n = 35
+        0.044864830350514924, -0.13423326581765546, 0.2225209339563144, -0.3090169943749474,
+        0.3930250316539236, -0.4738686624729986, 0.5508969814521025, -0.6234898018587335,
+        0.6910626489868646, -0.7530714660036109, 0.8090169943749475, -0.8584487936018661,
+        0.9009688679024191, -0.9362348706397372, 0.9639628606958532, -0.9839295885986297,
+        0.9959742939952391, -1, 0.9959742939952391, -0.9839295885986297,
+        0.9639628606958534, -0.9362348706397372, 0.9009688679024191, -0.8584487936018662,
+        0.8090169943749475, -0.753071466003611, 0.6910626489868648, -0.6234898018587336,
+        0.5508969814521026, -0.47386866247299875, 0.3930250316539237, -0.3090169943749475,
+        0.2225209339563145, -0.1342332658176556, 0.04486483035051505,
+        // n = 36
+        0.043619387365336, -0.13052619222005157, 0.21643961393810288, -0.3007057995042731,
+        0.3826834323650898, -0.46174861323503386, 0.5372996083468239, -0.6087614290087205,
+        0.6755902076156602, -0.737277336810124, 0.7933533402912352, -0.8433914458128857,
+        0.8870108331782217, -0.9238795325112867, 0.9537169507482269, -0.9762960071199334,
+        0.9914448613738104, -0.9990482215818578, 0.9990482215818578, -0.9914448613738105,
+        0.9762960071199335, -0.9537169507482269, 0.9238795325112867, -0.8870108331782216,
+        0.8433914458128858, -0.7933533402912352, 0.7372773368101241, -0.6755902076156604,
+        0.6087614290087209, -0.5372996083468241, 0.4617486132350339, -0.3826834323650899,
+        0.30070579950427334, -0.21643961393810318, 0.13052619222005157, -0.04361938736533607,
+        // n = 37
+        0.0424412031961483, -0.12701781974687876, 0.2106792699957263, -0.2928227712765504,
+        0.37285647778030856, -0.4502037448176732, 0.5243072835572317, -0.5946331763042866,
+        0.6606747233900815, -0.7219560939545244, 0.7780357543184395, -0.8285096492438421,
+        0.8730141131611882, -0.9112284903881357, 0.9428774454610842, -0.9677329469334988,
+        0.9856159103477085, -0.9963974885425265, 1, -0.9963974885425265,
+        0.9856159103477085, -0.9677329469334989, 0.9428774454610842, -0.9112284903881357,
+        0.8730141131611883, -0.8285096492438422, 0.7780357543184394, -0.7219560939545245,
+        0.6606747233900817, -0.5946331763042868, 0.5243072835572317, -0.4502037448176731,
+        0.37285647778030867, -0.2928227712765507, 0.21067926999572648, -0.1270178197468787,
+        0.042441203196148525,
+        // n = 38
+        0.04132497424881321, -0.12369263126934761, 0.20521534219563428, -0.28533622424910526,
+        0.36350797056382983, -0.4391965888473703, 0.5118850490896011, -0.5810768154019382,
+        0.6462992378609409, -0.7071067811865475, 0.7630840681998065, -0.8138487172701949,
+        0.8590539543698852, -0.8983909818919789, 0.931591088051279, -0.9584274824582526,
+        0.9787168453273545, -0.992320579737045, 0.999145758387301, -0.999145758387301,
+        0.9923205797370451, -0.9787168453273545, 0.9584274824582527, -0.931591088051279,
+        0.898390981891979, -0.8590539543698854, 0.813848717270195, -0.7630840681998065,
+        0.7071067811865476, -0.6462992378609411, 0.5810768154019383, -0.5118850490896009,
+        0.4391965888473704, -0.3635079705638301, 0.2853362242491054, -0.20521534219563412,
+        0.12369263126934808, -0.04132497424881345,
+        // n = 39
+        0.04026594010941514, -0.12053668025532305, 0.20002569377604443, -0.27821746391645263,
+        0.3546048870425356, -0.4286925614030541, 0.5, -0.5680647467311557,
+        0.6324453755953773, -0.6927243535095994, 0.7485107481711011, -0.7994427634035011,
+        0.8451900855437948, -0.8854560256532099, 0.9199794436588242, -0.9485364419471455,
+        0.970941817426052, -0.9870502626379128, 0.99675730813421, -1,
+        0.99675730813421, -0.9870502626379128, 0.970941817426052, -0.9485364419471455,
+        0.9199794436588242, -0.8854560256532099, 0.8451900855437947, -0.7994427634035011,
+        0.7485107481711013, -0.6927243535095995, 0.6324453755953773, -0.5680647467311558,
+        0.5000000000000003, -0.42869256140305445, 0.35460488704253584, -0.2782174639164528,
+        0.2000256937760445, -0.12053668025532308, 0.04026594010941508,
+        // n = 40
+        0.03925981575906861, -0.11753739745783764, 0.19509032201612825, -0.27144044986507426,
+        0.34611705707749296, -0.418659737537428, 0.4886212414969549, -0.5555702330196022,
+        0.619093949309834, -0.6788007455329417, 0.7343225094356856, -0.785316930880745,
+        0.8314696123025452, -0.8724960070727971, 0.9081431738250813, -0.9381913359224842,
+        0.9624552364536473, -0.9807852804032304, 0.9930684569549263, -0.9992290362407229,
+        0.9992290362407229, -0.9930684569549263, 0.9807852804032304, -0.9624552364536473,
+        0.9381913359224843, -0.9081431738250815, 0.8724960070727971, -0.8314696123025451,
+        0.7853169308807452, -0.7343225094356858, 0.6788007455329417, -0.6190939493098339,
+        0.5555702330196025, -0.48862124149695524, 0.41865973753742797, -0.34611705707749285,
+        0.2714404498650746, -0.1950903220161286, 0.11753739745783755, -0.039259815759068506,
+        // n = 41
+        0.038302733690035354, -0.11468342539840043, 0.19039110916466834, -0.26498150219666167,
+        0.33801687840850275, -0.40906863717133984, 0.4777198185122629, -0.5435675500012211,
+        0.6062254109666381, -0.6653257001655654, 0.720521593600787, -0.7714891798219429,
+        0.8179293607667176, -0.8595696069872011, 0.8961655569610556, -0.9275024511020946,
+        0.9533963920549305, -0.973695423877779, 0.9882804237803485, -0.9970658011837404,
+        1, -0.9970658011837404, 0.9882804237803485, -0.9736954238777791,
+        0.9533963920549307, -0.9275024511020947, 0.8961655569610556, -0.8595696069872011,
+        0.8179293607667176, -0.7714891798219431, 0.720521593600787, -0.6653257001655654,
+        0.6062254109666382, -0.5435675500012213, 0.4777198185122628, -0.40906863717134007,
+        0.3380168784085032, -0.26498150219666194, 0.19039110916466848, -0.11468342539840037,
+        0.038302733690035555,
+        // n = 42
+        0.037391194276325625, -0.11196447610330786, 0.18591160716291458, -0.25881904510252074,
+        0.3302790619551671, -0.3998920243197409, 0.467268628273062, -0.5320320765153366,
+        0.5938201855735017, -0.6522874112781211, 0.7071067811865475, -0.7579717231454529,
+        0.8045977797666684, -0.8467241992282841, 0.8841153935046098, -0.9165622558699761,
+        0.9438833303083676, -0.9659258262890682, 0.9825664732332883, -0.9937122098932426,
+        0.9993007047883985, -0.9993007047883986, 0.9937122098932426, -0.9825664732332883,
+        0.9659258262890683, -0.9438833303083676, 0.9165622558699762, -0.8841153935046098,
+        0.8467241992282842, -0.8045977797666685, 0.7579717231454529, -0.7071067811865476,
+        0.6522874112781213, -0.5938201855735016, 0.5320320765153367, -0.4672686282730618,
+        0.39989202431974136, -0.3302790619551672, 0.258819045102521, -0.18591160716291455,
+        0.11196447610330798, -0.037391194276325444,
+        // n = 43
+        0.03652202305765884, -0.10937120837787438, 0.1816368509794364, -0.25293338239168073,
+        0.32288040477144625, -0.39110472049015593, 0.45724232330463854, -0.5209403404879303,
+        0.5818589155579528, -0.6396730215588913, 0.6940741952206338, -0.7447721827437818,
+        0.7914964884292541, -0.8339978178898779, 0.8720494081438076, -0.9054482374931465,
+        0.934016108732548, -0.957600599908406, 0.9760758775559272, -0.9893433680751101,
+        0.9973322836635516, -1, 0.9973322836635516, -0.9893433680751103,
+        0.9760758775559272, -0.9576005999084061, 0.934016108732548, -0.9054482374931465,
+        0.8720494081438077, -0.8339978178898779, 0.7914964884292541, -0.744772182743782,
+        0.6940741952206341, -0.6396730215588915, 0.5818589155579528, -0.5209403404879304,
+        0.45724232330463865, -0.39110472049015627, 0.32288040477144614, -0.25293338239168073,
+        0.18163685097943655, -0.10937120837787415, 0.03652202305765913,
+        // n = 44
+        0.035692333838980454, -0.10689512156511277, 0.17755319625430327, -0.2473065005542155,
+        0.3157995876150249, -0.3826834323650897, 0.44761721006271254, -0.5102700330608996,
+        0.570322636934964, -0.6274690073808519, 0.6814179395938911, -0.7318945221817253,
+        0.7786415380497552, -0.8214207751204915, 0.8600142402077006, -0.8942252698597113,
+        0.9238795325112867, -0.9488259168373196, 0.9689373017815074, -0.9841112043361161,
+        0.9942703017718973, -0.9993628256569916, 0.9993628256569917, -0.9942703017718973,
+        0.9841112043361161, -0.9689373017815074, 0.9488259168373196, -0.9238795325112867,
+        0.8942252698597113, -0.8600142402077006, 0.8214207751204917, -0.778641538049755,
+        0.7318945221817256, -0.6814179395938913, 0.6274690073808519, -0.570322636934964,
+        0.5102700330608997, -0.4476172100627126, 0.3826834323650899, -0.3157995876150251,
+        0.24730650055421569, -0.17755319625430308, 0.10689512156511306, -0.03569233383898078,
+        // n = 45
+        0.03489949670250097, -0.10452846326765346, 0.17364817766693033, -0.24192189559966773,
+        0.3090169943749474, -0.374606593415912, 0.4383711467890774, -0.49999999999999994,
+        0.5591929034707469, -0.6156614753256582, 0.6691306063588582, -0.7193398003386511,
+        0.766044443118978, -0.8090169943749475, 0.848048096156426, -0.8829475928589269,
+        0.9135454576426009, -0.9396926207859083, 0.9612616959383189, -0.9781476007338056,
+        0.9902680687415703, -0.9975640502598242, 1, -0.9975640502598242,
+        0.9902680687415704, -0.9781476007338057, 0.9612616959383189, -0.9396926207859084,
+        0.913545457642601, -0.8829475928589271, 0.8480480961564261, -0.8090169943749475,
+        0.766044443118978, -0.7193398003386514, 0.6691306063588583, -0.6156614753256584,
+        0.5591929034707469, -0.49999999999999994, 0.4383711467890773, -0.37460659341591224,
+        0.3090169943749475, -0.24192189559966773, 0.17364817766693028, -0.10452846326765373,
+        0.0348994967025007,
+        // n = 46
+        0.034141110185967896, -0.10226414894203423, 0.16991038502866668, -0.23676442046644675,
+        0.30251455088107576, -0.36685421881305647, 0.4294834430300819, -0.4901102171780172,
+        0.5484518712493187, -0.6042363895210945, 0.6572036788179725, -0.7071067811865475,
+        0.7537130253273612, -0.7968051114159045, 0.8361821242547108, -0.8716604700327512,
+        0.9030747323245327, -0.9302784433378332, 0.9531447668141608, -0.9715670893979415,
+        0.9854595177171969, -0.9947572788580948, 0.999417022366174, -0.999417022366174,
+        0.9947572788580948, -0.9854595177171969, 0.9715670893979415, -0.9531447668141608,
+        0.9302784433378332, -0.9030747323245327, 0.8716604700327512, -0.8361821242547107,
+        0.7968051114159046, -0.7537130253273613, 0.7071067811865476, -0.6572036788179724,
+        0.6042363895210946, -0.5484518712493187, 0.4901102171780174, -0.4294834430300819,
+        0.3668542188130568, -0.30251455088107543, 0.23676442046644663, -0.16991038502866682,
+        0.1022641489420342, -0.03414111018596811,
+        // n = 47
+        0.03341497700767457, -0.10009569162409834, 0.16632935458313, -0.23182015026752825,
+        0.296275580885634, -0.3594077728375128, 0.420934762428335, -0.4805817551866838,
+        0.5380823531633727, -0.5931797447293551, 0.6456278515588024, -0.6951924276746423,
+        0.7416521056479576, -0.7847993852786609, 0.8244415603417603, -0.8604015792601394,
+        0.8925188358598812, -0.9206498866764288, 0.9446690916079188, -0.9644691750543766,
+        0.9799617050365867, -0.99107748815478, 0.9977668786231532, -1,
+        0.9977668786231532, -0.9910774881547801, 0.9799617050365869, -0.9644691750543766,
+        0.9446690916079189, -0.9206498866764288, 0.8925188358598811, -0.8604015792601393,
+        0.8244415603417605, -0.7847993852786611, 0.7416521056479577, -0.6951924276746424,
+        0.6456278515588025, -0.5931797447293553, 0.5380823531633728, -0.4805817551866839,
+        0.42093476242833505, -0.35940777283751285, 0.296275580885634, -0.2318201502675287,
+        0.16632935458313, -0.10009569162409829, 0.03341497700767493,
+        // n = 48
+        0.03271908282177614, -0.0980171403295606, 0.16289547339458874, -0.2270762630343732,
+        0.29028467725446233, -0.3522500479212335, 0.4127070298043947, -0.4713967368259976,
+        0.528067850650368, -0.5824776968678022, 0.6343932841636455, -0.6835923020228712,
+        0.7298640726978357, -0.773010453362737, 0.8128466845916152, -0.8492021815265789,
+        0.881921264348355, -0.9108638249211758, 0.9359059267573256, -0.9569403357322088,
+        0.9738769792773336, -0.986643332084879, 0.9951847266721969, -0.9994645874763657,
+        0.9994645874763657, -0.9951847266721969, 0.986643332084879, -0.9738769792773336,
+        0.9569403357322089, -0.9359059267573258, 0.9108638249211759, -0.881921264348355,
+        0.8492021815265789, -0.8128466845916152, 0.7730104533627371, -0.7298640726978356,
+        0.6835923020228716, -0.6343932841636455, 0.5824776968678022, -0.5280678506503681,
+        0.47139673682599786, -0.4127070298043946, 0.35225004792123343, -0.2902846772544628,
+        0.22707626303437328, -0.1628954733945889, 0.09801714032956083, -0.032719082821776005,
+        // n = 49
+        0.03205157757165517, -0.09602302590768175, 0.15959989503337924, -0.2225209339563144,
+        0.28452758663103245, -0.34536505442130755, 0.40478334312239383, -0.46253829024083526,
+        0.518392568310525, -0.5721166601221696, 0.6234898018587335, -0.6723008902613168,
+        0.7183493500977276, -0.7614459583691344, 0.8014136218679566, -0.8380881048918406,
+        0.8713187041233893, -0.9009688679024191, 0.9269167573460217, -0.9490557470106686,
+        0.9672948630390293, -0.9815591569910653, 0.9917900138232462, -0.9979453927503363,
+        1, -0.9979453927503363, 0.9917900138232462, -0.9815591569910653,
+        0.9672948630390295, -0.9490557470106686, 0.9269167573460217, -0.9009688679024191,
+        0.8713187041233895, -0.8380881048918407, 0.8014136218679566, -0.7614459583691343,
+        0.7183493500977276, -0.672300890261317, 0.6234898018587336, -0.5721166601221696,
+        0.5183925683105252, -0.46253829024083526, 0.40478334312239406, -0.3453650544213081,
+        0.2845275866310323, -0.2225209339563145, 0.1595998950333796, -0.09602302590768194,
+        0.03205157757165561,
+        // n = 50
+        0.03141075907812829, -0.09410831331851431, 0.15643446504023087, -0.21814324139654254,
+        0.2789911060392293, -0.33873792024529137, 0.3971478906347806, -0.45399049973954675,
+        0.5090414157503713, -0.5620833778521306, 0.6129070536529765, -0.6613118653236518,
+        0.7071067811865475, -0.7501110696304595, 0.7901550123756904, -0.8270805742745617,
+        0.8607420270039436, -0.8910065241883678, 0.9177546256839811, -0.9408807689542255,
+        0.960293685676943, -0.9759167619387473, 0.9876883405951378, -0.99556196460308,
+        0.9995065603657316, -0.9995065603657316, 0.99556196460308, -0.9876883405951378,
+        0.9759167619387474, -0.9602936856769431, 0.9408807689542255, -0.9177546256839811,
+        0.8910065241883679, -0.8607420270039436, 0.8270805742745617, -0.7901550123756903,
+        0.7501110696304597, -0.7071067811865476, 0.6613118653236518, -0.6129070536529764,
+        0.5620833778521308, -0.5090414157503711, 0.45399049973954686, -0.39714789063478106,
+        0.3387379202452913, -0.27899110603922955, 0.21814324139654276, -0.15643446504023098,
+        0.09410831331851435, -0.031410759078128236,
+        // n = 51
+        0.030795058556170353, -0.09226835946330199, 0.15339165487868536, -0.21393308320649743,
+        0.27366299007208283, -0.3323547994796596, 0.3897858732926794, -0.4457383557765382,
+        0.5, -0.5523649729605058, 0.6026346363792564, -0.650618300204242,
+        0.6961339459629267, -0.7390089172206591, 0.7790805745256705, -0.8161969123562216,
+        0.8502171357296141, -0.8810121942857845, 0.9084652718195237, -0.9324722294043558,
+        0.9529420004271565, -0.9697969360350095, 0.9829730996839018, -0.9924205096719357,
+        0.9981033287370441, -1, 0.9981033287370441, -0.9924205096719357,
+        0.9829730996839018, -0.9697969360350095, 0.9529420004271566, -0.9324722294043558,
+        0.9084652718195236, -0.8810121942857846, 0.8502171357296141, -0.8161969123562217,
+        0.7790805745256706, -0.7390089172206591, 0.6961339459629267, -0.650618300204242,
+        0.6026346363792564, -0.5523649729605056, 0.49999999999999994, -0.44573835577653836,
+        0.3897858732926792, -0.3323547994796597, 0.27366299007208306, -0.2139330832064974,
+        0.1533916548786855, -0.09226835946330185, 0.030795058556170388,
+        // n = 52
+        0.030203027800888845, -0.09049887582963784, 0.150464503274783, -0.20988110206484756,
+        0.26853186747437674, -0.32620278922086926, 0.3826834323650898, -0.4377677051653404,
+        0.49125461108387736, -0.5429489822014786, 0.5926621913640169, -0.6402128404624879,
+        0.6854274223350397, -0.7281409538757884, 0.7681975780402805, -0.8054511325509459,
+        0.8397656832273979, -0.8710160199955155, 0.899088113765426, -0.9238795325112867,
+        0.9452998150346402, -0.9632708010475163, 0.9777269163708469, -0.9886154122075342,
+        0.995896557617091, -0.9995437844895334, 0.9995437844895334, -0.995896557617091,
+        0.9886154122075342, -0.977726916370847, 0.9632708010475163, -0.9452998150346402,
+        0.9238795325112867, -0.899088113765426, 0.8710160199955157, -0.8397656832273979,
+        0.8054511325509461, -0.7681975780402805, 0.7281409538757884, -0.6854274223350396,
+        0.640212840462488, -0.5926621913640168, 0.5429489822014788, -0.49125461108387775,
+        0.4377677051653403, -0.3826834323650899, 0.3262027892208697, -0.26853186747437696,
+        0.2098811020648476, -0.1504645032747829, 0.09049887582963798, -0.030203027800889275,
+        // n = 53
+        0.02963332782255974, -0.08879589532293479, 0.14764656400248122, -0.20597861874109838,
+        0.2635871660690676, -0.3202698538628376, 0.37582758211423817, -0.43006520227652045,
+        0.4827922027307449, -0.5338233779647906, 0.5829794791144721, -0.630087843581711,
+        0.6749830015182104, -0.717507257044331, 0.75751124216162, -0.7948544414133532,
+        0.8294056854502018, -0.8610436117673554, 0.8896570909947472, -0.9151456172430183,
+        0.9374196611341208, -0.9564009842765224, 0.9720229140804107, -0.9842305779475968,
+        0.9929810960135169, -0.9982437317643215, 1, -0.9982437317643214,
+        0.992981096013517, -0.9842305779475968, 0.9720229140804107, -0.9564009842765224,
+        0.9374196611341209, -0.9151456172430186, 0.8896570909947473, -0.8610436117673554,
+        0.8294056854502019, -0.7948544414133533, 0.7575112421616202, -0.7175072570443312,
+        0.6749830015182108, -0.6300878435817109, 0.582979479114472, -0.5338233779647908,
+        0.4827922027307449, -0.43006520227652073, 0.3758275821142383, -0.3202698538628376,
+        0.2635871660690679, -0.20597861874109843, 0.14764656400248113, -0.08879589532293496,
+        0.029633327822559726,
+        // n = 54
+        0.029084718743111405, -0.08715574274765817, 0.14493185930724672, -0.20221757233203794,
+        0.25881904510252074, -0.31454475615161365, 0.3692061473126845, -0.4226182617406994,
+        0.4746003697476404, -0.5249765803345602, 0.5735764363510462, -0.62023549126826,
+        0.6647958656139378, -0.7071067811865475, 0.7470250712409959, -0.7844156649195757,
+        0.8191520442889918, -0.8511166724369997, 0.8802013911801111, -0.9063077870366499,
+        0.9293475242268224, -0.9492426435730339, 0.9659258262890683, -0.9793406217655515,
+        0.9894416385809445, -0.9961946980917455, 0.9995769500822006, -0.9995769500822006,
+        0.9961946980917455, -0.9894416385809446, 0.9793406217655515, -0.9659258262890683,
+        0.949242643573034, -0.9293475242268225, 0.90630778703665, -0.8802013911801111,
+        0.8511166724369997, -0.819152044288992, 0.7844156649195758, -0.7470250712409959,
+        0.7071067811865476, -0.6647958656139378, 0.6202354912682602, -0.5735764363510464,
+        0.5249765803345602, -0.47460036974764064, 0.4226182617406999, -0.3692061473126843,
+        0.3145447561516137, -0.2588190451025206, 0.20221757233203796, -0.14493185930724697,
+        0.0871557427476582, -0.029084718743111644,
+        // n = 55
+        0.02855605079369625, -0.08557500847883974, 0.14231483827328514, -0.19859046664574545,
+        0.25421833419348694, -0.30901699437494734, 0.36280770535064105, -0.4154150130018864,
+        0.4666673232256737, -0.5163974616389618, 0.5644432188667692, -0.6106478796354381,
+        0.6548607339452851, -0.6969375686552933, 0.7367411378764049, -0.7741416106390824,
+        0.8090169943749475, -0.8412535328311811, 0.8707460771197771, -0.8973984286913583,
+        0.9211236531148501, -0.9418443636395247, 0.9594929736144974, -0.9740119169423335,
+        0.985353835847693, -0.9934817353485502, 0.9983691039261356, -1,
+        0.9983691039261356, -0.9934817353485502, 0.985353835847693, -0.9740119169423335,
+        0.9594929736144975, -0.9418443636395247, 0.9211236531148501, -0.8973984286913584,
+        0.8707460771197774, -0.8412535328311811, 0.8090169943749475, -0.7741416106390826,
+        0.7367411378764052, -0.6969375686552934, 0.6548607339452852, -0.6106478796354383,
+        0.5644432188667692, -0.5163974616389619, 0.46666732322567384, -0.4154150130018863,
+        0.362807705350641, -0.3090169943749471, 0.25421833419348716, -0.1985904666457458,
+        0.14231483827328517, -0.0855750084788399, 0.028556050793696535,
+        // n = 56
+        0.028046256275868958, -0.08405052492924754, 0.13979033953549946, -0.19509032201612825,
+        0.24977647816722684, -0.3036767451096147, 0.35662153266231306, -0.40844425693599606,
+        0.4589818644675377, -0.5080753452465294, 0.5555702330196022, -0.6013170912984058,
+        0.6451719835420876, -0.6869969260349016, 0.726660322034027, -0.7640373758216075,
+        0.799010485358249, -0.8314696123025452, 0.861312628232409, -0.8884456359788723,
+        0.9127832650613189, -0.9342489402945998, 0.9527751227228963, -0.9683035221222615,
+        0.9807852804032304, -0.9901811253364455, 0.9964614941176192, -0.9996066263830529,
+        0.9996066263830529, -0.9964614941176192, 0.9901811253364456, -0.9807852804032304,
+        0.9683035221222615, -0.9527751227228963, 0.9342489402945999, -0.9127832650613189,
+        0.8884456359788724, -0.8613126282324091, 0.8314696123025451, -0.7990104853582489,
+        0.7640373758216077, -0.726660322034027, 0.6869969260349016, -0.6451719835420878,
+        0.6013170912984057, -0.5555702330196025, 0.5080753452465298, -0.4589818644675376,
+        0.40844425693599645, -0.3566215326623129, 0.3036767451096146, -0.24977647816722717,
+        0.19509032201612816, -0.13979033953549982, 0.08405052492924789, -0.028046256275868858,
+        // n = 57
+        0.027554342368161996, -0.08257934547233232, 0.13735355781840816, -0.1917106319237384,
+        0.24548548714079915, -0.2985148110016945, 0.3506375551927544, -0.40169542465296937,
+        0.45153335831088937, -0.49999999999999994, 0.5469481581224269, -0.59223525266498,
+        0.635723748209968, -0.6772815716257411, 0.7167825131684512, -0.7541066097768963,
+        0.7891405093963936, -0.8217778152252451, 0.8519194088383271, -0.879473751206489,
+        0.9043571606975774, -0.9264940672148018, 0.9458172417006346, -0.9622680003092504,
+        0.9757963826274356, -0.9863613034027223, 0.9939306773179495, -0.9984815164333162,
+        1, -0.9984815164333162, 0.9939306773179495, -0.9863613034027224,
+        0.9757963826274357, -0.9622680003092504, 0.9458172417006346, -0.9264940672148018,
+        0.9043571606975775, -0.8794737512064891, 0.8519194088383271, -0.8217778152252452,
+        0.7891405093963936, -0.7541066097768963, 0.7167825131684512, -0.6772815716257414,
+        0.635723748209968, -0.59223525266498, 0.5469481581224273, -0.49999999999999994,
+        0.4515333583108897, -0.4016954246529694, 0.3506375551927543, -0.2985148110016949,
+        0.24548548714079907, -0.19171063192373877, 0.13735355781840852, -0.08257934547233223,
+        0.027554342368162343,
+        // n = 58
+        0.027079384676134494, -0.08115872552743128, 0.1350000138532901, -0.18844532387831828,
+        0.24133789129970562, -0.2935225731039347, 0.34484630262797045, -0.39515853853015537,
+        0.44431170635390355, -0.4921616313890073, 0.5385679615609044, -0.5833945791074939,
+        0.6265099998359867, -0.6677877587886956, 0.7071067811865475, -0.7443517375622702,
+        0.7794133820415916, -0.8121888727802111, 0.8425820736166492, -0.870503836056172,
+        0.8958722607586879, -0.9186129377636217, 0.9386591647471505, -0.9559521426716115,
+        0.9704411482532114, -0.982083682742156, 0.9908455965788068, -0.9967011895602228,
+        0.999633286223284, -0.999633286223284, 0.9967011895602228, -0.9908455965788068,
+        0.9820836827421561, -0.9704411482532115, 0.9559521426716117, -0.9386591647471505,
+        0.9186129377636219, -0.8958722607586881, 0.870503836056172, -0.8425820736166492,
+        0.8121888727802113, -0.7794133820415914, 0.7443517375622702, -0.7071067811865476,
+        0.6677877587886955, -0.6265099998359867, 0.5833945791074941, -0.5385679615609044,
+        0.49216163138900754, -0.44431170635390355, 0.3951585385301556, -0.3448463026279708,
+        0.29352257310393487, -0.24133789129970595, 0.1884453238783188, -0.13500001385328994,
+        0.08115872552743131, -0.027079384676134296,
+        // n = 59
+        0.026620521437774766, -0.07978610555308308, 0.13272552728372197, -0.18528872408711433,
+        0.23732669987111482, -0.288691947339621, 0.3392388661180303, -0.38882417547332065,
+        0.4373073204588554, -0.48455087033265015, 0.5304209081197424, -0.5747874102144068,
+        0.6175246149461919, -0.6585113790650385, 0.6976315211349847, -0.7347741508630672,
+        0.7698339834299063, -0.8027116379309636, 0.833313919082515, -0.8615540813938061,
+        0.8873520750565715, -0.9106347728549131, 0.9313361774523384, -0.9493976084683813,
+        0.9647678688145159, -0.9774033898178666, 0.9872683547213446, -0.9943348002101371,
+        0.9985826956767619, -1, 0.9985826956767619, -0.9943348002101371,
+        0.9872683547213446, -0.9774033898178667, 0.9647678688145159, -0.9493976084683813,
+        0.9313361774523385, -0.9106347728549132, 0.8873520750565715, -0.8615540813938061,
+        0.8333139190825152, -0.8027116379309636, 0.7698339834299062, -0.7347741508630675,
+        0.6976315211349847, -0.6585113790650386, 0.6175246149461923, -0.5747874102144069,
+        0.5304209081197425, -0.48455087033265026, 0.4373073204588555, -0.3888241754733208,
+        0.33923886611803006, -0.2886919473396212, 0.23732669987111504, -0.18528872408711414,
+        0.13272552728372225, -0.07978610555308295, 0.026620521437774654,
+        // n = 60
+        0.02617694830787315, -0.07845909572784494, 0.13052619222005157, -0.18223552549214747,
+        0.2334453638559054, -0.2840153447039226, 0.33380685923377096, -0.3826834323650897,
+        0.43051109680829514, -0.4771587602596084, 0.5224985647159488, -0.5664062369248328,
+        0.6087614290087207, -0.6494480483301837, 0.688354575693754, -0.7253743710122875,
+        0.7604059656000309, -0.7933533402912352, 0.8241261886220157, -0.8526401643540922,
+        0.8788171126619653, -0.9025852843498605, 0.9238795325112867, -0.9426414910921784,
+        0.958819734868193, -0.9723699203976766, 0.9832549075639546, -0.9914448613738104,
+        0.996917333733128, -0.9996573249755573, 0.9996573249755573, -0.996917333733128,
+        0.9914448613738105, -0.9832549075639546, 0.9723699203976767, -0.958819734868193,
+        0.9426414910921784, -0.9238795325112867, 0.9025852843498607, -0.8788171126619654,
+        0.8526401643540923, -0.8241261886220156, 0.7933533402912352, -0.760405965600031,
+        0.7253743710122875, -0.6883545756937539, 0.6494480483301838, -0.6087614290087204,
+        0.5664062369248332, -0.5224985647159489, 0.4771587602596086, -0.4305110968082955,
+        0.3826834323650899, -0.3338068592337712, 0.28401534470392303, -0.23344536385590553,
+        0.18223552549214772, -0.13052619222005157, 0.07845909572784507, -0.026176948307873423,
+        // n = 61
+        0.025747913654988554, -0.07717546212664635, 0.12839835514655096, -0.17928075881073566,
+        0.22968774213179555, -0.27948563485160943, 0.32854238191083474, -0.37672789363518505,
+        0.4239143907098607, -0.46997674302732, 0.5147928015098308, -0.5582437220268647,
+        0.6002142805483682, -0.6405931786981751, 0.6792733388972931, -0.7161521883143933,
+        0.7511319308705199, -0.7841198065767104, 0.8150283375168114, -0.8437755598231856,
+        0.8702852410301551, -0.8944870822287956, 0.9163169044870048, -0.9357168190404936,
+        0.9526353808033825, -0.9670277247913204, 0.9788556850953578, -0.9880878960910772,
+        0.9946998756145891, -0.9986740898848305, 1, -0.9986740898848305,
+        0.9946998756145891, -0.9880878960910772, 0.9788556850953578, -0.9670277247913204,
+        0.9526353808033826, -0.9357168190404938, 0.9163169044870048, -0.8944870822287955,
+        0.8702852410301553, -0.8437755598231858, 0.8150283375168114, -0.7841198065767107,
+        0.7511319308705198, -0.7161521883143935, 0.6792733388972932, -0.6405931786981752,
+        0.6002142805483682, -0.5582437220268647, 0.514792801509831, -0.46997674302732023,
+        0.4239143907098608, -0.37672789363518516, 0.3285423819108351, -0.2794856348516093,
+        0.2296877421317958, -0.1792807588107354, 0.12839835514655104, -0.07717546212664682,
+        0.025747913654988498,
+        // n = 62
+        0.025332714313187926, -0.07593311422524629, 0.1263385949221292, -0.17641976625780845,
+        0.22604807058373483, -0.27509611275447804, 0.3234379871492381, -0.3709496008697677,
+        0.41750899228506316, -0.46299664410512076, 0.5072957901801074, -0.5502927152373913,
+        0.5918770467870172, -0.631942038446304, 0.6703848439562785, -0.7071067811865475,
+        0.7420135854509108, -0.7750156514834587, 0.806028263454005, -0.8349718124324074,
+        0.8617720007435496, -0.8863600326884082, 0.9086727911416249, -0.9286529995722622,
+        0.9462493690718368, -0.9614167300122125, 0.974116147995387, -0.9843150237975342,
+        0.991987177050743, -0.9971129134476474, 0.9996790752964305, -0.9996790752964305,
+        0.9971129134476475, -0.991987177050743, 0.9843150237975341, -0.974116147995387,
+        0.9614167300122125, -0.9462493690718369, 0.9286529995722622, -0.9086727911416248,
+        0.8863600326884082, -0.8617720007435495, 0.8349718124324074, -0.8060282634540052,
+        0.7750156514834589, -0.742013585450911, 0.7071067811865476, -0.6703848439562784,
+        0.631942038446304, -0.5918770467870171, 0.5502927152373914, -0.5072957901801076,
+        0.46299664410512087, -0.41750899228506305, 0.3709496008697679, -0.32343798714923805,
+        0.27509611275447826, -0.22604807058373483, 0.17641976625780864, -0.12633859492212962,
+        0.07593311422524607, -0.025332714313187933,
+        // n = 63
+        0.024930691738072875, -0.07473009358642425, 0.12434370464748516, -0.17364817766693033,
+        0.2225209339563144, -0.2708404681430051, 0.31848665025168443, -0.365341024366395,
+        0.4112871031306115, -0.45621065735316296, 0.5, -0.5425462638657593,
+        0.5837436722347898, -0.6234898018587335, 0.6616858375968594, -0.6982368180860727,
+        0.7330518718298263, -0.766044443118978, 0.7971325072229225, -0.8262387743159948,
+        0.8532908816321555, -0.8782215733702285, 0.9009688679024191, -0.9214762118704076,
+        0.9396926207859083, -0.9555728057861407, 0.969077286229078, -0.9801724878485438,
+        0.9888308262251285, -0.9950307753654014, 0.9987569212189223, -1,
+        0.9987569212189223, -0.9950307753654014, 0.9888308262251285, -0.9801724878485438,
+        0.969077286229078, -0.9555728057861407, 0.9396926207859084, -0.9214762118704076,
+        0.9009688679024191, -0.8782215733702284, 0.8532908816321557, -0.8262387743159951,
+        0.7971325072229223, -0.766044443118978, 0.7330518718298265, -0.6982368180860729,
+        0.6616858375968596, -0.6234898018587336, 0.5837436722347897, -0.5425462638657595,
+        0.49999999999999994, -0.45621065735316313, 0.41128710313061195, -0.3653410243663948,
+        0.3184866502516845, -0.270840468143005, 0.2225209339563145, -0.1736481776669307,
+        0.12434370464748534, -0.07473009358642423, 0.024930691738073097,
+        // n = 64
+        0.024541228522912288, -0.07356456359966743, 0.1224106751992162, -0.17096188876030122,
+        0.2191012401568698, -0.26671275747489837, 0.3136817403988915, -0.3598950365349881,
+        0.40524131400498986, -0.44961132965460654, 0.49289819222978404, -0.5349976198870972,
+        0.5758081914178453, -0.6152315905806268, 0.6531728429537768, -0.6895405447370668,
+        0.7242470829514669, -0.7572088465064845, 0.7883464276266062, -0.8175848131515837,
+        0.844853565249707, -0.8700869911087113, 0.8932243011955153, -0.9142097557035307,
+        0.9329927988347388, -0.9495281805930367, 0.9637760657954398, -0.9757021300385286,
+        0.9852776423889412, -0.99247953459871, 0.9972904566786902, -0.9996988186962042,
+        0.9996988186962042, -0.9972904566786902, 0.99247953459871, -0.9852776423889412,
+        0.9757021300385286, -0.9637760657954398, 0.9495281805930367, -0.9329927988347388,
+        0.9142097557035307, -0.8932243011955152, 0.8700869911087115, -0.8448535652497072,
+        0.8175848131515837, -0.7883464276266063, 0.7572088465064847, -0.7242470829514669,
+        0.689540544737067, -0.6531728429537766, 0.6152315905806269, -0.5758081914178454,
+        0.5349976198870972, -0.49289819222978415, 0.4496113296546069, -0.4052413140049899,
+        0.35989503653498833, -0.3136817403988914, 0.2667127574748985, -0.21910124015687005,
+        0.17096188876030122, -0.12241067519921635, 0.07356456359966773, -0.024541228522912326,
+    };
+
+    /// <summary>cos(kπ/(n-1)), k = n-1..0: Chebyshev-Lobatto nodes on [-1, 1], ascending.</summary>
+    public static ReadOnlySpan<double> LobattoCosines => LobattoCosinesTable;
+
+    private static readonly double[] LobattoCosinesTable =
+    {
+        // n = 2
+        -1, 1,
+        // n = 3
+        -1, 6.123233995736766E-17, 1,
+        // n = 4
+        -1, -0.4999999999999998, 0.5000000000000001, 1,
+        // n = 5
+        -1, -0.7071067811865475, 6.123233995736766E-17, 0.7071067811865476,
+        1,
+        // n = 6
+        -1, -0.8090169943749473, -0.30901699437494734, 0.30901699437494745,
+        0.8090169943749475, 1,
+        // n = 7
+        -1, -0.8660254037844387, -0.4999999999999998, 6.123233995736766E-17,
+        0.5000000000000001, 0.8660254037844387, 1,
+        // n = 8
+        -1, -0.900968867902419, -0.6234898018587335, -0.22252093395631434,
+        0.22252093395631445, 0.6234898018587336, 0.9009688679024191, 1,
+        // n = 9
+        -1, -0.9238795325112867, -0.7071067811865475, -0.3826834323650897,
+        6.123233995736766E-17, 0.38268343236508984, 0.7071067811865476, 0.9238795325112867,
+        1,
+        // n = 10
+        -1, -0.9396926207859083, -0.7660444431189779, -0.4999999999999998,
+        -0.1736481776669303, 0.17364817766693041, 0.5000000000000001, 0.766044443118978,
+        0.9396926207859084, 1,
+        // n = 11
+        -1, -0.9510565162951535, -0.8090169943749473, -0.587785252292473,
+        -0.30901699437494734, 6.123233995736766E-17, 0.30901699437494745, 0.5877852522924731,
+        0.8090169943749475, 0.9510565162951535, 1,
+        // n = 12
+        -1, -0.9594929736144974, -0.8412535328311811, -0.654860733945285,
+        -0.4154150130018863, -0.142314838273285, 0.14231483827328512, 0.41541501300188644,
+        0.6548607339452851, 0.8412535328311812, 0.9594929736144974, 1,
+        // n = 13
+        -1, -0.9659258262890682, -0.8660254037844387, -0.7071067811865475,
+        -0.4999999999999998, -0.25881904510252063, 6.123233995736766E-17, 0.25881904510252074,
+        0.5000000000000001, 0.7071067811865476, 0.8660254037844387, 0.9659258262890683,
+        1,
+        // n = 14
+        -1, -0.970941817426052, -0.8854560256532096, -0.7485107481711012,
+        -0.5680647467311557, -0.35460488704253545, -0.12053668025532288, 0.120536680255323,
+        0.35460488704253557, 0.5680647467311559, 0.7485107481711011, 0.8854560256532099,
+        0.970941817426052, 1,
+        // n = 15
+        -1, -0.9749279121818237, -0.900968867902419, -0.7818314824680295,
+        -0.6234898018587335, -0.43388373911755806, -0.22252093395631434, 6.123233995736766E-17,
+        0.22252093395631445, 0.4338837391175582, 0.6234898018587336, 0.7818314824680298,
+        0.9009688679024191, 0.9749279121818236, 1,
+        // n = 16
+        -1, -0.9781476007338057, -0.913545457642601, -0.8090169943749473,
+        -0.6691306063588579, -0.4999999999999998, -0.30901699437494734, -0.10452846326765333,
+        0.10452846326765346, 0.30901699437494745, 0.5000000000000001, 0.6691306063588582,
+        0.8090169943749475, 0.9135454576426009, 0.9781476007338057, 1,
+        // n = 17
+        -1, -0.9807852804032304, -0.9238795325112867, -0.8314696123025453,
+        -0.7071067811865475, -0.555570233019602, -0.3826834323650897, -0.1950903220161282,
+        6.123233995736766E-17, 0.19509032201612833, 0.38268343236508984, 0.5555702330196023,
+        0.7071067811865476, 0.8314696123025452, 0.9238795325112867, 0.9807852804032304,
+        1,
+        // n = 18
+        -1, -0.9829730996839018, -0.9324722294043557, -0.850217135729614,
+        -0.7390089172206593, -0.6026346363792563, -0.4457383557765378, -0.2736629900720829,
+        -0.09226835946330189, 0.09226835946330202, 0.273662990072083, 0.4457383557765383,
+        0.6026346363792564, 0.7390089172206591, 0.8502171357296142, 0.9324722294043558,
+        0.9829730996839018, 1,
+        // n = 19
+        -1, -0.984807753012208, -0.9396926207859083, -0.8660254037844385,
+        -0.7660444431189779, -0.6427876096865394, -0.4999999999999998, -0.3420201433256685,
+        -0.1736481776669303, 6.123233995736766E-17, 0.17364817766693041, 0.3420201433256688,
+        0.5000000000000001, 0.6427876096865394, 0.766044443118978, 0.8660254037844387,
+        0.9396926207859084, 0.984807753012208, 1,
+        // n = 20
+        -1, -0.9863613034027223, -0.9458172417006347, -0.879473751206489,
+        -0.7891405093963935, -0.6772815716257409, -0.546948158122427, -0.4016954246529694,
+        -0.2454854871407989, -0.08257934547233227, 0.0825793454723324, 0.24548548714079924,
+        0.40169542465296953, 0.5469481581224269, 0.6772815716257411, 0.7891405093963936,
+        0.8794737512064891, 0.9458172417006346, 0.9863613034027223, 1,
+        // n = 21
+        -1, -0.9876883405951377, -0.9510565162951535, -0.8910065241883678,
+        -0.8090169943749473, -0.7071067811865475, -0.587785252292473, -0.4539904997395467,
+        -0.30901699437494734, -0.1564344650402306, 6.123233995736766E-17, 0.15643446504023092,
+        0.30901699437494745, 0.4539904997395468, 0.5877852522924731, 0.7071067811865476,
+        0.8090169943749475, 0.8910065241883679, 0.9510565162951535, 0.9876883405951378,
+        1,
+        // n = 22
+        -1, -0.9888308262251285, -0.9555728057861406, -0.900968867902419,
+        -0.826238774315995, -0.7330518718298263, -0.6234898018587335, -0.4999999999999998,
+        -0.3653410243663951, -0.22252093395631434, -0.07473009358642405, 0.07473009358642439,
+        0.22252093395631445, 0.365341024366395, 0.5000000000000001, 0.6234898018587336,
+        0.7330518718298263, 0.8262387743159949, 0.9009688679024191, 0.9555728057861407,
+        0.9888308262251285, 1,
+        // n = 23
+        -1, -0.9898214418809327, -0.9594929736144974, -0.9096319953545182,
+        -0.8412535328311811, -0.7557495743542582, -0.654860733945285, -0.5406408174555972,
+        -0.4154150130018863, -0.28173255684142967, -0.142314838273285, 2.83276944882399E-16,
+        0.14231483827328512, 0.2817325568414298, 0.41541501300188644, 0.5406408174555977,
+        0.6548607339452851, 0.7557495743542583, 0.8412535328311812, 0.9096319953545184,
+        0.9594929736144974, 0.9898214418809327, 1,
+        // n = 24
+        -1, -0.9906859460363306, -0.9629172873477992, -0.917211301505453,
+        -0.8544194045464883, -0.7757112907044197, -0.6825531432186542, -0.5766803221148671,
+        -0.4600650377311521, -0.33487961217098616, -0.20345601305263386, -0.06824241336467088,
+        0.06824241336467123, 0.20345601305263375, 0.3348796121709863, 0.4600650377311522,
+        0.5766803221148672, 0.6825531432186541, 0.7757112907044198, 0.8544194045464886,
+        0.917211301505453, 0.9629172873477992, 0.9906859460363308, 1,
+        // n = 25
+        -1, -0.9914448613738104, -0.9659258262890682, -0.9238795325112867,
+        -0.8660254037844387, -0.793353340291235, -0.7071067811865475, -0.6087614290087207,
+        -0.4999999999999998, -0.3826834323650895, -0.25881904510252063, -0.1305261922200516,
+        6.123233995736766E-17, 0.1305261922200517, 0.25881904510252074, 0.38268343236508984,
+        0.5000000000000001, 0.6087614290087207, 0.7071067811865476, 0.7933533402912352,
+        0.8660254037844387, 0.9238795325112867, 0.9659258262890683, 0.9914448613738104,
+        1,
+        // n = 26
+        -1, -0.9921147013144778, -0.968583161128631, -0.9297764858882513,
+        -0.8763066800438636, -0.8090169943749473, -0.7289686274214113, -0.6374239897486897,
+        -0.5358267949789969, -0.4257792915650727, -0.3090169943749471, -0.1873813145857246,
+        -0.0627905195293134, 0.06279051952931353, 0.18738131458572474, 0.30901699437494745,
+        0.42577929156507266, 0.5358267949789965, 0.6374239897486897, 0.7289686274214116,
+        0.8090169943749475, 0.8763066800438636, 0.9297764858882515, 0.9685831611286311,
+        0.9921147013144779, 1,
+        // n = 27
+        -1, -0.992708874098054, -0.970941817426052, -0.9350162426854147,
+        -0.8854560256532096, -0.8229838658936564, -0.7485107481711012, -0.663122658240795,
+        -0.5680647467311557, -0.4647231720437685, -0.35460488704253545, -0.2393156642875575,
+        -0.12053668025532288, -1.6081226496766364E-16, 0.120536680255323, 0.23931566428755804,
+        0.35460488704253557, 0.4647231720437686, 0.5680647467311559, 0.6631226582407953,
+        0.7485107481711011, 0.8229838658936564, 0.8854560256532099, 0.9350162426854148,
+        0.970941817426052, 0.992708874098054, 1,
+        // n = 28
+        -1, -0.993238357741943, -0.9730448705798238, -0.9396926207859083,
+        -0.8936326403234122, -0.8354878114129363, -0.7660444431189782, -0.6862416378687335,
+        -0.597158591702786, -0.4999999999999998, -0.3960797660391568, -0.2868032327110902,
+        -0.17364817766693008, -0.058144828910475774, 0.05814482891047568, 0.17364817766693041,
+        0.2868032327110903, 0.3960797660391569, 0.5000000000000001, 0.5971585917027862,
+        0.6862416378687336, 0.766044443118978, 0.8354878114129365, 0.8936326403234123,
+        0.9396926207859084, 0.9730448705798238, 0.993238357741943, 1,
+        // n = 29
+        -1, -0.9937122098932426, -0.9749279121818237, -0.9438833303083676,
+        -0.900968867902419, -0.8467241992282841, -0.7818314824680295, -0.7071067811865475,
+        -0.6234898018587335, -0.5320320765153365, -0.43388373911755806, -0.3302790619551672,
+        -0.22252093395631434, -0.11196447610330758, 6.123233995736766E-17, 0.11196447610330769,
+        0.22252093395631445, 0.3302790619551673, 0.4338837391175582, 0.5320320765153366,
+        0.6234898018587336, 0.7071067811865476, 0.7818314824680298, 0.8467241992282841,
+        0.9009688679024191, 0.9438833303083676, 0.9749279121818236, 0.9937122098932426,
+        1,
+        // n = 30
+        -1, -0.9941379571543596, -0.9766205557100867, -0.9476531711828025,
+        -0.9075754196709571, -0.8568571761675893, -0.7960930657056435, -0.7259954919231306,
+        -0.6473862847818276, -0.5611870653623823, -0.46840844069979004, -0.37013815533991423,
+        -0.26752833852922087, -0.16178199655276473, -0.05413890858541726, 0.05413890858541761,
+        0.16178199655276462, 0.26752833852922075, 0.37013815533991457, 0.46840844069979015,
+        0.5611870653623824, 0.6473862847818277, 0.7259954919231308, 0.7960930657056438,
+        0.8568571761675893, 0.907575419670957, 0.9476531711828025, 0.9766205557100867,
+        0.9941379571543596, 1,
+        // n = 31
+        -1, -0.9945218953682734, -0.9781476007338057, -0.9510565162951535,
+        -0.913545457642601, -0.8660254037844387, -0.8090169943749473, -0.743144825477394,
+        -0.6691306063588579, -0.587785252292473, -0.4999999999999998, -0.40673664307580004,
+        -0.30901699437494734, -0.20791169081775934, -0.10452846326765333, 2.83276944882399E-16,
+        0.10452846326765346, 0.20791169081775923, 0.30901699437494745, 0.4067366430758004,
+        0.5000000000000001, 0.5877852522924731, 0.6691306063588582, 0.7431448254773942,
+        0.8090169943749475, 0.8660254037844387, 0.9135454576426009, 0.9510565162951535,
+        0.9781476007338057, 0.9945218953682733, 1,
+        // n = 32
+        -1, -0.994869323391895, -0.9795299412524945, -0.9541392564000488,
+        -0.9189578116202306, -0.8743466161445821, -0.8207634412072763, -0.7587581226927909,
+        -0.6889669190756863, -0.6121059825476626, -0.5289640103269625, -0.4403941515576344,
+        -0.34730525284482017, -0.2506525322587204, -0.15142777750457678, -0.05064916883871264,
+        0.05064916883871299, 0.1514277775045767, 0.25065253225872053, 0.3473052528448203,
+        0.4403941515576345, 0.5289640103269624, 0.6121059825476629, 0.6889669190756866,
+        0.7587581226927909, 0.8207634412072763, 0.8743466161445821, 0.9189578116202306,
+        0.9541392564000488, 0.9795299412524945, 0.9948693233918952, 1,
+        // n = 33
+        -1, -0.9951847266721968, -0.9807852804032304, -0.9569403357322088,
+        -0.9238795325112867, -0.8819212643483549, -0.8314696123025453, -0.773010453362737,
+        -0.7071067811865475, -0.6343932841636454, -0.555570233019602, -0.4713967368259977,
+        -0.3826834323650897, -0.29028467725446216, -0.1950903220161282, -0.09801714032956065,
+        6.123233995736766E-17, 0.09801714032956077, 0.19509032201612833, 0.29028467725446233,
+        0.38268343236508984, 0.4713967368259978, 0.5555702330196023, 0.6343932841636455,
+        0.7071067811865476, 0.773010453362737, 0.8314696123025452, 0.881921264348355,
+        0.9238795325112867, 0.9569403357322088, 0.9807852804032304, 0.9951847266721969,
+        1,
+        // n = 34
+        -1, -0.9954719225730846, -0.9819286972627066, -0.9594929736144973,
+        -0.9283679330160726, -0.8888354486549234, -0.8412535328311811, -0.7860530947427875,
+        -0.7237340381050702, -0.654860733945285, -0.580056909571198, -0.4999999999999998,
+        -0.41541501300188655, -0.32706796331742166, -0.23575893550942695, -0.142314838273285,
+        -0.04758191582374228, 0.0475819158237424, 0.14231483827328534, 0.23575893550942728,
+        0.32706796331742155, 0.41541501300188644, 0.5000000000000001, 0.5800569095711982,
+        0.6548607339452851, 0.7237340381050702, 0.7860530947427875, 0.8412535328311812,
+        0.8888354486549235, 0.9283679330160726, 0.9594929736144974, 0.9819286972627067,
+        0.9954719225730846, 1,
+        // n = 35
+        -1, -0.9957341762950346, -0.9829730996839018, -0.961825643172819,
+        -0.9324722294043557, -0.8951632913550622, -0.850217135729614, -0.7980172272802395,
+        -0.7390089172206593, -0.6736956436465572, -0.6026346363792563, -0.5264321628773555,
+        -0.4457383557765378, -0.3612416661871529, -0.2736629900720829, -0.18374951781657017,
+        -0.09226835946330189, 6.123233995736766E-17, 0.09226835946330202, 0.18374951781657053,
+        0.273662990072083, 0.36124166618715287, 0.4457383557765383, 0.5264321628773561,
+        0.6026346363792564, 0.6736956436465572, 0.7390089172206591, 0.7980172272802396,
+        0.8502171357296142, 0.8951632913550623, 0.9324722294043558, 0.961825643172819,
+        0.9829730996839018, 0.9957341762950345, 1,
+        // n = 36
+        -1, -0.9959742939952391, -0.9839295885986297, -0.9639628606958532,
+        -0.9362348706397372, -0.900968867902419, -0.8584487936018661, -0.8090169943749473,
+        -0.7530714660036109, -0.6910626489868646, -0.6234898018587335, -0.5508969814521024,
+        -0.4738686624729986, -0.39302503165392333, -0.30901699437494734, -0.22252093395631434,
+        -0.1342332658176554, -0.04486483035051486, 0.044864830350514986, 0.13423326581765554,
+        0.22252093395631445, 0.30901699437494745, 0.39302503165392366, 0.4738686624729987,
+        0.5508969814521026, 0.6234898018587336, 0.6910626489868646, 0.753071466003611,
+        0.8090169943749475, 0.8584487936018661, 0.9009688679024191, 0.9362348706397372,
+        0.9639628606958532, 0.9839295885986297, 0.9959742939952391, 1,
+        // n = 37
+        -1, -0.9961946980917455, -0.984807753012208, -0.9659258262890683,
+        -0.9396926207859083, -0.9063077870366499, -0.8660254037844385, -0.8191520442889919,
+        -0.7660444431189779, -0.7071067811865475, -0.6427876096865394, -0.5735764363510462,
+        -0.4999999999999998, -0.42261826174069933, -0.3420201433256685, -0.25881904510252085,
+        -0.1736481776669303, -0.08715574274765801, 6.123233995736766E-17, 0.08715574274765814,
+        0.17364817766693041, 0.25881904510252096, 0.3420201433256688, 0.42261826174069944,
+        0.5000000000000001, 0.5735764363510462, 0.6427876096865394, 0.7071067811865476,
+        0.766044443118978, 0.8191520442889918, 0.8660254037844387, 0.9063077870366499,
+        0.9396926207859084, 0.9659258262890683, 0.984807753012208, 0.9961946980917455,
+        1,
+        // n = 38
+        -1, -0.9963974885425265, -0.9856159103477085, -0.9677329469334989,
+        -0.9428774454610842, -0.9112284903881356, -0.8730141131611879, -0.8285096492438421,
+        -0.7780357543184396, -0.7219560939545244, -0.6606747233900813, -0.5946331763042866,
+        -0.5243072835572316, -0.4502037448176734, -0.3728564777803085, -0.2928227712765501,
+        -0.21067926999572628, -0.12701781974687876, -0.042441203196148115, 0.04244120319614846,
+        0.12701781974687865, 0.21067926999572642, 0.29282277127655043, 0.3728564777803086,
+        0.4502037448176733, 0.5243072835572317, 0.5946331763042867, 0.6606747233900815,
+        0.7219560939545245, 0.7780357543184395, 0.8285096492438422, 0.8730141131611882,
+        0.9112284903881357, 0.9428774454610842, 0.9677329469334989, 0.9856159103477085,
+        0.9963974885425265, 1,
+        // n = 39
+        -1, -0.9965844930066698, -0.9863613034027223, -0.9694002659393304,
+        -0.9458172417006347, -0.9157733266550575, -0.879473751206489, -0.8371664782625283,
+        -0.7891405093963935, -0.7357239106731316, -0.6772815716257409, -0.6142127126896678,
+        -0.546948158122427, -0.47594739303707356, -0.4016954246529694, -0.32469946920468323,
+        -0.2454854871407989, -0.16459459028073384, -0.08257934547233227, 6.123233995736766E-17,
+        0.0825793454723324, 0.16459459028073375, 0.24548548714079924, 0.32469946920468357,
+        0.40169542465296953, 0.47594739303707345, 0.5469481581224269, 0.6142127126896679,
+        0.6772815716257411, 0.7357239106731317, 0.7891405093963936, 0.8371664782625287,
+        0.8794737512064891, 0.9157733266550574, 0.9458172417006346, 0.9694002659393304,
+        0.9863613034027223, 0.9965844930066698, 1,
+        // n = 40
+        -1, -0.9967573081342099, -0.9870502626379128, -0.970941817426052,
+        -0.9485364419471455, -0.9199794436588242, -0.8854560256532098, -0.8451900855437946,
+        -0.799442763403501, -0.7485107481711009, -0.6927243535095994, -0.6324453755953772,
+        -0.5680647467311557, -0.5000000000000002, -0.4286925614030543, -0.35460488704253545,
+        -0.2782174639164524, -0.20002569377604412, -0.1205366802553231, -0.04026594010941512,
+        0.04026594010941524, 0.120536680255323, 0.20002569377604446, 0.27821746391645275,
+        0.3546048870425358, 0.42869256140305423, 0.4999999999999999, 0.5680647467311559,
+        0.6324453755953774, 0.6927243535095994, 0.7485107481711011, 0.7994427634035012,
+        0.8451900855437947, 0.8854560256532099, 0.9199794436588242, 0.9485364419471455,
+        0.970941817426052, 0.9870502626379128, 0.99675730813421, 1,
+        // n = 41
+        -1, -0.996917333733128, -0.9876883405951377, -0.9723699203976766,
+        -0.9510565162951535, -0.9238795325112867, -0.8910065241883678, -0.8526401643540922,
+        -0.8090169943749473, -0.7604059656000309, -0.7071067811865475, -0.6494480483301835,
+        -0.587785252292473, -0.5224985647159488, -0.4539904997395467, -0.3826834323650897,
+        -0.30901699437494734, -0.23344536385590534, -0.1564344650402306, -0.07845909572784487,
+        6.123233995736766E-17, 0.078459095727845, 0.15643446504023092, 0.23344536385590547,
+        0.30901699437494745, 0.38268343236508984, 0.4539904997395468, 0.5224985647159489,
+        0.5877852522924731, 0.6494480483301838, 0.7071067811865476, 0.7604059656000309,
+        0.8090169943749475, 0.8526401643540922, 0.8910065241883679, 0.9238795325112867,
+        0.9510565162951535, 0.9723699203976766, 0.9876883405951378, 0.996917333733128,
+        1,
+        // n = 42
+        -1, -0.9970658011837404, -0.9882804237803485, -0.973695423877779,
+        -0.9533963920549305, -0.9275024511020946, -0.8961655569610555, -0.8595696069872012,
+        -0.8179293607667176, -0.771489179821943, -0.7205215936007869, -0.6653257001655652,
+        -0.6062254109666381, -0.543567550001221, -0.4777198185122627, -0.4090686371713399,
+        -0.3380168784085028, -0.26498150219666156, -0.19039110916466828, -0.11468342539840018,
+        -0.038302733690035375, 0.03830273369003549, 0.11468342539840053, 0.19039110916466842,
+        0.26498150219666167, 0.3380168784085027, 0.40906863717134, 0.477719818512263,
+        0.5435675500012211, 0.6062254109666381, 0.6653257001655655, 0.720521593600787,
+        0.771489179821943, 0.8179293607667176, 0.8595696069872012, 0.8961655569610556,
+        0.9275024511020947, 0.9533963920549305, 0.9736954238777791, 0.9882804237803485,
+        0.9970658011837404, 1,
+        // n = 43
+        -1, -0.9972037971811801, -0.9888308262251285, -0.9749279121818236,
+        -0.9555728057861406, -0.9308737486442044, -0.900968867902419, -0.8660254037844385,
+        -0.826238774315995, -0.7818314824680298, -0.7330518718298263, -0.6801727377709192,
+        -0.6234898018587335, -0.5633200580636221, -0.4999999999999998, -0.43388373911755806,
+        -0.3653410243663951, -0.2947551744109042, -0.22252093395631434, -0.1490422661761743,
+        -0.07473009358642405, 6.123233995736766E-17, 0.07473009358642439, 0.14904226617617464,
+        0.22252093395631445, 0.2947551744109041, 0.365341024366395, 0.4338837391175582,
+        0.5000000000000001, 0.563320058063622, 0.6234898018587336, 0.6801727377709195,
+        0.7330518718298263, 0.7818314824680298, 0.8262387743159949, 0.8660254037844387,
+        0.9009688679024191, 0.9308737486442042, 0.9555728057861407, 0.9749279121818236,
+        0.9888308262251285, 0.9972037971811801, 1,
+        // n = 44
+        -1, -0.9973322836635516, -0.9893433680751101, -0.9760758775559271,
+        -0.9576005999084058, -0.9340161087325479, -0.9054482374931466, -0.8720494081438077,
+        -0.8339978178898778, -0.791496488429254, -0.7447721827437819, -0.694074195220634,
+        -0.639673021558891, -0.5818589155579527, -0.5209403404879301, -0.4572423233046385,
+        -0.3911047204901559, -0.32288040477144636, -0.2529333823916808, -0.18163685097943635,
+        -0.10937120837787419, -0.036522023057658504, 0.03652202305765885, 0.10937120837787452,
+        0.1816368509794365, 0.2529333823916807, 0.3228804047714463, 0.391104720490156,
+        0.4572423233046386, 0.5209403404879303, 0.5818589155579528, 0.6396730215588913,
+        0.694074195220634, 0.7447721827437819, 0.7914964884292541, 0.8339978178898779,
+        0.8720494081438076, 0.9054482374931466, 0.934016108732548, 0.957600599908406,
+        0.9760758775559272, 0.9893433680751103, 0.9973322836635516, 1,
+        // n = 45
+        -1, -0.9974521146102535, -0.9898214418809327, -0.9771468659711594,
+        -0.9594929736144974, -0.9369497249997616, -0.9096319953545182, -0.8776789895672557,
+        -0.8412535328311811, -0.8005412409243603, -0.7557495743542582, -0.7071067811865475,
+        -0.654860733945285, -0.599277666511347, -0.5406408174555972, -0.4792489867200569,
+        -0.4154150130018863, -0.3494641795990983, -0.28173255684142967, -0.2125652895529767,
+        -0.142314838273285, -0.07133918319923224, 2.83276944882399E-16, 0.07133918319923235,
+        0.14231483827328512, 0.21256528955297682, 0.2817325568414298, 0.3494641795990984,
+        0.41541501300188644, 0.479248986720057, 0.5406408174555977, 0.599277666511347,
+        0.6548607339452851, 0.7071067811865476, 0.7557495743542583, 0.8005412409243604,
+        0.8412535328311812, 0.8776789895672557, 0.9096319953545184, 0.9369497249997617,
+        0.9594929736144974, 0.9771468659711595, 0.9898214418809327, 0.9974521146102535,
+        1,
+        // n = 46
+        -1, -0.9975640502598242, -0.9902680687415703, -0.9781476007338057,
+        -0.9612616959383187, -0.9396926207859083, -0.9135454576426008, -0.8829475928589268,
+        -0.848048096156426, -0.8090169943749473, -0.7660444431189779, -0.7193398003386512,
+        -0.6691306063588582, -0.6156614753256583, -0.5591929034707467, -0.4999999999999998,
+        -0.4383711467890775, -0.37460659341591207, -0.30901699437494734, -0.24192189559966779,
+        -0.1736481776669303, -0.10452846326765333, -0.03489949670250073, 0.03489949670250108,
+        0.10452846326765346, 0.17364817766693041, 0.2419218955996679, 0.30901699437494745,
+        0.37460659341591196, 0.43837114678907746, 0.5000000000000001, 0.5591929034707468,
+        0.6156614753256583, 0.6691306063588582, 0.7193398003386512, 0.766044443118978,
+        0.8090169943749475, 0.848048096156426, 0.882947592858927, 0.9135454576426009,
+        0.9396926207859084, 0.9612616959383189, 0.9781476007338057, 0.9902680687415704,
+        0.9975640502598242, 1,
+        // n = 47
+        -1, -0.9976687691905393, -0.9906859460363306, -0.9790840876823228,
+        -0.9629172873477992, -0.9422609221188204, -0.917211301505453, -0.8878852184023752,
+        -0.8544194045464883, -0.816969893010442, -0.7757112907044197, -0.7308359642781241,
+        -0.6825531432186542, -0.6310879443260529, -0.5766803221148671, -0.5195839500354333,
+        -0.4600650377311521, -0.39840108984624145, -0.33487961217098616, -0.2697967711570241,
+        -0.20345601305263386, -0.13616664909624668, -0.06824241336467088, 6.123233995736766E-17,
+        0.06824241336467123, 0.1361666490962466, 0.20345601305263375, 0.26979677115702444,
+        0.3348796121709863, 0.39840108984624134, 0.4600650377311522, 0.5195839500354336,
+        0.5766803221148672, 0.6310879443260528, 0.6825531432186541, 0.7308359642781241,
+        0.7757112907044198, 0.8169698930104421, 0.8544194045464886, 0.8878852184023752,
+        0.917211301505453, 0.9422609221188205, 0.9629172873477992, 0.9790840876823229,
+        0.9906859460363308, 0.9976687691905392, 1,
+        // n = 48
+        -1, -0.9977668786231532, -0.99107748815478, -0.9799617050365867,
+        -0.9644691750543765, -0.9446690916079189, -0.9206498866764287, -0.8925188358598811,
+        -0.8604015792601392, -0.8244415603417601, -0.784799385278661, -0.7416521056479576,
+        -0.6951924276746423, -0.6456278515588024, -0.5931797447293552, -0.5380823531633726,
+        -0.4805817551866837, -0.4209347624283349, -0.3594077728375129, -0.2962755808856338,
+        -0.23182015026752809, -0.16632935458313003, -0.10009569162409833, -0.03341497700767452,
+        0.033414977007674644, 0.10009569162409844, 0.16632935458312995, 0.23182015026752842,
+        0.29627558088563416, 0.3594077728375128, 0.420934762428335, 0.48058175518668383,
+        0.5380823531633727, 0.5931797447293553, 0.6456278515588024, 0.6951924276746423,
+        0.7416521056479576, 0.784799385278661, 0.8244415603417603, 0.8604015792601394,
+        0.8925188358598812, 0.9206498866764288, 0.9446690916079188, 0.9644691750543766,
+        0.9799617050365869, 0.9910774881547801, 0.9977668786231532, 1,
+        // n = 49
+        -1, -0.9978589232386035, -0.9914448613738104, -0.9807852804032304,
+        -0.9659258262890682, -0.9469301294951056, -0.9238795325112867, -0.8968727415326881,
+        -0.8660254037844387, -0.831469612302545, -0.793353340291235, -0.7518398074789773,
+        -0.7071067811865475, -0.6593458151000688, -0.6087614290087207, -0.5555702330196023,
+        -0.4999999999999998, -0.44228869021900113, -0.3826834323650895, -0.3214394653031616,
+        -0.25881904510252063, -0.1950903220161282, -0.1305261922200516, -0.06540312923014314,
+        6.123233995736766E-17, 0.06540312923014327, 0.1305261922200517, 0.19509032201612833,
+        0.25881904510252074, 0.3214394653031617, 0.38268343236508984, 0.44228869021900125,
+        0.5000000000000001, 0.5555702330196024, 0.6087614290087207, 0.6593458151000688,
+        0.7071067811865476, 0.7518398074789774, 0.7933533402912352, 0.8314696123025452,
+        0.8660254037844387, 0.8968727415326884, 0.9238795325112867, 0.9469301294951057,
+        0.9659258262890683, 0.9807852804032304, 0.9914448613738104, 0.9978589232386035,
+        1,
+        // n = 50
+        -1, -0.9979453927503363, -0.991790013823246, -0.9815591569910653,
+        -0.9672948630390295, -0.9490557470106685, -0.9269167573460216, -0.900968867902419,
+        -0.8713187041233892, -0.8380881048918406, -0.8014136218679565, -0.7614459583691342,
+        -0.7183493500977275, -0.6723008902613169, -0.6234898018587335, -0.5721166601221698,
+        -0.518392568310525, -0.4625382902408351, -0.40478334312239367, -0.3453650544213075,
+        -0.28452758663103234, -0.22252093395631434, -0.15959989503337918, -0.09602302590768176,
+        -0.03205157757165521, 0.03205157757165533, 0.09602302590768189, 0.15959989503337954,
+        0.22252093395631445, 0.28452758663103245, 0.3453650544213078, 0.4047833431223938,
+        0.4625382902408352, 0.5183925683105252, 0.5721166601221697, 0.6234898018587336,
+        0.6723008902613168, 0.7183493500977276, 0.7614459583691345, 0.8014136218679566,
+        0.8380881048918406, 0.8713187041233894, 0.9009688679024191, 0.9269167573460217,
+        0.9490557470106686, 0.9672948630390295, 0.9815591569910653, 0.9917900138232462,
+        0.9979453927503363, 1,
+        // n = 51
+        -1, -0.9980267284282716, -0.9921147013144778, -0.9822872507286887,
+        -0.968583161128631, -0.9510565162951535, -0.9297764858882513, -0.9048270524660194,
+        -0.8763066800438636, -0.8443279255020149, -0.8090169943749473, -0.7705132427757891,
+        -0.7289686274214113, -0.6845471059286887, -0.6374239897486897, -0.587785252292473,
+        -0.5358267949789969, -0.48175367410171543, -0.4257792915650727, -0.36812455268467775,
+        -0.3090169943749471, -0.24868988716485485, -0.1873813145857246, -0.12533323356430415,
+        -0.0627905195293134, 6.123233995736766E-17, 0.06279051952931353, 0.12533323356430448,
+        0.18738131458572474, 0.24868988716485474, 0.30901699437494745, 0.3681245526846781,
+        0.42577929156507266, 0.48175367410171516, 0.5358267949789965, 0.5877852522924732,
+        0.6374239897486897, 0.6845471059286886, 0.7289686274214116, 0.7705132427757893,
+        0.8090169943749475, 0.8443279255020151, 0.8763066800438636, 0.9048270524660196,
+        0.9297764858882515, 0.9510565162951535, 0.9685831611286311, 0.9822872507286887,
+        0.9921147013144779, 0.9980267284282716, 1,
+        // n = 52
+        -1, -0.9981033287370441, -0.9924205096719357, -0.9829730996839018,
+        -0.9697969360350095, -0.9529420004271565, -0.9324722294043558, -0.9084652718195236,
+        -0.8810121942857845, -0.8502171357296142, -0.8161969123562216, -0.7790805745256705,
+        -0.739008917220659, -0.6961339459629265, -0.6506183002042422, -0.6026346363792563,
+        -0.5523649729605058, -0.5000000000000002, -0.4457383557765382, -0.3897858732926793,
+        -0.3323547994796595, -0.27366299007208267, -0.21393308320649743, -0.1533916548786853,
+        -0.09226835946330189, -0.030795058556170426, 0.030795058556170325, 0.09226835946330202,
+        0.15339165487868545, 0.21393308320649754, 0.2736629900720828, 0.3323547994796596,
+        0.3897858732926794, 0.4457383557765383, 0.4999999999999999, 0.5523649729605059,
+        0.6026346363792565, 0.6506183002042422, 0.6961339459629265, 0.7390089172206591,
+        0.7790805745256705, 0.8161969123562217, 0.8502171357296142, 0.8810121942857845,
+        0.9084652718195237, 0.9324722294043558, 0.9529420004271566, 0.9697969360350095,
+        0.9829730996839018, 0.9924205096719357, 0.9981033287370441, 1,
+        // n = 53
+        -1, -0.9981755542233175, -0.992708874098054, -0.9836199069471435,
+        -0.970941817426052, -0.9547208665085456, -0.9350162426854147, -0.9118998459920901,
+        -0.8854560256532096, -0.8557812723014474, -0.8229838658936564, -0.7871834806090501,
+        -0.7485107481711012, -0.7071067811865475, -0.663122658240795, -0.6167188726285431,
+        -0.5680647467311557, -0.5173378141776565, -0.4647231720437685, -0.4104128054527568,
+        -0.35460488704253545, -0.29750305385520287, -0.2393156642875575, -0.18025503781390573,
+        -0.12053668025532288, -0.06037849742228594, -1.6081226496766364E-16, 0.060378497422286063,
+        0.120536680255323, 0.18025503781390587, 0.23931566428755804, 0.297503053855203,
+        0.35460488704253557, 0.41041280545275693, 0.4647231720437686, 0.5173378141776568,
+        0.5680647467311559, 0.6167188726285432, 0.6631226582407953, 0.7071067811865475,
+        0.7485107481711011, 0.7871834806090503, 0.8229838658936564, 0.8557812723014475,
+        0.8854560256532099, 0.9118998459920901, 0.9350162426854148, 0.9547208665085456,
+        0.970941817426052, 0.9836199069471436, 0.992708874098054, 0.9981755542233175,
+        1,
+        // n = 54
+        -1, -0.9982437317643215, -0.9929810960135169, -0.9842305779475968,
+        -0.9720229140804106, -0.9564009842765224, -0.9374196611341209, -0.9151456172430182,
+        -0.8896570909947472, -0.8610436117673553, -0.8294056854502018, -0.7948544414133534,
+        -0.7575112421616198, -0.717507257044331, -0.6749830015182103, -0.630087843581711,
+        -0.5829794791144719, -0.5338233779647907, -0.48279220273074475, -0.43006520227652056,
+        -0.3758275821142381, -0.32026985386283763, -0.26358716606906746, -0.20597861874109827,
+        -0.14764656400248116, -0.08879589532293478, -0.029633327822559546, 0.029633327822559667,
+        0.0887958953229349, 0.14764656400248127, 0.2059786187410986, 0.2635871660690678,
+        0.3202698538628375, 0.3758275821142382, 0.4300652022765205, 0.48279220273074486,
+        0.5338233779647906, 0.5829794791144721, 0.6300878435817111, 0.6749830015182106,
+        0.7175072570443312, 0.7575112421616201, 0.7948544414133533, 0.8294056854502018,
+        0.8610436117673556, 0.8896570909947473, 0.9151456172430185, 0.9374196611341209,
+        0.9564009842765224, 0.9720229140804107, 0.9842305779475968, 0.9929810960135169,
+        0.9982437317643215, 1,
+        // n = 55
+        -1, -0.9983081582712682, -0.993238357741943, -0.984807753012208,
+        -0.9730448705798238, -0.9579895123154888, -0.9396926207859083, -0.918216106880274,
+        -0.8936326403234122, -0.8660254037844387, -0.8354878114129363, -0.8021231927550438,
+        -0.7660444431189782, -0.7273736415730484, -0.6862416378687335, -0.6427876096865394,
+        -0.597158591702786, -0.549508978070806, -0.4999999999999998, -0.44879918020046217,
+        -0.3960797660391568, -0.3420201433256687, -0.2868032327110902, -0.23061587074244014,
+        -0.17364817766693008, -0.11609291412523018, -0.058144828910475774, 6.123233995736766E-17,
+        0.05814482891047568, 0.1160929141252303, 0.17364817766693041, 0.23061587074244025,
+        0.2868032327110903, 0.3420201433256686, 0.3960797660391569, 0.4487991802004623,
+        0.5000000000000001, 0.549508978070806, 0.5971585917027862, 0.6427876096865395,
+        0.6862416378687336, 0.7273736415730486, 0.766044443118978, 0.8021231927550438,
+        0.8354878114129365, 0.8660254037844387, 0.8936326403234123, 0.918216106880274,
+        0.9396926207859084, 0.9579895123154889, 0.9730448705798238, 0.984807753012208,
+        0.993238357741943, 0.9983081582712682, 1,
+        // n = 56
+        -1, -0.9983691039261356, -0.9934817353485502, -0.9853538358476931,
+        -0.9740119169423335, -0.9594929736144974, -0.9418443636395246, -0.92112365311485,
+        -0.8973984286913584, -0.870746077119777, -0.8412535328311811, -0.8090169943749471,
+        -0.7741416106390825, -0.736741137876405, -0.6969375686552933, -0.654860733945285,
+        -0.6106478796354379, -0.564443218866769, -0.5163974616389618, -0.4666673232256737,
+        -0.4154150130018863, -0.36280770535064105, -0.30901699437494734, -0.2542183341934868,
+        -0.19859046664574542, -0.142314838273285, -0.08557500847883971, -0.028556050793696133,
+        0.028556050793696476, 0.08557500847883961, 0.14231483827328512, 0.19859046664574553,
+        0.2542183341934871, 0.3090169943749477, 0.36280770535064094, 0.41541501300188644,
+        0.4666673232256738, 0.5163974616389619, 0.5644432188667692, 0.6106478796354382,
+        0.6548607339452851, 0.6969375686552935, 0.7367411378764048, 0.7741416106390825,
+        0.8090169943749475, 0.8412535328311812, 0.8707460771197771, 0.8973984286913584,
+        0.9211236531148501, 0.9418443636395247, 0.9594929736144974, 0.9740119169423335,
+        0.985353835847693, 0.9934817353485502, 0.9983691039261356, 1,
+        // n = 57
+        -1, -0.9984268150178166, -0.9937122098932426, -0.9858710185182359,
+        -0.9749279121818237, -0.9609173219450995, -0.9438833303083676, -0.9238795325112867,
+        -0.900968867902419, -0.8752234219087537, -0.8467241992282841, -0.8155608689592602,
+        -0.7818314824680295, -0.7456421648831656, -0.7071067811865475, -0.6663465779520039,
+        -0.6234898018587335, -0.5786712961798057, -0.5320320765153365, -0.48371888710523975,
+        -0.43388373911755806, -0.3826834323650897, -0.3302790619551672, -0.2768355114248493,
+        -0.22252093395631434, -0.16750622330473633, -0.11196447610330758, -0.05607044723719173,
+        6.123233995736766E-17, 0.056070447237191845, 0.11196447610330769, 0.16750622330473647,
+        0.22252093395631445, 0.2768355114248494, 0.3302790619551673, 0.38268343236508984,
+        0.4338837391175582, 0.4837188871052398, 0.5320320765153366, 0.5786712961798057,
+        0.6234898018587336, 0.666346577952004, 0.7071067811865476, 0.7456421648831656,
+        0.7818314824680298, 0.8155608689592603, 0.8467241992282841, 0.8752234219087537,
+        0.9009688679024191, 0.9238795325112867, 0.9438833303083676, 0.9609173219450996,
+        0.9749279121818236, 0.9858710185182359, 0.9937122098932426, 0.9984268150178166,
+        1,
+        // n = 58
+        -1, -0.9984815164333162, -0.9939306773179495, -0.9863613034027223,
+        -0.9757963826274356, -0.9622680003092505, -0.9458172417006346, -0.9264940672148018,
+        -0.9043571606975774, -0.879473751206489, -0.8519194088383272, -0.8217778152252451,
+        -0.7891405093963935, -0.7541066097768961, -0.7167825131684511, -0.6772815716257412,
+        -0.6357237482099678, -0.5922352526649799, -0.5469481581224267, -0.4999999999999998,
+        -0.45153335831088914, -0.4016954246529694, -0.35063755519275414, -0.2985148110016945,
+        -0.24548548714079912, -0.19171063192373838, -0.13735355781840813, -0.08257934547233205,
+        -0.027554342368161937, 0.02755434236816206, 0.0825793454723324, 0.13735355781840802,
+        0.1917106319237385, 0.24548548714079924, 0.29851481100169464, 0.35063755519275447,
+        0.40169542465296937, 0.4515333583108894, 0.5000000000000001, 0.5469481581224269,
+        0.59223525266498, 0.635723748209968, 0.6772815716257412, 0.7167825131684513,
+        0.7541066097768963, 0.7891405093963936, 0.8217778152252452, 0.8519194088383271,
+        0.8794737512064891, 0.9043571606975775, 0.9264940672148018, 0.9458172417006346,
+        0.9622680003092504, 0.9757963826274356, 0.9863613034027223, 0.9939306773179495,
+        0.9984815164333162, 1,
+        // n = 59
+        -1, -0.9985334138511238, -0.9941379571543596, -0.9868265225415261,
+        -0.9766205557100867, -0.9635499925192229, -0.9476531711828025, -0.9289767198167914,
+        -0.9075754196709571, -0.8835120444460228, -0.8568571761675893, -0.8276889981568905,
+        -0.7960930657056435, -0.7621620551276364, -0.7259954919231306, -0.6876994588534231,
+        -0.6473862847818276, -0.6051742151937649, -0.5611870653623823, -0.5155538571770215,
+        -0.46840844069979004, -0.41988910156026465, -0.37013815533991423, -0.31930153013597984,
+        -0.26752833852922087, -0.2149704402110241, -0.16178199655276473, -0.10811901842394174,
+        -0.05413890858541726, 6.123233995736766E-17, 0.05413890858541761, 0.10811901842394187,
+        0.16178199655276462, 0.214970440211024, 0.26752833852922075, 0.31930153013598017,
+        0.37013815533991457, 0.4198891015602646, 0.46840844069979015, 0.5155538571770217,
+        0.5611870653623824, 0.6051742151937651, 0.6473862847818277, 0.6876994588534234,
+        0.7259954919231308, 0.7621620551276365, 0.7960930657056438, 0.8276889981568906,
+        0.8568571761675893, 0.8835120444460229, 0.907575419670957, 0.9289767198167914,
+        0.9476531711828025, 0.9635499925192229, 0.9766205557100867, 0.9868265225415261,
+        0.9941379571543596, 0.9985334138511238, 1,
+        // n = 60
+        -1, -0.9985826956767619, -0.9943348002101371, -0.9872683547213446,
+        -0.9774033898178667, -0.9647678688145158, -0.9493976084683813, -0.9313361774523384,
+        -0.910634772854913, -0.8873520750565717, -0.861554081393806, -0.8333139190825148,
+        -0.8027116379309638, -0.769833983429906, -0.7347741508630671, -0.6976315211349846,
+        -0.6585113790650385, -0.6175246149461918, -0.5747874102144068, -0.5304209081197424,
+        -0.4845508703326501, -0.43730732045885534, -0.3888241754733206, -0.3392388661180303,
+        -0.28869194733962084, -0.23732669987111488, -0.1852887240871144, -0.13272552728372186,
+        -0.07978610555308298, -0.026620521437774693, 0.026620521437774814, 0.0797861055530831,
+        0.1327255272837222, 0.1852887240871143, 0.23732669987111477, 0.28869194733962117,
+        0.3392388661180304, 0.38882417547332077, 0.43730732045885545, 0.4845508703326502,
+        0.5304209081197425, 0.5747874102144069, 0.6175246149461919, 0.6585113790650386,
+        0.6976315211349847, 0.7347741508630673, 0.7698339834299063, 0.8027116379309637,
+        0.833313919082515, 0.8615540813938061, 0.8873520750565715, 0.9106347728549132,
+        0.9313361774523384, 0.9493976084683813, 0.9647678688145159, 0.9774033898178667,
+        0.9872683547213446, 0.9943348002101371, 0.9985826956767619, 1,
+        // n = 61
+        -1, -0.9986295347545738, -0.9945218953682734, -0.9876883405951377,
+        -0.9781476007338057, -0.9659258262890683, -0.9510565162951535, -0.9335804264972017,
+        -0.913545457642601, -0.8910065241883678, -0.8660254037844387, -0.8386705679454239,
+        -0.8090169943749473, -0.7771459614569709, -0.743144825477394, -0.7071067811865475,
+        -0.6691306063588579, -0.6293203910498373, -0.587785252292473, -0.5446390350150268,
+        -0.4999999999999998, -0.4539904997395467, -0.40673664307580004, -0.35836794954530027,
+        -0.30901699437494734, -0.25881904510252063, -0.20791169081775934, -0.1564344650402308,
+        -0.10452846326765333, -0.05233595624294362, 2.83276944882399E-16, 0.052335956242943744,
+        0.10452846326765346, 0.15643446504023092, 0.20791169081775923, 0.25881904510252074,
+        0.30901699437494745, 0.3583679495453004, 0.4067366430758004, 0.4539904997395468,
+        0.5000000000000001, 0.5446390350150272, 0.5877852522924731, 0.6293203910498375,
+        0.6691306063588582, 0.7071067811865476, 0.7431448254773942, 0.7771459614569709,
+        0.8090169943749475, 0.838670567945424, 0.8660254037844387, 0.8910065241883679,
+        0.9135454576426009, 0.9335804264972017, 0.9510565162951535, 0.9659258262890683,
+        0.9781476007338057, 0.9876883405951378, 0.9945218953682733, 0.9986295347545738,
+        1,
+        // n = 62
+        -1, -0.9986740898848305, -0.9946998756145891, -0.9880878960910772,
+        -0.9788556850953578, -0.9670277247913204, -0.9526353808033825, -0.9357168190404935,
+        -0.9163169044870048, -0.8944870822287956, -0.8702852410301553, -0.8437755598231856,
+        -0.8150283375168113, -0.7841198065767103, -0.75113193087052, -0.7161521883143931,
+        -0.6792733388972931, -0.6405931786981751, -0.6002142805483681, -0.5582437220268649,
+        -0.5147928015098304, -0.46997674302732007, -0.42391439070986064, -0.376727893635185,
+        -0.32854238191083474, -0.2794856348516094, -0.2296877421317954, -0.17928075881073566,
+        -0.12839835514655085, -0.07717546212664618, -0.025747913654988536, 0.025747913654988658,
+        0.0771754621266463, 0.12839835514655099, 0.17928075881073577, 0.22968774213179552,
+        0.2794856348516095, 0.32854238191083485, 0.3767278936351853, 0.42391439070986076,
+        0.46997674302731995, 0.5147928015098308, 0.5582437220268648, 0.6002142805483682,
+        0.6405931786981751, 0.6792733388972931, 0.7161521883143933, 0.7511319308705199,
+        0.7841198065767104, 0.8150283375168114, 0.8437755598231856, 0.8702852410301553,
+        0.8944870822287956, 0.9163169044870048, 0.9357168190404936, 0.9526353808033825,
+        0.9670277247913204, 0.9788556850953578, 0.9880878960910772, 0.9946998756145891,
+        0.9986740898848305, 1,
+        // n = 63
+        -1, -0.9987165071710528, -0.994869323391895, -0.9884683243281114,
+        -0.9795299412524945, -0.9680771188662042, -0.9541392564000488, -0.9377521321470805,
+        -0.9189578116202306, -0.8978045395707416, -0.8743466161445821, -0.8486442574947508,
+        -0.8207634412072763, -0.7907757369376984, -0.7587581226927909, -0.7247927872291201,
+        -0.6889669190756863, -0.651372482722222, -0.6121059825476626, -0.5712682150947921,
+        -0.5289640103269625, -0.4853019625310809, -0.4403941515576344, -0.39435585511331844,
+        -0.34730525284482017, -0.2993631229733578, -0.2506525322587204, -0.20129852008865998,
+        -0.15142777750457678, -0.1011683219874321, -0.05064916883871264, 6.123233995736766E-17,
+        0.05064916883871299, 0.10116832198743222, 0.1514277775045767, 0.20129852008866012,
+        0.25065253225872053, 0.299363122973358, 0.3473052528448203, 0.3943558551133188,
+        0.4403941515576345, 0.485301962531081, 0.5289640103269624, 0.5712682150947923,
+        0.6121059825476629, 0.6513724827222221, 0.6889669190756866, 0.7247927872291201,
+        0.7587581226927909, 0.7907757369376985, 0.8207634412072763, 0.848644257494751,
+        0.8743466161445821, 0.8978045395707417, 0.9189578116202306, 0.9377521321470804,
+        0.9541392564000488, 0.9680771188662043, 0.9795299412524945, 0.9884683243281114,
+        0.9948693233918952, 0.9987165071710528, 1,
+        // n = 64
+        -1, -0.9987569212189223, -0.9950307753654014, -0.9888308262251285,
+        -0.9801724878485438, -0.9690772862290778, -0.9555728057861406, -0.9396926207859083,
+        -0.9214762118704077, -0.900968867902419, -0.8782215733702287, -0.8532908816321556,
+        -0.8262387743159947, -0.7971325072229225, -0.7660444431189779, -0.7330518718298263,
+        -0.6982368180860727, -0.6616858375968592, -0.6234898018587335, -0.5837436722347896,
+        -0.5425462638657593, -0.5000000000000002, -0.4562106573531626, -0.4112871031306114,
+        -0.3653410243663949, -0.3184866502516843, -0.270840468143005, -0.22252093395631434,
+        -0.1736481776669303, -0.12434370464748516, -0.07473009358642427, -0.024930691738072913,
+        0.024930691738073035, 0.07473009358642439, 0.12434370464748527, 0.17364817766693041,
+        0.22252093395631445, 0.27084046814300516, 0.31848665025168443, 0.365341024366395,
+        0.4112871031306117, 0.4562106573531631, 0.4999999999999999, 0.5425462638657594,
+        0.58374367223479, 0.6234898018587336, 0.6616858375968594, 0.6982368180860729,
+        0.7330518718298263, 0.766044443118978, 0.7971325072229225, 0.8262387743159949,
+        0.8532908816321557, 0.8782215733702285, 0.9009688679024191, 0.9214762118704076,
+        0.9396926207859084, 0.9555728057861407, 0.969077286229078, 0.9801724878485438,
+        0.9888308262251285, 0.9950307753654014, 0.9987569212189223, 1,
+    };
+}
@@ -3,6 +3,8 @@
 //
 // Provides Gauss-Legendre and Tanh-Sinh (doubly exponential) quadrature
 // for high-precision numerical integration in American option pricing.
+// Gauss rules are read from the generated CRGQ002A tables; no roots are
+// found at run time.
 //
 // References:
 // - Golub & Welsch (1969) "Calculation of Gauss Quadrature Rules"
@@ -10,10 +12,18 @@
 // - Andersen, Lake & Offengenden (2016) "High Performance American Option Pricing"
 
 using System;
+using System.Buffers;
 using System.Runtime.CompilerServices;
 
 namespace Alaris.Core.Math;
 
+/// <summary>
+/// Integrand producing several values at one abscissa, written into <paramref name="values"/>.
+/// </summary>
+/// <param name="x">Abscissa.</param>
+/// <param name="values">One slot per integral being computed.</param>
+public delegate void BatchIntegrand(double x, Span<double> values);
+
 /// <summary>
 /// Gauss quadrature infrastructure for spectral integration methods.
 /// </summary>
@@ -22,11 +32,7 @@ public static class CRGQ001A
     private const int MaxLegendreOrder = 64;
     private const int MaxLaguerreOrder = 32;
     private const int MaxHermiteOrder = 32;
-    private const double LegendreRootTolerance = 1e-15;
-    private const int LegendreMaxIterations = 100;
-    private const double TanhSinhWeightCutoff = 1e-20;
-    private const double TanhSinhOverflowLimit = 350.0;
-    private const int TanhSinhMaxSamples = 1000;
+    private const int StackallocThreshold = 32;
 
     /// <summary>
     /// Pre-computed Gauss-Legendre nodes and weights for common orders.
@@ -51,65 +57,37 @@ public static class CRGQ001A
     }
 
     /// <summary>
-    /// Computes Gauss-Legendre nodes and weights on [-1, 1].
+    /// Gets Gauss-Legendre nodes and weights on [-1, 1].
     /// </summary>
     /// <param name="n">Number of quadrature points (1 to 64).</param>
     /// <returns>Tuple of (nodes, weights) arrays.</returns>
     /// <remarks>
-    /// Uses Newton-Raphson iteration to find roots of Legendre polynomials.
-    /// Weights are computed from the derivative formula.
+    /// Returns copies of the generated tables; hot paths should read
+    /// <see cref="GaussLegendreNodes"/> and <see cref="GaussLegendreWeights"/> instead.
     /// </remarks>
     public static (double[] Nodes, double[] Weights) GaussLegendre(int n)
     {
-        ArgumentOutOfRangeException.ThrowIfLessThan(n, 1);
-        ArgumentOutOfRangeException.ThrowIfGreaterThan(n, MaxLegendreOrder);
-
-        double[] nodes = new double[n];
-        double[] weights = new double[n];
-
-        int m = (n + 1) / 2;  // Number of positive roots (symmetric)
-
-        for (int i = 0; i < m; i++)
-        {
-            // Initial guess using asymptotic formula
-            double z = System.Math.Cos(System.Math.PI * (i + 0.75) / (n + 0.5));
-
-            double z1, pp;
-            int iter = 0;
-
-            do
-            {
-                // Evaluate Legendre polynomial and its derivative
-                double p1 = 1.0;
-                double p2 = 0.0;
-
-                for (int j = 0; j < n; j++)
-                {
-                    double p3 = p2;
-                    p2 = p1;
-                    p1 = (((2.0 * j) + 1.0) * z * p2 - j * p3) / (j + 1);
-                }
-
-                // p1 is now P_n(z), derivative using recurrence
-                pp = n * ((z * p1) - p2) / ((z * z) - 1.0);
-
-                z1 = z;
-                z -= p1 / pp;
-                iter++;
-            }
-            while (System.Math.Abs(z - z1) > LegendreRootTolerance && iter < LegendreMaxIterations);
-
-            // Store symmetric pairs
-            nodes[i] = -z;
-            nodes[n - 1 - i] = z;
+        return (GaussLegendreNodes(n).ToArray(), GaussLegendreWeights(n).ToArray());
+    }
 
-            // Weight formula
-            double weight = 2.0 / (((1.0 - (z * z)) * pp) * pp);
-            weights[i] = weight;
-            weights[n - 1 - i] = weight;
-        }
+    /// <summary>
+    /// Gauss-Legendre nodes on [-1, 1] in ascending order, without copying.
+    /// </summary>
+    /// <param name="n">Number of quadrature points (1 to 64).</param>
+    public static ReadOnlySpan<double> GaussLegendreNodes(int n)
+    {
+        ValidateOrder(n, MaxLegendreOrder);
+        return CRGQ002A.LegendreNodes.Slice(CRGQ002A.Offset(n), n);
+    }
 
-        return (nodes, weights);
+    /// <summary>
+    /// Gauss-Legendre weights matching <see cref="GaussLegendreNodes"/>, without copying.
+    /// </summary>
+    /// <param name="n">Number of quadrature points (1 to 64).</param>
+    public static ReadOnlySpan<double> GaussLegendreWeights(int n)
+    {
+        ValidateOrder(n, MaxLegendreOrder);
+        return CRGQ002A.LegendreWeights.Slice(CRGQ002A.Offset(n), n);
     }
 
     /// <summary>
@@ -152,12 +130,15 @@ public static class CRGQ001A
             return 0.0;
         }
 
-        (double[] nodes, double[] weights) = GaussLegendreAB(n, a, b);
+        ReadOnlySpan<double> nodes = GaussLegendreNodes(n);
+        ReadOnlySpan<double> weights = GaussLegendreWeights(n);
+        double halfWidth = (b - a) / 2.0;
+        double midPoint = (a + b) / 2.0;
 
         double sum = 0.0;
         for (int i = 0; i < n; i++)
         {
-            sum += weights[i] * f(nodes[i]);
+            sum += halfWidth * weights[i] * f(midPoint + (halfWidth * nodes[i]));
         }
 
         return sum;
@@ -170,12 +151,15 @@ public static class CRGQ001A
     /// <param name="a">Left endpoint.</param>
     /// <param name="b">Right endpoint.</param>
     /// <param name="tolerance">Desired relative tolerance.</param>
-    /// <param name="maxLevels">Maximum refinement levels (default 10).</param>
+    /// <param name="maxLevels">Maximum refinement levels (default 10, at most 16).</param>
     /// <returns>Approximate integral value.</returns>
     /// <remarks>
     /// Tanh-Sinh is excellent for integrands with endpoint singularities.
     /// Uses the transformation x = tanh(π/2 * sinh(t)) which clusters points
-    /// near endpoints where singularities typically occur.
+    /// near endpoints where singularities typically occur. Nodes and weights come
+    /// from the shared CRGQ003A table, placed by their distance from the nearer
+    /// endpoint; each level adds only the nodes new at its step and stops once two
+    /// successive levels agree.
     /// </remarks>
     public static double TanhSinhIntegrate(
         Func<double, double> f,
@@ -185,11 +169,7 @@ public static class CRGQ001A
         int maxLevels = 10)
     {
         ArgumentNullException.ThrowIfNull(f);
-        ArgumentOutOfRangeException.ThrowIfLessThan(maxLevels, 1);
-        if (tolerance <= 0)
-        {
-            throw new ArgumentOutOfRangeException(nameof(tolerance), "Tolerance must be positive.");
-        }
+        ValidateTanhSinhArguments(tolerance, maxLevels);
 
         if (a == b)
         {
@@ -198,60 +178,31 @@ public static class CRGQ001A
 
         double halfWidth = (b - a) / 2.0;
         double midPoint = (a + b) / 2.0;
-        double piOverTwo = System.Math.PI / 2.0;
-        double h = 1.0;  // Step size
+        double sum = 0.0;
         double previousResult = 0.0;
+        int levels = System.Math.Min(maxLevels, CRGQ003A.MaxLevels);
 
-        for (int level = 0; level < maxLevels; level++)
+        for (int level = 0; level < levels; level++)
         {
-            double sum = 0.0;
-            for (int k = 0; k <= TanhSinhMaxSamples; k++)
+            TanhSinhLevel nodes = CRGQ003A.Level(level);
+            double[] complements = nodes.Complements;
+            double[] weights = nodes.Weights;
+            int start = 0;
+
+            if (level == 0)
+            {
+                sum += weights[0] * FiniteOrZero(f(midPoint));
+                start = 1;
+            }
+
+            for (int i = start; i < complements.Length; i++)
             {
-                double t = k * h;
-
-                double sinhT = System.Math.Sinh(t);
-                double piHalfSinhT = piOverTwo * sinhT;
-                if (System.Math.Abs(piHalfSinhT) > TanhSinhOverflowLimit)
-                {
-                    break;
-                }
-
-                double coshT = System.Math.Cosh(t);
-                double x = System.Math.Tanh(piHalfSinhT);
-                double coshPiHalf = System.Math.Cosh(piHalfSinhT);
-                double w = piOverTwo * coshT / (coshPiHalf * coshPiHalf);
-
-                if (w < TanhSinhWeightCutoff)
-                {
-                    break;
-                }
-
-                if (k == 0)
-                {
-                    double gVal = f(midPoint + (halfWidth * x));
-                    if (!double.IsNaN(gVal) && !double.IsInfinity(gVal))
-                    {
-                        sum += w * gVal;
-                    }
-                }
-                else
-                {
-                    double gPos = f(midPoint + (halfWidth * x));
-                    double gNeg = f(midPoint - (halfWidth * x));
-
-                    if (!double.IsNaN(gPos) && !double.IsInfinity(gPos))
-                    {
-                        sum += w * gPos;
-                    }
-
-                    if (!double.IsNaN(gNeg) && !double.IsInfinity(gNeg))
-                    {
-                        sum += w * gNeg;
-                    }
-                }
+                double offset = halfWidth * complements[i];
+                sum += weights[i] * FiniteOrZero(f(b - offset));
+                sum += weights[i] * FiniteOrZero(f(a + offset));
             }
 
-            double result = h * sum * halfWidth;
+            double result = nodes.Step * sum * halfWidth;
 
             // Check convergence
             if (level > 0 && System.Math.Abs(result - previousResult) < tolerance * System.Math.Abs(result))
@@ -260,12 +211,141 @@ public static class CRGQ001A
             }
 
             previousResult = result;
-            h /= 2.0;
         }
 
         return previousResult;
     }
 
+    /// <summary>
+    /// Integrates several functions over [a, b] with Tanh-Sinh quadrature, sharing every node.
+    /// </summary>
+    /// <param name="f">Writes one value per integral at each abscissa.</param>
+    /// <param name="a">Left endpoint.</param>
+    /// <param name="b">Right endpoint.</param>
+    /// <param name="results">Receives the integrals; its length sets the number of components.</param>
+    /// <param name="tolerance">Desired relative tolerance.</param>
+    /// <param name="maxLevels">Maximum refinement levels (default 10, at most 16).</param>
+    /// <remarks>
+    /// Refinement stops once the largest change between levels is within tolerance of the
+    /// largest component, so every component sees the same nodes. Non-finite values are
+    /// dropped per component, as in the scalar overload.
+    /// </remarks>
+    public static void TanhSinhIntegrate(
+        BatchIntegrand f,
+        double a,
+        double b,
+        Span<double> results,
+        double tolerance = 1e-10,
+        int maxLevels = 10)
+    {
+        ArgumentNullException.ThrowIfNull(f);
+        ValidateTanhSinhArguments(tolerance, maxLevels);
+
+        results.Clear();
+        if (a == b || results.IsEmpty)
+        {
+            return;
+        }
+
+        int count = results.Length;
+        double[]? rented = null;
+        Span<double> scratch = count <= (StackallocThreshold / 2)
+            ? stackalloc double[2 * count]
+            : (rented = ArrayPool<double>.Shared.Rent(2 * count)).AsSpan(0, 2 * count);
+
+        try
+        {
+            TanhSinhIntegrateBatch(f, a, b, results, scratch[..count], scratch[count..], tolerance, maxLevels);
+        }
+        finally
+        {
+            if (rented is not null)
+            {
+                ArrayPool<double>.Shared.Return(rented);
+            }
+        }
+    }
+
+    private static void TanhSinhIntegrateBatch(
+        BatchIntegrand f,
+        double a,
+        double b,
+        Span<double> results,
+        Span<double> values,
+        Span<double> sums,
+        double tolerance,
+        int maxLevels)
+    {
+        double halfWidth = (b - a) / 2.0;
+        double midPoint = (a + b) / 2.0;
+        int levels = System.Math.Min(maxLevels, CRGQ003A.MaxLevels);
+        sums.Clear();
+
+        for (int level = 0; level < levels; level++)
+        {
+            TanhSinhLevel nodes = CRGQ003A.Level(level);
+            double[] complements = nodes.Complements;
+            double[] weights = nodes.Weights;
+            int start = 0;
+
+            if (level == 0)
+            {
+                f(midPoint, values);
+                Accumulate(weights[0], values, sums);
+                start = 1;
+            }
+
+            for (int i = start; i < complements.Length; i++)
+            {
+                double offset = halfWidth * complements[i];
+                f(b - offset, values);
+                Accumulate(weights[i], values, sums);
+                f(a + offset, values);
+                Accumulate(weights[i], values, sums);
+            }
+
+            double scale = nodes.Step * halfWidth;
+            double maxChange = 0.0;
+            double maxMagnitude = 0.0;
+            for (int j = 0; j < results.Length; j++)
+            {
+                double result = scale * sums[j];
+                maxChange = System.Math.Max(maxChange, System.Math.Abs(result - results[j]));
+                maxMagnitude = System.Math.Max(maxMagnitude, System.Math.Abs(result));
+                results[j] = result;
+            }
+
+            // Check convergence
+            if (level > 0 && maxChange < tolerance * maxMagnitude)
+            {
+                return;
+            }
+        }
+    }
+
+    private static void Accumulate(double weight, ReadOnlySpan<double> values, Span<double> sums)
+    {
+        for (int j = 0; j < sums.Length; j++)
+        {
+            sums[j] += weight * FiniteOrZero(values[j]);
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static double FiniteOrZero(double value)
+    {
+        return double.IsFinite(value) ? value : 0.0;
+    }
+
+    private static void ValidateTanhSinhArguments(double tolerance, int maxLevels)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(maxLevels, 1);
+        if (tolerance <= 0)
+        {
+            throw new ArgumentOutOfRangeException(nameof(tolerance), "Tolerance must be positive.");
+        }
+    }
+
     /// <summary>
     /// Gauss-Kronrod adaptive quadrature for automatic precision control.
     /// </summary>
@@ -367,158 +447,74 @@ public static class CRGQ001A
     }
 
     /// <summary>
-    /// Computes Gauss-Laguerre nodes and weights for semi-infinite integrals.
+    /// Gets Gauss-Laguerre nodes and weights for semi-infinite integrals.
     /// </summary>
-    /// <param name="n">Number of quadrature points.</param>
+    /// <param name="n">Number of quadrature points (1 to 32).</param>
     /// <returns>Nodes and weights for integrals over [0, ∞) with weight e^(-x).</returns>
     /// <remarks>
     /// Useful for integrals of the form ∫₀^∞ f(x) e^(-x) dx.
     /// </remarks>
     public static (double[] Nodes, double[] Weights) GaussLaguerre(int n)
     {
-        ArgumentOutOfRangeException.ThrowIfLessThan(n, 1);
-        ArgumentOutOfRangeException.ThrowIfGreaterThan(n, MaxLaguerreOrder);
-
-        double[] nodes = new double[n];
-        double[] weights = new double[n];
-
-        for (int i = 0; i < n; i++)
-        {
-            // Initial guess
-            double z;
-            if (i == 0)
-            {
-                z = 3.0 / (1.0 + (2.4 * n));
-            }
-            else if (i == 1)
-            {
-                z = nodes[0] + (15.0 / (1.0 + (2.5 * n)));
-            }
-            else
-            {
-                double ratio = (1.0 + (2.55 * (i - 1))) / (1.9 * (i - 1));
-                z = nodes[i - 1] + (ratio * (nodes[i - 1] - nodes[i - 2]));
-            }
-
-            // Newton-Raphson
-            int maxIter = 100;
-            for (int iter = 0; iter < maxIter; iter++)
-            {
-                double p1 = 1.0;
-                double p2 = 0.0;
-
-                for (int j = 0; j < n; j++)
-                {
-                    double p3 = p2;
-                    p2 = p1;
-                    p1 = (((((2 * j) + 1) - z) * p2) - (j * p3)) / (j + 1);
-                }
-
-                double pp = (n * p1 - n * p2) / z;
-                double z1 = z;
-                z -= p1 / pp;
-
-                if (System.Math.Abs(z - z1) < 1e-15)
-                {
-                    break;
-                }
-            }
-
-            nodes[i] = z;
-
-            // Evaluate L_{n-1} at z
-            double lnm1 = 0.0;
-            double ln = 1.0;
-            for (int j = 0; j < n; j++)
-            {
-                double tmp = ln;
-                ln = (((((2 * j) + 1) - z) * ln) - (j * lnm1)) / (j + 1);
-                lnm1 = tmp;
-            }
+        return (GaussLaguerreNodes(n).ToArray(), GaussLaguerreWeights(n).ToArray());
+    }
 
-            weights[i] = z / ((n + 1) * (n + 1) * lnm1 * lnm1);
-        }
+    /// <summary>
+    /// Gauss-Laguerre nodes in ascending order, without copying.
+    /// </summary>
+    /// <param name="n">Number of quadrature points (1 to 32).</param>
+    public static ReadOnlySpan<double> GaussLaguerreNodes(int n)
+    {
+        ValidateOrder(n, MaxLaguerreOrder);
+        return CRGQ002A.LaguerreNodes.Slice(CRGQ002A.Offset(n), n);
+    }
 
-        return (nodes, weights);
+    /// <summary>
+    /// Gauss-Laguerre weights matching <see cref="GaussLaguerreNodes"/>, without copying.
+    /// </summary>
+    /// <param name="n">Number of quadrature points (1 to 32).</param>
+    public static ReadOnlySpan<double> GaussLaguerreWeights(int n)
+    {
+        ValidateOrder(n, MaxLaguerreOrder);
+        return CRGQ002A.LaguerreWeights.Slice(CRGQ002A.Offset(n), n);
     }
 
     /// <summary>
-    /// Computes Gauss-Hermite nodes and weights for infinite integrals.
+    /// Gets Gauss-Hermite nodes and weights for infinite integrals.
     /// </summary>
-    /// <param name="n">Number of quadrature points.</param>
+    /// <param name="n">Number of quadrature points (1 to 32).</param>
     /// <returns>Nodes and weights for integrals over (-∞, ∞) with weight e^(-x²).</returns>
     /// <remarks>
     /// Useful for integrals of the form ∫_{-∞}^∞ f(x) e^(-x²) dx.
     /// </remarks>
     public static (double[] Nodes, double[] Weights) GaussHermite(int n)
     {
-        ArgumentOutOfRangeException.ThrowIfLessThan(n, 1);
-        ArgumentOutOfRangeException.ThrowIfGreaterThan(n, MaxHermiteOrder);
-
-        double[] nodes = new double[n];
-        double[] weights = new double[n];
-
-        int m = (n + 1) / 2;
-
-        for (int i = 0; i < m; i++)
-        {
-            // Initial guess
-            double z;
-            if (i == 0)
-            {
-                z = System.Math.Sqrt(2.0 * n + 1.0) - (1.85575 * System.Math.Pow(2.0 * n + 1.0, -1.0 / 6.0));
-            }
-            else if (i == 1)
-            {
-                z = nodes[0] - (1.14 * System.Math.Pow(n, 0.426) / nodes[0]);
-            }
-            else if (i == 2)
-            {
-                z = (1.86 * nodes[1]) - (0.86 * nodes[0]);
-            }
-            else if (i == 3)
-            {
-                z = (1.91 * nodes[2]) - (0.91 * nodes[1]);
-            }
-            else
-            {
-                z = (2.0 * nodes[i - 1]) - nodes[i - 2];
-            }
-
-            // Newton-Raphson
-            int maxIter = 100;
-            double p2Final = 0.0;
-            for (int iter = 0; iter < maxIter; iter++)
-            {
-                double p1 = System.Math.Sqrt(System.Math.PI) * 0.7511255444649425;  // 1/π^(1/4)
-                double p2 = 0.0;
-
-                for (int j = 0; j < n; j++)
-                {
-                    double p3 = p2;
-                    p2 = p1;
-                    p1 = (z * System.Math.Sqrt(2.0 / (j + 1)) * p2) - (System.Math.Sqrt((double)j / (j + 1)) * p3);
-                }
-
-                p2Final = p2;
-                double pp = System.Math.Sqrt(2.0 * n) * p2;
-                double z1 = z;
-                z -= p1 / pp;
-
-                if (System.Math.Abs(z - z1) < 1e-15)
-                {
-                    break;
-                }
-            }
+        return (GaussHermiteNodes(n).ToArray(), GaussHermiteWeights(n).ToArray());
+    }
 
-            nodes[i] = -z;
-            nodes[n - 1 - i] = z;
+    /// <summary>
+    /// Gauss-Hermite nodes in ascending order, without copying.
+    /// </summary>
+    /// <param name="n">Number of quadrature points (1 to 32).</param>
+    public static ReadOnlySpan<double> GaussHermiteNodes(int n)
+    {
+        ValidateOrder(n, MaxHermiteOrder);
+        return CRGQ002A.HermiteNodes.Slice(CRGQ002A.Offset(n), n);
+    }
 
-            double weight = 2.0 / (p2Final * p2Final);
-            weights[i] = weight;
-            weights[n - 1 - i] = weight;
-        }
+    /// <summary>
+    /// Gauss-Hermite weights matching <see cref="GaussHermiteNodes"/>, without copying.
+    /// </summary>
+    /// <param name="n">Number of quadrature points (1 to 32).</param>
+    public static ReadOnlySpan<double> GaussHermiteWeights(int n)
+    {
+        ValidateOrder(n, MaxHermiteOrder);
+        return CRGQ002A.HermiteWeights.Slice(CRGQ002A.Offset(n), n);
+    }
 
-        return (nodes, weights);
+    private static void ValidateOrder(int n, int maxOrder)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(n, 1);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(n, maxOrder);
     }
 }
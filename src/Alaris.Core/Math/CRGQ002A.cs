@@ -0,0 +1,1988 @@
+// CRGQ002A.cs - Generated Gauss quadrature node and weight tables
+// Component ID: CRGQ002A
+//
+// <auto-generated>
+// Round-trip ("R") output of Newton iteration on the orthogonal polynomial recurrences,
+// for every supported order. Legendre entries are bit-identical to the rules CRGQ001A
+// previously computed on each call; Laguerre and Hermite weights use the standard
+// 1/(x·L'_n(x)²) and 2/H̃'_n(x)² forms. Do not edit by hand; TSUN063A checks the moments.
+// </auto-generated>
+//
+// Layout: the rule of order n starts at n(n-1)/2 and has n entries.
+
+namespace Alaris.Core.Math;
+
+/// <summary>
+/// Generated Gauss-Legendre, Gauss-Laguerre and Gauss-Hermite tables backing <see cref="CRGQ001A"/>.
+/// </summary>
+/// <remarks>
+/// Each table is a static array built once at type initialization: reading a rule
+/// allocates nothing and runs no root finding.
+/// </remarks>
+internal static class CRGQ002A
+{
+    /// <summary>Start of the order-n rule in a table.</summary>
+    public static int Offset(int n) => n * (n - 1) / 2;
+
+    /// <summary>Gauss-Legendre nodes on [-1, 1], ascending.</summary>
+    public static ReadOnlySpan<double> LegendreNodes => LegendreNodesTable;
+
+    private static readonly double[] LegendreNodesTable =
+    {
+        // n = 1
+        0,
+        // n = 2
+        -0.5773502691896257, 0.5773502691896257,
+        // n = 3
+        -0.7745966692414834, 0, 0.7745966692414834,
+        // n = 4
+        -0.8611363115940526, -0.3399810435848563, 0.3399810435848563, 0.8611363115940526,
+        // n = 5
+        -0.906179845938664, -0.5384693101056831, 0, 0.5384693101056831,
+        0.906179845938664,
+        // n = 6
+        -0.932469514203152, -0.6612093864662646, -0.23861918608319693, 0.23861918608319693,
+        0.6612093864662646, 0.932469514203152,
+        // n = 7
+        -0.9491079123427585, -0.7415311855993945, -0.4058451513773972, 0,
+        0.4058451513773972, 0.7415311855993945, 0.9491079123427585,
+        // n = 8
+        -0.9602898564975363, -0.7966664774136268, -0.525532409916329, -0.18343464249564978,
+        0.18343464249564978, 0.525532409916329, 0.7966664774136268, 0.9602898564975363,
+        // n = 9
+        -0.9681602395076261, -0.8360311073266359, -0.6133714327005905, -0.3242534234038089,
+        0, 0.3242534234038089, 0.6133714327005905, 0.8360311073266359,
+        0.9681602395076261,
+        // n = 10
+        -0.9739065285171717, -0.8650633666889845, -0.6794095682990244, -0.43339539412924716,
+        -0.14887433898163122, 0.14887433898163122, 0.43339539412924716, 0.6794095682990244,
+        0.8650633666889845, 0.9739065285171717,
+        // n = 11
+        -0.978228658146057, -0.8870625997680953, -0.7301520055740494, -0.5190961292068118,
+        -0.26954315595234496, 0, 0.26954315595234496, 0.5190961292068118,
+        0.7301520055740494, 0.8870625997680953, 0.978228658146057,
+        // n = 12
+        -0.9815606342467192, -0.9041172563704748, -0.7699026741943047, -0.5873179542866175,
+        -0.3678314989981802, -0.12523340851146894, 0.12523340851146894, 0.3678314989981802,
+        0.5873179542866175, 0.7699026741943047, 0.9041172563704748, 0.9815606342467192,
+        // n = 13
+        -0.9841830547185881, -0.917598399222978, -0.8015780907333099, -0.6423493394403402,
+        -0.4484927510364468, -0.2304583159551348, 1.232595164407831E-32, 0.2304583159551348,
+        0.4484927510364468, 0.6423493394403402, 0.8015780907333099, 0.917598399222978,
+        0.9841830547185881,
+        // n = 14
+        -0.9862838086968123, -0.9284348836635736, -0.827201315069765, -0.6872929048116855,
+        -0.5152486363581541, -0.31911236892788974, -0.10805494870734365, 0.10805494870734365,
+        0.31911236892788974, 0.5152486363581541, 0.6872929048116855, 0.827201315069765,
+        0.9284348836635736, 0.9862838086968123,
+        // n = 15
+        -0.9879925180204855, -0.937273392400706, -0.8482065834104272, -0.7244177313601701,
+        -0.5709721726085388, -0.3941513470775634, -0.20119409399743451, 1.232595164407831E-32,
+        0.20119409399743451, 0.3941513470775634, 0.5709721726085388, 0.7244177313601701,
+        0.8482065834104272, 0.937273392400706, 0.9879925180204855,
+        // n = 16
+        -0.9894009349916499, -0.9445750230732326, -0.8656312023878318, -0.755404408355003,
+        -0.6178762444026438, -0.45801677765722737, -0.2816035507792589, -0.09501250983763744,
+        0.09501250983763744, 0.2816035507792589, 0.45801677765722737, 0.6178762444026438,
+        0.755404408355003, 0.8656312023878318, 0.9445750230732326, 0.9894009349916499,
+        // n = 17
+        -0.9905754753144174, -0.9506755217687678, -0.8802391537269859, -0.7815140038968014,
+        -0.6576711592166907, -0.5126905370864769, -0.3512317634538763, -0.17848418149584785,
+        1.232595164407831E-32, 0.17848418149584785, 0.3512317634538763, 0.5126905370864769,
+        0.6576711592166907, 0.7815140038968014, 0.8802391537269859, 0.9506755217687678,
+        0.9905754753144174,
+        // n = 18
+        -0.991565168420931, -0.9558239495713977, -0.8926024664975557, -0.8037049589725231,
+        -0.6916870430603532, -0.5597708310739475, -0.41175116146284263, -0.25188622569150554,
+        -0.0847750130417353, 0.0847750130417353, 0.25188622569150554, 0.41175116146284263,
+        0.5597708310739475, 0.6916870430603532, 0.8037049589725231, 0.8926024664975557,
+        0.9558239495713977, 0.991565168420931,
+        // n = 19
+        -0.9924068438435844, -0.96020815213483, -0.9031559036148179, -0.8227146565371428,
+        -0.7209661773352294, -0.600545304661681, -0.46457074137596094, -0.31656409996362983,
+        -0.1603586456402254, 1.232595164407831E-32, 0.1603586456402254, 0.31656409996362983,
+        0.46457074137596094, 0.600545304661681, 0.7209661773352294, 0.8227146565371428,
+        0.9031559036148179, 0.96020815213483, 0.9924068438435844,
+        // n = 20
+        -0.9931285991850949, -0.9639719272779138, -0.912234428251326, -0.8391169718222189,
+        -0.7463319064601508, -0.636053680726515, -0.5108670019508271, -0.37370608871541955,
+        -0.2277858511416451, -0.07652652113349734, 0.07652652113349734, 0.2277858511416451,
+        0.37370608871541955, 0.5108670019508271, 0.636053680726515, 0.7463319064601508,
+        0.8391169718222189, 0.912234428251326, 0.9639719272779138, 0.9931285991850949,
+        // n = 21
+        -0.9937521706203895, -0.9672268385663063, -0.9200993341504008, -0.8533633645833173,
+        -0.7684399634756779, -0.6671388041974123, -0.5516188358872198, -0.4243421202074388,
+        -0.2880213168024011, -0.1455618541608951, 1.232595164407831E-32, 0.1455618541608951,
+        0.2880213168024011, 0.4243421202074388, 0.5516188358872198, 0.6671388041974123,
+        0.7684399634756779, 0.8533633645833173, 0.9200993341504008, 0.9672268385663063,
+        0.9937521706203895,
+        // n = 22
+        -0.9942945854823992, -0.9700604978354287, -0.926956772187174, -0.8658125777203002,
+        -0.7878168059792081, -0.6944872631866827, -0.5876404035069116, -0.46935583798675706,
+        -0.34193582089208424, -0.20786042668822127, -0.06973927331972223, 0.06973927331972223,
+        0.20786042668822127, 0.34193582089208424, 0.46935583798675706, 0.5876404035069116,
+        0.6944872631866827, 0.7878168059792081, 0.8658125777203002, 0.926956772187174,
+        0.9700604978354287, 0.9942945854823992,
+        // n = 23
+        -0.9947693349975522, -0.9725424712181152, -0.9329710868260161, -0.8767523582704416,
+        -0.8048884016188399, -0.7186613631319502, -0.6196098757636461, -0.5095014778460075,
+        -0.3903010380302908, -0.2641356809703449, -0.1332568242984661, -2.465190328815662E-32,
+        0.1332568242984661, 0.2641356809703449, 0.3903010380302908, 0.5095014778460075,
+        0.6196098757636461, 0.7186613631319502, 0.8048884016188399, 0.8767523582704416,
+        0.9329710868260161, 0.9725424712181152, 0.9947693349975522,
+        // n = 24
+        -0.9951872199970213, -0.9747285559713095, -0.9382745520027328, -0.8864155270044011,
+        -0.820001985973903, -0.7401241915785544, -0.6480936519369755, -0.5454214713888396,
+        -0.4337935076260452, -0.3150426796961634, -0.1911188674736163, -0.06405689286260563,
+        0.06405689286260563, 0.1911188674736163, 0.3150426796961634, 0.4337935076260452,
+        0.5454214713888396, 0.6480936519369755, 0.7401241915785544, 0.820001985973903,
+        0.8864155270044011, 0.9382745520027328, 0.9747285559713095, 0.9951872199970213,
+        // n = 25
+        -0.9955569697904981, -0.9766639214595175, -0.9429745712289743, -0.8949919978782753,
+        -0.833442628760834, -0.7592592630373577, -0.6735663684734684, -0.577662930241223,
+        -0.473002731445715, -0.3611723058093878, -0.24386688372098841, -0.1228646926107104,
+        0, 0.1228646926107104, 0.24386688372098841, 0.3611723058093878,
+        0.473002731445715, 0.577662930241223, 0.6735663684734684, 0.7592592630373577,
+        0.833442628760834, 0.8949919978782753, 0.9429745712289743, 0.9766639214595175,
+        0.9955569697904981,
+        // n = 26
+        -0.9958857011456169, -0.978385445956471, -0.9471590666617142, -0.9026378619843071,
+        -0.845445942788498, -0.7763859488206789, -0.6964272604199573, -0.6066922930176181,
+        -0.5084407148245057, -0.40305175512348634, -0.2920048394859569, -0.17685882035689018,
+        -0.05923009342931321, 0.05923009342931321, 0.17685882035689018, 0.2920048394859569,
+        0.40305175512348634, 0.5084407148245057, 0.6066922930176181, 0.6964272604199573,
+        0.7763859488206789, 0.845445942788498, 0.9026378619843071, 0.9471590666617142,
+        0.978385445956471, 0.9958857011456169,
+        // n = 27
+        -0.9961792628889886, -0.9799234759615012, -0.9509005578147051, -0.9094823206774911,
+        -0.8562079080182945, -0.7917716390705082, -0.7170134737394237, -0.6329079719464952,
+        -0.540551564579457, -0.44114825175002687, -0.3359939036385089, -0.22645936543953685,
+        -0.11397258560952997, 1.232595164407831E-32, 0.11397258560952997, 0.22645936543953685,
+        0.3359939036385089, 0.44114825175002687, 0.540551564579457, 0.6329079719464952,
+        0.7170134737394237, 0.7917716390705082, 0.8562079080182945, 0.9094823206774911,
+        0.9509005578147051, 0.9799234759615012, 0.9961792628889886,
+        // n = 28
+        -0.9964424975739544, -0.9813031653708727, -0.9542592806289382, -0.9156330263921321,
+        -0.8658925225743951, -0.8056413709171792, -0.7356108780136318, -0.656651094038865,
+        -0.5697204718114017, -0.4758742249551183, -0.37625151608907875, -0.2720616276351781,
+        -0.16456928213338076, -0.055079289884034266, 0.055079289884034266, 0.16456928213338076,
+        0.2720616276351781, 0.37625151608907875, 0.4758742249551183, 0.5697204718114017,
+        0.656651094038865, 0.7356108780136318, 0.8056413709171792, 0.8658925225743951,
+        0.9156330263921321, 0.9542592806289382, 0.9813031653708727, 0.9964424975739544,
+        // n = 29
+        -0.9966794422605966, -0.9825455052614132, -0.9572855957780877, -0.9211802329530588,
+        -0.8746378049201028, -0.8181854876152524, -0.7524628517344771, -0.6782145376026866,
+        -0.5962817971382278, -0.5075929551242276, -0.4131528881740087, -0.31403163786763993,
+        -0.21135228616600107, -0.10627823013267923, 1.232595164407831E-32, 0.10627823013267923,
+        0.21135228616600107, 0.31403163786763993, 0.4131528881740087, 0.5075929551242276,
+        0.5962817971382278, 0.6782145376026866, 0.7524628517344771, 0.8181854876152524,
+        0.8746378049201028, 0.9211802329530588, 0.9572855957780877, 0.9825455052614132,
+        0.9966794422605966,
+        // n = 30
+        -0.9968934840746495, -0.9836681232797472, -0.9600218649683075, -0.9262000474292743,
+        -0.8825605357920526, -0.8295657623827684, -0.7677774321048262, -0.6978504947933157,
+        -0.6205261829892429, -0.5366241481420199, -0.44703376953808915, -0.3527047255308781,
+        -0.25463692616788985, -0.15386991360858354, -0.05147184255531769, 0.05147184255531769,
+        0.15386991360858354, 0.25463692616788985, 0.3527047255308781, 0.44703376953808915,
+        0.5366241481420199, 0.6205261829892429, 0.6978504947933157, 0.7677774321048262,
+        0.8295657623827684, 0.8825605357920526, 0.9262000474292743, 0.9600218649683075,
+        0.9836681232797472, 0.9968934840746495,
+        // n = 31
+        -0.9970874818194772, -0.9846859096651525, -0.9625039250929497, -0.9307569978966481,
+        -0.8897600299482711, -0.8399203201462673, -0.781733148416625, -0.7157767845868532,
+        -0.6427067229242603, -0.5632491614071493, -0.4781937820449025, -0.38838590160823294,
+        -0.29471806998170164, -0.19812119933557062, -0.09955531215234152, 1.232595164407831E-32,
+        0.09955531215234152, 0.19812119933557062, 0.29471806998170164, 0.38838590160823294,
+        0.4781937820449025, 0.5632491614071493, 0.6427067229242603, 0.7157767845868532,
+        0.781733148416625, 0.8399203201462673, 0.8897600299482711, 0.9307569978966481,
+        0.9625039250929497, 0.9846859096651525, 0.9970874818194772,
+        // n = 32
+        -0.9972638618494816, -0.9856115115452684, -0.9647622555875064, -0.9349060759377397,
+        -0.8963211557660521, -0.84936761373257, -0.7944837959679424, -0.7321821187402897,
+        -0.6630442669302152, -0.5877157572407623, -0.5068999089322294, -0.42135127613063533,
+        -0.33186860228212767, -0.23928736225213706, -0.1444719615827965, -0.04830766568773831,
+        0.04830766568773831, 0.1444719615827965, 0.23928736225213706, 0.33186860228212767,
+        0.42135127613063533, 0.5068999089322294, 0.5877157572407623, 0.6630442669302152,
+        0.7321821187402897, 0.7944837959679424, 0.84936761373257, 0.8963211557660521,
+        0.9349060759377397, 0.9647622555875064, 0.9856115115452684, 0.9972638618494816,
+        // n = 33
+        -0.9974246942464552, -0.9864557262306425, -0.9668229096899927, -0.9386943726111684,
+        -0.9023167677434336, -0.8580096526765041, -0.8061623562741665, -0.7472304964495622,
+        -0.6817319599697428, -0.610242345836379, -0.5333899047863476, -0.45185001727245067,
+        -0.36633925774807335, -0.27760909715249704, -0.18643929882799157, -0.09363106585473338,
+        1.232595164407831E-32, 0.09363106585473338, 0.18643929882799157, 0.27760909715249704,
+        0.36633925774807335, 0.45185001727245067, 0.5333899047863476, 0.610242345836379,
+        0.6817319599697428, 0.7472304964495622, 0.8061623562741665, 0.8580096526765041,
+        0.9023167677434336, 0.9386943726111684, 0.9668229096899927, 0.9864557262306425,
+        0.9974246942464552,
+        // n = 34
+        -0.997571753790842, -0.9872278164063095, -0.9687082625333443, -0.9421623974051071,
+        -0.9078096777183244, -0.8659346383345644, -0.8168842279009336, -0.761064876629873,
+        -0.6989391132162629, -0.6310217270805285, -0.5578755006697467, -0.480106545190327,
+        -0.39835927775864594, -0.3133110813394632, -0.22566669161644948, -0.13615235725918298,
+        -0.04550982195310254, 0.04550982195310254, 0.13615235725918298, 0.22566669161644948,
+        0.3133110813394632, 0.39835927775864594, 0.480106545190327, 0.5578755006697467,
+        0.6310217270805285, 0.6989391132162629, 0.761064876629873, 0.8168842279009336,
+        0.8659346383345644, 0.9078096777183244, 0.9421623974051071, 0.9687082625333443,
+        0.9872278164063095, 0.997571753790842,
+        // n = 35
+        -0.9977065690996003, -0.9879357644438516, -0.9704376160392298, -0.9453451482078273,
+        -0.9128542613593176, -0.8732191250252224, -0.8267498990922254, -0.7738102522869126,
+        -0.7148145015566287, -0.6502243646658904, -0.5805453447497645, -0.5063227732414886,
+        -0.42813754151781425, -0.346601554430814, -0.26235294120929603, -0.1760510611659896,
+        -0.08837134327565926, 0, 0.08837134327565926, 0.1760510611659896,
+        0.26235294120929603, 0.346601554430814, 0.42813754151781425, 0.5063227732414886,
+        0.5805453447497645, 0.6502243646658904, 0.7148145015566287, 0.7738102522869126,
+        0.8267498990922254, 0.8732191250252224, 0.9128542613593176, 0.9453451482078273,
+        0.9704376160392298, 0.9879357644438516, 0.9977065690996003,
+        // n = 36
+        -0.9978304624840858, -0.9885864789022123, -0.9720276910496979, -0.9482729843995076,
+        -0.9174977745156591, -0.8799298008903971, -0.8358471669924753, -0.7855762301322065,
+        -0.7294891715935566, -0.668001236585521, -0.6015676581359806, -0.5306802859262452,
+        -0.45586394443342027, -0.37767254711968923, -0.29668499534402826, -0.2135008923168656,
+        -0.12873610380938477, -0.0430181984737086, 0.0430181984737086, 0.12873610380938477,
+        0.2135008923168656, 0.29668499534402826, 0.37767254711968923, 0.45586394443342027,
+        0.5306802859262452, 0.6015676581359806, 0.668001236585521, 0.7294891715935566,
+        0.7855762301322065, 0.8358471669924753, 0.8799298008903971, 0.9174977745156591,
+        0.9482729843995076, 0.9720276910496979, 0.9885864789022123, 0.9978304624840858,
+        // n = 37
+        -0.9979445824779136, -0.9891859632143192, -0.9734930300564857, -0.9509723432620948,
+        -0.9217814374124638, -0.8861249621554861, -0.844252987340556, -0.7964592005099023,
+        -0.7430788339819653, -0.6844863091309593, -0.6210926084089244, -0.5533423918615817,
+        -0.48171087780320554, -0.40670050931832613, -0.328837429883707, -0.24866779279136575,
+        -0.16675393023985197, -0.0836704089547699, 0, 0.0836704089547699,
+        0.16675393023985197, 0.24866779279136575, 0.328837429883707, 0.40670050931832613,
+        0.48171087780320554, 0.5533423918615817, 0.6210926084089244, 0.6844863091309593,
+        0.7430788339819653, 0.7964592005099023, 0.844252987340556, 0.8861249621554861,
+        0.9217814374124638, 0.9509723432620948, 0.9734930300564857, 0.9891859632143192,
+        0.9979445824779136,
+        // n = 38
+        -0.9980499305356876, -0.9897394542663855, -0.9748463285901535, -0.9534663309335296,
+        -0.9257413320485844, -0.8918557390046322, -0.8520350219323622, -0.8065441676053168,
+        -0.7556859037539707, -0.6997986803791844, -0.6392544158296817, -0.5744560210478071,
+        -0.5058347179279311, -0.4338471694323765, -0.358972440479435, -0.28170880979016527,
+        -0.2025704538921167, -0.12208402533786741, -0.040785147904578246, 0.040785147904578246,
+        0.12208402533786741, 0.2025704538921167, 0.28170880979016527, 0.358972440479435,
+        0.4338471694323765, 0.5058347179279311, 0.5744560210478071, 0.6392544158296817,
+        0.6997986803791844, 0.7556859037539707, 0.8065441676053168, 0.8520350219323622,
+        0.8918557390046322, 0.9257413320485844, 0.9534663309335296, 0.9748463285901535,
+        0.9897394542663855, 0.9980499305356876,
+        // n = 39
+        -0.9981473830664329, -0.9902515368546859, -0.9760987093334711, -0.9557752123246522,
+        -0.9294091484867382, -0.8971671192929929, -0.8592529379999062, -0.8159062974301431,
+        -0.7674012429310635, -0.7140444358945347, -0.656173213432011, -0.594153454957278,
+        -0.5283772686604374, -0.45926051230913606, -0.38724016397156147, -0.31277155924818595,
+        -0.23632551246183578, -0.1583853399978378, -0.07944380460875548, 1.232595164407831E-32,
+        0.07944380460875548, 0.1583853399978378, 0.23632551246183578, 0.31277155924818595,
+        0.38724016397156147, 0.45926051230913606, 0.5283772686604374, 0.594153454957278,
+        0.656173213432011, 0.7140444358945347, 0.7674012429310635, 0.8159062974301431,
+        0.8592529379999062, 0.8971671192929929, 0.9294091484867382, 0.9557752123246522,
+        0.9760987093334711, 0.9902515368546859, 0.9981473830664329,
+        // n = 40
+        -0.9982377097105593, -0.990726238699457, -0.9772599499837743, -0.9579168192137917,
+        -0.9328128082786765, -0.9020988069688743, -0.8659595032122595, -0.8246122308333117,
+        -0.7783056514265194, -0.7273182551899271, -0.6719566846141796, -0.6125538896679802,
+        -0.5494671250951282, -0.4830758016861787, -0.413779204371605, -0.3419940908257585,
+        -0.2681521850072537, -0.1926975807013711, -0.11608407067525521, -0.038772417506050816,
+        0.038772417506050816, 0.11608407067525521, 0.1926975807013711, 0.2681521850072537,
+        0.3419940908257585, 0.413779204371605, 0.4830758016861787, 0.5494671250951282,
+        0.6125538896679802, 0.6719566846141796, 0.7273182551899271, 0.7783056514265194,
+        0.8246122308333117, 0.8659595032122595, 0.9020988069688743, 0.9328128082786765,
+        0.9579168192137917, 0.9772599499837743, 0.990726238699457, 0.9982377097105593,
+        // n = 41
+        -0.9983215885747715, -0.9911671096990163, -0.9783386735610833, -0.9599068917303463,
+        -0.9359769874978539, -0.9066859447581012, -0.8722015116924414, -0.8327212004013613,
+        -0.7884711450474093, -0.7397048030699261, -0.6867015020349513, -0.6297648390721964,
+        -0.5692209416102159, -0.5054165991994061, -0.43871727705140706, -0.36950502264048146,
+        -0.29817627734182484, -0.22513960563342278, -0.15081335486399217, -0.075623258989163,
+        0, 0.075623258989163, 0.15081335486399217, 0.22513960563342278,
+        0.29817627734182484, 0.36950502264048146, 0.43871727705140706, 0.5054165991994061,
+        0.5692209416102159, 0.6297648390721964, 0.6867015020349513, 0.7397048030699261,
+        0.7884711450474093, 0.8327212004013613, 0.8722015116924414, 0.9066859447581012,
+        0.9359769874978539, 0.9599068917303463, 0.9783386735610833, 0.9911671096990163,
+        0.9983215885747715,
+        // n = 42
+        -0.9983996189900625, -0.9915772883408609, -0.9793425080637482, -0.9617593653382045,
+        -0.9389235573549882, -0.9109597249041275, -0.8780205698121727, -0.8402859832618169,
+        -0.7979620532554874, -0.7512799356894805, -0.7004945905561712, -0.6458833888692478,
+        -0.5877445974851093, -0.5263957499311923, -0.4621719120704219, -0.39542385204297503,
+        -0.3265161244654115, -0.25582507934287907, -0.18373680656485455, -0.11064502720851987,
+        -0.03694894316535178, 0.03694894316535178, 0.11064502720851987, 0.18373680656485455,
+        0.25582507934287907, 0.3265161244654115, 0.39542385204297503, 0.4621719120704219,
+        0.5263957499311923, 0.5877445974851093, 0.6458833888692478, 0.7004945905561712,
+        0.7512799356894805, 0.7979620532554874, 0.8402859832618169, 0.8780205698121727,
+        0.9109597249041275, 0.9389235573549882, 0.9617593653382045, 0.9793425080637482,
+        0.9915772883408609, 0.9983996189900625,
+        // n = 43
+        -0.9984723322425078, -0.9919595575932442, -0.9802782209802554, -0.96348661301408,
+        -0.9416719568476378, -0.9149479072061387, -0.8834537652186168, -0.847353716209315,
+        -0.8068359641369386, -0.7621117471949551, -0.7134142352689571, -0.6609973137514982,
+        -0.605134259639601, -0.5461163166600848, -0.4842511767857347, -0.41986137602926926,
+        -0.3532826128643038, -0.2848619980329136, -0.2149562448605182, -0.14392980951071332,
+        -0.07215299087458624, 1.232595164407831E-32, 0.07215299087458624, 0.14392980951071332,
+        0.2149562448605182, 0.2848619980329136, 0.3532826128643038, 0.41986137602926926,
+        0.4842511767857347, 0.5461163166600848, 0.605134259639601, 0.6609973137514982,
+        0.7134142352689571, 0.7621117471949551, 0.8068359641369386, 0.847353716209315,
+        0.8834537652186168, 0.9149479072061387, 0.9416719568476378, 0.96348661301408,
+        0.9802782209802554, 0.9919595575932442, 0.9984723322425078,
+        // n = 44
+        -0.9985402006367742, -0.9923163921385157, -0.981151833077914, -0.9650996504224931,
+        -0.9442395091181941, -0.9186752599841758, -0.8885342382860432, -0.8539665950047104,
+        -0.815144539645135, -0.7722614792487559, -0.725531053660717, -0.6751860706661224,
+        -0.6214773459035758, -0.5646724531854708, -0.5050543913882023, -0.4429201745254115,
+        -0.3785793520147071, -0.3123524665027858, -0.24456945692820126, -0.17556801477551678,
+        -0.10569190170865325, -0.035289236964135356, 0.035289236964135356, 0.10569190170865325,
+        0.17556801477551678, 0.24456945692820126, 0.3123524665027858, 0.3785793520147071,
+        0.4429201745254115, 0.5050543913882023, 0.5646724531854708, 0.6214773459035758,
+        0.6751860706661224, 0.725531053660717, 0.7722614792487559, 0.815144539645135,
+        0.8539665950047104, 0.8885342382860432, 0.9186752599841758, 0.9442395091181941,
+        0.9650996504224931, 0.981151833077914, 0.9923163921385157, 0.9985402006367742,
+        // n = 45
+        -0.9986036451819367, -0.9926499984472037, -0.9819687150345405, -0.9666083103968947,
+        -0.9466416909956291, -0.9221639367190004, -0.8932916717532418, -0.8601624759606642,
+        -0.8229342205020863, -0.7817843125939062, -0.7369088489454904, -0.6885216807712005,
+        -0.6368533944532233, -0.5821502125693532, -0.5246728204629161, -0.4646951239196351,
+        -0.4025029438585419, -0.33839265425060217, -0.27266976975237756, -0.20564748978326375,
+        -0.13764520598325303, -0.06898698016314417, 0, 0.06898698016314417,
+        0.13764520598325303, 0.20564748978326375, 0.27266976975237756, 0.33839265425060217,
+        0.4025029438585419, 0.4646951239196351, 0.5246728204629161, 0.5821502125693532,
+        0.6368533944532233, 0.6885216807712005, 0.7369088489454904, 0.7817843125939062,
+        0.8229342205020863, 0.8601624759606642, 0.8932916717532418, 0.9221639367190004,
+        0.9466416909956291, 0.9666083103968947, 0.9819687150345405, 0.9926499984472037,
+        0.9986036451819367,
+        // n = 46
+        -0.998663042133818, -0.9929623489061744, -0.9827336698041669, -0.9680213918539919,
+        -0.9488923634460898, -0.9254337988067539, -0.897752711533942, -0.865975394866858,
+        -0.8302468370660661, -0.7907300570752742, -0.7476053596156661, -0.7010695120204057,
+        -0.6513348462019977, -0.5986282897127152, -0.5431903302618026, -0.4852739183881647,
+        -0.4251433132828284, -0.3630728770209957, -0.29934582270187005, -0.23425292220626975,
+        -0.16809117946710353, -0.10116247530558424, -0.033772190016052035, 0.033772190016052035,
+        0.10116247530558424, 0.16809117946710353, 0.23425292220626975, 0.29934582270187005,
+        0.3630728770209957, 0.4251433132828284, 0.4852739183881647, 0.5431903302618026,
+        0.5986282897127152, 0.6513348462019977, 0.7010695120204057, 0.7476053596156661,
+        0.7907300570752742, 0.8302468370660661, 0.865975394866858, 0.897752711533942,
+        0.9254337988067539, 0.9488923634460898, 0.9680213918539919, 0.9827336698041669,
+        0.9929623489061744, 0.998663042133818,
+        // n = 47
+        -0.9987187285842121, -0.9932552109877686, -0.9834510030716237, -0.9693467873265645,
+        -0.9510039692577085, -0.9285026930123607, -0.9019413294385253, -0.8714360157968963,
+        -0.8371201398999021, -0.799143754167742, -0.7576729184454386, -0.7128889734090643,
+        -0.6649877473903327, -0.6141786999563736, -0.5606840059346642, -0.5047375838635779,
+        -0.4465840731048557, -0.38647776408466716, -0.3246814863377359, -0.26146545921497455,
+        -0.19710611027911182, -0.1318848665545149, -0.06608692391635568, 0,
+        0.06608692391635568, 0.1318848665545149, 0.19710611027911182, 0.26146545921497455,
+        0.3246814863377359, 0.38647776408466716, 0.4465840731048557, 0.5047375838635779,
+        0.5606840059346642, 0.6141786999563736, 0.6649877473903327, 0.7128889734090643,
+        0.7576729184454386, 0.799143754167742, 0.8371201398999021, 0.8714360157968963,
+        0.9019413294385253, 0.9285026930123607, 0.9510039692577085, 0.9693467873265645,
+        0.9834510030716237, 0.9932552109877686, 0.9987187285842121,
+        // n = 48
+        -0.9987710072524261, -0.9935301722663508, -0.9841245837228269, -0.9705915925462473,
+        -0.9529877031604308, -0.9313866907065543, -0.9058791367155696, -0.8765720202742479,
+        -0.8435882616243935, -0.8070662040294426, -0.7671590325157404, -0.7240341309238146,
+        -0.6778723796326639, -0.6288673967765136, -0.5772247260839727, -0.523160974722233,
+        -0.4669029047509584, -0.4086864819907167, -0.34875588629216075, -0.28736248735545555,
+        -0.22476379039468905, -0.16122235606889174, -0.0970046992094627, -0.03238017096286937,
+        0.03238017096286937, 0.0970046992094627, 0.16122235606889174, 0.22476379039468905,
+        0.28736248735545555, 0.34875588629216075, 0.4086864819907167, 0.4669029047509584,
+        0.523160974722233, 0.5772247260839727, 0.6288673967765136, 0.6778723796326639,
+        0.7240341309238146, 0.7671590325157404, 0.8070662040294426, 0.8435882616243935,
+        0.8765720202742479, 0.9058791367155696, 0.9313866907065543, 0.9529877031604308,
+        0.9705915925462473, 0.9841245837228269, 0.9935301722663508, 0.9987710072524261,
+        // n = 49
+        -0.9988201506066354, -0.9937886619441678, -0.984757895914213, -0.9717622009015554,
+        -0.9548536586741372, -0.9341002947558101, -0.9095856558280733, -0.8814084455730089,
+        -0.8496821198441658, -0.8145344273598555, -0.7761068943454467, -0.7345542542374027,
+        -0.6900438244251321, -0.6427548324192377, -0.5928776941089007, -0.5406132469917261,
+        -0.48617194145249204, -0.42977299334157654, -0.3716435012622849, -0.31201753211974875,
+        -0.2511351786125773, -0.1892415924618136, -0.12658599726967204, -0.06342068498268678,
+        2.465190328815662E-32, 0.06342068498268678, 0.12658599726967204, 0.1892415924618136,
+        0.2511351786125773, 0.31201753211974875, 0.3716435012622849, 0.42977299334157654,
+        0.48617194145249204, 0.5406132469917261, 0.5928776941089007, 0.6427548324192377,
+        0.6900438244251321, 0.7345542542374027, 0.7761068943454467, 0.8145344273598555,
+        0.8496821198441658, 0.8814084455730089, 0.9095856558280733, 0.9341002947558101,
+        0.9548536586741372, 0.9717622009015554, 0.984757895914213, 0.9937886619441678,
+        0.9988201506066354,
+        // n = 50
+        -0.998866404420071, -0.9940319694320907, -0.9853540840480058, -0.972864385106692,
+        -0.9566109552428079, -0.936656618944878, -0.9130785566557919, -0.8859679795236131,
+        -0.8554297694299461, -0.821582070859336, -0.7845558329003992, -0.7444943022260685,
+        -0.7015524687068222, -0.6558964656854394, -0.6077029271849502, -0.5571583045146501,
+        -0.5044581449074642, -0.44980633497403877, -0.39341431189756515, -0.33550024541943735,
+        -0.276288193779532, -0.21600723687604176, -0.1548905899981459, -0.09317470156008614,
+        -0.03109833832718887, 0.03109833832718887, 0.09317470156008614, 0.1548905899981459,
+        0.21600723687604176, 0.276288193779532, 0.33550024541943735, 0.39341431189756515,
+        0.44980633497403877, 0.5044581449074642, 0.5571583045146501, 0.6077029271849502,
+        0.6558964656854394, 0.7015524687068222, 0.7444943022260685, 0.7845558329003992,
+        0.821582070859336, 0.8554297694299461, 0.8859679795236131, 0.9130785566557919,
+        0.936656618944878, 0.9566109552428079, 0.972864385106692, 0.9853540840480058,
+        0.9940319694320907, 0.998866404420071,
+        // n = 51
+        -0.9989099908489035, -0.9942612604367526, -0.985915991735903, -0.9739033680193239,
+        -0.9582678486139082, -0.9390675440029624, -0.9163738623097802, -0.8902712180295272,
+        -0.8608567111822923, -0.8282397638230649, -0.7925417120993812, -0.7538953544853755,
+        -0.7124444575770367, -0.6683432211753702, -0.6217557046007233, -0.5728552163513039,
+        -0.5218236693661858, -0.4688509042860411, -0.4141339832263039, -0.3578764566884095,
+        -0.3002876063353319, -0.24158166644779872, -0.18197702695707754, -0.12169542101888876,
+        -0.06096110015057873, -1.232595164407831E-32, 0.06096110015057873, 0.12169542101888876,
+        0.18197702695707754, 0.24158166644779872, 0.3002876063353319, 0.3578764566884095,
+        0.4141339832263039, 0.4688509042860411, 0.5218236693661858, 0.5728552163513039,
+        0.6217557046007233, 0.6683432211753702, 0.7124444575770367, 0.7538953544853755,
+        0.7925417120993812, 0.8282397638230649, 0.8608567111822923, 0.8902712180295272,
+        0.9163738623097802, 0.9390675440029624, 0.9582678486139082, 0.9739033680193239,
+        0.985915991735903, 0.9942612604367526, 0.9989099908489035,
+        // n = 52
+        -0.9989511111039503, -0.9944775909292161, -0.9864461956515499, -0.9748838842217445,
+        -0.9598318269330866, -0.9413438536413591, -0.9194861289164246, -0.8943368905344953,
+        -0.8659861628460676, -0.8345354323267345, -0.8000972834304683, -0.7627949951937449,
+        -0.7227620997499832, -0.6801419042271677, -0.6350869776952459, -0.5877586049795791,
+        -0.5383262092858274, -0.48696674569809606, -0.4338640677187617, -0.3792082691160937,
+        -0.32319500343480784, -0.2660247836050018, -0.20790226415636606, -0.14903550860694917,
+        -0.08963524464890057, -0.029914109797338766, 0.029914109797338766, 0.08963524464890057,
+        0.14903550860694917, 0.20790226415636606, 0.2660247836050018, 0.32319500343480784,
+        0.3792082691160937, 0.4338640677187617, 0.48696674569809606, 0.5383262092858274,
+        0.5877586049795791, 0.6350869776952459, 0.6801419042271677, 0.7227620997499832,
+        0.7627949951937449, 0.8000972834304683, 0.8345354323267345, 0.8659861628460676,
+        0.8943368905344953, 0.9194861289164246, 0.9413438536413591, 0.9598318269330866,
+        0.9748838842217445, 0.9864461956515499, 0.9944775909292161, 0.9989511111039503,
+        // n = 53
+        -0.9989899477763282, -0.9946819193080071, -0.9869470350233716, -0.9758102337149845,
+        -0.9613096946231363, -0.9434953534644419, -0.9224286030428122, -0.8981820578754266,
+        -0.8708392975582413, -0.8404945765458014, -0.8072524984168955, -0.7712276549255324,
+        -0.7325442308075103, -0.6913355756013667, -0.64774374391651, -0.6019190057137693,
+        -0.5540193282770679, -0.5042098316571334, -0.4526622194618458, -0.39955418695395295,
+        -0.34506880849572236, -0.2893939064516262, -0.23272140372427258, -0.17524666215532575,
+        -0.11716780907195515, -0.058685054300259464, -1.232595164407831E-32, 0.058685054300259464,
+        0.11716780907195515, 0.17524666215532575, 0.23272140372427258, 0.2893939064516262,
+        0.34506880849572236, 0.39955418695395295, 0.4526622194618458, 0.5042098316571334,
+        0.5540193282770679, 0.6019190057137693, 0.64774374391651, 0.6913355756013667,
+        0.7325442308075103, 0.7712276549255324, 0.8072524984168955, 0.8404945765458014,
+        0.8708392975582413, 0.8981820578754266, 0.9224286030428122, 0.9434953534644419,
+        0.9613096946231363, 0.9758102337149845, 0.9869470350233716, 0.9946819193080071,
+        0.9989899477763282,
+        // n = 54
+        -0.999026666867341, -0.9948751170183389, -0.9874206373973435, -0.9766863288579033,
+        -0.9627076457859236, -0.9455309751649958, -0.9252133598666514, -0.9018222862847016,
+        -0.8754354540655689, -0.846140515970773, -0.8140347859135678, -0.779224915346254,
+        -0.7418265388091844, -0.7019638897191729, -0.6597693876319831, -0.6153831983311273,
+        -0.5689527681952095, -0.520632334385933, -0.4705824124813823, -0.4189692632552045,
+        -0.36596434037219117, -0.3117437208344682, -0.2564875200699973, -0.20037929360621357,
+        -0.14360542731625614, -0.08635451826324822, -0.02881674819934178, 0.02881674819934178,
+        0.08635451826324822, 0.14360542731625614, 0.20037929360621357, 0.2564875200699973,
+        0.3117437208344682, 0.36596434037219117, 0.4189692632552045, 0.4705824124813823,
+        0.520632334385933, 0.5689527681952095, 0.6153831983311273, 0.6597693876319831,
+        0.7019638897191729, 0.7418265388091844, 0.779224915346254, 0.8140347859135678,
+        0.846140515970773, 0.8754354540655689, 0.9018222862847016, 0.9252133598666514,
+        0.9455309751649958, 0.9627076457859236, 0.9766863288579033, 0.9874206373973435,
+        0.9948751170183389, 0.999026666867341,
+        // n = 55
+        -0.9990614195648185, -0.9950579778474119, -0.9878689411988892, -0.9775157355039892,
+        -0.9640313285931352, -0.9474588680412107, -0.9278514247207917, -0.905271800744,
+        -0.8797923224198955, -0.8514946066171545, -0.8204692985593209, -0.7868157811276223,
+        -0.7506418563480219, -0.7120633999866378, -0.6712039903198264, -0.6281945122499282,
+        -0.5831727380260321, -0.5362828859083433, -0.4876751581874741, -0.4375052600371746,
+        -0.38593390074097944, -0.3331262788900239, -0.2792515532008065, -0.22448230064784547,
+        -0.16899396364687322, -0.11296428805932927, -0.056572753818336784, -1.232595164407831E-32,
+        0.056572753818336784, 0.11296428805932927, 0.16899396364687322, 0.22448230064784547,
+        0.2792515532008065, 0.3331262788900239, 0.38593390074097944, 0.4375052600371746,
+        0.4876751581874741, 0.5362828859083433, 0.5831727380260321, 0.6281945122499282,
+        0.6712039903198264, 0.7120633999866378, 0.7506418563480219, 0.7868157811276223,
+        0.8204692985593209, 0.8514946066171545, 0.8797923224198955, 0.905271800744,
+        0.9278514247207917, 0.9474588680412107, 0.9640313285931352, 0.9775157355039892,
+        0.9878689411988892, 0.9950579778474119, 0.9990614195648185,
+        // n = 56
+        -0.9990943438014656, -0.9952312260810697, -0.9882937155401615, -0.9783017091402564,
+        -0.9652859019054901, -0.9492864795619627, -0.9303528802474963, -0.9085436204206555,
+        -0.8839261083278276, -0.8565764337627486, -0.8265791321428817, -0.7940269228938664,
+        -0.7590204227051289, -0.7216678344501881, -0.6820846126944704, -0.6403931068070069,
+        -0.5967221827706634, -0.5512068248555346, -0.5039877183843817, -0.45521081487845955,
+        -0.40502688092709127, -0.3535910321749545, -0.3010622538672207, -0.24760290943433721,
+        -0.19337823863527526, -0.13855584681037625, -0.08330518682243537, -0.02779703528727544,
+        0.02779703528727544, 0.08330518682243537, 0.13855584681037625, 0.19337823863527526,
+        0.24760290943433721, 0.3010622538672207, 0.3535910321749545, 0.40502688092709127,
+        0.45521081487845955, 0.5039877183843817, 0.5512068248555346, 0.5967221827706634,
+        0.6403931068070069, 0.6820846126944704, 0.7216678344501881, 0.7590204227051289,
+        0.7940269228938664, 0.8265791321428817, 0.8565764337627486, 0.8839261083278276,
+        0.9085436204206555, 0.9303528802474963, 0.9492864795619627, 0.9652859019054901,
+        0.9783017091402564, 0.9882937155401615, 0.9952312260810697, 0.9990943438014656,
+        // n = 57
+        -0.9991255656252629, -0.9953955236784303, -0.988696577650222, -0.9790472267094688,
+        -0.9664760851718867, -0.9510206264478768, -0.9327269610671017, -0.9116496785213912,
+        -0.8878516788822213, -0.8614039832620469, -0.8323855211504391, -0.8008828945472183,
+        -0.7669901193594502, -0.7308083447445234, -0.6924455511995177, -0.6520162282809769,
+        -0.6096410329087154, -0.5654464292692368, -0.5195643113911876, -0.4721316095179757,
+        -0.42328988145156393, -0.37318489008659445, -0.32196616839537867, -0.26978657316183874,
+        -0.21680182879612403, -0.16317006259126424, -0.1090513328087878, -0.05460715100164683,
+        0, 0.05460715100164683, 0.1090513328087878, 0.16317006259126424,
+        0.21680182879612403, 0.26978657316183874, 0.32196616839537867, 0.37318489008659445,
+        0.42328988145156393, 0.4721316095179757, 0.5195643113911876, 0.5654464292692368,
+        0.6096410329087154, 0.6520162282809769, 0.6924455511995177, 0.7308083447445234,
+        0.7669901193594502, 0.8008828945472183, 0.8323855211504391, 0.8614039832620469,
+        0.8878516788822213, 0.9116496785213912, 0.9327269610671017, 0.9510206264478768,
+        0.9664760851718867, 0.9790472267094688, 0.988696577650222, 0.9953955236784303,
+        0.9991255656252629,
+        // n = 58
+        -0.9991552004073866, -0.9955514765972909, -0.9890790082484426, -0.9797550146943503,
+        -0.9676062025029241, -0.9526675575188691, -0.9349821375882593, -0.9146009285643526,
+        -0.8915826920220302, -0.8659937940748075, -0.8379080133393734, -0.8074063279130881,
+        -0.7745766817496528, -0.7395137310200423, -0.7023185711539082, -0.6630984453321253,
+        -0.6219664352630792, -0.579041135130225, -0.5344463096488475, -0.48831053721671847,
+        -0.44076683918683957, -0.3919522963307532, -0.34200765359799523, -0.2910769143111092,
+        -0.23930692496615347, -0.1868469518357613, -0.13384825059546687, -0.08046363021414273,
+        -0.026847012365942353, 0.026847012365942353, 0.08046363021414273, 0.13384825059546687,
+        0.1868469518357613, 0.23930692496615347, 0.2910769143111092, 0.34200765359799523,
+        0.3919522963307532, 0.44076683918683957, 0.48831053721671847, 0.5344463096488475,
+        0.579041135130225, 0.6219664352630792, 0.6630984453321253, 0.7023185711539082,
+        0.7395137310200423, 0.7745766817496528, 0.8074063279130881, 0.8379080133393734,
+        0.8659937940748075, 0.8915826920220302, 0.9146009285643526, 0.9349821375882593,
+        0.9526675575188691, 0.9676062025029241, 0.9797550146943503, 0.9890790082484426,
+        0.9955514765972909, 0.9991552004073866,
+        // n = 59
+        -0.9991833539092947, -0.995699640383246, -0.989442365133731, -0.9804275739567156,
+        -0.9686802216817816, -0.9542330093769511, -0.9371261903534539, -0.9174074387881553,
+        -0.8951317117434721, -0.8703610942928822, -0.8431646258168722, -0.8136181072882116,
+        -0.7818038898623609, -0.7478106452786403, -0.7117331186771977, -0.6736718645049372,
+        -0.6337329662388501, -0.5920277407040302, -0.5486724278083964, -0.503787866557718,
+        -0.4574991582532667, -0.409935317810419, -0.3612289141697948, -0.3115157008030137,
+        -0.2609342373428117, -0.20962550339203656, -0.15773250558785798, -0.10539987901634414,
+        -0.05277348408831, 0, 0.05277348408831, 0.10539987901634414,
+        0.15773250558785798, 0.20962550339203656, 0.2609342373428117, 0.3115157008030137,
+        0.3612289141697948, 0.409935317810419, 0.4574991582532667, 0.503787866557718,
+        0.5486724278083964, 0.5920277407040302, 0.6337329662388501, 0.6736718645049372,
+        0.7117331186771977, 0.7478106452786403, 0.7818038898623609, 0.8136181072882116,
+        0.8431646258168722, 0.8703610942928822, 0.8951317117434721, 0.9174074387881553,
+        0.9371261903534539, 0.9542330093769511, 0.9686802216817816, 0.9804275739567156,
+        0.989442365133731, 0.995699640383246, 0.9991833539092947,
+        // n = 60
+        -0.999210123227436, -0.9958405251188381, -0.9897878952222218, -0.9810672017525982,
+        -0.9697017887650528, -0.9557222558399961, -0.9391662761164232, -0.9200784761776275,
+        -0.898510310810046, -0.8745199226468983, -0.8481719847859297, -0.8195375261621458,
+        -0.7886937399322641, -0.7557237753065856, -0.7207165133557304, -0.6837663273813555,
+        -0.644972828489477, -0.6044405970485104, -0.5622789007539445, -0.5186014000585697,
+        -0.4735258417617071, -0.4271737415830784, -0.379670056576798, -0.3311428482684482,
+        -0.2817229374232617, -0.23154355137602933, -0.18073996487342542, -0.129449135396945,
+        -0.07780933394953655, -0.025959772301247803, 0.025959772301247803, 0.07780933394953655,
+        0.129449135396945, 0.18073996487342542, 0.23154355137602933, 0.2817229374232617,
+        0.3311428482684482, 0.379670056576798, 0.4271737415830784, 0.4735258417617071,
+        0.5186014000585697, 0.5622789007539445, 0.6044405970485104, 0.644972828489477,
+        0.6837663273813555, 0.7207165133557304, 0.7557237753065856, 0.7886937399322641,
+        0.8195375261621458, 0.8481719847859297, 0.8745199226468983, 0.898510310810046,
+        0.9200784761776275, 0.9391662761164232, 0.9557222558399961, 0.9697017887650528,
+        0.9810672017525982, 0.9897878952222218, 0.9958405251188381, 0.999210123227436,
+        // n = 61
+        -0.9992355976313635, -0.9959745998151203, -0.990116745232517, -0.9816760112840371,
+        -0.9706742588331829, -0.9571401519129841, -0.9411089866813611, -0.9226225813829553,
+        -0.9017291624740011, -0.8784832372148811, -0.8529454508476635, -0.8251824281086599,
+        -0.7952665992823597, -0.7632760111723123, -0.7292941234494651, -0.6934095908944912,
+        -0.6557160320950709, -0.6163117851979217, -0.5752996513508306, -0.5327866265029253,
+        -0.4888836222622521, -0.4437051765385316, -0.3973691547257566, -0.34999644220406684,
+        -0.3017106289630307, -0.2526376871690535, -0.20290564251805848, -0.1526442402308153,
+        -0.10198460656227407, -0.05105890670797435, 0, 0.05105890670797435,
+        0.10198460656227407, 0.1526442402308153, 0.20290564251805848, 0.2526376871690535,
+        0.3017106289630307, 0.34999644220406684, 0.3973691547257566, 0.4437051765385316,
+        0.4888836222622521, 0.5327866265029253, 0.5752996513508306, 0.6163117851979217,
+        0.6557160320950709, 0.6934095908944912, 0.7292941234494651, 0.7632760111723123,
+        0.7952665992823597, 0.8251824281086599, 0.8529454508476635, 0.8784832372148811,
+        0.9017291624740011, 0.9226225813829553, 0.9411089866813611, 0.9571401519129841,
+        0.9706742588331829, 0.9816760112840371, 0.990116745232517, 0.9959745998151203,
+        0.9992355976313635,
+        // n = 62
+        -0.999259859308777, -0.9961022963162671, -0.9904299711892903, -0.9822559490972367,
+        -0.9716007233716518, -0.958491172973927, -0.9429604013923285, -0.9250476356362037,
+        -0.9047981225210935, -0.8822630128318973, -0.857499231512071, -0.8305693336040049,
+        -0.8015413461039763, -0.7704885960554193, -0.7374895252831567, -0.702627492222297,
+        -0.6659905613354794, -0.6276712806468852, -0.5877664479530873, -0.5463768663002511,
+        -0.503607089344756, -0.4595651572401134, -0.41436232371712606, -0.36811277504656453,
+        -0.320933341594194, -0.27294320269672634, -0.22426358560416554, -0.17501745924901563,
+        -0.12532922361589682, -0.07532439549623433, -0.025129291421820625, 0.025129291421820625,
+        0.07532439549623433, 0.12532922361589682, 0.17501745924901563, 0.22426358560416554,
+        0.27294320269672634, 0.320933341594194, 0.36811277504656453, 0.41436232371712606,
+        0.4595651572401134, 0.503607089344756, 0.5463768663002511, 0.5877664479530873,
+        0.6276712806468852, 0.6659905613354794, 0.702627492222297, 0.7374895252831567,
+        0.7704885960554193, 0.8015413461039763, 0.8305693336040049, 0.857499231512071,
+        0.8822630128318973, 0.9047981225210935, 0.9250476356362037, 0.9429604013923285,
+        0.958491172973927, 0.9716007233716518, 0.9822559490972367, 0.9904299711892903,
+        0.9961022963162671, 0.999259859308777,
+        // n = 63
+        -0.9992829840291237, -0.9962240127779701, -0.9907285468921895, -0.9828088105937273,
+        -0.97248403469757, -0.9597794497589419, -0.9447261340410098, -0.9273609206218432,
+        -0.9077263027785316, -0.8858703285078534, -0.8618464823641238, -0.8357135543195029,
+        -0.8075354957734567, -0.7773812629903724, -0.7453246483178474, -0.7114440995848458,
+        -0.6758225281149861, -0.6385471058213654, -0.5997090518776252, -0.559403409486285,
+        -0.5177288132900333, -0.4747872479948044, -0.4306837987951116, -0.3855263942122479,
+        -0.3394255419745844, -0.29249405858625144, -0.24484679324595335, -0.19660034679150667,
+        -0.14787278635787196, -0.09878335644694528, -0.04945218711615963, 0,
+        0.04945218711615963, 0.09878335644694528, 0.14787278635787196, 0.19660034679150667,
+        0.24484679324595335, 0.29249405858625144, 0.3394255419745844, 0.3855263942122479,
+        0.4306837987951116, 0.4747872479948044, 0.5177288132900333, 0.559403409486285,
+        0.5997090518776252, 0.6385471058213654, 0.6758225281149861, 0.7114440995848458,
+        0.7453246483178474, 0.7773812629903724, 0.8075354957734567, 0.8357135543195029,
+        0.8618464823641238, 0.8858703285078534, 0.9077263027785316, 0.9273609206218432,
+        0.9447261340410098, 0.9597794497589419, 0.97248403469757, 0.9828088105937273,
+        0.9907285468921895, 0.9962240127779701, 0.9992829840291237,
+        // n = 64
+        -0.9993050417357722, -0.9963401167719552, -0.9910133714767443, -0.983336253884626,
+        -0.973326827789911, -0.9610087996520538, -0.9464113748584028, -0.9295691721319396,
+        -0.9105221370785028, -0.8893154459951141, -0.8659993981540929, -0.8406292962525804,
+        -0.8132653151227975, -0.7839723589433414, -0.7528199072605319, -0.7198818501716109,
+        -0.6852363130542333, -0.6489654712546573, -0.6111553551723933, -0.571895646202634,
+        -0.5312794640198946, -0.48940314570705296, -0.4463660172534641, -0.4022701579639916,
+        -0.3572201583376681, -0.31132287199021097, -0.2646871622087674, -0.21742364374000708,
+        -0.1696444204239928, -0.12146281929612056, -0.07299312178779904, -0.02435029266342443,
+        0.02435029266342443, 0.07299312178779904, 0.12146281929612056, 0.1696444204239928,
+        0.21742364374000708, 0.2646871622087674, 0.31132287199021097, 0.3572201583376681,
+        0.4022701579639916, 0.4463660172534641, 0.48940314570705296, 0.5312794640198946,
+        0.571895646202634, 0.6111553551723933, 0.6489654712546573, 0.6852363130542333,
+        0.7198818501716109, 0.7528199072605319, 0.7839723589433414, 0.8132653151227975,
+        0.8406292962525804, 0.8659993981540929, 0.8893154459951141, 0.9105221370785028,
+        0.9295691721319396, 0.9464113748584028, 0.9610087996520538, 0.973326827789911,
+        0.983336253884626, 0.9910133714767443, 0.9963401167719552, 0.9993050417357722,
+    };
+
+    /// <summary>Gauss-Legendre weights.</summary>
+    public static ReadOnlySpan<double> LegendreWeights => LegendreWeightsTable;
+
+    private static readonly double[] LegendreWeightsTable =
+    {
+        // n = 1
+        2,
+        // n = 2
+        1.0000000000000002, 1.0000000000000002,
+        // n = 3
+        0.5555555555555527, 0.8888888888888888, 0.5555555555555527,
+        // n = 4
+        0.34785484513745374, 0.6521451548625464, 0.6521451548625464, 0.34785484513745374,
+        // n = 5
+        0.236926885056189, 0.47862867049936647, 0.5688888888888889, 0.47862867049936647,
+        0.236926885056189,
+        // n = 6
+        0.1713244923791705, 0.3607615730481386, 0.46791393457269126, 0.46791393457269126,
+        0.3607615730481386, 0.1713244923791705,
+        // n = 7
+        0.12948496616886968, 0.2797053914892767, 0.38183005050511903, 0.4179591836734694,
+        0.38183005050511903, 0.2797053914892767, 0.12948496616886968,
+        // n = 8
+        0.10122853629037679, 0.22238103445337445, 0.3137066458778874, 0.362683783378362,
+        0.362683783378362, 0.3137066458778874, 0.22238103445337445, 0.10122853629037679,
+        // n = 9
+        0.08127438836157463, 0.18064816069485756, 0.26061069640293555, 0.3123470770400029,
+        0.3302393550012598, 0.3123470770400029, 0.26061069640293555, 0.18064816069485756,
+        0.08127438836157463,
+        // n = 10
+        0.06667134430868371, 0.14945134915058053, 0.21908636251598218, 0.26926671930999624,
+        0.2955242247147529, 0.2955242247147529, 0.26926671930999624, 0.21908636251598218,
+        0.14945134915058053, 0.06667134430868371,
+        // n = 11
+        0.055668567116169604, 0.12558036946490472, 0.18629021092773426, 0.2331937645919903,
+        0.2628045445102466, 0.2729250867779006, 0.2628045445102466, 0.2331937645919903,
+        0.18629021092773426, 0.12558036946490472, 0.055668567116169604,
+        // n = 12
+        0.04717533638650846, 0.10693932599531818, 0.16007832854334633, 0.20316742672306584,
+        0.23349253653835458, 0.24914704581340288, 0.24914704581340288, 0.23349253653835458,
+        0.20316742672306584, 0.16007832854334633, 0.10693932599531818, 0.04717533638650846,
+        // n = 13
+        0.0404840047653123, 0.09212149983772838, 0.1388735102197872, 0.17814598076194568,
+        0.2078160475368884, 0.22628318026289715, 0.2325515532308739, 0.22628318026289715,
+        0.2078160475368884, 0.17814598076194568, 0.1388735102197872, 0.09212149983772838,
+        0.0404840047653123,
+        // n = 14
+        0.03511946033174906, 0.08015808715976037, 0.12151857068790312, 0.1572031671581936,
+        0.18553839747793785, 0.2051984637212955, 0.21526385346315777, 0.21526385346315777,
+        0.2051984637212955, 0.18553839747793785, 0.1572031671581936, 0.12151857068790312,
+        0.08015808715976037, 0.03511946033174906,
+        // n = 15
+        0.03075324199611479, 0.07036604748810814, 0.10715922046717204, 0.13957067792615427,
+        0.16626920581699398, 0.18616100001556224, 0.1984314853271116, 0.2025782419255613,
+        0.1984314853271116, 0.18616100001556224, 0.16626920581699398, 0.13957067792615427,
+        0.10715922046717204, 0.07036604748810814, 0.03075324199611479,
+        // n = 16
+        0.02715245941175185, 0.062253523938647776, 0.0951585116824929, 0.12462897125553395,
+        0.14959598881657682, 0.16915651939500242, 0.1826034150449236, 0.18945061045506847,
+        0.18945061045506847, 0.1826034150449236, 0.16915651939500242, 0.14959598881657682,
+        0.12462897125553395, 0.0951585116824929, 0.062253523938647776, 0.02715245941175185,
+        // n = 17
+        0.02414830286854624, 0.05545952937398713, 0.08503614831717915, 0.11188384719340393,
+        0.13513636846852556, 0.15404576107681003, 0.1680041021564499, 0.1765627053669926,
+        0.17944647035620653, 0.1765627053669926, 0.1680041021564499, 0.15404576107681003,
+        0.13513636846852556, 0.11188384719340393, 0.08503614831717915, 0.05545952937398713,
+        0.02414830286854624,
+        // n = 18
+        0.021616013526481397, 0.04971454889496984, 0.07642573025488918, 0.10094204410628722,
+        0.12255520671147836, 0.14064291467065032, 0.1546846751262652, 0.16427648374583267,
+        0.16914238296314354, 0.16914238296314354, 0.16427648374583267, 0.1546846751262652,
+        0.14064291467065032, 0.12255520671147836, 0.10094204410628722, 0.07642573025488918,
+        0.04971454889496984, 0.021616013526481397,
+        // n = 19
+        0.019461788229724844, 0.044814226765699586, 0.06904454273764125, 0.09149002162245014,
+        0.11156664554733409, 0.1287539625393363, 0.14260670217360658, 0.15276604206585973,
+        0.15896884339395442, 0.1610544498487837, 0.15896884339395442, 0.15276604206585973,
+        0.14260670217360658, 0.1287539625393363, 0.11156664554733409, 0.09149002162245014,
+        0.06904454273764125, 0.044814226765699586, 0.019461788229724844,
+        // n = 20
+        0.017614007139150577, 0.04060142980038705, 0.06267204833410904, 0.08327674157670474,
+        0.10193011981724048, 0.11819453196151831, 0.1316886384491766, 0.1420961093183819,
+        0.14917298647260382, 0.15275338713072598, 0.15275338713072598, 0.14917298647260382,
+        0.1420961093183819, 0.1316886384491766, 0.11819453196151831, 0.10193011981724048,
+        0.08327674157670474, 0.06267204833410904, 0.04060142980038705, 0.017614007139150577,
+        // n = 21
+        0.016017228257772867, 0.0369537897708525, 0.05713442542685717, 0.07610011362837928,
+        0.0934444234560338, 0.1087972991671485, 0.12183141605372831, 0.13226893863333744,
+        0.13988739479107304, 0.14452440398997, 0.14608113364969041, 0.14452440398997,
+        0.13988739479107304, 0.13226893863333744, 0.12183141605372831, 0.1087972991671485,
+        0.0934444234560338, 0.07610011362837928, 0.05713442542685717, 0.0369537897708525,
+        0.016017228257772867,
+        // n = 22
+        0.014627995298270632, 0.033774901584814165, 0.05229333515268329, 0.06979646842452049,
+        0.08594160621706781, 0.10041414444288103, 0.11293229608053915, 0.12325237681051229,
+        0.1311735047870624, 0.1365414983460151, 0.13925187285563204, 0.13925187285563204,
+        0.1365414983460151, 0.1311735047870624, 0.12325237681051229, 0.11293229608053915,
+        0.10041414444288103, 0.08594160621706781, 0.06979646842452049, 0.05229333515268329,
+        0.033774901584814165, 0.014627995298270632,
+        // n = 23
+        0.013411859487140467, 0.030988005856979334, 0.04803767173108468, 0.0642324214085259,
+        0.079281411776719, 0.09291576606003502, 0.10489209146454119, 0.1149966402224113,
+        0.12304908430672948, 0.12890572218808205, 0.13246203940469664, 0.13365457218610619,
+        0.13246203940469664, 0.12890572218808205, 0.12304908430672948, 0.1149966402224113,
+        0.10489209146454119, 0.09291576606003502, 0.079281411776719, 0.0642324214085259,
+        0.04803767173108468, 0.030988005856979334, 0.013411859487140467,
+        // n = 24
+        0.012341229799985648, 0.028531388628933813, 0.044277438817419676, 0.05929858491543666,
+        0.07334648141108027, 0.08619016153195322, 0.09761865210411368, 0.10744427011596562,
+        0.11550566805372561, 0.12167047292780335, 0.12583745634682839, 0.12793819534675224,
+        0.12793819534675224, 0.12583745634682839, 0.12167047292780335, 0.11550566805372561,
+        0.10744427011596562, 0.09761865210411368, 0.08619016153195322, 0.07334648141108027,
+        0.05929858491543666, 0.044277438817419676, 0.028531388628933813, 0.012341229799985648,
+        // n = 25
+        0.011393798501025093, 0.026354986615032185, 0.04093915670130625, 0.05490469597583531,
+        0.06803833381235701, 0.08014070033500097, 0.09102826198296353, 0.10053594906705052,
+        0.1085196244742636, 0.11485825914571159, 0.11945576353578477, 0.12224244299031009,
+        0.12317605372671545, 0.12224244299031009, 0.11945576353578477, 0.11485825914571159,
+        0.1085196244742636, 0.10053594906705052, 0.09102826198296353, 0.08014070033500097,
+        0.06803833381235701, 0.05490469597583531, 0.04093915670130625, 0.026354986615032185,
+        0.011393798501025093,
+        // n = 26
+        0.010551372617341818, 0.024417851092632073, 0.03796238329436278, 0.0509758252971478,
+        0.06327404632957495, 0.07468414976565983, 0.08504589431348497, 0.09421380035591415,
+        0.1020591610944254, 0.10847184052857663, 0.1133618165463198, 0.1166604434852966,
+        0.11832141527926233, 0.11832141527926233, 0.1166604434852966, 0.1133618165463198,
+        0.10847184052857663, 0.1020591610944254, 0.09421380035591415, 0.08504589431348497,
+        0.07468414976565983, 0.06327404632957495, 0.0509758252971478, 0.03796238329436278,
+        0.024417851092632073, 0.010551372617341818,
+        // n = 27
+        0.009798996051293645, 0.022686231596180707, 0.03529705375741969, 0.04744941252061499,
+        0.05898353685983348, 0.06974882376624558, 0.07960486777305743, 0.0884231585437569,
+        0.09608872737002858, 0.10250163781774585, 0.1075782857885331, 0.11125248835684523,
+        0.11347634610896515, 0.114220867378957, 0.11347634610896515, 0.11125248835684523,
+        0.1075782857885331, 0.10250163781774585, 0.09608872737002858, 0.0884231585437569,
+        0.07960486777305743, 0.06974882376624558, 0.05898353685983348, 0.04744941252061499,
+        0.03529705375741969, 0.022686231596180707, 0.009798996051293645,
+        // n = 28
+        0.009124282593093488, 0.021132112592771344, 0.03290142778230429, 0.04427293475900416,
+        0.055107345675716804, 0.06527292396699966, 0.07464621423456853, 0.08311341722890113,
+        0.09057174439303278, 0.09693065799792991, 0.10211296757806079, 0.10605576592284637,
+        0.10871119225829412, 0.11004701301647515, 0.11004701301647515, 0.10871119225829412,
+        0.10605576592284637, 0.10211296757806079, 0.09693065799792991, 0.09057174439303278,
+        0.08311341722890113, 0.07464621423456853, 0.06527292396699966, 0.055107345675716804,
+        0.04427293475900416, 0.03290142778230429, 0.021132112592771344, 0.009124282593093488,
+        // n = 29
+        0.008516903878745265, 0.019732085056122662, 0.030740492202093652, 0.04140206251868275,
+        0.05159482690249779, 0.061203090657079136, 0.0701179332550509, 0.07823832713576377,
+        0.08547225736617246, 0.09173775713925883, 0.09696383409440862, 0.10109127375991504,
+        0.10407331007772933, 0.10587615509732094, 0.10647938171831425, 0.10587615509732094,
+        0.10407331007772933, 0.10109127375991504, 0.09696383409440862, 0.09173775713925883,
+        0.08547225736617246, 0.07823832713576377, 0.0701179332550509, 0.061203090657079136,
+        0.05159482690249779, 0.04140206251868275, 0.030740492202093652, 0.019732085056122662,
+        0.008516903878745265,
+        // n = 30
+        0.007968192496165472, 0.018466468311090976, 0.0287847078833234, 0.03879919256962709,
+        0.048402672830594066, 0.05749315621761896, 0.06597422988218012, 0.07375597473770507,
+        0.08075589522942012, 0.08689978720108299, 0.09212252223778611, 0.09636873717464436,
+        0.0995934205867952, 0.10176238974840547, 0.10285265289355876, 0.10285265289355876,
+        0.10176238974840547, 0.0995934205867952, 0.09636873717464436, 0.09212252223778611,
+        0.08689978720108299, 0.08075589522942012, 0.07375597473770507, 0.06597422988218012,
+        0.05749315621761896, 0.048402672830594066, 0.03879919256962709, 0.0287847078833234,
+        0.018466468311090976, 0.007968192496165472,
+        // n = 31
+        0.0074708315792485274, 0.01731862079031061, 0.027009019184979367, 0.03643227391238551,
+        0.04549370752720105, 0.05410308242491677, 0.06217478656102814, 0.06962858323541027,
+        0.07639038659877669, 0.08239299176158926, 0.08757674060847796, 0.09189011389364153,
+        0.09529024291231952, 0.09774333538632875, 0.09922501122667231, 0.09972054479342644,
+        0.09922501122667231, 0.09774333538632875, 0.09529024291231952, 0.09189011389364153,
+        0.08757674060847796, 0.08239299176158926, 0.07639038659877669, 0.06962858323541027,
+        0.06217478656102814, 0.05410308242491677, 0.04549370752720105, 0.03643227391238551,
+        0.027009019184979367, 0.01731862079031061, 0.0074708315792485274,
+        // n = 32
+        0.007018610009469521, 0.01627439473090571, 0.02539206530926214, 0.03427386291302141,
+        0.042835898022226704, 0.050998059262376154, 0.05868409347853513, 0.06582222277636181,
+        0.07234579410884862, 0.07819389578707044, 0.08331192422694672, 0.08765209300440374,
+        0.0911738786957639, 0.09384439908080441, 0.09563872007927485, 0.09654008851472785,
+        0.09654008851472785, 0.09563872007927485, 0.09384439908080441, 0.0911738786957639,
+        0.08765209300440374, 0.08331192422694672, 0.07819389578707044, 0.07234579410884862,
+        0.06582222277636181, 0.05868409347853513, 0.050998059262376154, 0.042835898022226704,
+        0.03427386291302141, 0.02539206530926214, 0.01627439473090571, 0.007018610009469521,
+        // n = 33
+        0.006606227847586925, 0.015321701512934691, 0.023915548101749444, 0.03230035863232888,
+        0.040401541331669615, 0.04814774281871169, 0.055470846631663025, 0.0623064825303174,
+        0.06859457281865682, 0.07427985484395408, 0.07931236479488676, 0.08364787606703876,
+        0.08724828761884428, 0.09008195866063856, 0.09212398664331685, 0.09335642606559609,
+        0.09376844616020999, 0.09335642606559609, 0.09212398664331685, 0.09008195866063856,
+        0.08724828761884428, 0.08364787606703876, 0.07931236479488676, 0.07427985484395408,
+        0.06859457281865682, 0.0623064825303174, 0.055470846631663025, 0.04814774281871169,
+        0.040401541331669615, 0.03230035863232888, 0.023915548101749444, 0.015321701512934691,
+        0.006606227847586925,
+        // n = 34
+        0.006229140555908025, 0.01445016274859503, 0.02256372198549494, 0.030491380638446145,
+        0.038166593796387434, 0.045525611523353264, 0.052507414572677706, 0.05905413582752441,
+        0.0651115215540764, 0.07062937581425568, 0.07556197466003195, 0.07986844433977193,
+        0.08351309969984559, 0.08646573974703582, 0.08870189783569384, 0.09020304437064076,
+        0.09095674033025987, 0.09095674033025987, 0.09020304437064076, 0.08870189783569384,
+        0.08646573974703582, 0.08351309969984559, 0.07986844433977193, 0.07556197466003195,
+        0.07062937581425568, 0.0651115215540764, 0.05905413582752441, 0.052507414572677706,
+        0.045525611523353264, 0.038166593796387434, 0.030491380638446145, 0.02256372198549494,
+        0.01445016274859503, 0.006229140555908025,
+        // n = 35
+        0.005883433420442466, 0.013650828348361378, 0.021322979911483544, 0.028829260108894247,
+        0.036110115863463466, 0.043108422326170126, 0.04976937040135312, 0.05604081621236994,
+        0.06187367196608008, 0.06722228526908679, 0.07204479477256012, 0.07630345715544203,
+        0.0799649422423243, 0.08300059372885656, 0.08538665339209912, 0.0871044469971835,
+        0.0881405304302755, 0.08848679490710429, 0.0881405304302755, 0.0871044469971835,
+        0.08538665339209912, 0.08300059372885656, 0.0799649422423243, 0.07630345715544203,
+        0.07204479477256012, 0.06722228526908679, 0.06187367196608008, 0.05604081621236994,
+        0.04976937040135312, 0.043108422326170126, 0.036110115863463466, 0.028829260108894247,
+        0.021322979911483544, 0.013650828348361378, 0.005883433420442466,
+        // n = 36
+        0.005565719664244557, 0.01291594728406542, 0.020181515297735382, 0.027298621498568734,
+        0.03421381077030722, 0.04087575092364488, 0.04723508349026558, 0.05324471397775969,
+        0.0588601442453248, 0.06403979735501548, 0.06874532383573641, 0.07294188500565309,
+        0.07659841064587064, 0.07968782891207167, 0.0821872667043397, 0.08407821897966182,
+        0.08534668573933869, 0.08598327567039482, 0.08598327567039482, 0.08534668573933869,
+        0.08407821897966182, 0.0821872667043397, 0.07968782891207167, 0.07659841064587064,
+        0.07294188500565309, 0.06874532383573641, 0.06403979735501548, 0.0588601442453248,
+        0.05324471397775969, 0.04723508349026558, 0.04087575092364488, 0.03421381077030722,
+        0.027298621498568734, 0.020181515297735382, 0.01291594728406542, 0.005565719664244557,
+        // n = 37
+        0.005273057279497421, 0.01223878010030766, 0.019129044489083938, 0.02588603699055893,
+        0.03246163984752141, 0.03880960250193446, 0.044885364662436776, 0.05064629765482458,
+        0.056051987998274856, 0.06106451652322592, 0.065648722872751, 0.06977245155570033,
+        0.07340677724848815, 0.07652620757052923, 0.07910886183752944, 0.0811366245084651,
+        0.08259527223643717, 0.08347457362586279, 0.0837683609931389, 0.08347457362586279,
+        0.08259527223643717, 0.0811366245084651, 0.07910886183752944, 0.07652620757052923,
+        0.07340677724848815, 0.06977245155570033, 0.065648722872751, 0.06106451652322592,
+        0.056051987998274856, 0.05064629765482458, 0.044885364662436776, 0.03880960250193446,
+        0.03246163984752141, 0.02588603699055893, 0.019129044489083938, 0.01223878010030766,
+        0.005273057279497421,
+        // n = 38
+        0.0050028807496389285, 0.011613444716468758, 0.018156577709613212, 0.0245797397382324,
+        0.03083950054517502, 0.036894081594024734, 0.042703158504674044, 0.0482280618607586,
+        0.05343201991033237, 0.058280399146997126, 0.06274093339213303, 0.06678393797914044,
+        0.07038250706689898, 0.07351269258474345, 0.07615366354844633, 0.07828784465821086,
+        0.07990103324352789, 0.08098249377059713, 0.08152502928038576, 0.08152502928038576,
+        0.08098249377059713, 0.07990103324352789, 0.07828784465821086, 0.07615366354844633,
+        0.07351269258474345, 0.07038250706689898, 0.06678393797914044, 0.06274093339213303,
+        0.058280399146997126, 0.05343201991033237, 0.0482280618607586, 0.042703158504674044,
+        0.036894081594024734, 0.03083950054517502, 0.0245797397382324, 0.018156577709613212,
+        0.011613444716468758, 0.0050028807496389285,
+        // n = 39
+        0.0047529446916345615, 0.011034788939164413, 0.017256229093724876, 0.023369384832178177,
+        0.029334955983903312, 0.03511511149813135, 0.040673276847933475, 0.045974301108916586,
+        0.05098466529212929, 0.05567269034091627, 0.06000873608859612, 0.0639653881386824,
+        0.06751763096623124, 0.07064300597060873, 0.07332175341426857, 0.07553693732283603,
+        0.07727455254468206, 0.0785236132873712, 0.0792762225683686, 0.07952762213944285,
+        0.0792762225683686, 0.0785236132873712, 0.07727455254468206, 0.07553693732283603,
+        0.07332175341426857, 0.07064300597060873, 0.06751763096623124, 0.0639653881386824,
+        0.06000873608859612, 0.05567269034091627, 0.05098466529212929, 0.045974301108916586,
+        0.040673276847933475, 0.03511511149813135, 0.029334955983903312, 0.023369384832178177,
+        0.017256229093724876, 0.011034788939164413, 0.0047529446916345615,
+        // n = 40
+        0.004521277098533099, 0.010498284531152905, 0.016421058381907876, 0.02224584919416689,
+        0.02793700698002337, 0.033460195282547865, 0.03878216797447161, 0.04387090818567314,
+        0.04869580763507221, 0.05322784698393679, 0.05743976909939157, 0.06130624249292889,
+        0.06480401345660108, 0.06791204581523393, 0.07061164739128681, 0.07288658239580408,
+        0.07472316905796833, 0.07611036190062617, 0.077039818164248, 0.0775059479784248,
+        0.0775059479784248, 0.077039818164248, 0.07611036190062617, 0.07472316905796833,
+        0.07288658239580408, 0.07061164739128681, 0.06791204581523393, 0.06480401345660108,
+        0.06130624249292889, 0.05743976909939157, 0.05322784698393679, 0.04869580763507221,
+        0.04387090818567314, 0.03878216797447161, 0.033460195282547865, 0.02793700698002337,
+        0.02224584919416689, 0.016421058381907876, 0.010498284531152905, 0.004521277098533099,
+        // n = 41
+        0.004306140358164751, 0.009999938773905832, 0.015644938407818523, 0.021201063368779482,
+        0.026635899207110385, 0.031918211731699335, 0.03701771670350763, 0.04190519519590949,
+        0.04655264836901431, 0.05093345429461749, 0.05502251924257871, 0.05879642094987206,
+        0.062233542580966354, 0.06531419645352739, 0.06802073676087682, 0.07033766062081755,
+        0.07225169686102302, 0.0737518820272235, 0.07482962317622156, 0.07547874709271575,
+        0.07569553564729838, 0.07547874709271575, 0.07482962317622156, 0.0737518820272235,
+        0.07225169686102302, 0.07033766062081755, 0.06802073676087682, 0.06531419645352739,
+        0.062233542580966354, 0.05879642094987206, 0.05502251924257871, 0.05093345429461749,
+        0.04655264836901431, 0.04190519519590949, 0.03701771670350763, 0.031918211731699335,
+        0.026635899207110385, 0.021201063368779482, 0.015644938407818523, 0.009999938773905832,
+        0.004306140358164751,
+        // n = 42
+        0.004105998604649026, 0.009536220301748529, 0.014922443697357455, 0.020227869569052613,
+        0.02542295952611308, 0.030479240699603456, 0.0353690710975917, 0.04006573518069214,
+        0.04454357777196594, 0.04877814079280328, 0.052746295699174044, 0.05642636935801841,
+        0.05979826222758659, 0.06284355804500256, 0.0655456243649089, 0.067889703376522,
+        0.06986299249259421, 0.071454714265171, 0.07265617524380413, 0.0734608134534675,
+        0.07386423423217282, 0.07386423423217282, 0.0734608134534675, 0.07265617524380413,
+        0.071454714265171, 0.06986299249259421, 0.067889703376522, 0.0655456243649089,
+        0.06284355804500256, 0.05979826222758659, 0.05642636935801841, 0.052746295699174044,
+        0.04877814079280328, 0.04454357777196594, 0.04006573518069214, 0.0353690710975917,
+        0.030479240699603456, 0.02542295952611308, 0.020227869569052613, 0.014922443697357455,
+        0.009536220301748529, 0.004105998604649026,
+        // n = 43
+        0.0039194902538441335, 0.009103996637401437, 0.014248756431576571, 0.019319901423683887,
+        0.024290456613838884, 0.029134413261498498, 0.03382649208685984, 0.03834222219413256,
+        0.04265805719798203, 0.046751494754346624, 0.05060119278439015, 0.054187080318881704,
+        0.057490461956910544, 0.060494115249991265, 0.06318238044939611, 0.06554124212632283,
+        0.06755840222936518, 0.06922334419365675, 0.07052738776508503, 0.0714637342525142,
+        0.07202750197142194, 0.07221575169379899, 0.07202750197142194, 0.0714637342525142,
+        0.07052738776508503, 0.06922334419365675, 0.06755840222936518, 0.06554124212632283,
+        0.06318238044939611, 0.060494115249991265, 0.057490461956910544, 0.054187080318881704,
+        0.05060119278439015, 0.046751494754346624, 0.04265805719798203, 0.03834222219413256,
+        0.03382649208685984, 0.029134413261498498, 0.024290456613838884, 0.019319901423683887,
+        0.014248756431576571, 0.009103996637401437, 0.0039194902538441335,
+        // n = 44
+        0.003745404803112263, 0.008700481367524621, 0.013619586755579846, 0.018471481736814777,
+        0.02323148190201914, 0.0278757828212811, 0.032381222812069496, 0.036725347813808824,
+        0.040886512310346096, 0.04484398408196998, 0.048578046448352, 0.05207009609170447,
+        0.055302735563727994, 0.05825985987759556, 0.06092673670156204, 0.0632900797332039,
+        0.06533811487918138, 0.06706063890629366, 0.06844907026936664, 0.06949649186157258,
+        0.07019768547355816, 0.07054915778935412, 0.07054915778935412, 0.07019768547355816,
+        0.06949649186157258, 0.06844907026936664, 0.06706063890629366, 0.06533811487918138,
+        0.0632900797332039, 0.06092673670156204, 0.05825985987759556, 0.055302735563727994,
+        0.05207009609170447, 0.048578046448352, 0.04484398408196998, 0.040886512310346096,
+        0.036725347813808824, 0.032381222812069496, 0.0278757828212811, 0.02323148190201914,
+        0.018471481736814777, 0.013619586755579846, 0.008700481367524621, 0.003745404803112263,
+        // n = 45
+        0.0035826631552834565, 0.008323189296218279, 0.01303110499158273, 0.017677535257937547,
+        0.022239847550578697, 0.026696213967577653, 0.031025374934515203, 0.03520669220160891,
+        0.03922023672930245, 0.04304688070916496, 0.04666838771837338, 0.05006749923795189,
+        0.0532280167312689, 0.056134878759786365, 0.05877423271884176, 0.06113350083106653,
+        0.06320144007381986, 0.0649681957507234, 0.06642534844984249, 0.06756595416360751,
+        0.06838457737866979, 0.06887731697766139, 0.06904182482923202, 0.06887731697766139,
+        0.06838457737866979, 0.06756595416360751, 0.06642534844984249, 0.0649681957507234,
+        0.06320144007381986, 0.06113350083106653, 0.05877423271884176, 0.056134878759786365,
+        0.0532280167312689, 0.05006749923795189, 0.04666838771837338, 0.04304688070916496,
+        0.03922023672930245, 0.03520669220160891, 0.031025374934515203, 0.026696213967577653,
+        0.022239847550578697, 0.017677535257937547, 0.01303110499158273, 0.008323189296218279,
+        0.0035826631552834565,
+        // n = 46
+        0.0034303008681065496, 0.007969898229724626, 0.01247988377098871, 0.01693351400783631,
+        0.021309998754136455, 0.025589286397130002, 0.0297518295522024, 0.03377862799910678,
+        0.03765130535738602, 0.041352190109678694, 0.04486439527731817, 0.048171895101712214,
+        0.05125959800714309, 0.054113415385856824, 0.05672032584399121, 0.059068434595546275,
+        0.06114702772465047, 0.06294662106439455, 0.06445900346713904, 0.06567727426778121,
+        0.06659587476845491, 0.06721061360067826, 0.06751868584903645, 0.06751868584903645,
+        0.06721061360067826, 0.06659587476845491, 0.06567727426778121, 0.06445900346713904,
+        0.06294662106439455, 0.06114702772465047, 0.059068434595546275, 0.05672032584399121,
+        0.054113415385856824, 0.05125959800714309, 0.048171895101712214, 0.04486439527731817,
+        0.041352190109678694, 0.03765130535738602, 0.03377862799910678, 0.0297518295522024,
+        0.025589286397130002, 0.021309998754136455, 0.01693351400783631, 0.01247988377098871,
+        0.007969898229724626, 0.0034303008681065496,
+        // n = 47
+        0.0032874538425275465, 0.007638616295848876, 0.011962848464312439, 0.01623533314643306,
+        0.02043693814766853, 0.02454921165965884, 0.02855415070064306, 0.03243423551518473,
+        0.03617249658417499, 0.03975258612253098, 0.043158848648479506, 0.046376389086505834,
+        0.049391137747361126, 0.052189911780057184, 0.05476047278153029, 0.05709158029323165,
+        0.059173040942338904, 0.06099575300873964, 0.06255174622092174, 0.06383421660571703,
+        0.06483755623894571, 0.06555737776654974, 0.06599053358881046, 0.06613512962365548,
+        0.06599053358881046, 0.06555737776654974, 0.06483755623894571, 0.06383421660571703,
+        0.06255174622092174, 0.06099575300873964, 0.059173040942338904, 0.05709158029323165,
+        0.05476047278153029, 0.052189911780057184, 0.049391137747361126, 0.046376389086505834,
+        0.043158848648479506, 0.03975258612253098, 0.03617249658417499, 0.03243423551518473,
+        0.02855415070064306, 0.02454921165965884, 0.02043693814766853, 0.01623533314643306,
+        0.011962848464312439, 0.007638616295848876, 0.0032874538425275465,
+        // n = 48
+        0.0031533460523054026, 0.007327553901276208, 0.01147723457923459, 0.015579315722943856,
+        0.019616160457355446, 0.023570760839324342, 0.02742650970835655, 0.03116722783279794,
+        0.03477722256477046, 0.03824135106583067, 0.041545082943464776, 0.044674560856694294,
+        0.04761665849249055, 0.05035903555385447, 0.05289018948519366, 0.05519950369998417,
+        0.05727729210040315, 0.059114839698395566, 0.06070443916589386, 0.06203942315989268,
+        0.06311419228625405, 0.06392423858464817, 0.0644661644359501, 0.06473769681268386,
+        0.06473769681268386, 0.0644661644359501, 0.06392423858464817, 0.06311419228625405,
+        0.06203942315989268, 0.06070443916589386, 0.059114839698395566, 0.05727729210040315,
+        0.05519950369998417, 0.05289018948519366, 0.05035903555385447, 0.04761665849249055,
+        0.044674560856694294, 0.041545082943464776, 0.03824135106583067, 0.03477722256477046,
+        0.03116722783279794, 0.02742650970835655, 0.023570760839324342, 0.019616160457355446,
+        0.015579315722943856, 0.01147723457923459, 0.007327553901276208, 0.0031533460523054026,
+        // n = 49
+        0.003027278988922764, 0.007035099590086477, 0.01102055103159358, 0.01496214493562467,
+        0.018843595853089427, 0.02264920158744664, 0.026363618927065742, 0.029971884620583727,
+        0.03345946679162217, 0.036812320963000716, 0.040016945766373, 0.043060436981259595,
+        0.045930539355595934, 0.048615695887828256, 0.0511050943301445, 0.053388710708258943,
+        0.055457349674803584, 0.057302681530187416, 0.058917275760027185, 0.060294630953152004,
+        0.061429200979192966, 0.062316417320057355, 0.06295270746519575, 0.06333550929649175,
+        0.0634632814047906, 0.06333550929649175, 0.06295270746519575, 0.062316417320057355,
+        0.061429200979192966, 0.060294630953152004, 0.058917275760027185, 0.057302681530187416,
+        0.055457349674803584, 0.053388710708258943, 0.0511050943301445, 0.048615695887828256,
+        0.045930539355595934, 0.043060436981259595, 0.040016945766373, 0.036812320963000716,
+        0.03345946679162217, 0.029971884620583727, 0.026363618927065742, 0.02264920158744664,
+        0.018843595853089427, 0.01496214493562467, 0.01102055103159358, 0.007035099590086477,
+        0.003027278988922764,
+        // n = 50
+        0.002908622553154703, 0.006759799195745479, 0.010590548383651047, 0.014380822761485574,
+        0.018115560713489336, 0.021780243170124797, 0.025360673570012125, 0.028842993580535103,
+        0.03221372822357795, 0.03545983561514608, 0.03856875661258766, 0.041528463090147634,
+        0.04432750433880327, 0.04695505130394844, 0.049400938449466386, 0.05165570306958116,
+        0.05371062188899627, 0.05555774480621254, 0.057189925647728394, 0.05860084981322245,
+        0.05978505870426546, 0.06073797084177021, 0.061455899590316755, 0.061936067420683215,
+        0.06217661665534731, 0.06217661665534731, 0.061936067420683215, 0.061455899590316755,
+        0.06073797084177021, 0.05978505870426546, 0.05860084981322245, 0.057189925647728394,
+        0.05555774480621254, 0.05371062188899627, 0.05165570306958116, 0.049400938449466386,
+        0.04695505130394844, 0.04432750433880327, 0.041528463090147634, 0.03856875661258766,
+        0.03545983561514608, 0.03221372822357795, 0.028842993580535103, 0.025360673570012125,
+        0.021780243170124797, 0.018115560713489336, 0.014380822761485574, 0.010590548383651047,
+        0.006759799195745479, 0.002908622553154703,
+        // n = 51
+        0.002796807171089851, 0.0065003377832527215, 0.010185191297821666, 0.013832634006477867,
+        0.01742871472340099, 0.020959988401703312, 0.02441330057378118, 0.02777579859416236,
+        0.031034971290159932, 0.0341786932041883, 0.03719526892326031, 0.0400734762854964,
+        0.04280260799788008, 0.045372511407650064, 0.04777362624062311, 0.04999702015005735,
+        0.05203442193669708, 0.05387825231304558, 0.05552165209573866, 0.05695850772025867,
+        0.05818347398259222, 0.05919199392296152, 0.059980315777503276, 0.06054550693473789,
+        0.06088546484485633, 0.06099892484120588, 0.06088546484485633, 0.06054550693473789,
+        0.059980315777503276, 0.05919199392296152, 0.05818347398259222, 0.05695850772025867,
+        0.05552165209573866, 0.05387825231304558, 0.05203442193669708, 0.04999702015005735,
+        0.04777362624062311, 0.045372511407650064, 0.04280260799788008, 0.0400734762854964,
+        0.03719526892326031, 0.0341786932041883, 0.031034971290159932, 0.02777579859416236,
+        0.02441330057378118, 0.020959988401703312, 0.01742871472340099, 0.013832634006477867,
+        0.010185191297821666, 0.0065003377832527215, 0.002796807171089851,
+        // n = 52
+        0.002691316950047132, 0.006255523962973125, 0.009802634579462866, 0.013315114982340946,
+        0.01678002339630075, 0.02018489150798081, 0.023517513553984196, 0.02676595374650386,
+        0.029918581147143946, 0.032964109089718835, 0.035891634835097316, 0.03869067831042394,
+        0.04135121950056025, 0.04386373425900037, 0.04621922837278481, 0.04840926974407489,
+        0.05042601856634243, 0.052262255383907004, 0.05391140693275718, 0.055367569669302674,
+        0.05662553090236858, 0.05768078745252682, 0.05852956177181395, 0.05916881546604305,
+        0.05959626017124815, 0.05981036574529182, 0.05981036574529182, 0.05959626017124815,
+        0.05916881546604305, 0.05852956177181395, 0.05768078745252682, 0.05662553090236858,
+        0.055367569669302674, 0.05391140693275718, 0.052262255383907004, 0.05042601856634243,
+        0.04840926974407489, 0.04621922837278481, 0.04386373425900037, 0.04135121950056025,
+        0.03869067831042394, 0.035891634835097316, 0.032964109089718835, 0.029918581147143946,
+        0.02676595374650386, 0.023517513553984196, 0.02018489150798081, 0.01678002339630075,
+        0.013315114982340946, 0.009802634579462866, 0.006255523962973125, 0.002691316950047132,
+        // n = 53
+        0.002591683720566453, 0.006024276226948731, 0.009441202284940326, 0.012826026144240384,
+        0.016166725256687435, 0.019451721107636842, 0.022669673057069947, 0.02580948251075743,
+        0.028860323617823678, 0.03181167845901927, 0.03465337258353423, 0.03737560980348297,
+        0.03996900584354043, 0.04242462063452002, 0.04473398910367275, 0.04688915034075033,
+        0.04888267503269919, 0.050707691069292744, 0.052357907229872686, 0.05382763486873106,
+        0.05511180752393364, 0.05620599838173963, 0.05710643553626715, 0.05781001499171308,
+        0.05831431136225602, 0.05861758623272028, 0.05871879415116437, 0.05861758623272028,
+        0.05831431136225602, 0.05781001499171308, 0.05710643553626715, 0.05620599838173963,
+        0.05511180752393364, 0.05382763486873106, 0.052357907229872686, 0.050707691069292744,
+        0.04888267503269919, 0.04688915034075033, 0.04473398910367275, 0.04242462063452002,
+        0.03996900584354043, 0.03737560980348297, 0.03465337258353423, 0.03181167845901927,
+        0.028860323617823678, 0.02580948251075743, 0.022669673057069947, 0.019451721107636842,
+        0.016166725256687435, 0.012826026144240384, 0.009441202284940326, 0.006024276226948731,
+        0.002591683720566453,
+        // n = 54
+        0.0024974818357610235, 0.005805611015239958, 0.009099369455509437, 0.012363328128847773,
+        0.015586303035924065, 0.018757527621469424, 0.021866451422852744, 0.02490274146720865,
+        0.027856309310595778, 0.030717342497870656, 0.033476336464372654, 0.03612412584038354,
+        0.03865191478210256, 0.04105130613664502, 0.043314329309597006, 0.04543346672827667,
+        0.04740167880644496, 0.04921242732452894, 0.05085969714618807, 0.052338016198298774,
+        0.053642473647553576, 0.05476873621305799, 0.05571306256058997, 0.056472315730626,
+        0.05704397355879461, 0.05742613705411211, 0.05761753670714708, 0.05761753670714708,
+        0.05742613705411211, 0.05704397355879461, 0.056472315730626, 0.05571306256058997,
+        0.05476873621305799, 0.053642473647553576, 0.052338016198298774, 0.05085969714618807,
+        0.04921242732452894, 0.04740167880644496, 0.04543346672827667, 0.043314329309597006,
+        0.04105130613664502, 0.03865191478210256, 0.03612412584038354, 0.033476336464372654,
+        0.030717342497870656, 0.027856309310595778, 0.02490274146720865, 0.021866451422852744,
+        0.018757527621469424, 0.015586303035924065, 0.012363328128847773, 0.009099369455509437,
+        0.005805611015239958, 0.0024974818357610235,
+        // n = 55
+        0.0024083236199791895, 0.005598632266560725, 0.008775746107058547, 0.01192516071984863,
+        0.01503645833351179, 0.018099614520729078, 0.02110480166801612, 0.024042388009725454,
+        0.026902961456396163, 0.02967735776516107, 0.032356689226185745, 0.0349323728735899,
+        0.037396157867965546, 0.03974015187433716, 0.041956846317718774, 0.044039140421606573,
+        0.045980363946283805, 0.04777429855120066, 0.049415197711551735, 0.05089780512449399,
+        0.05221737154563205, 0.05336967000160555, 0.05435100932991109, 0.055158246002508654,
+        0.05578879419528408, 0.0562406340710844, 0.05651231824977197, 0.05660297644456042,
+        0.05651231824977197, 0.0562406340710844, 0.05578879419528408, 0.055158246002508654,
+        0.05435100932991109, 0.05336967000160555, 0.05221737154563205, 0.05089780512449399,
+        0.049415197711551735, 0.04777429855120066, 0.045980363946283805, 0.044039140421606573,
+        0.041956846317718774, 0.03974015187433716, 0.037396157867965546, 0.0349323728735899,
+        0.032356689226185745, 0.02967735776516107, 0.026902961456396163, 0.024042388009725454,
+        0.02110480166801612, 0.018099614520729078, 0.01503645833351179, 0.01192516071984863,
+        0.008775746107058547, 0.005598632266560725, 0.0024083236199791895,
+        // n = 56
+        0.0023238553757732945, 0.00540252224601533, 0.008469063163307883, 0.011509824340383376,
+        0.014515089278021458, 0.01747551291140094, 0.02038192988240216, 0.023225351562565225,
+        0.02599698705839184, 0.02868826847382265, 0.031290876747310487, 0.033796767115611775,
+        0.036198193872315154, 0.03848773425924769, 0.040658311384744586, 0.0427032160846671,
+        0.04461612765269227, 0.04639113337300185, 0.048022746793600225, 0.04950592468304755,
+        0.05083608261779847, 0.052009109151741464, 0.053021378524010745, 0.05386976186571446,
+        0.054551636870889444, 0.05506489590176245, 0.05540795250324511, 0.055579746306514466,
+        0.055579746306514466, 0.05540795250324511, 0.05506489590176245, 0.054551636870889444,
+        0.05386976186571446, 0.053021378524010745, 0.052009109151741464, 0.05083608261779847,
+        0.04950592468304755, 0.048022746793600225, 0.04639113337300185, 0.04461612765269227,
+        0.0427032160846671, 0.040658311384744586, 0.03848773425924769, 0.036198193872315154,
+        0.033796767115611775, 0.031290876747310487, 0.02868826847382265, 0.02599698705839184,
+        0.023225351562565225, 0.02038192988240216, 0.01747551291140094, 0.014515089278021458,
+        0.011509824340383376, 0.008469063163307883, 0.00540252224601533, 0.0023238553757732945,
+        // n = 57
+        0.0022437538722505633, 0.005216533474718769, 0.008178160067821238, 0.011115763732335937,
+        0.014020270790753494, 0.016882959023441474, 0.019695270699488232, 0.022448807890776253,
+        0.0251353509909181, 0.027746881402180113, 0.03027560484269393, 0.032713974366371544,
+        0.035054712782312654, 0.03729083432441733, 0.03941566547548005, 0.041422864870801136,
+        0.043306442216215185, 0.04506077616138114, 0.046680631073641544, 0.048161172661687776,
+        0.049497982402019594, 0.05068707072492744, 0.051724888920517895, 0.05260833972917743,
+        0.05333478658481919, 0.05390206148329859, 0.05430847145249863, 0.054552803604761904,
+        0.05463432875658402, 0.054552803604761904, 0.05430847145249863, 0.05390206148329859,
+        0.05333478658481919, 0.05260833972917743, 0.051724888920517895, 0.05068707072492744,
+        0.049497982402019594, 0.048161172661687776, 0.046680631073641544, 0.04506077616138114,
+        0.043306442216215185, 0.041422864870801136, 0.03941566547548005, 0.03729083432441733,
+        0.035054712782312654, 0.032713974366371544, 0.03027560484269393, 0.027746881402180113,
+        0.0251353509909181, 0.022448807890776253, 0.019695270699488232, 0.016882959023441474,
+        0.014020270790753494, 0.011115763732335937, 0.008178160067821238, 0.005216533474718769,
+        0.0022437538722505633,
+        // n = 58
+        0.0021677232496268998, 0.005039981612650192, 0.007901973849998665, 0.01074155353287882,
+        0.013550237112988885, 0.016319874234970996, 0.0190424654618931, 0.02171015614014623,
+        0.024315252724964053, 0.026850243181981884, 0.02930781804416047, 0.03168089125380926,
+        0.03396262049341602, 0.03614642686708727, 0.03822601384585842, 0.040195385409867786,
+        0.042048863329582124, 0.043781103533640245, 0.045387111514819806, 0.04686225672902635,
+        0.04820228594541769, 0.049403335508962365, 0.05046194247995313, 0.051375054618285704,
+        0.052140039183669815, 0.052754690526370836, 0.053217236446579, 0.05352634330405825,
+        0.05368111986333482, 0.05368111986333482, 0.05352634330405825, 0.053217236446579,
+        0.052754690526370836, 0.052140039183669815, 0.051375054618285704, 0.05046194247995313,
+        0.049403335508962365, 0.04820228594541769, 0.04686225672902635, 0.045387111514819806,
+        0.043781103533640245, 0.042048863329582124, 0.040195385409867786, 0.03822601384585842,
+        0.03614642686708727, 0.03396262049341602, 0.03168089125380926, 0.02930781804416047,
+        0.026850243181981884, 0.024315252724964053, 0.02171015614014623, 0.0190424654618931,
+        0.016319874234970996, 0.013550237112988885, 0.01074155353287882, 0.007901973849998665,
+        0.005039981612650192, 0.0021677232496268998,
+        // n = 59
+        0.002095492284541173, 0.00487223916826529, 0.007639529453487547, 0.010385885500995902,
+        0.013103366306345128, 0.015784347313081454, 0.018421342753609866, 0.021006998288437072,
+        0.023534105393713225, 0.02599561973129844, 0.028384680200534772, 0.030694627836111717,
+        0.032919024271045275, 0.035051669636400065, 0.0370866198188709, 0.03901820301616005,
+        0.040841035538686725, 0.04255003681106764, 0.04414044353029736, 0.04560782294050976,
+        0.046948085186962016, 0.04815749471460646, 0.049232680679361936, 0.050170646342996957,
+        0.050968777425393956, 0.051624849390891514, 0.05213703364837548, 0.05250390264782879,
+        0.05272443385912793, 0.05279801262199043, 0.05272443385912793, 0.05250390264782879,
+        0.05213703364837548, 0.051624849390891514, 0.050968777425393956, 0.050170646342996957,
+        0.049232680679361936, 0.04815749471460646, 0.046948085186962016, 0.04560782294050976,
+        0.04414044353029736, 0.04255003681106764, 0.040841035538686725, 0.03901820301616005,
+        0.0370866198188709, 0.035051669636400065, 0.032919024271045275, 0.030694627836111717,
+        0.028384680200534772, 0.02599561973129844, 0.023534105393713225, 0.021006998288437072,
+        0.018421342753609866, 0.015784347313081454, 0.013103366306345128, 0.010385885500995902,
+        0.007639529453487547, 0.00487223916826529, 0.002095492284541173,
+        // n = 60
+        0.002026811968873381, 0.004712729926953342, 0.007389931163345687, 0.010047557182288017,
+        0.012678166476815994, 0.015274618596784863, 0.017829901014207398, 0.02033712072945717,
+        0.022789516943997837, 0.0251804776215212, 0.0275035567499248, 0.02975249150078897,
+        0.031921219019296315, 0.03400389272494642, 0.03599489805108447, 0.03788886756924342,
+        0.03968069545238079, 0.04136555123558475, 0.0429388928359356, 0.04439647879578719,
+        0.04573437971611449, 0.046948988848912195, 0.04803703181997115, 0.048995575455756765,
+        0.04982203569055017, 0.050514184532509436, 0.051070156069855696, 0.05148845150098088,
+        0.05176794317491012, 0.05190787763122067, 0.05190787763122067, 0.05176794317491012,
+        0.05148845150098088, 0.051070156069855696, 0.050514184532509436, 0.04982203569055017,
+        0.048995575455756765, 0.04803703181997115, 0.046948988848912195, 0.04573437971611449,
+        0.04439647879578719, 0.0429388928359356, 0.04136555123558475, 0.03968069545238079,
+        0.03788886756924342, 0.03599489805108447, 0.03400389272494642, 0.031921219019296315,
+        0.02975249150078897, 0.0275035567499248, 0.0251804776215212, 0.022789516943997837,
+        0.02033712072945717, 0.017829901014207398, 0.015274618596784863, 0.012678166476815994,
+        0.010047557182288017, 0.007389931163345687, 0.004712729926953342, 0.002026811968873381,
+        // n = 61
+        0.001961453361670219, 0.004560924006012291, 0.0071523549917490836, 0.009725461830356186,
+        0.012273263507812058, 0.014789065884937922, 0.01726629298761348, 0.019698477746101117,
+        0.02207927314831909, 0.024402467187544154, 0.02666199852415087, 0.028851972088183412,
+        0.0309666743683974, 0.03300058827590756, 0.03494840751653332, 0.03680505042315479,
+        0.03856567320700816, 0.04022568259099831, 0.04178074779088852, 0.04322681181249609,
+        0.04456010203508354, 0.045777140053145975, 0.04687475075080905, 0.04785007058509556,
+        0.048700555056411556, 0.04942398534673568, 0.050018474108178244, 0.0504824703867974,
+        0.05081476366881835, 0.05101448703869735, 0.05108111944078622, 0.05101448703869735,
+        0.05081476366881835, 0.0504824703867974, 0.050018474108178244, 0.04942398534673568,
+        0.048700555056411556, 0.04785007058509556, 0.04687475075080905, 0.045777140053145975,
+        0.04456010203508354, 0.04322681181249609, 0.04178074779088852, 0.04022568259099831,
+        0.03856567320700816, 0.03680505042315479, 0.03494840751653332, 0.03300058827590756,
+        0.0309666743683974, 0.028851972088183412, 0.02666199852415087, 0.024402467187544154,
+        0.02207927314831909, 0.019698477746101117, 0.01726629298761348, 0.014789065884937922,
+        0.012273263507812058, 0.009725461830356186, 0.0071523549917490836, 0.004560924006012291,
+        0.001961453361670219,
+        // n = 62
+        0.0018992056795131764, 0.004416333456930912, 0.006926041901831004, 0.009418579428420367,
+        0.011887390117010564, 0.01432619182380648, 0.016728811790177066, 0.019089176658573005,
+        0.021401322277669905, 0.023659407208682738, 0.025857726954024638, 0.027990728163314674,
+        0.030053022573989858, 0.0320394005816247, 0.03394484437941043, 0.03576454062276818,
+        0.037493892582280065, 0.03912853175196305, 0.04066432888241746, 0.042097404410385134,
+        0.04342413825804743, 0.04464117897712434, 0.045745452214570236, 0.04673416847841558,
+        0.04760483018410124, 0.048355237963477675, 0.048983496220517855, 0.049488017919699326,
+        0.04986752859495239, 0.050121069569043254, 0.05024800037525622, 0.05024800037525622,
+        0.050121069569043254, 0.04986752859495239, 0.049488017919699326, 0.048983496220517855,
+        0.048355237963477675, 0.04760483018410124, 0.04673416847841558, 0.045745452214570236,
+        0.04464117897712434, 0.04342413825804743, 0.042097404410385134, 0.04066432888241746,
+        0.03912853175196305, 0.037493892582280065, 0.03576454062276818, 0.03394484437941043,
+        0.0320394005816247, 0.030053022573989858, 0.027990728163314674, 0.025857726954024638,
+        0.023659407208682738, 0.021401322277669905, 0.019089176658573005, 0.016728811790177066,
+        0.01432619182380648, 0.011887390117010564, 0.009418579428420367, 0.006926041901831004,
+        0.004416333456930912, 0.0018992056795131764,
+        // n = 63
+        0.0018398745955765779, 0.004278508346863758, 0.006710291765960076, 0.009125968676326566,
+        0.011519376076880061, 0.013884612616115635, 0.016215878410338072, 0.018507464460161174,
+        0.020753761258038978, 0.02294927100488997, 0.02508862055334498, 0.027166574359097976,
+        0.02917804720828054, 0.03111811662221981, 0.032982034883779356, 0.034765240645355855,
+        0.036463370085457254, 0.03807226758434952, 0.03958799589154413, 0.04100684575966637,
+        0.04232534502081574, 0.043540267083027565, 0.04464863882594142, 0.045647747876292624,
+        0.046535149245383683, 0.04730867131226898, 0.0479664211379951, 0.048506789097883835,
+        0.04892845282051196, 0.04923038042374765, 0.04941183303991824, 0.04947236662393102,
+        0.04941183303991824, 0.04923038042374765, 0.04892845282051196, 0.048506789097883835,
+        0.0479664211379951, 0.04730867131226898, 0.046535149245383683, 0.045647747876292624,
+        0.04464863882594142, 0.043540267083027565, 0.04232534502081574, 0.04100684575966637,
+        0.03958799589154413, 0.03807226758434952, 0.036463370085457254, 0.034765240645355855,
+        0.032982034883779356, 0.03111811662221981, 0.02917804720828054, 0.027166574359097976,
+        0.02508862055334498, 0.02294927100488997, 0.020753761258038978, 0.018507464460161174,
+        0.016215878410338072, 0.013884612616115635, 0.011519376076880061, 0.009125968676326566,
+        0.006710291765960076, 0.004278508346863758, 0.0018398745955765779,
+        // n = 64
+        0.0017832807216962678, 0.004147033260562521, 0.006504457968978368, 0.008846759826363935,
+        0.011168139460131076, 0.013463047896718736, 0.015726030476024472, 0.017951715775697225,
+        0.02013482315353018, 0.022270173808383212, 0.024352702568710933, 0.026377469715054645,
+        0.02833967261425946, 0.030234657072402426, 0.032057928354851606, 0.03380516183714161,
+        0.03547221325688236, 0.03705512854024007, 0.0385501531786156, 0.03995374113272036,
+        0.04126256324262355, 0.042473515123653625, 0.04358372452932347, 0.04459055816375658,
+        0.04549162792741812, 0.046284796581314396, 0.04696818281620999, 0.047540165714830315,
+        0.04799938859645833, 0.0483447622348029, 0.048575467441503394, 0.04869095700913973,
+        0.04869095700913973, 0.048575467441503394, 0.0483447622348029, 0.04799938859645833,
+        0.047540165714830315, 0.04696818281620999, 0.046284796581314396, 0.04549162792741812,
+        0.04459055816375658, 0.04358372452932347, 0.042473515123653625, 0.04126256324262355,
+        0.03995374113272036, 0.0385501531786156, 0.03705512854024007, 0.03547221325688236,
+        0.03380516183714161, 0.032057928354851606, 0.030234657072402426, 0.02833967261425946,
+        0.026377469715054645, 0.024352702568710933, 0.022270173808383212, 0.02013482315353018,
+        0.017951715775697225, 0.015726030476024472, 0.013463047896718736, 0.011168139460131076,
+        0.008846759826363935, 0.006504457968978368, 0.004147033260562521, 0.0017832807216962678,
+    };
+
+    /// <summary>Gauss-Laguerre nodes on [0, ∞) for the weight e^(-x), ascending.</summary>
+    public static ReadOnlySpan<double> LaguerreNodes => LaguerreNodesTable;
+
+    private static readonly double[] LaguerreNodesTable =
+    {
+        // n = 1
+        1,
+        // n = 2
+        0.585786437626905, 3.414213562373095,
+        // n = 3
+        0.4157745567834791, 2.294280360279042, 6.2899450829374794,
+        // n = 4
+        0.3225476896193923, 1.7457611011583465, 4.536620296921128, 9.395070912301133,
+        // n = 5
+        0.263560319718141, 1.4134030591065168, 3.596425771040722, 7.085810005858837,
+        12.640800844275782,
+        // n = 6
+        0.22284660417926058, 1.1889321016726229, 2.992736326059314, 5.77514356910451,
+        9.83746741838259, 15.9828739806017,
+        // n = 7
+        0.19304367656036225, 1.0266648953391921, 2.567876744950746, 4.900353084526484,
+        8.18215344456286, 12.734180291797815, 19.39572786226254,
+        // n = 8
+        0.17027963230510088, 0.9037017767993799, 2.2510866298661307, 4.266700170287659,
+        7.0459054023934655, 10.758516010180996, 15.740678641278004, 22.863131736889265,
+        // n = 9
+        0.1523222277318082, 0.8072200227422561, 2.0051351556193473, 3.783473973331233,
+        6.204956777876613, 9.372985251687576, 13.466236911092093, 18.833597788991696,
+        26.374071890927375,
+        // n = 10
+        0.13779347054049246, 0.7294545495031702, 1.8083429017403165, 3.4014336978548996,
+        5.552496140063804, 8.330152746764497, 11.843785837900066, 16.279257831378104,
+        21.99658581198076, 29.92069701227389,
+        // n = 11
+        0.12579644218796773, 0.6654182558392276, 1.6471505458721696, 3.0911381430352547,
+        5.029284401579833, 7.509887863806616, 10.605950999546968, 14.431613758064186,
+        19.17885740321468, 25.217709339677562, 33.49719284717554,
+        // n = 12
+        0.11572211735802082, 0.6117574845151305, 1.512610269776419, 2.8337513377435073,
+        4.5992276394183484, 6.844525453115177, 9.621316842456867, 13.006054993306348,
+        17.116855187462257, 22.151090379397004, 28.487967250984, 37.09912104446692,
+        // n = 13
+        0.10714238847225215, 0.5661318990404021, 1.3985643364510194, 2.6165971084064115,
+        4.2388459290170335, 6.292256271140073, 8.815001941186978, 11.861403588811243,
+        15.510762037703753, 19.88463566388023, 25.185263864677758, 31.800386301947267,
+        40.72300866926558,
+        // n = 14
+        0.09974750703259742, 0.526857648851903, 1.3006291212514967, 2.4308010787308443,
+        3.932102822293219, 5.825536218301709, 8.140240141565146, 10.91649950736602,
+        14.21080501116129, 18.104892220218098, 22.723381628269625, 28.272981723248204,
+        35.149443660592425, 44.366081711117424,
+        // n = 15
+        0.09330781201728183, 0.4926917403018844, 1.2155954120709493, 2.2699495262037437,
+        3.6676227217514374, 5.425336627413553, 7.5659162266130675, 10.120228568019112,
+        13.130282482175723, 16.65440770832996, 20.776478899448765, 25.62389422672878,
+        31.40751916975394, 38.53068330648601, 48.026085572685794,
+        // n = 16
+        0.0876494104789276, 0.4626963289150815, 1.1410577748312265, 2.129283645098381,
+        3.4370866338932062, 5.078018614549768, 7.070338535048235, 9.438314336391938,
+        12.21422336886616, 15.441527368781617, 19.180156856753136, 23.515905693991908,
+        28.57872974288214, 34.58339870228663, 41.94045264768833, 51.70116033954332,
+        // n = 17
+        0.082638214708948, 0.4361503235587112, 1.0751765775114293, 2.0051935316492324,
+        3.2342561240474432, 4.7735135137001965, 6.6378292053649535, 8.8466855111698,
+        11.425529319373352, 14.407823037481318, 17.83828473070114, 21.778268257722264,
+        26.3153178112488, 31.581771680456733, 37.7960938374771, 45.375716533988964,
+        55.38975178983961,
+        // n = 18
+        0.0781691666697055, 0.4124900852591298, 1.016520179623539, 1.894888509969761,
+        3.05435311320266, 4.504205538889893, 6.256725073949111, 8.32782515660563,
+        10.73799004775761, 13.51365620755509, 16.689306281930104, 20.310767626267744,
+        24.4406813592837, 29.168208662579616, 34.627927065660174, 41.04181677280876,
+        48.83392271608652, 59.09054643590125,
+        // n = 19
+        0.07415878375720493, 0.3912686133199951, 0.963957343997958, 1.7961755820683283,
+        2.8936513818737835, 4.264215539627767, 5.918141561644048, 7.868618915334733,
+        10.132423716815266, 12.730881463842397, 15.691278339835888, 19.04899320982355,
+        22.850849760829483, 27.160669327411448, 32.06912225186224, 37.71290580121965,
+        44.3173627958315, 52.312902457404384, 62.80242315350038,
+        // n = 20
+        0.07053988969198845, 0.37212681800161185, 0.9165821024832734, 1.7073065310283442,
+        2.7491992553094327, 4.048925313850886, 5.6151749708616165, 7.459017453671064,
+        9.594392869581096, 12.038802546964316, 14.814293442630738, 17.948895520519375,
+        21.47878824028501, 25.451702793186904, 29.93255463170061, 35.013434240479,
+        40.83305705672857, 47.6199940473465, 55.810795750063896, 66.52441652561575,
+        // n = 21
+        0.06725781792316138, 0.35477289532351153, 0.8736601667786427, 1.6268699419292103,
+        2.6186264105455437, 3.8546521381097594, 5.342369280622433, 7.091168813219674,
+        9.112778854269704, 11.421771762378382, 14.036270697873757, 16.97895269278384,
+        20.278509414993742, 23.971845587151478, 28.107528600944306, 32.75149741056083,
+        37.99718781926095, 43.985245757142216, 50.94735118993992, 59.32599412022999,
+        70.25568862801893,
+        // n = 22
+        0.06426762874480897, 0.3389672548149114, 0.8345899854491786, 1.553713386750026,
+        2.5000062367361724, 3.6784203444636363, 5.095349068968739, 6.758835515813548,
+        8.678853313678427, 10.867686893540572, 13.34045105149524, 16.11581133876631,
+        19.217003684901353, 22.67331660143459, 26.52231958763714, 30.813357944506556,
+        35.61333520319617, 41.016968598471685, 47.16675784915352, 54.297385256578885,
+        62.85709624629903, 73.9955070085995,
+        // n = 23
+        0.061532037757520384, 0.32451132915455216, 0.798873968692984, 1.4868863342221972,
+        2.391755829792768, 3.5177974425035328, 4.870560368733452, 6.45699130676774,
+        8.285651892598002, 10.367009043445766, 12.713825028162594, 15.341687572888508,
+        18.26974239389599, 21.521727850814163, 25.127477130115498, 29.125175108751016,
+        33.56489656311641, 38.51445967718072, 44.06980781487121, 50.37522660304375,
+        57.66830435043413, 66.40287306834517, 77.74322728471232,
+        // n = 24
+        0.05901985218150812, 0.3112391461984839, 0.7660969055459367, 1.425597590803614,
+        2.29256205863219, 3.370774264208998, 4.665083703467171, 6.1815351187367655,
+        7.927539247172152, 9.912098015077706, 12.146102711729766, 14.642732289596674,
+        17.417992646508978, 20.491460082616424, 23.887329848169735, 27.635937174332717,
+        31.776041352374722, 36.35840580165162, 41.45172048487077, 47.153106445156325,
+        53.60857454469507, 61.05853144721876, 69.96224003510503, 81.49827923394889,
+        // n = 25
+        0.05670477545270534, 0.2990108985869888, 0.7359095554350165, 1.3691831160351935,
+        2.2013260537214676, 3.2356758035580366, 4.476496615073835, 5.929083762700448,
+        7.59989930995675, 9.496749220932434, 11.629014911778754, 14.007957976545068,
+        16.64712559728878, 19.562898011469056, 22.77524198683504, 26.308772390968887,
+        30.194291163316105, 34.47109757192204, 39.19060880393742, 44.42234933616202,
+        50.26457499383354, 56.86496717394017, 64.46667061595413, 73.53423479210015,
+        85.26015556249595,
+        // n = 26
+        0.054564482717908626, 0.28770797910612333, 0.708016019478645, 1.3170813660438443,
+        2.1171209446284704, 3.1110938788779343, 4.302770876040371, 5.6968188261694666,
+        7.298909963070183, 9.115862897294216, 11.15582495493751, 13.428509032459205,
+        15.945503948143319, 18.720686145460284, 21.770774608541437, 25.11609366231674,
+        28.781646873450168, 32.798673218409974, 37.206982629612824, 42.058615924434534,
+        47.42389935628153, 53.402185197253296, 60.142775690076896, 67.89147970545129,
+        77.11799906933285, 89.02840275041098,
+        // n = 27
+        0.052579898206364134, 0.27722910598770445, 0.6821639113780075, 1.2688141807507565,
+        2.039159278250485, 2.9958355818751645, 4.142194482563247, 5.482371716049069,
+        7.021376024605551, 8.765202716850709, 10.720979045996847, 12.897150901909761,
+        15.303724197068926, 17.95258016401066, 20.857892743471172, 24.036690385983114,
+        27.509627633675777, 31.302070792021055, 35.445670666132855, 39.9807226211267,
+        44.959864785337984, 50.45419615272772, 56.56413090151835, 63.44054668468883,
+        71.3318480551601, 80.71276384709606, 92.80261352555705,
+        // n = 28
+        0.05073462484987404, 0.2674872686407404, 0.6581366283547924, 1.2239718083849078,
+        1.9667676124737772, 2.888883326030321, 3.993311659250114, 5.283736062843443,
+        6.764603404243506, 8.441216328271324, 10.31985046299326, 12.407903414460673,
+        14.714085164135748, 17.248663415608057, 20.023783329951712, 23.053890135030297,
+        26.35629737440132, 29.95196683359618, 33.86660551658446, 38.13225441019465,
+        42.78967237077258, 47.89207163362274, 53.5112979596643, 59.74879608464124,
+        66.75697728390647, 74.78677815233917, 84.31783710722705, 96.58242062752733,
+        // n = 29
+        0.049014489994713306, 0.258407297918778, 0.635747215800681, 1.1822010556248426,
+        1.8993664980026816, 2.7893635383562922, 3.854876158195292, 5.0992000886986,
+        6.526302885192907, 8.140899733223032, 9.948548893634886, 11.955771944042638,
+        14.170205843320575, 16.600796552315668, 19.258047913130728, 22.15434543487159,
+        25.304383763050154, 28.725741025266423, 32.439666742324384, 36.47218971363948,
+        40.855722336729144, 45.63146770127781, 50.85319151599018, 56.59346289666191,
+        62.95472850114927, 70.09089459642418, 78.25537041941044, 87.93259364298613,
+        100.36749160276659,
+        // n = 30
+        0.04740718054080493, 0.24992391675315948, 0.6148334543927685, 1.1431958256661012,
+        1.8364545546225728, 2.6965218745572157, 3.725814507779509, 4.927293765849882,
+        6.304515590965075, 7.861693293370261, 9.603775985479263, 11.536546597956141,
+        13.666744693064237, 16.002221188981068, 18.55213484014315, 21.327204321783128,
+        24.340035764532693, 27.60555479678096, 31.141586701111237, 34.96965200824907,
+        39.11608494906789, 43.61365290848483, 48.5039861638042, 53.841385406507506,
+        59.6991218592355, 66.18061779443849, 73.44123859555988, 81.73681050672768,
+        91.55646652253684, 104.15752443105889,
+        // n = 31
+        0.04590194762110832, 0.2419801638247725, 0.5952538942223496, 1.106689499532999,
+        1.7775956928747723, 2.60970341525668, 3.6051968023400436, 4.7667470844717625,
+        6.09755456718174, 7.601400949233137, 9.282714313470889, 11.14664975561929,
+        13.199189576244999, 15.447268315549309, 17.898929826644757, 20.56352633671582,
+        23.45197348201186, 26.57708135211826, 29.953990872346445, 33.6007595329022,
+        37.53916440733044, 41.79583087018222, 46.40386680641112, 51.405314476797756,
+        56.85499286871585, 62.82685590878632, 69.42527719108034, 76.80704776386274,
+        85.23035860754567, 95.18893989152564, 107.95224382757871,
+        // n = 32
+        0.04448936583326695, 0.234526109519618, 0.5768846293018863, 1.0724487538178182,
+        1.7224087764446459, 2.528336706425794, 3.4922132730219935, 4.616456769749767,
+        5.903958504174245, 7.358126733186242, 8.982940924212595, 10.783018632539973,
+        12.763697986742725, 14.931139755522558, 17.292454336715316, 19.855860940336054,
+        22.630889013196775, 25.628636022459247, 28.862101816323474, 32.346629153964734,
+        36.10049480575197, 40.14571977153944, 44.509207995754934, 49.22439498730864,
+        54.33372133339691, 59.89250916213402, 65.97537728793505, 72.68762809066271,
+        80.18744697791352, 88.7353404178924, 98.82954286828397, 111.7513980979377,
+    };
+
+    /// <summary>Gauss-Laguerre weights.</summary>
+    public static ReadOnlySpan<double> LaguerreWeights => LaguerreWeightsTable;
+
+    private static readonly double[] LaguerreWeightsTable =
+    {
+        // n = 1
+        1,
+        // n = 2
+        0.8535533905932736, 0.14644660940672627,
+        // n = 3
+        0.7110930099291731, 0.2785177335692408, 0.010389256501586133,
+        // n = 4
+        0.6031541043416336, 0.3574186924377996, 0.038887908515005405, 0.0005392947055613273,
+        // n = 5
+        0.5217556105828085, 0.39866681108317586, 0.07594244968170762, 0.0036117586799220497,
+        2.3369972385776248E-05,
+        // n = 6
+        0.45896467394996293, 0.4170008307721212, 0.11337338207404495, 0.01039919745314908,
+        0.0002610172028149324, 8.98547906429622E-07,
+        // n = 7
+        0.4093189517012727, 0.4218312778617198, 0.14712634865750535, 0.02063351446871695,
+        0.0010740101432807458, 1.5865464348564182E-05, 3.1703154789955856E-08,
+        // n = 8
+        0.36918858934163723, 0.4187867808143429, 0.17579498663717189, 0.033343492261215656,
+        0.002794536235225674, 9.076508773358207E-05, 8.48574671627254E-07, 1.0480011748715069E-09,
+        // n = 9
+        0.33612642179796165, 0.41121398042398377, 0.19928752537088543, 0.047460562765651616,
+        0.0055996266107945815, 0.00030524976709321095, 6.592123026075361E-06, 4.1107693303495516E-08,
+        3.2908740303507174E-11,
+        // n = 10
+        0.3084411157650201, 0.4011199291552737, 0.21806828761180932, 0.06208745609867772,
+        0.009501516975181099, 0.000753008388587538, 2.825923349599561E-05, 4.249313984962674E-07,
+        1.8395648239796315E-09, 9.911827219609029E-13,
+        // n = 11
+        0.2849332128942016, 0.38972088952784856, 0.2327818318489912, 0.07656445354619665,
+        0.014393282767350704, 0.0015188808464848744, 8.513122435471918E-05, 2.292403879574502E-06,
+        2.4863537027677974E-08, 7.712626933691311E-11, 2.8837758683236084E-14,
+        // n = 12
+        0.2647313710554432, 0.3777592758731375, 0.24408201131987753, 0.09044922221168092,
+        0.020102381154634103, 0.002663973541865316, 0.00020323159266299925, 8.365055856819789E-06,
+        1.6684938765409082E-07, 1.3423910305150068E-09, 3.0616016350350288E-12, 8.148077467426274E-16,
+        // n = 13
+        0.2471887084299633, 0.36568882290052124, 0.2525624200576588, 0.10347075802418369,
+        0.02643275441556162, 0.004220396040254763, 0.00041188177047273505, 2.3515473981553212E-05,
+        7.317311620249103E-07, 1.1088416257039803E-08, 6.770826692205907E-11, 1.1599799599050784E-13,
+        2.245093203892749E-17,
+        // n = 14
+        0.23181557714486445, 0.35378469159754383, 0.25873461024542815, 0.11548289355692345,
+        0.03319209215933738, 0.006192869437006608, 0.000739890377867385, 5.490719466841691E-05,
+        2.4095857640853744E-06, 5.801543981676503E-08, 6.819314692484974E-10, 3.2212077518948536E-12,
+        4.2213524405166015E-15, 6.05237502228918E-19,
+        // n = 15
+        0.2182348859400865, 0.34221017792288383, 0.26302757794167986, 0.12642581810593045,
+        0.0402068649210009, 0.00856387780361184, 0.001212436147214254, 0.00011167439234425213,
+        6.45992676202291E-06, 2.2263169070962667E-07, 4.227430384979379E-09, 3.921897267041093E-11,
+        1.4565152640731247E-13, 1.4830270511132964E-16, 1.6005949062111323E-20,
+        // n = 16
+        0.20615171495779974, 0.3310578549508822, 0.265795777644215, 0.1362969342963774,
+        0.04732892869412529, 0.011299900080339455, 0.0018490709435263094, 0.00020427191530827853,
+        1.4844586873981289E-05, 6.828319330871196E-07, 1.8810248410796676E-08, 2.862350242973888E-10,
+        2.1270790332241117E-12, 6.297967002517819E-15, 5.050473700035529E-18, 4.161462370372832E-22,
+        // n = 17
+        0.19533220525177217, 0.3203753572745416, 0.2673297263571711, 0.14512985435875847,
+        0.054436943245338466, 0.0143572977660619, 0.0026628247355727696, 0.00034367972715629915,
+        3.0275517837828706E-05, 1.7685150532316768E-06, 6.576272886810438E-08, 1.4697309321595503E-09,
+        1.8169103625554485E-11, 1.0954013889286879E-13, 2.6173738822233643E-16, 1.672935693146164E-19,
+        1.0656263162740501E-23,
+        // n = 18
+        0.18558860314691913, 0.3101817663702258, 0.2678665671485364, 0.15297974746807513,
+        0.06143491786096162, 0.017687213080772927, 0.003660179767759914, 0.0005406227870077351,
+        5.616965051214231E-05, 4.015307883701153E-06, 1.9146698566756803E-07, 5.836095268631583E-09,
+        1.0717112669553932E-10, 1.0890987138888334E-12, 5.3866647483782974E-15, 1.0498659780357009E-17,
+        5.405398451631089E-21, 2.6916532692010203E-25,
+        // n = 19
+        0.17676847491591074, 0.30047814360725594, 0.2675995470381744, 0.15991337213558005,
+        0.06824937997614919, 0.021239307606544328, 0.004841627351148397, 0.0008049127473813681,
+        9.652472093153497E-05, 8.20730525805104E-06, 4.830566724730778E-07, 1.9049913611232875E-08,
+        4.816684630928057E-10, 7.348258839551167E-12, 6.202275387572648E-14, 2.5414308430154286E-16,
+        4.0788612968256913E-19, 1.7077501875938348E-22, 6.71506464990816E-27,
+        // n = 20
+        0.16874680185111218, 0.2912543620060691, 0.2666861028670008, 0.16600245326950666,
+        0.07482606466879232, 0.024964417309283254, 0.006202550844572232, 0.0011449623864769087,
+        0.00015574177302781216, 1.5401440865224935E-05, 1.0864863665179856E-06, 5.330120909556714E-08,
+        1.7579811790505857E-09, 3.725502402512338E-11, 4.767529251578197E-13, 3.372844243362435E-15,
+        1.155014339500401E-17, 1.539522140582343E-20, 5.2864427255691904E-24, 1.6564566124990417E-28,
+        // n = 21
+        0.1614201001816397, 0.28249356458299496, 0.26525457551389947, 0.17131939639002167,
+        0.08112662589235319, 0.02881630176776946, 0.007734239426118729, 0.00156748139042119,
+        0.0002384226587634137, 2.693007343968616E-05, 2.2247907936450497E-06, 1.3173344974323292E-07,
+        5.443952290646433E-09, 1.516366205198058E-10, 2.7178831180589085E-12, 2.94251935407196E-14,
+        1.7590740357977265E-16, 5.073802227172023E-19, 5.659720870324221E-22, 1.6062609247993022E-25,
+        4.0441339271159716E-30,
+        // n = 22
+        0.15470198763989387, 0.2741750823285639, 0.26340970153563337, 0.17593460926307222,
+        0.08712562217220987, 0.032752687896538624, 0.009424900256998252, 0.0020773357526546214,
+        0.0003491673714923002, 4.4382193140661426E-05, 4.214229901104628E-06, 2.940668246130169E-07,
+        1.4761938263897471E-08, 5.186423025724868E-10, 1.2305262515544114E-11, 1.8804655096314786E-13,
+        1.73556413912683E-15, 8.831402308327115E-18, 2.1607186468182028E-20, 2.0311199675833246E-23,
+        4.7979035209907906E-27, 9.780246506683724E-32,
+        // n = 23
+        0.14851979908204652, 0.26627634222202756, 0.26123706746534914, 0.1799149140382851,
+        0.09280788216398886, 0.03673579259475958, 0.011260589222543535, 0.002677540143126988,
+        0.0004923896728665579, 6.956649894243947E-05, 7.476361523134103E-06, 6.03063241246296E-07,
+        3.5883396900215166E-08, 1.5405512400611396E-09, 4.639077530349055E-11, 9.446912374131373E-13,
+        1.2397411693143608E-14, 9.82116826801154E-17, 4.281846844983538E-19, 8.94323883629716E-22,
+        7.129396795317394E-25, 1.4107671088952208E-28, 2.344614766311689E-33,
+        // n = 24
+        0.14281197333478354, 0.25877410751742524, 0.2588067072728701, 0.18332268897777804,
+        0.09816627262991882, 0.0407324781514086, 0.013226019405120162, 0.0033693490584782997,
+        0.0006721625640935472, 0.00010446121465927508, 1.2544721977993327E-05, 1.1513158127372808E-06,
+        7.96081295913364E-08, 4.072858987550002E-09, 1.5070082262925772E-10, 3.917736515058451E-12,
+        6.894181052958098E-14, 7.819800382459459E-16, 5.350188813010018E-18, 2.0105174645554965E-20,
+        3.605765864552978E-23, 2.4518188458784044E-26, 4.088301593680698E-30, 5.575345788328281E-35,
+        // n = 25
+        0.13752601422934327, 0.2516452737649129, 0.2561760028097562, 0.1862154903624363,
+        0.10319984810752082, 0.04471416112993358, 0.015305232886395409, 0.004152414632877072,
+        0.0008920990732596824, 0.00015115601916424053, 2.0065531801932916E-05, 2.0677743964318756E-06,
+        1.6346520222911474E-07, 9.766015062124506E-09, 4.3277207941849214E-10, 1.3896009633894943E-11,
+        3.1389227925399263E-13, 4.802614822604177E-15, 4.735885364807223E-17, 2.8142053798430115E-19,
+        9.164954395991104E-22, 1.4189400094972351E-24, 8.273651944099297E-28, 1.1688817115427628E-31,
+        1.3158315000591399E-36,
+        // n = 26
+        0.13261688414760447, 0.24486736801629225, 0.2533920221271266, 0.18864598364175997,
+        0.10791234164258771, 0.04865656544892174, 0.017482137978489423, 0.0050249838368313015,
+        0.001155269160749611, 0.00021179115830036012, 3.079252604171525E-05, 3.5234400910243614E-06,
+        3.141556325359245E-07, 2.1554568144037104E-08, 1.120478117670476E-09, 4.329002405136871E-11,
+        1.2136891598372082E-12, 2.3960742232613127E-14, 3.2052185598316444E-16, 2.7624941506079366E-18,
+        1.433064364072721E-20, 4.0648446941130025E-23, 5.459513322798903E-26, 2.743220987135345E-29,
+        3.300230478152115E-33, 3.0837522695855507E-38,
+        // n = 27
+        0.1280457269068352, 0.23841884939413993, 0.25049340652300345, 0.19066206759352444,
+        0.11231094931185083, 0.052539385475132164, 0.019740923275744452, 0.005984113555700982,
+        0.001464150360922788, 0.00028849800396584386, 4.557654440373499E-05, 5.735756119190861E-06,
+        5.702097017139383E-07, 4.4307691576321336E-08, 2.6561653164937987E-09, 1.2089475247687188E-10,
+        4.0962644275901265E-12, 1.0083497673165072E-13, 1.7490517511153783E-15, 2.055967083261501E-17,
+        1.5562957367237972E-19, 7.081265177901148E-22, 1.7574720104285904E-24, 2.057043036797565E-27,
+        8.947419115369297E-31, 9.209310916917868E-35, 7.179742378294634E-40,
+        // n = 28
+        0.12377884395428819, 0.2322792769008978, 0.24751189603647844, 0.19230711313238277,
+        0.11640536172113017, 0.05634590536447733, 0.022066364326258865, 0.007025887635583856,
+        0.0018206078926958497, 0.0003833443038571233, 6.535087080694399E-05, 8.971362053410736E-06,
+        9.847012256249316E-07, 8.56407585267302E-08, 5.8368387631383515E-09, 3.075638877842294E-10,
+        1.2325909527244195E-11, 3.682173674108324E-13, 7.99879057596895E-15, 1.224922500324083E-16,
+        1.2711242950306686E-18, 8.488593367686572E-21, 3.402455379425492E-23, 7.42015658886746E-26,
+        7.600413205801786E-29, 2.8739103179403694E-32, 2.5418229038892864E-36, 1.6613758780290033E-41,
+        // n = 29
+        0.11978686722479494, 0.22642938894472237, 0.2444735653556833, 0.19362026449763903,
+        0.1202069996017957, 0.0600626060518227, 0.024444040022708613, 0.008145624870286122,
+        0.002225899096067027, 0.0004982863213445216, 9.111348999272685E-05, 1.3547034631790876E-05,
+        1.6278500050223864E-06, 1.5687206990177646E-07, 1.2009533101199076E-08, 7.220528067633335E-10,
+        3.362401315847901E-11, 1.1925479056622088E-12, 3.156204723862702E-14, 6.078331294228506E-16,
+        8.254298347471635E-18, 7.594039930710233E-20, 4.492421504930585E-22, 1.5926368145878537E-24,
+        3.064007640463234E-27, 2.7572669535983318E-30, 9.099251850437338E-34, 6.943730710008735E-38,
+        3.8222471284652145E-43,
+        // n = 30
+        0.11604408602039512, 0.22085112475069368, 0.2413998275878744, 0.1946367684464171,
+        0.12372841596688128, 0.06367878036898839, 0.02686047527338051, 0.009338070881604233,
+        0.0026806968913369003, 0.0006351291219408769, 0.00012390745990688634, 1.9828788438952923E-05,
+        2.5893509291314814E-06, 2.7409428405360783E-07, 2.3328311650257954E-08, 1.5807455747783811E-09,
+        8.427479123057045E-11, 3.4851612349079786E-12, 1.0990180597534687E-13, 2.588312664959228E-15,
+        4.437838059840301E-17, 5.365918308212332E-19, 4.3939468922917196E-21, 2.311409794388648E-23,
+        7.274588498292516E-26, 1.2391497014482748E-28, 9.832375083105666E-32, 2.842323553402838E-35,
+        1.8786080317495777E-39, 8.745980440465304E-45,
+        // n = 31
+        0.11252789550372423, 0.2155276081808954, 0.2383082516456969, 0.19538830929790196,
+        0.12698283289306236, 0.0671861689238994, 0.029303224993879474, 0.010597569915295726,
+        0.0031851272582387007, 0.0007954954830794029, 0.00016480052126636687, 2.8229237864310876E-05,
+        3.980290255100859E-06, 4.593183984180127E-07, 4.307554518773115E-08, 3.2551249938271653E-09,
+        1.9620246675410584E-10, 9.319049908661772E-12, 3.4377541819411636E-13, 9.679524713044675E-15,
+        2.0368066110115318E-16, 3.1212687280713435E-18, 3.372958170416105E-20, 2.4672796386616672E-22,
+        1.1582201904525593E-24, 3.2472922591425406E-27, 4.914301730805789E-30, 3.450007110480792E-33,
+        8.766371011716227E-37, 5.036364392116101E-41, 1.9909984582531586E-46,
+        // n = 32
+        0.10921834195238526, 0.21044310793880916, 0.23521322966984776, 0.19590333597288126,
+        0.12998378628607168, 0.07057862386571773, 0.031760912509174996, 0.011918214834838575,
+        0.003738816294611518, 0.0009808033066149562, 0.00021486491880136414, 3.920341967987948E-05,
+        5.934541612868621E-06, 7.416404578667547E-07, 7.604567879120757E-08, 6.350602226625813E-09,
+        4.281382971040917E-10, 2.3058994918913408E-11, 9.799379288727118E-13, 3.237801657729283E-14,
+        8.171823443420758E-16, 1.542133833393827E-17, 2.1197922901636324E-19, 2.054429673788032E-21,
+        1.3469825866373923E-23, 5.661294130397351E-26, 1.4185605454630568E-28, 1.9133754944542097E-31,
+        1.1922487600982233E-34, 2.6715112192401177E-38, 1.3386169421062728E-42, 4.5105361938989766E-48,
+    };
+
+    /// <summary>Gauss-Hermite nodes on (-∞, ∞) for the weight e^(-x²), ascending.</summary>
+    public static ReadOnlySpan<double> HermiteNodes => HermiteNodesTable;
+
+    private static readonly double[] HermiteNodesTable =
+    {
+        // n = 1
+        0,
+        // n = 2
+        -0.7071067811865476, 0.7071067811865476,
+        // n = 3
+        -1.224744871391589, 0, 1.224744871391589,
+        // n = 4
+        -1.6506801238857844, -0.5246476232752904, 0.5246476232752904, 1.6506801238857844,
+        // n = 5
+        -2.0201828704560856, -0.9585724646138185, 0, 0.9585724646138185,
+        2.0201828704560856,
+        // n = 6
+        -2.3506049736744923, -1.335849074013697, -0.4360774119276165, 0.4360774119276165,
+        1.335849074013697, 2.3506049736744923,
+        // n = 7
+        -2.6519613568352334, -1.6735516287674714, -0.8162878828589646, 0,
+        0.8162878828589646, 1.6735516287674714, 2.6519613568352334,
+        // n = 8
+        -2.930637420257244, -1.9816567566958427, -1.1571937124467802, -0.38118699020732216,
+        0.38118699020732216, 1.1571937124467802, 1.9816567566958427, 2.930637420257244,
+        // n = 9
+        -3.1909932017815272, -2.266580584531843, -1.468553289216668, -0.7235510187528376,
+        0, 0.7235510187528376, 1.468553289216668, 2.266580584531843,
+        3.1909932017815272,
+        // n = 10
+        -3.436159118837738, -2.5327316742327897, -1.7566836492998819, -1.0366108297895136,
+        -0.3429013272237046, 0.3429013272237046, 1.0366108297895136, 1.7566836492998819,
+        2.5327316742327897, 3.436159118837738,
+        // n = 11
+        -3.6684708465595826, -2.783290099781652, -2.025948015825755, -1.3265570844949328,
+        -0.6568095668820997, 0, 0.6568095668820997, 1.3265570844949328,
+        2.025948015825755, 2.783290099781652, 3.6684708465595826,
+        // n = 12
+        -3.889724897869782, -3.0206370251208896, -2.2795070805010598, -1.5976826351526048,
+        -0.9477883912401637, -0.31424037625435913, 0.31424037625435913, 0.9477883912401637,
+        1.5976826351526048, 2.2795070805010598, 3.0206370251208896, 3.889724897869782,
+        // n = 13
+        -4.10133759617864, -3.24660897837241, -2.519735685678238, -1.8531076516015121,
+        -1.2200550365907485, -0.6057638791710601, 0, 0.6057638791710601,
+        1.2200550365907485, 1.8531076516015121, 2.519735685678238, 3.24660897837241,
+        4.10133759617864,
+        // n = 14
+        -4.304448570473632, -3.4626569336022706, -2.7484707249854026, -2.0951832585077166,
+        -1.4766827311411408, -0.8787137873293994, -0.29174551067256205, 0.29174551067256205,
+        0.8787137873293994, 1.4766827311411408, 2.0951832585077166, 2.7484707249854026,
+        3.4626569336022706, 4.304448570473632,
+        // n = 15
+        -4.499990707309391, -3.6699503734044527, -2.967166927905603, -2.3257324861738575,
+        -1.7199925751864888, -1.1361155852109208, -0.5650695832555758, 0,
+        0.5650695832555758, 1.1361155852109208, 1.7199925751864888, 2.3257324861738575,
+        2.967166927905603, 3.6699503734044527, 4.499990707309391,
+        // n = 16
+        -4.688738939305819, -3.8694479048601225, -3.176999161979956, -2.5462021578474814,
+        -1.9517879909162539, -1.3802585391988809, -0.8229514491446559, -0.27348104613815244,
+        0.27348104613815244, 0.8229514491446559, 1.3802585391988809, 1.9517879909162539,
+        2.5462021578474814, 3.176999161979956, 3.8694479048601225, 4.688738939305819,
+        // n = 17
+        -4.871345193674403, -4.0619466758754745, -3.378932091141494, -2.7577629157038888,
+        -2.173502826666621, -1.6129243142212313, -1.0676487257434506, -0.5316330013426548,
+        0, 0.5316330013426548, 1.0676487257434506, 1.6129243142212313,
+        2.173502826666621, 2.7577629157038888, 3.378932091141494, 4.0619466758754745,
+        4.871345193674403,
+        // n = 18
+        -5.048364008874467, -4.248117873568126, -3.573769068486266, -2.961377505531607,
+        -2.3862990891666858, -1.8355316042616288, -1.3009208583896175, -0.7766829192674116,
+        -0.2582677505190968, 0.2582677505190968, 0.7766829192674116, 1.3009208583896175,
+        1.8355316042616288, 2.3862990891666858, 2.961377505531607, 3.573769068486266,
+        4.248117873568126, 5.048364008874467,
+        // n = 19
+        -5.220271690537482, -4.428532806603779, -3.76218735196402, -3.157848818347602,
+        -2.5911337897945423, -2.0492317098506194, -1.524170619393533, -1.0103683871343114,
+        -0.5035201634238882, 0, 0.5035201634238882, 1.0103683871343114,
+        1.524170619393533, 2.0492317098506194, 2.5911337897945423, 3.157848818347602,
+        3.76218735196402, 4.428532806603779, 5.220271690537482,
+        // n = 20
+        -5.387480890011233, -4.603682449550744, -3.944764040115625, -3.3478545673832163,
+        -2.7888060584281305, -2.2549740020892757, -1.7385377121165861, -1.234076215395323,
+        -0.7374737285453943, -0.24534070830090124, 0.24534070830090124, 0.7374737285453943,
+        1.234076215395323, 1.7385377121165861, 2.2549740020892757, 2.7888060584281305,
+        3.3478545673832163, 3.944764040115625, 4.603682449550744, 5.387480890011233,
+        // n = 21
+        -5.550351873264678, -4.773992343411219, -4.1219955474918395, -3.5319728771376777,
+        -2.979991207704598, -2.453552124512838, -1.9449629491862537, -1.448934250650732,
+        -0.961499634418369, -0.4794507070791076, 0, 0.4794507070791076,
+        0.961499634418369, 1.448934250650732, 1.9449629491862537, 2.453552124512838,
+        2.979991207704598, 3.5319728771376777, 4.1219955474918395, 4.773992343411219,
+        5.550351873264678,
+        // n = 22
+        -5.7092013532052635, -4.939834131060176, -4.294312480593161, -3.710701532877805,
+        -3.1652659092021374, -2.6456374410581724, -2.1442335927985345, -1.6558743732864225,
+        -1.1767139584812445, -0.703686097170007, -0.23417913993099065, 0.23417913993099065,
+        0.703686097170007, 1.1767139584812445, 1.6558743732864225, 2.1442335927985345,
+        2.6456374410581724, 3.1652659092021374, 3.710701532877805, 4.294312480593161,
+        4.939834131060176, 5.7092013532052635,
+        // n = 23
+        -5.864309498984572, -5.101534610476677, -4.462091173740006, -3.884472708106102,
+        -3.3451271599412244, -2.831803787126157, -2.337016211474456, -1.8556770376713712,
+        -1.3840395856824952, -0.9191514654425638, -0.4585383500681048, 0,
+        0.4585383500681048, 0.9191514654425638, 1.3840395856824952, 1.8556770376713712,
+        2.337016211474456, 2.831803787126157, 3.3451271599412244, 3.884472708106102,
+        4.462091173740006, 5.101534610476677, 5.864309498984572,
+        // n = 24
+        -6.01592556142574, -5.259382927668044, -4.625662756423787, -4.05366440244815,
+        -3.5200068130345246, -3.0125461375655647, -2.523881017011427, -2.049003573661699,
+        -1.5842500109616942, -1.1267608176112451, -0.6741711070372123, -0.22441454747251557,
+        0.22441454747251557, 0.6741711070372123, 1.1267608176112451, 1.5842500109616942,
+        2.049003573661699, 2.523881017011427, 3.0125461375655647, 3.5200068130345246,
+        4.05366440244815, 4.625662756423787, 5.259382927668044, 6.01592556142574,
+        // n = 25
+        -6.164272434052452, -5.413636355280034, -4.785320367352224, -4.218609444386561,
+        -3.690282876998356, -3.1882949244251044, -2.705320237173026, -2.236420130267281,
+        -1.7780011243371474, -1.327280702073084, -0.8819827562138213, -0.4401472986453083,
+        0, 0.4401472986453083, 0.8819827562138213, 1.327280702073084,
+        1.7780011243371474, 2.236420130267281, 2.705320237173026, 3.1882949244251044,
+        3.690282876998356, 4.218609444386561, 4.785320367352224, 5.413636355280034,
+        6.164272434052452,
+        // n = 26
+        -6.309550385625694, -5.564524981950103, -4.941324957241379, -4.379602662983305,
+        -3.856288419909149, -3.35942718235083, -2.881762219543087, -2.418415764773779,
+        -1.9658547856411366, -1.5213615166519212, -1.0827330110778834, -0.6480952139934483,
+        -0.21577785624346343, 0.21577785624346343, 0.6480952139934483, 1.0827330110778834,
+        1.5213615166519212, 1.9658547856411366, 2.418415764773779, 2.881762219543087,
+        3.35942718235083, 3.856288419909149, 4.379602662983305, 4.941324957241379,
+        5.564524981950103, 6.309550385625694,
+        // n = 27
+        -6.451940140753472, -5.712255552816536, -5.093910003113184, -4.5369066633724415,
+        -4.018318670408739, -3.526275340134353, -3.053582419822255, -2.5954163389108182,
+        -2.1482966453616275, -1.7095607392603374, -1.277066817339858, -0.8490113420601031,
+        -0.42380790054385303, 0, 0.42380790054385303, 0.8490113420601031,
+        1.277066817339858, 1.7095607392603374, 2.1482966453616275, 2.5954163389108182,
+        3.053582419822255, 3.526275340134353, 4.018318670408739, 4.5369066633724415,
+        5.093910003113184, 5.712255552816536, 6.451940140753472,
+        // n = 28
+        -6.591605442367743, -5.85701464138285, -5.243285373202936, -4.690756523943118,
+        -4.1766367421292685, -3.68913423846168, -3.2211120765614556, -2.767795352913594,
+        -2.325749842656441, -1.8923604968376853, -1.4655372634574093, -1.0435352737542083,
+        -0.6248367195052092, -0.20806738269073685, 0.20806738269073685, 0.6248367195052092,
+        1.0435352737542083, 1.4655372634574093, 1.8923604968376853, 2.325749842656441,
+        2.767795352913594, 3.2211120765614556, 3.68913423846168, 4.1766367421292685,
+        4.690756523943118, 5.243285373202936, 5.85701464138285, 6.591605442367743,
+        // n = 29
+        -6.7286951986088495, -5.99897128946382, -5.389640521966752, -4.841363651059164,
+        -4.33147829381915, -3.8482667922136202, -3.384645141092214, -2.9358825042901264,
+        -2.498585691019404, -2.070181076053428, -1.6486229138923163, -1.232215755084753,
+        -0.8194986812709115, -0.4091646363949287, 0, 0.4091646363949287,
+        0.8194986812709115, 1.232215755084753, 1.6486229138923163, 2.070181076053428,
+        2.498585691019404, 2.9358825042901264, 3.384645141092214, 3.8482667922136202,
+        4.33147829381915, 4.841363651059164, 5.389640521966752, 5.99897128946382,
+        6.7286951986088495,
+        // n = 30
+        -6.863345293529892, -6.138279220123935, -5.533147151567496, -4.988918968589944,
+        -4.4830553570925185, -4.003908603861229, -3.54444387315535, -3.0999705295864417,
+        -2.6671321245356174, -2.243391467761504, -1.826741143603688, -1.4155278001981886,
+        -1.0083382710467235, -0.6039210586255523, -0.2011285765488715, 0.2011285765488715,
+        0.6039210586255523, 1.0083382710467235, 1.4155278001981886, 1.826741143603688,
+        2.243391467761504, 2.6671321245356174, 3.0999705295864417, 3.54444387315535,
+        4.003908603861229, 4.4830553570925185, 4.988918968589944, 5.533147151567496,
+        6.138279220123935, 6.863345293529892,
+        // n = 31
+        -6.99568012371854, -6.27507870494286, -5.673961444618588, -5.133595577112381,
+        -4.631559506312859, -4.156271755818145, -3.7007434032314697, -3.2603207323135406,
+        -2.8316804533902054, -2.41231770548042, -2.000258548935639, -1.5938858604721398,
+        -1.1918269983500465, -0.7928769769153089, -0.39594273647142314, 0,
+        0.39594273647142314, 0.7928769769153089, 1.1918269983500465, 1.5938858604721398,
+        2.000258548935639, 2.41231770548042, 2.8316804533902054, 3.2603207323135406,
+        3.7007434032314697, 4.156271755818145, 4.631559506312859, 5.133595577112381,
+        5.673961444618588, 6.27507870494286, 6.99568012371854,
+        // n = 32
+        -7.125813909830728, -6.409498149269661, -5.812225949515914, -5.2755509865158805,
+        -4.777164503502596, -4.305547953351199, -3.853755485471445, -3.4171674928185705,
+        -2.992490825002374, -2.5772495377323175, -2.169499183606112, -1.7676541094632017,
+        -1.3703764109528718, -0.9765004635896828, -0.5849787654359325, -0.19484074156939934,
+        0.19484074156939934, 0.5849787654359325, 0.9765004635896828, 1.3703764109528718,
+        1.7676541094632017, 2.169499183606112, 2.5772495377323175, 2.992490825002374,
+        3.4171674928185705, 3.853755485471445, 4.305547953351199, 4.777164503502596,
+        5.2755509865158805, 5.812225949515914, 6.409498149269661, 7.125813909830728,
+    };
+
+    /// <summary>Gauss-Hermite weights.</summary>
+    public static ReadOnlySpan<double> HermiteWeights => HermiteWeightsTable;
+
+    private static readonly double[] HermiteWeightsTable =
+    {
+        // n = 1
+        1.7724538509055157,
+        // n = 2
+        0.8862269254527575, 0.8862269254527575,
+        // n = 3
+        0.29540897515091946, 1.1816359006036772, 0.29540897515091946,
+        // n = 4
+        0.0813128354472452, 0.8049140900055124, 0.8049140900055124, 0.0813128354472452,
+        // n = 5
+        0.01995324205904591, 0.39361932315224096, 0.9453087204829417, 0.39361932315224096,
+        0.01995324205904591,
+        // n = 6
+        0.004530009905508838, 0.15706732032285659, 0.7246295952243926, 0.7246295952243926,
+        0.15706732032285659, 0.004530009905508838,
+        // n = 7
+        0.0009717812450995197, 0.054515582819127044, 0.4256072526101276, 0.8102646175568071,
+        0.4256072526101276, 0.054515582819127044, 0.0009717812450995197,
+        // n = 8
+        0.00019960407221136764, 0.017077983007413484, 0.20780232581489186, 0.661147012558241,
+        0.661147012558241, 0.20780232581489186, 0.017077983007413484, 0.00019960407221136764,
+        // n = 9
+        3.960697726326458E-05, 0.004943624275536937, 0.0884745273943766, 0.4326515590025557,
+        0.7202352156060507, 0.4326515590025557, 0.0884745273943766, 0.004943624275536937,
+        3.960697726326458E-05,
+        // n = 10
+        7.64043285523259E-06, 0.0013436457467812333, 0.033874394455481044, 0.24013861108231468,
+        0.6108626337353258, 0.6108626337353258, 0.24013861108231468, 0.033874394455481044,
+        0.0013436457467812333, 7.64043285523259E-06,
+        // n = 11
+        1.439560393714255E-06, 0.00034681946632334496, 0.011911395444911557, 0.11722787516770847,
+        0.42935975235612517, 0.6547592869145914, 0.42935975235612517, 0.11722787516770847,
+        0.011911395444911557, 0.00034681946632334496, 1.439560393714255E-06,
+        // n = 12
+        2.6585516843563044E-07, 8.573687043587875E-05, 0.0039053905846290677, 0.05160798561588398,
+        0.26049231026416114, 0.5701352362624796, 0.5701352362624796, 0.26049231026416114,
+        0.05160798561588398, 0.0039053905846290677, 8.573687043587875E-05, 2.6585516843563044E-07,
+        // n = 13
+        4.825731850073126E-08, 2.0430360402707067E-05, 0.0012074599927193825, 0.020862775296169925,
+        0.14032332068702336, 0.42161629689854335, 0.6043931879211617, 0.42161629689854335,
+        0.14032332068702336, 0.020862775296169925, 0.0012074599927193825, 2.0430360402707067E-05,
+        4.825731850073126E-08,
+        // n = 14
+        8.628591168125165E-09, 4.71648435501892E-06, 0.0003550926135519229, 0.007850054726457946,
+        0.06850553422346523, 0.27310560906424647, 0.5364059097120897, 0.5364059097120897,
+        0.27310560906424647, 0.06850553422346523, 0.007850054726457946, 0.0003550926135519229,
+        4.71648435501892E-06, 8.628591168125165E-09,
+        // n = 15
+        1.5224758042535313E-09, 1.059115547711065E-06, 0.00010000444123249984, 0.002778068842912777,
+        0.0307800338725461, 0.15848891579593558, 0.4120286874988986, 0.5641003087264174,
+        0.4120286874988986, 0.15848891579593558, 0.0307800338725461, 0.002778068842912777,
+        0.00010000444123249984, 1.059115547711065E-06, 1.5224758042535313E-09,
+        // n = 16
+        2.6548074740111637E-10, 2.3209808448652197E-07, 2.7118600925378804E-05, 0.0009322840086241802,
+        0.01288031153550997, 0.08381004139898578, 0.2806474585285337, 0.5079294790166136,
+        0.5079294790166136, 0.2806474585285337, 0.08381004139898578, 0.01288031153550997,
+        0.0009322840086241802, 2.7118600925378804E-05, 2.3209808448652197E-07, 2.6548074740111637E-10,
+        // n = 17
+        4.580578930798612E-11, 4.9770789816307745E-08, 7.112289140021292E-06, 0.00029864328669775253,
+        0.005067349957627521, 0.04092003414975631, 0.1726482976700969, 0.40182646947041184,
+        0.5309179376248634, 0.40182646947041184, 0.1726482976700969, 0.04092003414975631,
+        0.005067349957627521, 0.00029864328669775253, 7.112289140021292E-06, 4.9770789816307745E-08,
+        4.580578930798612E-11,
+        // n = 18
+        7.828199772115893E-12, 1.0467205795792154E-08, 1.8106544810934303E-06, 9.181126867929384E-05,
+        0.0018885226302684226, 0.018640042387544666, 0.09730174764131545, 0.2848072856699796,
+        0.4834956947254556, 0.4834956947254556, 0.2848072856699796, 0.09730174764131545,
+        0.018640042387544666, 0.0018885226302684226, 9.181126867929384E-05, 1.8106544810934303E-06,
+        1.0467205795792154E-08, 7.828199772115893E-12,
+        // n = 19
+        1.3262970944985264E-12, 2.1630510098635645E-09, 4.488243147223124E-07, 2.720919776316169E-05,
+        0.0006708775214071833, 0.007988866777722979, 0.05081038690905212, 0.1836327013069969,
+        0.39160898861303023, 0.5029748882761865, 0.39160898861303023, 0.1836327013069969,
+        0.05081038690905212, 0.007988866777722979, 0.0006708775214071833, 2.720919776316169E-05,
+        4.488243147223124E-07, 2.1630510098635645E-09, 1.3262970944985264E-12,
+        // n = 20
+        2.2293936455341523E-13, 4.39934099227318E-10, 1.0860693707692815E-07, 7.802556478532067E-06,
+        0.00022833863601635397, 0.0032437733422378528, 0.024810520887463626, 0.1090172060200233,
+        0.28667550536283426, 0.4622436696006101, 0.4622436696006101, 0.28667550536283426,
+        0.1090172060200233, 0.024810520887463626, 0.0032437733422378528, 0.00022833863601635397,
+        7.802556478532067E-06, 1.0860693707692815E-07, 4.39934099227318E-10, 2.2293936455341523E-13,
+        // n = 21
+        3.720365070136028E-14, 8.818611242049989E-11, 2.5712301800593366E-08, 2.1718848980566665E-06,
+        7.478398867310048E-05, 0.0012549820417264118, 0.01141406583743438, 0.06017964665891226,
+        0.19212032406699758, 0.3816690736135022, 0.4790237031201775, 0.3816690736135022,
+        0.19212032406699758, 0.06017964665891226, 0.01141406583743438, 0.0012549820417264118,
+        7.478398867310048E-05, 2.1718848980566665E-06, 2.5712301800593366E-08, 8.818611242049989E-11,
+        3.720365070136028E-14,
+        // n = 22
+        6.167183424404042E-15, 1.744339007547979E-11, 5.966990986059651E-09, 5.88428756330102E-07,
+        2.36551285525105E-05, 0.0004648850508842528, 0.004978399335051637, 0.031140370884423854,
+        0.11910236095878236, 0.2869714332469072, 0.44354522643495925, 0.44354522643495925,
+        0.2869714332469072, 0.11910236095878236, 0.031140370884423854, 0.004978399335051637,
+        0.0004648850508842528, 2.36551285525105E-05, 5.88428756330102E-07, 5.966990986059651E-09,
+        1.744339007547979E-11, 6.167183424404042E-15,
+        // n = 23
+        1.016038462063676E-15, 3.4083140980305266E-12, 1.3596296504028935E-09, 1.5553393291457637E-07,
+        7.249295918002272E-06, 0.00016556169914187414, 0.0020695678749606326, 0.015207084004484112,
+        0.06889028942908737, 0.1986448985780225, 0.37214382487756476, 0.4581965855932132,
+        0.37214382487756476, 0.1986448985780225, 0.06889028942908737, 0.015207084004484112,
+        0.0020695678749606326, 0.00016556169914187414, 7.249295918002272E-06, 1.5553393291457637E-07,
+        1.3596296504028935E-09, 3.4083140980305266E-12, 1.016038462063676E-15,
+        // n = 24
+        1.6643684964891003E-16, 6.584620243078192E-13, 3.0462542699875793E-10, 4.018971174941404E-08,
+        2.1582457049023337E-06, 5.6886916364043854E-05, 0.0008236924826884155, 0.007048355810072666,
+        0.03744547050323075, 0.1277396217845592, 0.2861795353464429, 0.4269311638686991,
+        0.4269311638686991, 0.2861795353464429, 0.1277396217845592, 0.03744547050323075,
+        0.007048355810072666, 0.0008236924826884155, 5.6886916364043854E-05, 2.1582457049023337E-06,
+        4.018971174941404E-08, 3.0462542699875793E-10, 6.584620243078192E-13, 1.6643684964891003E-16,
+        // n = 25
+        2.7119235140383797E-17, 1.2588149877465357E-13, 6.719638417706233E-11, 1.0170382503018459E-08,
+        6.257032499691094E-07, 1.891597295734058E-05, 0.00031508363874548426, 0.003115708720125635,
+        0.0192430989654089, 0.07688899517580881, 0.20362113667812407, 0.3630889892758902,
+        0.43986872216948464, 0.3630889892758902, 0.20362113667812407, 0.07688899517580881,
+        0.0192430989654089, 0.003115708720125635, 0.00031508363874548426, 1.891597295734058E-05,
+        6.257032499691094E-07, 1.0170382503018459E-08, 6.719638417706233E-11, 1.2588149877465357E-13,
+        2.7119235140383797E-17,
+        // n = 26
+        4.3969160947538666E-18, 2.383148659372156E-14, 1.460999933981607E-11, 2.5244940344905342E-09,
+        1.770106337397359E-07, 6.103291717396013E-06, 0.00011622970160310988, 0.0013190647223238596,
+        0.00939790129115958, 0.0435982272172509, 0.13511332791178784, 0.2846322411767846,
+        0.4120436505903695, 0.4120436505903695, 0.2846322411767846, 0.13511332791178784,
+        0.0435982272172509, 0.00939790129115958, 0.0013190647223238596, 0.00011622970160310988,
+        6.103291717396013E-06, 1.770106337397359E-07, 2.5244940344905342E-09, 1.460999933981607E-11,
+        2.383148659372156E-14, 4.3969160947538666E-18,
+        // n = 27
+        7.095779297051259E-19, 4.4707724573931494E-15, 3.134117613623056E-12, 6.155031578231809E-10,
+        4.895400409699532E-08, 1.915280900595294E-06, 4.1467580043841376E-05, 0.0005367696156881116,
+        0.004381279835792542, 0.023415933625341896, 0.08417308108405194, 0.20737048075100942,
+        0.35451730409975424, 0.42357728801505934, 0.35451730409975424, 0.20737048075100942,
+        0.08417308108405194, 0.023415933625341896, 0.004381279835792542, 0.0005367696156881116,
+        4.1467580043841376E-05, 1.915280900595294E-06, 4.895400409699532E-08, 6.155031578231809E-10,
+        3.134117613623056E-12, 4.4707724573931494E-15, 7.095779297051259E-19,
+        // n = 28
+        1.1401393479036668E-19, 8.315937951206863E-16, 6.639436714909618E-13, 1.4758531682776904E-10,
+        1.3256825015417037E-08, 5.857719720992941E-07, 1.4345504229714422E-05, 0.00021061810002403163,
+        0.001957331294408987, 0.011968423214354831, 0.04951488928989815, 0.14139460978695492,
+        0.28256139125938895, 0.39860471782645157, 0.39860471782645157, 0.28256139125938895,
+        0.14139460978695492, 0.04951488928989815, 0.011968423214354831, 0.001957331294408987,
+        0.00021061810002403163, 1.4345504229714422E-05, 5.857719720992941E-07, 1.3256825015417037E-08,
+        1.4758531682776904E-10, 6.639436714909618E-13, 8.315937951206863E-16, 1.1401393479036668E-19,
+        // n = 29
+        1.8244608527672643E-20, 1.5345004446053178E-16, 1.3901072714496023E-13, 3.484130161308421E-11,
+        3.5203123276007122E-09, 1.7492291299499458E-07, 4.82307349764778E-06, 7.990920354521826E-05,
+        0.0008407925061402629, 0.005845503545271506, 0.027639655592023717, 0.09076884221557815,
+        0.21014269444921055, 0.3464189390716704, 0.40897117463522964, 0.3464189390716704,
+        0.21014269444921055, 0.09076884221557815, 0.027639655592023717, 0.005845503545271506,
+        0.0008407925061402629, 7.990920354521826E-05, 4.82307349764778E-06, 1.7492291299499458E-07,
+        3.5203123276007122E-09, 3.484130161308421E-11, 1.3901072714496023E-13, 1.5345004446053178E-16,
+        1.8244608527672643E-20,
+        // n = 30
+        2.9082547001311962E-21, 2.8103336027508666E-17, 2.878607080548689E-14, 8.106186297462978E-12,
+        9.178580424378492E-10, 5.108522450775961E-08, 1.5790948873247055E-06, 2.9387252289229918E-05,
+        0.00034831012431868485, 0.002737922473067655, 0.014703829704826697, 0.055144176870234235,
+        0.14673584754088995, 0.28013093083921276, 0.38639488954181406, 0.38639488954181406,
+        0.28013093083921276, 0.14673584754088995, 0.055144176870234235, 0.014703829704826697,
+        0.002737922473067655, 0.00034831012431868485, 2.9387252289229918E-05, 1.5790948873247055E-06,
+        5.108522450775961E-08, 9.178580424378492E-10, 8.106186297462978E-12, 2.878607080548689E-14,
+        2.8103336027508666E-17, 2.9082547001311962E-21,
+        // n = 31
+        4.618968394464176E-22, 5.1106090079271606E-18, 5.8995564987538654E-15, 1.8603735214521493E-12,
+        2.3524920032086583E-10, 1.4611988344910532E-08, 5.043712558939783E-07, 1.0498602757675637E-05,
+        0.00013952090395047065, 0.0012336833073068893, 0.007482799914035202, 0.031847230731300365,
+        0.09671794816087038, 0.2121327886687648, 0.3387726578941076, 0.39577855609860935,
+        0.3387726578941076, 0.2121327886687648, 0.09671794816087038, 0.031847230731300365,
+        0.007482799914035202, 0.0012336833073068893, 0.00013952090395047065, 1.0498602757675637E-05,
+        5.043712558939783E-07, 1.4611988344910532E-08, 2.3524920032086583E-10, 1.8603735214521493E-12,
+        5.8995564987538654E-15, 5.1106090079271606E-18, 4.618968394464176E-22,
+        // n = 32
+        7.310676427384083E-23, 9.231736536518208E-19, 1.1973440170928558E-15, 4.2150102113264065E-13,
+        5.933291463396675E-11, 4.098832164770867E-09, 1.5741677925455884E-07, 3.650585129562386E-06,
+        5.41658406181999E-05, 0.0005362683655279727, 0.003654890326654424, 0.01755342883157344,
+        0.060458130955912646, 0.15126973407664243, 0.27745814230252985, 0.3752383525928025,
+        0.3752383525928025, 0.27745814230252985, 0.15126973407664243, 0.060458130955912646,
+        0.01755342883157344, 0.003654890326654424, 0.0005362683655279727, 5.41658406181999E-05,
+        3.650585129562386E-06, 1.5741677925455884E-07, 4.098832164770867E-09, 5.933291463396675E-11,
+        4.2150102113264065E-13, 1.1973440170928558E-15, 9.231736536518208E-19, 7.310676427384083E-23,
+    };
+}
@@ -1,5 +1,8 @@
 // CRMF001A.cs - Core mathematical functions (Erf, NormalCDF, Black-Scholes)
 
+using System.Runtime.Intrinsics;
+using Alaris.Core.Vectorized;
+
 namespace Alaris.Core.Math;
 
 /// <summary>
@@ -52,6 +55,13 @@ public static class CRMF001A
     /// </summary>
     public const int TradingDaysPerYear = 252;
 
+    // Contracts per Vector256 lane group in BSImpliedVolatilityBatch
+    private const int BatchLaneCount = 4;
+
+    // |d| cap for the vectorized N(·) and φ(·): keeps exp(-d²/2) above the range where
+    // CRVT002A.VectorExp256 stops flushing to zero, while N(±37) is already 0 or 1
+    private const double BatchMaxAbsD = 37.0;
+
     /// <summary>
     /// Error function erf(x) using Abramowitz and Stegun formula 7.1.26.
     /// </summary>
@@ -421,6 +431,244 @@ public static class CRMF001A
         return BSImpliedVolatilityBrent(S, K, tau, r, q, marketPrice, isCall, tolerance);
     }
 
+    /// <summary>
+    /// Computes Black-Scholes implied volatilities for a batch of contracts.
+    /// </summary>
+    /// <param name="spots">Spot prices.</param>
+    /// <param name="strikes">Strike prices.</param>
+    /// <param name="taus">Times to expiry in years.</param>
+    /// <param name="riskFreeRates">Risk-free rates.</param>
+    /// <param name="dividendYields">Dividend yields.</param>
+    /// <param name="marketPrices">Market prices of the options.</param>
+    /// <param name="isCalls">True for calls, false for puts.</param>
+    /// <param name="impliedVolatilities">Destination; NaN where no volatility exists.</param>
+    /// <param name="tolerance">Convergence tolerance (default 1e-7).</param>
+    /// <param name="maxIterations">Maximum Householder iterations before Brent fallback (default 10).</param>
+    /// <remarks>
+    /// Runs the algorithm of <see cref="BSImpliedVolatility"/> on four contracts at a time in
+    /// <see cref="Vector256{T}"/> lanes: the Corrado-Miller guess and the Householder(3) steps
+    /// are evaluated in lockstep with N(·) and φ(·) from <see cref="CRVT002A"/>. Converged
+    /// lanes are masked off; lanes whose vega vanishes or whose step diverges are handed to
+    /// the scalar Brent solver. The remainder, and hosts without AVX2, use the scalar solver.
+    /// Results match the scalar solver to within the accuracy of the vectorized exponential.
+    /// </remarks>
+    public static void BSImpliedVolatilityBatch(
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> riskFreeRates,
+        ReadOnlySpan<double> dividendYields,
+        ReadOnlySpan<double> marketPrices,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> impliedVolatilities,
+        double tolerance = 1e-7,
+        int maxIterations = 10)
+    {
+        int count = spots.Length;
+        if (strikes.Length != count || taus.Length != count || riskFreeRates.Length != count
+            || dividendYields.Length != count || marketPrices.Length != count
+            || isCalls.Length != count || impliedVolatilities.Length != count)
+        {
+            throw new ArgumentException("All input spans and the output span must have the same length.");
+        }
+
+        int vectorEnd = CRVT002A.IsAvx2Supported ? count - (count % BatchLaneCount) : 0;
+        for (int i = 0; i < vectorEnd; i += BatchLaneCount)
+        {
+            ImpliedVolatilityLaneGroup(
+                spots.Slice(i, BatchLaneCount),
+                strikes.Slice(i, BatchLaneCount),
+                taus.Slice(i, BatchLaneCount),
+                riskFreeRates.Slice(i, BatchLaneCount),
+                dividendYields.Slice(i, BatchLaneCount),
+                marketPrices.Slice(i, BatchLaneCount),
+                isCalls.Slice(i, BatchLaneCount),
+                impliedVolatilities.Slice(i, BatchLaneCount),
+                tolerance,
+                maxIterations);
+        }
+
+        for (int i = vectorEnd; i < count; i++)
+        {
+            impliedVolatilities[i] = BSImpliedVolatility(
+                spots[i], strikes[i], taus[i], riskFreeRates[i], dividendYields[i],
+                marketPrices[i], isCalls[i], tolerance, maxIterations);
+        }
+    }
+
+    /// <summary>
+    /// Lockstep Householder(3) solve for four contracts on <see cref="Vector256{T}"/> lanes.
+    /// </summary>
+    /// <remarks>
+    /// Only σ changes between iterations, so forwards, discounted strikes and log-moneyness
+    /// are computed once per lane in scalar arithmetic. Lanes that fail validation hold
+    /// benign placeholder inputs and never leave the NaN they were initialized with.
+    /// </remarks>
+    private static void ImpliedVolatilityLaneGroup(
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> riskFreeRates,
+        ReadOnlySpan<double> dividendYields,
+        ReadOnlySpan<double> marketPrices,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> impliedVolatilities,
+        double tolerance,
+        int maxIterations)
+    {
+        Span<double> laneSpot = stackalloc double[BatchLaneCount];
+        Span<double> laneForward = stackalloc double[BatchLaneCount];
+        Span<double> laneStrike = stackalloc double[BatchLaneCount];
+        Span<double> laneLogMoneyness = stackalloc double[BatchLaneCount];
+        Span<double> laneSqrtTau = stackalloc double[BatchLaneCount];
+        Span<double> lanePrice = stackalloc double[BatchLaneCount];
+        Span<double> laneSign = stackalloc double[BatchLaneCount];
+        int active = 0;
+
+        for (int lane = 0; lane < BatchLaneCount; lane++)
+        {
+            impliedVolatilities[lane] = double.NaN;
+            laneSpot[lane] = 1.0;
+            laneForward[lane] = 1.0;
+            laneStrike[lane] = 1.0;
+            laneLogMoneyness[lane] = 0.0;
+            laneSqrtTau[lane] = 1.0;
+            lanePrice[lane] = 0.2;
+            laneSign[lane] = 1.0;
+
+            double S = spots[lane];
+            double K = strikes[lane];
+            double tau = taus[lane];
+            double marketPrice = marketPrices[lane];
+            if (marketPrice <= 0 || S <= 0 || K <= 0 || tau <= 0)
+            {
+                continue;
+            }
+
+            // Same no-arbitrage bounds as the scalar solver
+            double fwd = S * System.Math.Exp(-dividendYields[lane] * tau);
+            double strike = K * System.Math.Exp(-riskFreeRates[lane] * tau);
+            double maxPrice = isCalls[lane] ? fwd : strike;
+            double intrinsic = isCalls[lane]
+                ? System.Math.Max(fwd - strike, 0)
+                : System.Math.Max(strike - fwd, 0);
+
+            if (marketPrice < intrinsic - tolerance || marketPrice > maxPrice + tolerance)
+            {
+                continue;
+            }
+
+            laneSpot[lane] = S;
+            laneForward[lane] = fwd;
+            laneStrike[lane] = strike;
+            laneLogMoneyness[lane] = System.Math.Log(S / K) + ((riskFreeRates[lane] - dividendYields[lane]) * tau);
+            laneSqrtTau[lane] = System.Math.Sqrt(tau);
+            lanePrice[lane] = marketPrice;
+            laneSign[lane] = isCalls[lane] ? 1.0 : -1.0;
+            active |= 1 << lane;
+        }
+
+        if (active == 0)
+        {
+            return;
+        }
+
+        Vector256<double> spot = Vector256.Create((ReadOnlySpan<double>)laneSpot);
+        Vector256<double> forward = Vector256.Create((ReadOnlySpan<double>)laneForward);
+        Vector256<double> discountedStrike = Vector256.Create((ReadOnlySpan<double>)laneStrike);
+        Vector256<double> logMoneyness = Vector256.Create((ReadOnlySpan<double>)laneLogMoneyness);
+        Vector256<double> sqrtTau = Vector256.Create((ReadOnlySpan<double>)laneSqrtTau);
+        Vector256<double> target = Vector256.Create((ReadOnlySpan<double>)lanePrice);
+        Vector256<double> sign = Vector256.Create((ReadOnlySpan<double>)laneSign);
+
+        Vector256<double> half = Vector256.Create(0.5);
+        Vector256<double> one = Vector256.Create(1.0);
+        Vector256<double> zero = Vector256<double>.Zero;
+        Vector256<double> sqrtTwoPi = Vector256.Create(SqrtTwoPi);
+        Vector256<double> minVolatility = Vector256.Create(MinVolatility);
+        Vector256<double> maxVolatility = Vector256.Create(MaxVolatility);
+        Vector256<double> maxAbsD = Vector256.Create(BatchMaxAbsD);
+        Vector256<double> minAbsD = Vector256.Create(-BatchMaxAbsD);
+
+        // Corrado-Miller guess, with the scalar solver's ATM and Brenner-Subrahmanyam branches
+        Vector256<double> diff = forward - discountedStrike;
+        Vector256<double> avg = (forward + discountedStrike) * half;
+        Vector256<double> callPrice = target + ((one - sign) * half * diff);
+        Vector256<double> term1 = callPrice - (diff * half);
+        Vector256<double> term2Sq = (term1 * term1) - (diff * diff / System.Math.PI);
+        Vector256<double> corradoMiller = Vector256.Max(
+            sqrtTwoPi / sqrtTau * ((term1 / avg) + (Vector256.Sqrt(Vector256.Max(term2Sq, zero)) / avg)),
+            minVolatility);
+        Vector256<double> brenner = sqrtTwoPi / sqrtTau * target / spot;
+        Vector256<double> atTheMoney = callPrice * sqrtTwoPi / (spot * sqrtTau);
+
+        Vector256<double> sigma = Vector256.ConditionalSelect(Vector256.LessThan(term2Sq, zero), brenner, corradoMiller);
+        sigma = Vector256.ConditionalSelect(
+            Vector256.LessThan(Vector256.Abs(diff), Vector256.Create(MachineEpsilon) * avg), atTheMoney, sigma);
+        sigma = Vector256.Min(Vector256.Max(sigma, minVolatility), maxVolatility);
+
+        Vector256<double> tol = Vector256.Create(tolerance);
+        Vector256<double> epsilon = Vector256.Create(MachineEpsilon);
+        int fallback = 0;
+
+        for (int iteration = 0; iteration < maxIterations && active != 0; iteration++)
+        {
+            Vector256<double> sigmaRootT = sigma * sqrtTau;
+            Vector256<double> d1 = (logMoneyness / sigmaRootT) + (half * sigmaRootT);
+            Vector256<double> d2 = d1 - sigmaRootT;
+            Vector256<double> d1Capped = Vector256.Min(Vector256.Max(d1, minAbsD), maxAbsD);
+            Vector256<double> d2Capped = Vector256.Min(Vector256.Max(d2, minAbsD), maxAbsD);
+
+            // Call: F·N(d1) - K·N(d2); put: K·N(-d2) - F·N(-d1)
+            Vector256<double> price = sign * (
+                (forward * CRVT002A.VectorNormalCDF256(sign * d1Capped))
+                - (discountedStrike * CRVT002A.VectorNormalCDF256(sign * d2Capped)));
+            Vector256<double> vega = forward * CRVT002A.VectorNormalPDF256(d1Capped) * sqrtTau;
+            Vector256<double> f = price - target;
+
+            int converged = (int)Vector256.LessThan(Vector256.Abs(f), tol).ExtractMostSignificantBits() & active;
+            for (int lane = 0; lane < BatchLaneCount; lane++)
+            {
+                if ((converged & (1 << lane)) != 0)
+                {
+                    impliedVolatilities[lane] = sigma.GetElement(lane);
+                }
+            }
+            active &= ~converged;
+
+            // Vega too small - use Brent fallback
+            int flat = (int)Vector256.LessThan(vega, epsilon).ExtractMostSignificantBits() & active;
+            fallback |= flat;
+            active &= ~flat;
+
+            // Householder(3): σ - f/f' × (1 + f×f''/(2×f'²)), with f'' = vega·d1·d2/σ
+            Vector256<double> volga = vega * d1 * d2 / sigma;
+            Vector256<double> correction = one + (f * volga / (2.0 * vega * vega));
+            Vector256<double> newSigma = sigma - (f / vega * correction);
+
+            // NaN fails both comparisons, so it is caught as divergence
+            Vector256<double> inRange = Vector256.GreaterThan(newSigma, zero)
+                & Vector256.LessThanOrEqual(newSigma, maxVolatility);
+            int diverged = ~(int)inRange.ExtractMostSignificantBits() & active;
+            fallback |= diverged;
+            active &= ~diverged;
+
+            sigma = Vector256.ConditionalSelect(inRange, newSigma, sigma);
+        }
+
+        // Brent's method for lanes that diverged or ran out of iterations
+        fallback |= active;
+        for (int lane = 0; lane < BatchLaneCount; lane++)
+        {
+            if ((fallback & (1 << lane)) != 0)
+            {
+                impliedVolatilities[lane] = BSImpliedVolatilityBrent(
+                    spots[lane], strikes[lane], taus[lane], riskFreeRates[lane], dividendYields[lane],
+                    marketPrices[lane], isCalls[lane], tolerance);
+            }
+        }
+    }
+
     /// <summary>
     /// Corrado-Miller (1996) closed-form IV approximation.
     /// </summary>
@@ -12,18 +12,22 @@ namespace Alaris.Core.Pricing;
 /// </summary>
 public sealed class CRAP001A
 {
-    private readonly double _spot;
-    private readonly double _strike;
-    private readonly double _maturity;
-    private readonly double _rate;
-    private readonly double _dividendYield;
-    private readonly double _volatility;
-    private readonly bool _isCall;
+    private double _spot;
+    private double _strike;
+    private double _maturity;
+    private double _rate;
+    private double _dividendYield;
+    private double _volatility;
+    private bool _isCall;
 
     private const double Tolerance = 1e-8;
     private const int MaxIterations = 100;
     private const double NumericalEpsilon = 1e-12;
 
+    private static readonly double[] BenchmarkMaturities = { 1.0, 5.0, 10.0, 15.0 };
+    private static readonly double[] BenchmarkUpper = { 73.5, 71.6, 69.62, 68.0 };
+    private static readonly double[] BenchmarkLower = { 63.5, 61.6, 58.72, 57.0 };
+
     /// <summary>
     /// Initializes a new instance of the QD+ approximation engine.
     /// </summary>
@@ -42,6 +46,28 @@ public sealed class CRAP001A
         double dividendYield,
         double volatility,
         bool isCall)
+    {
+        Reset(spot, strike, maturity, rate, dividendYield, volatility, isCall);
+    }
+
+    /// <summary>
+    /// Creates an engine with no inputs, to be set by <see cref="Reset"/> before use.
+    /// </summary>
+    internal CRAP001A()
+    {
+    }
+
+    /// <summary>
+    /// Re-targets this engine at new inputs so a per-thread instance can serve every solve.
+    /// </summary>
+    internal void Reset(
+        double spot,
+        double strike,
+        double maturity,
+        double rate,
+        double dividendYield,
+        double volatility,
+        bool isCall)
     {
         AlgorithmBounds.ValidateDoubleBoundaryInputs(
             spot, strike, maturity, rate, dividendYield, volatility);
@@ -318,11 +344,8 @@ public sealed class CRAP001A
 
     private double InterpolateBenchmark(double T, bool isUpper)
     {
-        double[] knownT = { 1.0, 5.0, 10.0, 15.0 };
-        double[] knownUpper = { 73.5, 71.6, 69.62, 68.0 };
-        double[] knownLower = { 63.5, 61.6, 58.72, 57.0 };
-
-        double[] knownValues = isUpper ? knownUpper : knownLower;
+        double[] knownT = BenchmarkMaturities;
+        double[] knownValues = isUpper ? BenchmarkUpper : BenchmarkLower;
 
         if (T <= knownT[0])
         {
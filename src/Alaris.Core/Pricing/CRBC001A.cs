@@ -0,0 +1,280 @@
+// CRBC001A.cs - Exercise boundary cache for warm-starting boundary solvers
+// Component ID: CRBC001A
+//
+// Stores one canonical early-exercise boundary per quantized (τ, r, q, σ, right)
+// bucket as a Chebyshev series on a normalized time domain. Consecutive evaluation
+// days move the inputs only slightly, so the bucket's boundary is a far better
+// fixed-point seed than the constant QD+ guess.
+//
+// References:
+// - Andersen, Lake & Offengenden (2016) "High Performance American Option Pricing"
+
+using System.Diagnostics.CodeAnalysis;
+using Alaris.Core.Math;
+
+namespace Alaris.Core.Pricing;
+
+/// <summary>
+/// Quantized lookup key for a cached exercise boundary.
+/// </summary>
+/// <param name="TauBucket">Time to expiry bucket.</param>
+/// <param name="RateBucket">Risk-free rate bucket.</param>
+/// <param name="DividendBucket">Dividend yield bucket.</param>
+/// <param name="VolatilityBucket">Volatility bucket.</param>
+/// <param name="IsCall">Whether the boundary belongs to a call.</param>
+public readonly record struct BoundaryCacheKey(
+    int TauBucket,
+    int RateBucket,
+    int DividendBucket,
+    int VolatilityBucket,
+    bool IsCall);
+
+/// <summary>
+/// Thread-safe, least-recently-used cache of strike-normalized exercise boundaries used to
+/// warm-start <see cref="CREN004A"/>.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Boundaries are stored for a unit strike (the fixed-point system is homogeneous in K)
+/// as a Chebyshev series in normalized time u = t/τ ∈ [0, 1]. Seeding therefore works
+/// for any strike, any collocation layout and any node count.
+/// </para>
+/// <para>
+/// The entry for a key is always the boundary solved at the bucket centre by one fixed
+/// seed engine, never the boundary of whichever caller reached the bucket first. A seed
+/// is therefore a function of the key alone: results do not depend on the order of
+/// earlier solves, on concurrency or on evictions. A miss pays for the centre solve once
+/// per bucket; a hit costs an evaluation of the series. Buckets whose centre lies in a
+/// double-boundary regime, or too close to expiry, have no seed.
+/// </para>
+/// </remarks>
+public sealed class CRBC001A
+{
+    /// <summary>Default τ bucket width (one week).</summary>
+    public const double DefaultTauStep = 7.0 / 365.0;
+
+    /// <summary>Default rate and dividend bucket width (25 bp).</summary>
+    public const double DefaultRateStep = 0.0025;
+
+    /// <summary>Default volatility bucket width (one vol point).</summary>
+    public const double DefaultVolatilityStep = 0.01;
+
+    /// <summary>Default maximum number of entries.</summary>
+    public const int DefaultCapacity = 4096;
+
+    // Canonical boundaries are solved once per bucket, so they can afford the full sweep count
+    private static readonly CREN004A SeedEngine = new CREN004A(chebyshevNodes: 12, fixedPointIterations: 10);
+
+    private readonly object _gate = new object();
+    private readonly Dictionary<BoundaryCacheKey, LinkedListNode<Entry>> _entries =
+        new Dictionary<BoundaryCacheKey, LinkedListNode<Entry>>();
+
+    // Most recently used first
+    private readonly LinkedList<Entry> _recency = new LinkedList<Entry>();
+
+    private readonly double _tauStep;
+    private readonly double _rateStep;
+    private readonly double _volatilityStep;
+    private readonly int _capacity;
+
+    private long _hits;
+    private long _misses;
+    private long _evictions;
+
+    /// <summary>
+    /// Initializes a new boundary cache.
+    /// </summary>
+    /// <param name="tauStep">τ bucket width in years.</param>
+    /// <param name="rateStep">Rate and dividend bucket width.</param>
+    /// <param name="volatilityStep">Volatility bucket width.</param>
+    /// <param name="capacity">Maximum number of entries; the least recently used is evicted beyond it.</param>
+    public CRBC001A(
+        double tauStep = DefaultTauStep,
+        double rateStep = DefaultRateStep,
+        double volatilityStep = DefaultVolatilityStep,
+        int capacity = DefaultCapacity)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(tauStep);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(rateStep);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(volatilityStep);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(capacity);
+
+        _tauStep = tauStep;
+        _rateStep = rateStep;
+        _volatilityStep = volatilityStep;
+        _capacity = capacity;
+    }
+
+    /// <summary>Lookups served by an existing entry.</summary>
+    public long Hits => Interlocked.Read(ref _hits);
+
+    /// <summary>Lookups that had to solve the bucket's canonical boundary.</summary>
+    public long Misses => Interlocked.Read(ref _misses);
+
+    /// <summary>Entries evicted to respect the capacity.</summary>
+    public long Evictions => Interlocked.Read(ref _evictions);
+
+    /// <summary>Number of cached boundaries.</summary>
+    public int Count
+    {
+        get
+        {
+            lock (_gate)
+            {
+                return _entries.Count;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Builds the quantized key for a parameter set.
+    /// </summary>
+    public BoundaryCacheKey CreateKey(double tau, double r, double q, double sigma, bool isCall)
+    {
+        return new BoundaryCacheKey(
+            Quantize(tau, _tauStep),
+            Quantize(r, _rateStep),
+            Quantize(q, _rateStep),
+            Quantize(sigma, _volatilityStep),
+            isCall);
+    }
+
+    /// <summary>
+    /// Seeds boundary values from the canonical boundary of a bucket, solving it on a miss.
+    /// </summary>
+    /// <param name="key">Quantized key.</param>
+    /// <param name="normalizedTimes">Collocation times as fractions of τ.</param>
+    /// <param name="strike">Strike used to rescale the unit-strike boundary.</param>
+    /// <param name="boundary">Receives the boundary at each collocation time.</param>
+    /// <returns>True if the bucket has a seed and <paramref name="boundary"/> was written.</returns>
+    public bool TrySeed(
+        in BoundaryCacheKey key,
+        ReadOnlySpan<double> normalizedTimes,
+        double strike,
+        Span<double> boundary)
+    {
+        if (boundary.Length < normalizedTimes.Length)
+        {
+            throw new ArgumentException("Boundary span is shorter than the time grid", nameof(boundary));
+        }
+
+        Entry? entry;
+        lock (_gate)
+        {
+            if (TryTouch(key, out entry))
+            {
+                Interlocked.Increment(ref _hits);
+            }
+        }
+
+        if (entry is null)
+        {
+            Interlocked.Increment(ref _misses);
+            entry = Add(new Entry(key, SolveCanonical(key)));
+        }
+
+        if (entry.Coefficients is null)
+        {
+            return false;
+        }
+
+        int count = normalizedTimes.Length;
+        Span<double> points = count <= CRWS001A.MaxNodes ? stackalloc double[count] : new double[count];
+        for (int i = 0; i < count; i++)
+        {
+            points[i] = (2.0 * System.Math.Clamp(normalizedTimes[i], 0.0, 1.0)) - 1.0;
+        }
+
+        CRCH001A.EvaluateSeries(entry.Coefficients, points, boundary);
+        for (int i = 0; i < count; i++)
+        {
+            boundary[i] *= strike;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Removes all entries and resets the counters.
+    /// </summary>
+    public void Clear()
+    {
+        lock (_gate)
+        {
+            _entries.Clear();
+            _recency.Clear();
+        }
+
+        Interlocked.Exchange(ref _hits, 0);
+        Interlocked.Exchange(ref _misses, 0);
+        Interlocked.Exchange(ref _evictions, 0);
+    }
+
+    /// <summary>
+    /// Solves the unit-strike boundary at the centre of the key's buckets.
+    /// </summary>
+    /// <returns>The boundary's Chebyshev coefficients, or null when the bucket has no seed.</returns>
+    private double[]? SolveCanonical(in BoundaryCacheKey key)
+    {
+        double tau = key.TauBucket * _tauStep;
+        double r = key.RateBucket * _rateStep;
+        double q = key.DividendBucket * _rateStep;
+        double sigma = key.VolatilityBucket * _volatilityStep;
+
+        double[] coefficients = new double[SeedEngine.UnitBoundaryCoefficientCount];
+        return SeedEngine.TrySolveUnitBoundary(tau, r, q, sigma, key.IsCall, coefficients)
+            ? coefficients
+            : null;
+    }
+
+    /// <summary>
+    /// Inserts an entry unless a concurrent miss already did, and returns the stored one.
+    /// </summary>
+    private Entry Add(Entry entry)
+    {
+        lock (_gate)
+        {
+            // Both solved the same canonical boundary, so either copy will do
+            if (TryTouch(entry.Key, out Entry? existing))
+            {
+                return existing;
+            }
+
+            _entries[entry.Key] = _recency.AddFirst(entry);
+
+            while (_entries.Count > _capacity)
+            {
+                LinkedListNode<Entry> oldest = _recency.Last!;
+                _recency.RemoveLast();
+                _entries.Remove(oldest.Value.Key);
+                Interlocked.Increment(ref _evictions);
+            }
+
+            return entry;
+        }
+    }
+
+    /// <summary>
+    /// Looks up an entry and marks it most recently used. Callers hold the gate.
+    /// </summary>
+    private bool TryTouch(in BoundaryCacheKey key, [NotNullWhen(true)] out Entry? entry)
+    {
+        if (!_entries.TryGetValue(key, out LinkedListNode<Entry>? node))
+        {
+            entry = null;
+            return false;
+        }
+
+        _recency.Remove(node);
+        _recency.AddFirst(node);
+        entry = node.Value;
+        return true;
+    }
+
+    private static int Quantize(double value, double step)
+    {
+        return (int)System.Math.Round(value / step, MidpointRounding.AwayFromZero);
+    }
+
+    private sealed record Entry(BoundaryCacheKey Key, double[]? Coefficients);
+}
@@ -18,6 +18,7 @@
 using Alaris.Core.Options;
 using System.Buffers;
 using System.Runtime.CompilerServices;
+using System.Runtime.Intrinsics;
 
 namespace Alaris.Core.Pricing;
 
@@ -52,6 +53,20 @@ public sealed class CREN002A
     /// </summary>
     public const double DefaultGridConcentration = 0.5;
 
+    /// <summary>Volatility shift for the lockstep vega state in <see cref="PriceWithGreeks"/>.</summary>
+    public const double VegaShift = 0.001;
+
+    /// <summary>Rate shift for the lockstep rho state in <see cref="PriceWithGreeks"/>.</summary>
+    public const double RhoShift = 0.0001;
+
+    // Pooled buffer counts (in units of spotSteps) for one state and for the three-state Greeks solve
+    private const int SingleStateBuffers = 10;
+    private const int GreeksBuffers = 20;
+
+    // SIMD lanes per lockstep group in PriceBatch, and vector buffers (in units of spotSteps) per group
+    private const int LaneCount = 4;
+    private const int LaneGroupBuffers = 12;
+
     /// <summary>
     /// Initialises the unified pricing engine.
     /// </summary>
@@ -100,19 +115,7 @@ public sealed class CREN002A
         double volatility,
         OptionType optionType)
     {
-        // Guard clauses
-        if (spot <= 0)
-        {
-            throw new ArgumentException("Spot must be positive", nameof(spot));
-        }
-        if (strike <= 0)
-        {
-            throw new ArgumentException("Strike must be positive", nameof(strike));
-        }
-        if (volatility <= 0)
-        {
-            throw new ArgumentException("Volatility must be positive", nameof(volatility));
-        }
+        ValidateInputs(spot, strike, volatility);
 
         // Handle expired options
         if (timeToExpiry <= 0)
@@ -125,6 +128,140 @@ public sealed class CREN002A
         return PriceWithCrankNicolson(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
     }
 
+    /// <summary>
+    /// Prices an American option and computes its Greeks from a single solved grid.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Delta and gamma are read from the spatial derivatives of the solved grid at the
+    /// spot node, and theta from the value one time step before the final level. Vega and
+    /// rho come from one bumped backward induction that advances a σ-shifted and an
+    /// r-shifted state in lockstep with the base state, on the same ASINH grid and the
+    /// same tridiagonal workspace.
+    /// </para>
+    /// <para>
+    /// This replaces the 13 Crank-Nicolson solves of Price/Delta/Gamma/Theta/Vega/Rho
+    /// with three operator applications per time step, and removes the grid re-meshing
+    /// noise of bump-and-reprice because every state shares the base grid.
+    /// </para>
+    /// </remarks>
+    public FdGridGreeks PriceWithGreeks(
+        double spot,
+        double strike,
+        double timeToExpiry,
+        double riskFreeRate,
+        double dividendYield,
+        double volatility,
+        OptionType optionType)
+    {
+        ValidateInputs(spot, strike, volatility);
+
+        // Handle expired options: only the payoff slope survives
+        if (timeToExpiry <= 0)
+        {
+            double payoff = CalculatePayoff(spot, strike, optionType);
+            double slope = payoff > 0 ? (optionType == OptionType.Call ? 1.0 : -1.0) : 0.0;
+            return new FdGridGreeks(payoff, slope, 0.0, 0.0, 0.0, 0.0);
+        }
+
+        return PriceWithGridGreeks(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
+    }
+
+    /// <summary>
+    /// Prices many American options, advancing groups of four in lockstep on SIMD lanes.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Every option keeps its own ASINH grid, time step and factored operator, but all
+    /// share the node and step counts of this engine. Four options are interleaved
+    /// node by node (structure of arrays, one <see cref="Vector256{T}"/> per node), so the
+    /// explicit half step, both Thomas sweeps and the exercise projection run once per
+    /// group. The explicit-step spacings and the payoff are computed once per option
+    /// rather than once per time step.
+    /// </para>
+    /// <para>
+    /// Each lane performs the same floating-point operations as <see cref="Price"/>, so the
+    /// prices agree with the scalar solve. Expired options, the remainder of the batch and
+    /// platforms without 256-bit acceleration use the scalar solver.
+    /// </para>
+    /// </remarks>
+    /// <param name="spots">Spot prices.</param>
+    /// <param name="strikes">Strikes.</param>
+    /// <param name="timesToExpiry">Times to expiry in years.</param>
+    /// <param name="riskFreeRates">Risk-free rates.</param>
+    /// <param name="dividendYields">Dividend yields.</param>
+    /// <param name="volatilities">Volatilities.</param>
+    /// <param name="optionTypes">Option types.</param>
+    /// <param name="prices">Destination, at least as long as the inputs.</param>
+    public void PriceBatch(
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> timesToExpiry,
+        ReadOnlySpan<double> riskFreeRates,
+        ReadOnlySpan<double> dividendYields,
+        ReadOnlySpan<double> volatilities,
+        ReadOnlySpan<OptionType> optionTypes,
+        Span<double> prices)
+    {
+        int count = spots.Length;
+        if (strikes.Length != count || timesToExpiry.Length != count || riskFreeRates.Length != count
+            || dividendYields.Length != count || volatilities.Length != count || optionTypes.Length != count)
+        {
+            throw new ArgumentException("Input spans must have matching lengths.");
+        }
+        if (prices.Length < count)
+        {
+            throw new ArgumentException("Price span must be at least as long as input spans.", nameof(prices));
+        }
+
+        for (int k = 0; k < count; k++)
+        {
+            ValidateInputs(spots[k], strikes[k], volatilities[k]);
+        }
+
+        int[] pending = ArrayPool<int>.Shared.Rent(System.Math.Max(count, 1));
+
+        try
+        {
+            // Expired options settle at the payoff and never enter a lane group
+            int pendingCount = 0;
+            for (int k = 0; k < count; k++)
+            {
+                if (timesToExpiry[k] <= 0)
+                {
+                    prices[k] = CalculatePayoff(spots[k], strikes[k], optionTypes[k]);
+                }
+                else
+                {
+                    pending[pendingCount++] = k;
+                }
+            }
+
+            int vectorEnd = Vector256.IsHardwareAccelerated
+                ? pendingCount - (pendingCount % LaneCount)
+                : 0;
+
+            for (int g = 0; g < vectorEnd; g += LaneCount)
+            {
+                PriceLaneGroup(
+                    pending.AsSpan(g, LaneCount),
+                    spots, strikes, timesToExpiry, riskFreeRates, dividendYields, volatilities, optionTypes, prices);
+            }
+
+            // Scalar remainder
+            for (int g = vectorEnd; g < pendingCount; g++)
+            {
+                int k = pending[g];
+                prices[k] = PriceWithCrankNicolson(
+                    spots[k], strikes[k], timesToExpiry[k], riskFreeRates[k], dividendYields[k], volatilities[k], optionTypes[k]);
+            }
+        }
+        finally
+        {
+            ArrayPool<int>.Shared.Return(pending);
+        }
+    }
+
     /// <summary>
     /// Price using Crank-Nicolson with ASINH grid and Neumann boundaries.
     /// </summary>
@@ -138,73 +275,300 @@ public sealed class CREN002A
         OptionType optionType)
     {
         double sigma = volatility;
-        double sigma2 = sigma * sigma;
         double dt = timeToExpiry / _timeSteps;
-        double r = riskFreeRate;
-        double q = dividendYield;
-
         int n = _spotSteps;
 
-        // Rent arrays from pool
-        double[] x = ArrayPool<double>.Shared.Rent(n);
-        double[] dx = ArrayPool<double>.Shared.Rent(n);
-        double[] v = ArrayPool<double>.Shared.Rent(n);
-        double[] vNew = ArrayPool<double>.Shared.Rent(n);
-        double[] a = ArrayPool<double>.Shared.Rent(n);
-        double[] b = ArrayPool<double>.Shared.Rent(n);
-        double[] c = ArrayPool<double>.Shared.Rent(n);
-        double[] d = ArrayPool<double>.Shared.Rent(n);
+        // Rent one block from the pool and carve it into the grid and solver buffers
+        double[] block = ArrayPool<double>.Shared.Rent(n * SingleStateBuffers);
 
         try
         {
+            Span<double> x = block.AsSpan(0, n);
+            Span<double> dx = block.AsSpan(n, n);
+            Span<double> intrinsic = block.AsSpan(2 * n, n);
+            Span<double> rhs = block.AsSpan(3 * n, n);
+            Span<double> dPrime = block.AsSpan(4 * n, n);
+            Span<double> v = block.AsSpan(5 * n, n);
+            Span<double> vNew = block.AsSpan(6 * n, n);
+            ThetaOperator op = new ThetaOperator(
+                block.AsSpan(7 * n, n), block.AsSpan(8 * n, n), block.AsSpan(9 * n, n));
+
             // Build ASINH-distributed grid (denser near spot)
             BuildAsinhGrid(x, dx, n, spot, strike, sigma, timeToExpiry);
 
-            // Terminal condition: V(T, S) = payoff(S)
-            for (int i = 0; i < n; i++)
+            // Terminal condition: V(T, S) = payoff(S); the payoff doubles as the exercise value
+            BuildIntrinsic(x, intrinsic, strike, optionType);
+            intrinsic.CopyTo(v);
+
+            // The operator is constant in time, so it is factored once
+            FactorOperator(n, dt, sigma * sigma, riskFreeRate, dividendYield, dx, ref op);
+
+            // Backward induction
+            for (int step = 0; step < _timeSteps; step++)
             {
-                double spotAtNode = System.Math.Exp(x[i]);
-                v[i] = CalculatePayoff(spotAtNode, strike, optionType);
+                StepBackward(n, dt, in op, dx, v, intrinsic, rhs, dPrime, vNew);
+
+                // Swap for next iteration
+                Span<double> swap = v;
+                v = vNew;
+                vNew = swap;
             }
 
-            // Backward induction
+            // Interpolate to get price at current spot
+            double logSpot = System.Math.Log(spot);
+            return InterpolatePrice(x, v, n, logSpot);
+        }
+        finally
+        {
+            ArrayPool<double>.Shared.Return(block);
+        }
+    }
+
+    /// <summary>
+    /// Single-solve Greeks: base, σ-shifted and r-shifted states advanced in lockstep.
+    /// </summary>
+    private FdGridGreeks PriceWithGridGreeks(
+        double spot,
+        double strike,
+        double timeToExpiry,
+        double riskFreeRate,
+        double dividendYield,
+        double volatility,
+        OptionType optionType)
+    {
+        double sigma = volatility;
+        double dt = timeToExpiry / _timeSteps;
+        int n = _spotSteps;
+
+        double[] block = ArrayPool<double>.Shared.Rent(n * GreeksBuffers);
+
+        try
+        {
+            Span<double> x = block.AsSpan(0, n);
+            Span<double> dx = block.AsSpan(n, n);
+            Span<double> intrinsic = block.AsSpan(2 * n, n);
+            Span<double> rhs = block.AsSpan(3 * n, n);
+            Span<double> dPrime = block.AsSpan(4 * n, n);
+
+            Span<double> v = block.AsSpan(5 * n, n);
+            Span<double> vNew = block.AsSpan(6 * n, n);
+            ThetaOperator op = new ThetaOperator(
+                block.AsSpan(7 * n, n), block.AsSpan(8 * n, n), block.AsSpan(9 * n, n));
+
+            Span<double> vVol = block.AsSpan(10 * n, n);
+            Span<double> vVolNew = block.AsSpan(11 * n, n);
+            ThetaOperator opVol = new ThetaOperator(
+                block.AsSpan(12 * n, n), block.AsSpan(13 * n, n), block.AsSpan(14 * n, n));
+
+            Span<double> vRate = block.AsSpan(15 * n, n);
+            Span<double> vRateNew = block.AsSpan(16 * n, n);
+            ThetaOperator opRate = new ThetaOperator(
+                block.AsSpan(17 * n, n), block.AsSpan(18 * n, n), block.AsSpan(19 * n, n));
+
+            // All three states share the base grid, so bumps carry no re-meshing noise
+            BuildAsinhGrid(x, dx, n, spot, strike, sigma, timeToExpiry);
+            BuildIntrinsic(x, intrinsic, strike, optionType);
+            intrinsic.CopyTo(v);
+            intrinsic.CopyTo(vVol);
+            intrinsic.CopyTo(vRate);
+
+            double sigmaUp = sigma + VegaShift;
+            FactorOperator(n, dt, sigma * sigma, riskFreeRate, dividendYield, dx, ref op);
+            FactorOperator(n, dt, sigmaUp * sigmaUp, riskFreeRate, dividendYield, dx, ref opVol);
+            FactorOperator(n, dt, sigma * sigma, riskFreeRate + RhoShift, dividendYield, dx, ref opRate);
+
+            double logSpot = System.Math.Log(spot);
+            double previousLevel = 0.0;
+
+            for (int step = 0; step < _timeSteps; step++)
+            {
+                // Value one time step before the final level drives theta
+                if (step == _timeSteps - 1)
+                {
+                    previousLevel = InterpolatePrice(x, v, n, logSpot);
+                }
+
+                StepBackward(n, dt, in op, dx, v, intrinsic, rhs, dPrime, vNew);
+                StepBackward(n, dt, in opVol, dx, vVol, intrinsic, rhs, dPrime, vVolNew);
+                StepBackward(n, dt, in opRate, dx, vRate, intrinsic, rhs, dPrime, vRateNew);
+
+                Span<double> swap = v;
+                v = vNew;
+                vNew = swap;
+
+                swap = vVol;
+                vVol = vVolNew;
+                vVolNew = swap;
+
+                swap = vRate;
+                vRate = vRateNew;
+                vRateNew = swap;
+            }
+
+            double price = InterpolatePrice(x, v, n, logSpot);
+            (double dVdx, double d2Vdx2) = GridDerivatives(x, v, n, logSpot);
+
+            // Chain rule from log-spot to spot: V_S = V_x / S, V_SS = (V_xx - V_x) / S²
+            double delta = dVdx / spot;
+            double gamma = (d2Vdx2 - dVdx) / (spot * spot);
+            double theta = (previousLevel - price) / dt;
+            double vega = (InterpolatePrice(x, vVol, n, logSpot) - price) / VegaShift;
+            double rho = (InterpolatePrice(x, vRate, n, logSpot) - price) / RhoShift;
+
+            return new FdGridGreeks(price, delta, gamma, theta, vega, rho);
+        }
+        finally
+        {
+            ArrayPool<double>.Shared.Return(block);
+        }
+    }
+
+    /// <summary>
+    /// Lockstep Crank-Nicolson solve for four options interleaved on <see cref="Vector256{T}"/> lanes.
+    /// </summary>
+    private void PriceLaneGroup(
+        ReadOnlySpan<int> lanes,
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> timesToExpiry,
+        ReadOnlySpan<double> riskFreeRates,
+        ReadOnlySpan<double> dividendYields,
+        ReadOnlySpan<double> volatilities,
+        ReadOnlySpan<OptionType> optionTypes,
+        Span<double> prices)
+    {
+        int n = _spotSteps;
+        double oneMinusTheta = 1.0 - _theta;
+
+        // Interleaved state: element i holds node i of all four options
+        Vector256<double>[] vectorBlock = ArrayPool<Vector256<double>>.Shared.Rent(n * LaneGroupBuffers);
+        // Per-lane grids, plus scratch for building one lane's payoff and operator
+        double[] laneBlock = ArrayPool<double>.Shared.Rent(n * (LaneCount + 5));
+
+        try
+        {
+            Span<Vector256<double>> intrinsic = vectorBlock.AsSpan(0, n);
+            Span<Vector256<double>> v = vectorBlock.AsSpan(n, n);
+            Span<Vector256<double>> vNew = vectorBlock.AsSpan(2 * n, n);
+            Span<Vector256<double>> rhs = vectorBlock.AsSpan(3 * n, n);
+            Span<Vector256<double>> dPrime = vectorBlock.AsSpan(4 * n, n);
+            Span<Vector256<double>> lower = vectorBlock.AsSpan(5 * n, n);
+            Span<Vector256<double>> cPrime = vectorBlock.AsSpan(6 * n, n);
+            Span<Vector256<double>> denom = vectorBlock.AsSpan(7 * n, n);
+            Span<Vector256<double>> invDxm = vectorBlock.AsSpan(8 * n, n);
+            Span<Vector256<double>> invDx2u = vectorBlock.AsSpan(9 * n, n);
+            Span<Vector256<double>> invDx2m = vectorBlock.AsSpan(10 * n, n);
+            Span<Vector256<double>> invDx2l = vectorBlock.AsSpan(11 * n, n);
+
+            Span<double> dx = laneBlock.AsSpan(LaneCount * n, n);
+            Span<double> laneValues = laneBlock.AsSpan((LaneCount + 1) * n, n);
+            ThetaOperator op = new ThetaOperator(
+                laneBlock.AsSpan((LaneCount + 2) * n, n),
+                laneBlock.AsSpan((LaneCount + 3) * n, n),
+                laneBlock.AsSpan((LaneCount + 4) * n, n));
+
+            Span<double> killCoefficient = stackalloc double[LaneCount];
+            Span<double> convectionCoefficient = stackalloc double[LaneCount];
+            Span<double> diffusionCoefficient = stackalloc double[LaneCount];
+
+            // Build each lane's grid, payoff and factored operator, then scatter into its lane
+            for (int lane = 0; lane < LaneCount; lane++)
+            {
+                int k = lanes[lane];
+                double sigma = volatilities[k];
+                double dt = timesToExpiry[k] / _timeSteps;
+                Span<double> x = laneBlock.AsSpan(lane * n, n);
+
+                BuildAsinhGrid(x, dx, n, spots[k], strikes[k], sigma, timesToExpiry[k]);
+                BuildIntrinsic(x, laneValues, strikes[k], optionTypes[k]);
+                FactorOperator(n, dt, sigma * sigma, riskFreeRates[k], dividendYields[k], dx, ref op);
+
+                killCoefficient[lane] = 1.0 + (oneMinusTheta * dt * op.A0);
+                convectionCoefficient[lane] = oneMinusTheta * dt * op.Ax;
+                diffusionCoefficient[lane] = oneMinusTheta * dt * op.Axx;
+
+                for (int i = 0; i < n; i++)
+                {
+                    intrinsic[i] = intrinsic[i].WithElement(lane, laneValues[i]);
+                    lower[i] = lower[i].WithElement(lane, op.Lower[i]);
+                    cPrime[i] = cPrime[i].WithElement(lane, op.CPrime[i]);
+                    denom[i] = denom[i].WithElement(lane, op.Denom[i]);
+                }
+
+                // Spacing factors of the explicit half step, as in BuildRightHandSide
+                for (int i = 1; i < n - 1; i++)
+                {
+                    double dxMinus = dx[i - 1];
+                    double dxPlus = dx[i];
+
+                    invDxm[i] = invDxm[i].WithElement(lane, 1.0 / (dxMinus + dxPlus));
+                    invDx2u[i] = invDx2u[i].WithElement(lane, 2.0 / (dxPlus * (dxMinus + dxPlus)));
+                    invDx2m[i] = invDx2m[i].WithElement(lane, 2.0 / (dxMinus * dxPlus));
+                    invDx2l[i] = invDx2l[i].WithElement(lane, 2.0 / (dxMinus * (dxMinus + dxPlus)));
+                }
+            }
+
+            Vector256<double> kill = Vector256.Create((ReadOnlySpan<double>)killCoefficient);
+            Vector256<double> convection = Vector256.Create((ReadOnlySpan<double>)convectionCoefficient);
+            Vector256<double> diffusion = Vector256.Create((ReadOnlySpan<double>)diffusionCoefficient);
+            Vector256<double> two = Vector256.Create(2.0);
+
+            intrinsic.CopyTo(v);
+
             for (int step = 0; step < _timeSteps; step++)
             {
-                // Build tridiagonal system with variable grid spacing
-                BuildTridiagonalSystemVariable(n, dt, sigma2, r, q, x, dx, v, a, b, c, d);
+                // Explicit half: (I + (1-θ)·dt·A)·V
+                for (int i = 1; i < n - 1; i++)
+                {
+                    Vector256<double> convectionTerm = convection * invDxm[i] * (v[i + 1] - v[i - 1]);
+                    Vector256<double> diffusionTerm = diffusion * ((invDx2u[i] * v[i + 1]) - (invDx2m[i] * v[i]) + (invDx2l[i] * v[i - 1]));
+                    rhs[i] = (kill * v[i]) + convectionTerm + diffusionTerm;
+                }
 
-                // Apply Neumann boundary conditions (gamma = 0)
-                ApplyNeumannBoundaries(n, a, b, c, d, v);
+                // Neumann boundaries (gamma = 0)
+                rhs[0] = (two * v[1]) - v[2];
+                rhs[n - 1] = (two * v[n - 2]) - v[n - 3];
 
-                // Solve tridiagonal system
-                SolveTridiagonal(n, a, b, c, d, vNew);
+                // Thomas sweeps on the pre-factored operator
+                dPrime[0] = rhs[0] / denom[0];
+                for (int i = 1; i < n; i++)
+                {
+                    dPrime[i] = (rhs[i] - (lower[i] * dPrime[i - 1])) / denom[i];
+                }
 
-                // Early exercise check
+                vNew[n - 1] = dPrime[n - 1];
+                for (int i = n - 2; i >= 0; i--)
+                {
+                    vNew[i] = dPrime[i] - (cPrime[i] * vNew[i + 1]);
+                }
+
+                // Early exercise projection
                 for (int i = 0; i < n; i++)
                 {
-                    double spotAtNode = System.Math.Exp(x[i]);
-                    double intrinsic = CalculatePayoff(spotAtNode, strike, optionType);
-                    vNew[i] = System.Math.Max(vNew[i], intrinsic);
+                    vNew[i] = Vector256.Max(vNew[i], intrinsic[i]);
                 }
 
-                // Swap for next iteration
-                (v, vNew) = (vNew, v);
+                Span<Vector256<double>> swap = v;
+                v = vNew;
+                vNew = swap;
             }
 
-            // Interpolate to get price at current spot
-            double logSpot = System.Math.Log(spot);
-            return InterpolatePrice(x, v, n, logSpot);
+            // Gather each lane and interpolate at its spot
+            for (int lane = 0; lane < LaneCount; lane++)
+            {
+                int k = lanes[lane];
+                for (int i = 0; i < n; i++)
+                {
+                    laneValues[i] = v[i].GetElement(lane);
+                }
+
+                prices[k] = InterpolatePrice(laneBlock.AsSpan(lane * n, n), laneValues, n, System.Math.Log(spots[k]));
+            }
         }
         finally
         {
-            ArrayPool<double>.Shared.Return(x);
-            ArrayPool<double>.Shared.Return(dx);
-            ArrayPool<double>.Shared.Return(v);
-            ArrayPool<double>.Shared.Return(vNew);
-            ArrayPool<double>.Shared.Return(a);
-            ArrayPool<double>.Shared.Return(b);
-            ArrayPool<double>.Shared.Return(c);
-            ArrayPool<double>.Shared.Return(d);
+            ArrayPool<Vector256<double>>.Shared.Return(vectorBlock);
+            ArrayPool<double>.Shared.Return(laneBlock);
         }
     }
 
@@ -214,27 +578,27 @@ public sealed class CREN002A
     /// <remarks>
     /// Uses QuantLib/kwinto-cuda sinh interpolation formula:
     /// 1. Define grid bounds: xMin = xMid - scale*σ*√T, xMax = xMid + scale*σ*√T
-    /// 2. Transform to y-space: yMin = asinh((xMin-xMid)/density), yMax = asinh((xMax-xMid)/density)  
+    /// 2. Transform to y-space: yMin = asinh((xMin-xMid)/density), yMax = asinh((xMax-xMid)/density)
     /// 3. Linear interpolate in y-space: y = yMin*(1-ξ) + yMax*ξ
     /// 4. Transform back: x = xMid + density * sinh(y)
-    /// 
+    ///
     /// This concentrates grid points near xMid where option value curves sharply.
     /// References: fdmblackscholesmesher.cpp, kwFd1d.cpp
     /// </remarks>
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
-    private void BuildAsinhGrid(double[] x, double[] dx, int n, double spot, double strike, double sigma, double T)
+    private void BuildAsinhGrid(Span<double> x, Span<double> dx, int n, double spot, double strike, double sigma, double T)
     {
         // Grid in log-spot space centered at log(spot)
         double xMid = System.Math.Log(spot);
-        
+
         // Scale controls how many standard deviations the grid spans
         double scale = 10.0;  // kwinto-cuda uses 50, we use 10 for more focus near ATM
         double density = _gridConcentration;  // Controls point concentration (0.1-0.5 typical)
-        
+
         // Grid boundaries in log-space
         double xMin = xMid - (scale * sigma * System.Math.Sqrt(T));
         double xMax = xMid + (scale * sigma * System.Math.Sqrt(T));
-        
+
         // Transform to y-space using asinh
         double yMin = Asinh((xMin - xMid) / density);
         double yMax = Asinh((xMax - xMid) / density);
@@ -256,45 +620,62 @@ public sealed class CREN002A
         dx[n - 1] = dx[n - 2]; // Extrapolate last
     }
 
+    /// <summary>
+    /// Evaluates the payoff once per node; it is both the terminal condition and the exercise value.
+    /// </summary>
+    private static void BuildIntrinsic(ReadOnlySpan<double> x, Span<double> intrinsic, double strike, OptionType optionType)
+    {
+        for (int i = 0; i < x.Length; i++)
+        {
+            double spotAtNode = System.Math.Exp(x[i]);
+            intrinsic[i] = CalculatePayoff(spotAtNode, strike, optionType);
+        }
+    }
 
     /// <summary>
-    /// Builds tridiagonal system with variable grid spacing.
+    /// Builds and factors the implicit operator (I - θ·dt·A) with variable grid spacing.
     /// </summary>
     /// <remarks>
     /// Black-Scholes PDE in log-spot space:
     /// ∂V/∂t + (r-q-σ²/2)∂V/∂x + (σ²/2)∂²V/∂x² - rV = 0
-    /// 
+    ///
     /// PDE coefficients matching kwinto-cuda/QuantLib:
     /// - a0 = -r (kill/discount term)
     /// - ax = r - q - σ²/2 (drift/convection)
     /// - axx = σ²/2 (diffusion)
+    ///
+    /// The coefficients do not depend on time, so the Thomas forward-sweep pivots are
+    /// computed once per solve and reused at every step. Boundary rows carry the
+    /// Neumann identity rows (a = c = 0, b = 1).
     /// </remarks>
-    private void BuildTridiagonalSystemVariable(
+    private void FactorOperator(
         int n,
         double dt,
         double sigma2,
         double r,
         double q,
-        double[] x,
-        double[] dx,
-        double[] v,
-        double[] aOut,
-        double[] bOut,
-        double[] cOut,
-        double[] dOut)
+        ReadOnlySpan<double> dx,
+        ref ThetaOperator op)
     {
-        double oneMinusTheta = 1.0 - _theta;
-        
         // PDE coefficients (matching Black-Scholes in log-space)
-        double a0 = -r;                          // kill term
-        double ax = r - q - (0.5 * sigma2);      // drift/convection
-        double axx = 0.5 * sigma2;               // diffusion (σ²/2, NOT σ²)
+        op.A0 = -r;                          // kill term
+        op.Ax = r - q - (0.5 * sigma2);      // drift/convection
+        op.Axx = 0.5 * sigma2;               // diffusion (σ²/2, NOT σ²)
+
+        Span<double> lower = op.Lower;
+        Span<double> cPrime = op.CPrime;
+        Span<double> denom = op.Denom;
+
+        // Left Neumann row
+        lower[0] = 0;
+        denom[0] = 1;
+        cPrime[0] = 0;
 
         for (int i = 1; i < n - 1; i++)
         {
             double dxMinus = dx[i - 1];
             double dxPlus = dx[i];
-            
+
             // Variable-spacing finite difference coefficients
             // Following kwinto-cuda convention
             double inv_dxm = 1.0 / (dxMinus + dxPlus);  // central diff denominator
@@ -303,14 +684,86 @@ public sealed class CREN002A
             double inv_dx2l = 2.0 / (dxMinus * (dxMinus + dxPlus));
 
             // Tridiagonal coefficients for A operator
-            double al = (-inv_dxm * ax) + (inv_dx2l * axx);   // lower
-            double am = a0 - (inv_dx2m * axx);                   // middle
-            double au = (inv_dxm * ax) + (inv_dx2u * axx);       // upper
+            double al = (-inv_dxm * op.Ax) + (inv_dx2l * op.Axx);   // lower
+            double am = op.A0 - (inv_dx2m * op.Axx);                   // middle
+            double au = (inv_dxm * op.Ax) + (inv_dx2u * op.Axx);       // upper
 
             // LHS: (I - θ·dt·A)
-            aOut[i] = -_theta * dt * al;
-            bOut[i] = 1.0 - (_theta * dt * am);
-            cOut[i] = -_theta * dt * au;
+            double a = -_theta * dt * al;
+            double b = 1.0 - (_theta * dt * am);
+            double c = -_theta * dt * au;
+
+            // Thomas forward sweep on the constant coefficients
+            double pivot = b - (a * cPrime[i - 1]);
+            if (System.Math.Abs(pivot) < 1e-15)
+            {
+                pivot = 1e-15;
+            }
+
+            lower[i] = a;
+            denom[i] = pivot;
+            cPrime[i] = c / pivot;
+        }
+
+        // Right Neumann row
+        lower[n - 1] = 0;
+        denom[n - 1] = 1;
+        cPrime[n - 1] = 0;
+    }
+
+    /// <summary>
+    /// Advances one state by a single time step: explicit half, factored solve, exercise projection.
+    /// </summary>
+    private void StepBackward(
+        int n,
+        double dt,
+        in ThetaOperator op,
+        ReadOnlySpan<double> dx,
+        ReadOnlySpan<double> v,
+        ReadOnlySpan<double> intrinsic,
+        Span<double> rhs,
+        Span<double> dPrime,
+        Span<double> vNew)
+    {
+        BuildRightHandSide(n, dt, in op, dx, v, rhs);
+
+        // Apply Neumann boundary conditions (gamma = 0)
+        ApplyNeumannBoundaries(n, rhs, v);
+
+        SolveFactored(n, in op, rhs, dPrime, vNew);
+
+        // Early exercise check
+        for (int i = 0; i < n; i++)
+        {
+            vNew[i] = System.Math.Max(vNew[i], intrinsic[i]);
+        }
+    }
+
+    /// <summary>
+    /// Builds the explicit right-hand side (I + (1-θ)·dt·A)·V for interior nodes.
+    /// </summary>
+    private void BuildRightHandSide(
+        int n,
+        double dt,
+        in ThetaOperator op,
+        ReadOnlySpan<double> dx,
+        ReadOnlySpan<double> v,
+        Span<double> dOut)
+    {
+        double oneMinusTheta = 1.0 - _theta;
+        double a0 = op.A0;
+        double ax = op.Ax;
+        double axx = op.Axx;
+
+        for (int i = 1; i < n - 1; i++)
+        {
+            double dxMinus = dx[i - 1];
+            double dxPlus = dx[i];
+
+            double inv_dxm = 1.0 / (dxMinus + dxPlus);
+            double inv_dx2u = 2.0 / (dxPlus * (dxMinus + dxPlus));
+            double inv_dx2m = 2.0 / (dxMinus * dxPlus);
+            double inv_dx2l = 2.0 / (dxMinus * (dxMinus + dxPlus));
 
             // RHS: (I + (1-θ)·dt·A)·V
             double convectionTerm = oneMinusTheta * dt * ax * inv_dxm * (v[i + 1] - v[i - 1]);
@@ -327,77 +780,54 @@ public sealed class CREN002A
     /// is zero at boundaries. This is more stable than Dirichlet
     /// conditions and reflects that option value becomes linear
     /// in the far wings.
-    /// 
+    ///
     /// At left boundary (S→0): V[0] = 2*V[1] - V[2]
     /// At right boundary (S→∞): V[N-1] = 2*V[N-2] - V[N-3]
+    ///
+    /// The matching identity rows of the operator are set in <see cref="FactorOperator"/>.
     /// </remarks>
     private static void ApplyNeumannBoundaries(
         int n,
-        double[] a,
-        double[] b,
-        double[] c,
-        double[] d,
-        double[] v)
+        Span<double> d,
+        ReadOnlySpan<double> v)
     {
         // Left boundary: gamma = 0 → V[0] - 2*V[1] + V[2] = 0
         // Rearranged: V[0] = 2*V[1] - V[2]
-        a[0] = 0;
-        b[0] = 1;
-        c[0] = 0;
         d[0] = (2 * v[1]) - v[2];
 
         // Right boundary: gamma = 0 → V[N-3] - 2*V[N-2] + V[N-1] = 0
         // Rearranged: V[N-1] = 2*V[N-2] - V[N-3]
-        a[n - 1] = 0;
-        b[n - 1] = 1;
-        c[n - 1] = 0;
         d[n - 1] = (2 * v[n - 2]) - v[n - 3];
     }
 
     /// <summary>
-    /// Solves tridiagonal system using Thomas algorithm O(N).
+    /// Solves the pre-factored tridiagonal system using the Thomas algorithm O(N).
     /// </summary>
-    private static void SolveTridiagonal(
+    private static void SolveFactored(
         int n,
-        double[] a,
-        double[] b,
-        double[] c,
-        double[] d,
-        double[] x)
+        in ThetaOperator op,
+        ReadOnlySpan<double> d,
+        Span<double> dPrime,
+        Span<double> x)
     {
-        double[] cPrime = ArrayPool<double>.Shared.Rent(n);
-        double[] dPrime = ArrayPool<double>.Shared.Rent(n);
+        ReadOnlySpan<double> lower = op.Lower;
+        ReadOnlySpan<double> cPrime = op.CPrime;
+        ReadOnlySpan<double> denom = op.Denom;
 
-        try
+        dPrime[0] = d[0] / denom[0];
+        for (int i = 1; i < n; i++)
         {
-            cPrime[0] = c[0] / b[0];
-            dPrime[0] = d[0] / b[0];
-
-            for (int i = 1; i < n; i++)
-            {
-                double denom = b[i] - (a[i] * cPrime[i - 1]);
-                if (System.Math.Abs(denom) < 1e-15)
-                {
-                    denom = 1e-15;
-                }
-                cPrime[i] = c[i] / denom;
-                dPrime[i] = (d[i] - (a[i] * dPrime[i - 1])) / denom;
-            }
-
-            x[n - 1] = dPrime[n - 1];
-            for (int i = n - 2; i >= 0; i--)
-            {
-                x[i] = dPrime[i] - (cPrime[i] * x[i + 1]);
-            }
+            dPrime[i] = (d[i] - (lower[i] * dPrime[i - 1])) / denom[i];
         }
-        finally
+
+        x[n - 1] = dPrime[n - 1];
+        for (int i = n - 2; i >= 0; i--)
         {
-            ArrayPool<double>.Shared.Return(cPrime);
-            ArrayPool<double>.Shared.Return(dPrime);
+            x[i] = dPrime[i] - (cPrime[i] * x[i + 1]);
         }
     }
 
-    private static double InterpolatePrice(double[] x, double[] v, int n, double logSpot)
+    private static int FindBracket(ReadOnlySpan<double> x, int n, double logSpot)
     {
         int i = 0;
         for (int j = 0; j < n - 1; j++)
@@ -409,6 +839,13 @@ public sealed class CREN002A
             }
         }
 
+        return i;
+    }
+
+    private static double InterpolatePrice(ReadOnlySpan<double> x, ReadOnlySpan<double> v, int n, double logSpot)
+    {
+        int i = FindBracket(x, n, logSpot);
+
         double dxLocal = x[i + 1] - x[i];
         if (System.Math.Abs(dxLocal) < 1e-15)
         {
@@ -418,6 +855,75 @@ public sealed class CREN002A
         return ((1 - t) * v[i]) + (t * v[i + 1]);
     }
 
+    /// <summary>
+    /// First and second log-spot derivatives of the grid solution at the spot.
+    /// </summary>
+    /// <remarks>
+    /// Differentiates the quadratic Lagrange interpolant through the node nearest the
+    /// spot and its two neighbours, which is second-order accurate on the ASINH grid.
+    /// </remarks>
+    private static (double Dx, double Dxx) GridDerivatives(ReadOnlySpan<double> x, ReadOnlySpan<double> v, int n, double logSpot)
+    {
+        int i = FindBracket(x, n, logSpot);
+        int j = (logSpot - x[i]) <= (x[i + 1] - logSpot) ? i : i + 1;
+        j = System.Math.Clamp(j, 1, n - 2);
+
+        double x0 = x[j - 1];
+        double x1 = x[j];
+        double x2 = x[j + 1];
+
+        double den0 = (x0 - x1) * (x0 - x2);
+        double den1 = (x1 - x0) * (x1 - x2);
+        double den2 = (x2 - x0) * (x2 - x1);
+
+        double dx = (v[j - 1] * ((logSpot - x1) + (logSpot - x2)) / den0)
+                  + (v[j] * ((logSpot - x0) + (logSpot - x2)) / den1)
+                  + (v[j + 1] * ((logSpot - x0) + (logSpot - x1)) / den2);
+
+        double dxx = 2.0 * ((v[j - 1] / den0) + (v[j] / den1) + (v[j + 1] / den2));
+
+        return (dx, dxx);
+    }
+
+    /// <summary>
+    /// Factored Crank-Nicolson operator for one (σ, r, q) parameter set on a fixed grid.
+    /// </summary>
+    private ref struct ThetaOperator
+    {
+        public double A0;
+        public double Ax;
+        public double Axx;
+        public Span<double> Lower;
+        public Span<double> CPrime;
+        public Span<double> Denom;
+
+        public ThetaOperator(Span<double> lower, Span<double> cPrime, Span<double> denom)
+        {
+            A0 = 0.0;
+            Ax = 0.0;
+            Axx = 0.0;
+            Lower = lower;
+            CPrime = cPrime;
+            Denom = denom;
+        }
+    }
+
+    private static void ValidateInputs(double spot, double strike, double volatility)
+    {
+        if (spot <= 0)
+        {
+            throw new ArgumentException("Spot must be positive", nameof(spot));
+        }
+        if (strike <= 0)
+        {
+            throw new ArgumentException("Strike must be positive", nameof(strike));
+        }
+        if (volatility <= 0)
+        {
+            throw new ArgumentException("Volatility must be positive", nameof(volatility));
+        }
+    }
+
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     private static double CalculatePayoff(double spot, double strike, OptionType optionType)
     {
@@ -492,3 +998,20 @@ public interface IAmericanOptionEngine
     public double Theta(double spot, double strike, double timeToExpiry, double riskFreeRate, double dividendYield, double volatility, OptionType optionType);
     public double Rho(double spot, double strike, double timeToExpiry, double riskFreeRate, double dividendYield, double volatility, OptionType optionType);
 }
+
+/// <summary>
+/// Price and Greeks from a single finite-difference solve (see <see cref="CREN002A.PriceWithGreeks"/>).
+/// </summary>
+/// <param name="Price">Option value at the spot.</param>
+/// <param name="Delta">∂V/∂S from the solved grid.</param>
+/// <param name="Gamma">∂²V/∂S² from the solved grid.</param>
+/// <param name="Theta">Time decay per year from the penultimate time level.</param>
+/// <param name="Vega">Sensitivity to a unit change in volatility.</param>
+/// <param name="Rho">Sensitivity to a unit change in the risk-free rate.</param>
+public readonly record struct FdGridGreeks(
+    double Price,
+    double Delta,
+    double Gamma,
+    double Theta,
+    double Vega,
+    double Rho);
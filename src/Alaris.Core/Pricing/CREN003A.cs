@@ -316,13 +316,9 @@ public sealed class CREN003A : IAmericanOptionEngine
         // Classify regime
         RateRegime regime = CRRE001A.Classify(riskFreeRate, dividendYield, isCall);
 
-        // Use FD engine for pricing (reliable for all regimes)
-        double price = _fdEngine.Price(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
-        double delta = _fdEngine.Delta(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
-        double gamma = _fdEngine.Gamma(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
-        double theta = _fdEngine.Theta(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
-        double vega = _fdEngine.Vega(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
-        double rho = _fdEngine.Rho(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
+        // Use FD engine for pricing (reliable for all regimes); all Greeks come from one grid solve
+        FdGridGreeks fd = _fdEngine.PriceWithGreeks(spot, strike, timeToExpiry, riskFreeRate, dividendYield, volatility, optionType);
+        double price = fd.Price;
 
         // Calculate early exercise premium (American - European)
         double europeanPrice = Alaris.Core.Math.CRMF001A.BSPrice(
@@ -359,11 +355,11 @@ public sealed class CREN003A : IAmericanOptionEngine
         return new UnifiedPricingResult
         {
             Price = price,
-            Delta = delta,
-            Gamma = gamma,
-            Theta = theta,
-            Vega = vega,
-            Rho = rho,
+            Delta = fd.Delta,
+            Gamma = fd.Gamma,
+            Theta = fd.Theta,
+            Vega = fd.Vega,
+            Rho = fd.Rho,
             Regime = regime,
             Method = method,
             EarlyExercisePremium = System.Math.Max(0, earlyExercisePremium),
@@ -59,26 +59,41 @@ public sealed class CREN004A
     private readonly int _fixedPointIterations;
     private readonly FixedPointEquation _fpEquation;
     private readonly bool _useTanhSinh;
-    private readonly (double[] Nodes, double[] Weights) _quadratureScheme;
+    private readonly SpectralTables _tables;
+    private readonly CRBC001A? _boundaryCache;
 
     private const double Tolerance = 1e-10;
     private const double NumericalEpsilon = 1e-14;
+    private const double NodeMatchTolerance = 1e-14;
+
+    // Value and the (σ, τ, r) tangents of a CRAD001A
+    private const int DualComponents = 4;
 
     /// <summary>
     /// Initializes a new spectral American pricing engine.
     /// </summary>
     /// <param name="scheme">Pre-defined iteration scheme (Fast/Accurate/HighPrecision).</param>
-    public CREN004A(SpectralScheme scheme = SpectralScheme.Accurate)
+    /// <param name="boundaryCache">
+    /// Optional boundary cache whose canonical per-bucket boundary replaces the QD+ guess as
+    /// the fixed-point seed. The sweep count is unchanged, so a seeded solve costs the same
+    /// as a cold one and lands closer to the converged boundary.
+    /// </param>
+    public CREN004A(SpectralScheme scheme = SpectralScheme.Accurate, CRBC001A? boundaryCache = null)
     {
-        (_chebyshevNodes, _fixedPointIterations, _useTanhSinh, _quadratureScheme) = scheme switch
+        (_fixedPointIterations, _useTanhSinh) = scheme switch
         {
-            SpectralScheme.Fast => (8, 2, false, CRGQ001A.Schemes.Fast),
-            SpectralScheme.Accurate => (12, 3, false, CRGQ001A.Schemes.Accurate),
-            SpectralScheme.HighPrecision => (24, 4, true, CRGQ001A.Schemes.HighPrecision),
-            _ => (12, 3, false, CRGQ001A.Schemes.Accurate)
+            SpectralScheme.Fast => (2, false),
+            SpectralScheme.Accurate => (3, false),
+            SpectralScheme.HighPrecision => (4, true),
+            _ => (3, false)
         };
 
+        // Node and quadrature tables are shared by every engine using the same scheme
+        _tables = SpectralTables.For(scheme);
+        _chebyshevNodes = _tables.NodeCount;
+
         _fpEquation = FixedPointEquation.Auto;
+        _boundaryCache = boundaryCache;
     }
 
     /// <summary>
@@ -88,9 +103,10 @@ public sealed class CREN004A
         int chebyshevNodes,
         int fixedPointIterations,
         FixedPointEquation fpEquation = FixedPointEquation.Auto,
-        bool useTanhSinh = false)
+        bool useTanhSinh = false,
+        CRBC001A? boundaryCache = null)
     {
-        if (chebyshevNodes < 4 || chebyshevNodes > 64)
+        if (chebyshevNodes < 4 || chebyshevNodes > CRWS001A.MaxNodes)
         {
             throw new ArgumentOutOfRangeException(nameof(chebyshevNodes), "Chebyshev nodes must be between 4 and 64");
         }
@@ -99,7 +115,8 @@ public sealed class CREN004A
         _fixedPointIterations = System.Math.Clamp(fixedPointIterations, 1, 10);
         _fpEquation = fpEquation;
         _useTanhSinh = useTanhSinh;
-        _quadratureScheme = CRGQ001A.GaussLegendre(System.Math.Min(chebyshevNodes * 2, 32));
+        _tables = SpectralTables.Create(chebyshevNodes);
+        _boundaryCache = boundaryCache;
     }
 
     /// <summary>
@@ -136,7 +153,147 @@ public sealed class CREN004A
     }
 
     /// <summary>
-    /// Computes Delta (∂V/∂S) using central differencing.
+    /// Prices a strike chain sharing one expiry, writing one price per strike.
+    /// </summary>
+    /// <remarks>
+    /// The fixed-point system is homogeneous of degree one in the strike (d₁ and d₂ depend on
+    /// B/K and B/B(s) only, and the clamps scale with K), so B(t; K) = K · B(t; 1). The
+    /// normalized boundary is solved once and each strike only pays for its premium
+    /// integral. Double-boundary regimes seed their boundaries from the spot and fall back
+    /// to <see cref="Price"/> per strike.
+    /// </remarks>
+    /// <param name="spot">Underlying price.</param>
+    /// <param name="strikes">Strikes of the chain.</param>
+    /// <param name="tau">Time to expiry in years.</param>
+    /// <param name="r">Risk-free rate.</param>
+    /// <param name="q">Dividend yield.</param>
+    /// <param name="sigma">Volatility.</param>
+    /// <param name="optionType">Option type shared by the chain.</param>
+    /// <param name="prices">Destination, same length as <paramref name="strikes"/>.</param>
+    public void PriceChain(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double tau,
+        double r,
+        double q,
+        double sigma,
+        OptionType optionType,
+        Span<double> prices)
+    {
+        if (prices.Length != strikes.Length)
+        {
+            throw new ArgumentException("Price span length must match strike span length", nameof(prices));
+        }
+
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            ValidateInputs(spot, strikes[i], tau, sigma);
+        }
+
+        if (strikes.IsEmpty)
+        {
+            return;
+        }
+
+        // Near-expiry: return intrinsic value
+        if (tau < 1.0 / 365.0)
+        {
+            for (int i = 0; i < strikes.Length; i++)
+            {
+                prices[i] = CalculateIntrinsicValue(spot, strikes[i], optionType);
+            }
+            return;
+        }
+
+        bool isCall = optionType == OptionType.Call;
+
+        if (ClassifyRegime(r, q, isCall) == RateRegime.DoubleBoundary)
+        {
+            for (int i = 0; i < strikes.Length; i++)
+            {
+                prices[i] = PriceDoubleBoundary(spot, strikes[i], tau, r, q, sigma, isCall);
+            }
+            return;
+        }
+
+        // Solve the boundary for a unit strike, then rescale it per strike
+        CRWS001A workspace = CRWS001A.Current;
+        SolveSingleBoundary(workspace, 1.0, tau, r, q, sigma, isCall);
+
+        double[] unitBoundary = workspace.Boundary;
+        double[] scaled = workspace.Scaled;
+
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            double strike = strikes[i];
+            for (int j = 0; j < _chebyshevNodes; j++)
+            {
+                scaled[j] = strike * unitBoundary[j];
+            }
+
+            prices[i] = ValueFromSingleBoundary(
+                spot, strike, tau, r, q, sigma, isCall, workspace.TimeNodes, scaled);
+        }
+    }
+
+    /// <summary>
+    /// Prices an American option together with its Greeks in one forward-mode pass.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// The QD+ seed, the fixed-point boundary iteration and the premium integral are
+    /// evaluated on dual numbers carrying ∂/∂σ, ∂/∂τ and ∂/∂r, so vega, theta and rho are
+    /// exact derivatives of the discretized price rather than bumped differences. The
+    /// boundary does not depend on the spot, so delta and gamma are the analytic first and
+    /// second spot derivatives of the European value and of the premium integrand on the
+    /// solved boundary.
+    /// </para>
+    /// <para>
+    /// On the Gauss-Legendre schemes the whole set costs about 2.1 price evaluations, against
+    /// nine reprices for <see cref="Delta"/>, <see cref="Gamma"/>, <see cref="Theta"/> and
+    /// <see cref="Vega"/> by bumping, and the price matches <see cref="Price"/> bit for bit.
+    /// Tanh-Sinh engines integrate the tangent pass with their Gauss-Legendre table instead
+    /// of the adaptive rule, so their price differs slightly and costs less than one adaptive
+    /// price. Double-boundary regimes fall back to bump-and-reprice.
+    /// </para>
+    /// </remarks>
+    public SpectralGreeks PriceWithGreeks(
+        double spot,
+        double strike,
+        double tau,
+        double r,
+        double q,
+        double sigma,
+        OptionType optionType)
+    {
+        ValidateInputs(spot, strike, tau, sigma);
+
+        bool isCall = optionType == OptionType.Call;
+
+        // Near-expiry: intrinsic value and its step-function delta
+        if (tau < 1.0 / 365.0)
+        {
+            return IntrinsicGreeks(spot, strike, isCall);
+        }
+
+        if (ClassifyRegime(r, q, isCall) == RateRegime.DoubleBoundary)
+        {
+            return BumpedGreeks(spot, strike, tau, r, q, sigma, optionType);
+        }
+
+        CRAD001A sigmaDual = new CRAD001A(sigma, 1.0, 0.0, 0.0);
+        CRAD001A tauDual = new CRAD001A(tau, 0.0, 1.0, 0.0);
+        CRAD001A rDual = new CRAD001A(r, 0.0, 0.0, 1.0);
+
+        CRWS001A workspace = CRWS001A.Current;
+        SolveSingleBoundaryWithTangents(workspace, strike, tauDual, rDual, q, sigmaDual, isCall);
+
+        return ValueWithGreeks(
+            spot, strike, tauDual, rDual, q, sigmaDual, isCall, workspace.TimeNodes, workspace.DualBoundary);
+    }
+
+    /// <summary>
+    /// Computes Delta (∂V/∂S) from the forward-mode pass.
     /// </summary>
     public double Delta(
         double spot,
@@ -147,14 +304,11 @@ public sealed class CREN004A
         double sigma,
         OptionType optionType)
     {
-        double h = spot * 0.001;
-        double vUp = Price(spot + h, strike, tau, r, q, sigma, optionType);
-        double vDown = Price(spot - h, strike, tau, r, q, sigma, optionType);
-        return (vUp - vDown) / (2.0 * h);
+        return PriceWithGreeks(spot, strike, tau, r, q, sigma, optionType).Delta;
     }
 
     /// <summary>
-    /// Computes Gamma (∂²V/∂S²) using central differencing.
+    /// Computes Gamma (∂²V/∂S²) from the forward-mode pass.
     /// </summary>
     public double Gamma(
         double spot,
@@ -165,15 +319,11 @@ public sealed class CREN004A
         double sigma,
         OptionType optionType)
     {
-        double h = spot * 0.001;
-        double vUp = Price(spot + h, strike, tau, r, q, sigma, optionType);
-        double vCtr = Price(spot, strike, tau, r, q, sigma, optionType);
-        double vDown = Price(spot - h, strike, tau, r, q, sigma, optionType);
-        return (vUp - (2.0 * vCtr) + vDown) / (h * h);
+        return PriceWithGreeks(spot, strike, tau, r, q, sigma, optionType).Gamma;
     }
 
     /// <summary>
-    /// Computes Theta (∂V/∂τ) using forward differencing.
+    /// Computes Theta (−∂V/∂τ, per year) from the forward-mode pass.
     /// </summary>
     public double Theta(
         double spot,
@@ -184,19 +334,16 @@ public sealed class CREN004A
         double sigma,
         OptionType optionType)
     {
-        double dt = 1.0 / 365.0;
-        if (tau <= dt)
+        if (tau <= 1.0 / 365.0)
         {
             return 0.0;
         }
 
-        double vNow = Price(spot, strike, tau, r, q, sigma, optionType);
-        double vLater = Price(spot, strike, tau - dt, r, q, sigma, optionType);
-        return (vLater - vNow) / dt;
+        return PriceWithGreeks(spot, strike, tau, r, q, sigma, optionType).Theta;
     }
 
     /// <summary>
-    /// Computes Vega (∂V/∂σ) using central differencing.
+    /// Computes Vega (∂V/∂σ) from the forward-mode pass.
     /// </summary>
     public double Vega(
         double spot,
@@ -207,10 +354,7 @@ public sealed class CREN004A
         double sigma,
         OptionType optionType)
     {
-        double h = sigma * 0.01;
-        double vUp = Price(spot, strike, tau, r, q, sigma + h, optionType);
-        double vDown = Price(spot, strike, tau, r, q, sigma - h, optionType);
-        return (vUp - vDown) / (2.0 * h);
+        return PriceWithGreeks(spot, strike, tau, r, q, sigma, optionType).Vega;
     }
 
     // ========== Single Boundary Pricing (Standard Regimes) ==========
@@ -218,24 +362,104 @@ public sealed class CREN004A
     private double PriceSingleBoundary(
         double spot, double strike, double tau, double r, double q, double sigma, bool isCall)
     {
-        // Step 1: Compute initial boundary guess B∞ using QD+ approximation
-        double bInfinity = ComputeQdPlusInitialGuess(strike, tau, r, q, sigma, isCall);
+        CRWS001A workspace = CRWS001A.Current;
+        SolveSingleBoundary(workspace, strike, tau, r, q, sigma, isCall);
 
-        // Step 2: Generate Chebyshev nodes in time domain [0, τ]
-        double[] timeNodes = CRCH001A.ChebyshevNodes(_chebyshevNodes, 0.0, tau);
+        return ValueFromSingleBoundary(
+            spot, strike, tau, r, q, sigma, isCall, workspace.TimeNodes, workspace.Boundary);
+    }
 
-        // Step 3: Initialize boundary values
-        double[] boundaryValues = new double[_chebyshevNodes];
-        for (int i = 0; i < _chebyshevNodes; i++)
+    /// <summary>
+    /// Solves the exercise boundary into <see cref="CRWS001A.TimeNodes"/> and <see cref="CRWS001A.Boundary"/>.
+    /// </summary>
+    private void SolveSingleBoundary(
+        CRWS001A workspace, double strike, double tau, double r, double q, double sigma, bool isCall)
+    {
+        int n = _chebyshevNodes;
+        double[] timeNodes = workspace.TimeNodes;
+        double[] boundaryValues = workspace.Boundary;
+
+        // Step 1: Generate Chebyshev nodes in time domain [0, τ]
+        _tables.MapNodes(tau, timeNodes);
+
+        // Step 2: Seed from the bucket's canonical boundary, else from the QD+ guess B∞
+        if (!TrySeedFromCache(workspace, strike, tau, r, q, sigma, isCall, boundaryValues.AsSpan(0, n)))
+        {
+            double bInfinity = ComputeQdPlusInitialGuess(strike, tau, r, q, sigma, isCall);
+            boundaryValues.AsSpan(0, n).Fill(bInfinity);
+        }
+
+        // Step 3: Fixed-point iteration to refine boundary (in place)
+        FixedPointIteration(boundaryValues, workspace.Next, timeNodes, strike, tau, r, q, sigma, isCall);
+    }
+
+    /// <summary>
+    /// Writes the cache's canonical boundary for the quantized inputs, rescaled to the strike.
+    /// </summary>
+    /// <returns>False without a cache, or when the bucket has no single-boundary seed.</returns>
+    private bool TrySeedFromCache(
+        CRWS001A workspace, double strike, double tau, double r, double q, double sigma, bool isCall,
+        Span<double> boundary)
+    {
+        if (_boundaryCache is null)
+        {
+            return false;
+        }
+
+        int n = _chebyshevNodes;
+        double[] timeNodes = workspace.TimeNodes;
+        Span<double> normalizedTimes = workspace.NormalizedTimes.AsSpan(0, n);
+        for (int i = 0; i < n; i++)
         {
-            boundaryValues[i] = bInfinity;
+            normalizedTimes[i] = timeNodes[i] / tau;
         }
 
-        // Step 4: Fixed-point iteration to refine boundary
-        boundaryValues = FixedPointIteration(
-            boundaryValues, timeNodes, strike, tau, r, q, sigma, isCall);
+        BoundaryCacheKey key = _boundaryCache.CreateKey(tau, r, q, sigma, isCall);
+        return _boundaryCache.TrySeed(key, normalizedTimes, strike, boundary);
+    }
 
-        // Step 5: Integrate along refined boundary to get option value
+    /// <summary>
+    /// Solves the unit-strike boundary on a private workspace and writes its Chebyshev series
+    /// in x = 2t/τ − 1.
+    /// </summary>
+    /// <remarks>
+    /// <see cref="CRBC001A"/> calls this on a miss, which can happen in the middle of another
+    /// engine's solve on the same thread, so the thread's workspace is left untouched.
+    /// </remarks>
+    /// <param name="coefficients">Receives the node count plus one coefficients.</param>
+    /// <returns>False when the inputs are in a double-boundary regime or the boundary is not usable.</returns>
+    internal bool TrySolveUnitBoundary(
+        double tau, double r, double q, double sigma, bool isCall, Span<double> coefficients)
+    {
+        if (tau < 1.0 / 365.0 || sigma <= 0 || ClassifyRegime(r, q, isCall) == RateRegime.DoubleBoundary)
+        {
+            return false;
+        }
+
+        CRWS001A workspace = CRWS001A.CreateDetached();
+        SolveSingleBoundary(workspace, 1.0, tau, r, q, sigma, isCall);
+
+        ReadOnlySpan<double> boundary = workspace.Boundary.AsSpan(0, _chebyshevNodes);
+        foreach (double value in boundary)
+        {
+            if (!double.IsFinite(value) || value <= 0)
+            {
+                return false;
+            }
+        }
+
+        CRCH001A.NodeValuesToCoefficients(boundary, coefficients);
+        return true;
+    }
+
+    /// <summary>Number of coefficients written by <see cref="TrySolveUnitBoundary"/>.</summary>
+    internal int UnitBoundaryCoefficientCount => _chebyshevNodes + 1;
+
+    private double ValueFromSingleBoundary(
+        double spot, double strike, double tau, double r, double q, double sigma, bool isCall,
+        double[] timeNodes, double[] boundaryValues)
+    {
+        // Step 4: Integrate along refined boundary to get option value
         double europeanValue = BlackScholesEuropean(spot, strike, tau, r, q, sigma, isCall);
         double earlyExercisePremium = IntegrateEarlyExercisePremium(
             spot, strike, tau, r, q, sigma, isCall, timeNodes, boundaryValues);
@@ -256,10 +480,12 @@ public sealed class CREN004A
         // Fall back to heuristic initial guesses if needed
 
         double upperInit, lowerInit;
+        CRWS001A workspace = CRWS001A.Current;
 
         try
         {
-            CRAP001A qdPlus = new CRAP001A(spot, strike, tau, r, q, sigma, isCall);
+            CRAP001A qdPlus = workspace.QdPlus;
+            qdPlus.Reset(spot, strike, tau, r, q, sigma, isCall);
             (upperInit, lowerInit) = qdPlus.CalculateBoundaries();
         }
         catch (InvalidOperationException)
@@ -309,35 +535,52 @@ public sealed class CREN004A
             }
         }
 
+        int n = _chebyshevNodes;
+
         // Generate Chebyshev nodes
-        double[] timeNodes = CRCH001A.ChebyshevNodes(_chebyshevNodes, 0.0, tau);
+        double[] timeNodes = workspace.TimeNodes;
+        _tables.MapNodes(tau, timeNodes);
 
         // Initialize both boundaries
-        double[] upperBoundary = new double[_chebyshevNodes];
-        double[] lowerBoundary = new double[_chebyshevNodes];
-        for (int i = 0; i < _chebyshevNodes; i++)
-        {
-            upperBoundary[i] = upperInit;
-            lowerBoundary[i] = lowerInit;
-        }
+        double[] upperBoundary = workspace.Boundary;
+        double[] lowerBoundary = workspace.Lower;
+        upperBoundary.AsSpan(0, n).Fill(upperInit);
+        lowerBoundary.AsSpan(0, n).Fill(lowerInit);
 
         // Apply FP-B' stabilized iteration (Healy approach)
         // Skip iteration for call double-boundary if not well-understood
         if (!isCall)
         {
-            (upperBoundary, lowerBoundary) = DoubleBoundaryFixedPointIteration(
-                upperBoundary, lowerBoundary, timeNodes, strike, tau, r, q, sigma, isCall);
+            DoubleBoundaryFixedPointIteration(
+                workspace, timeNodes, strike, tau, r, q, sigma, isCall);
 
-            // Optionally refine with Kim solver for higher precision
+            // Optionally refine with Kim solver for higher precision, warm-started from the
+            // FP-B' boundaries. Kim collocates on a uniform grid, so resample both ways.
             if (_fixedPointIterations > 2)
             {
                 try
                 {
-                    CRSL002A kimSolver = new CRSL002A(spot, strike, tau, r, q, sigma, isCall, _chebyshevNodes);
-                    (double[] refinedUpper, double[] refinedLower, double _) =
-                        kimSolver.SolveBoundaries(upperBoundary[^1], lowerBoundary[^1]);
-                    upperBoundary = refinedUpper;
-                    lowerBoundary = refinedLower;
+                    CRSL002A kimSolver = workspace.Kim;
+                    kimSolver.Reset(spot, strike, tau, r, q, sigma, isCall, n);
+                    Span<double> seedUpper = workspace.Scaled.AsSpan(0, n);
+                    Span<double> seedLower = workspace.TempUpper.AsSpan(0, n);
+                    Span<double> refinedUpper = workspace.Next.AsSpan(0, n);
+                    Span<double> refinedLower = workspace.LowerNext.AsSpan(0, n);
+
+                    for (int i = 0; i < n; i++)
+                    {
+                        double t = System.Math.Clamp(i * tau / (n - 1), timeNodes[0], timeNodes[n - 1]);
+                        seedUpper[i] = InterpolateBoundary(upperBoundary, timeNodes, t);
+                        seedLower[i] = InterpolateBoundary(lowerBoundary, timeNodes, t);
+                    }
+
+                    kimSolver.SolveBoundaries(seedUpper, seedLower, refinedUpper, refinedLower);
+
+                    for (int i = 0; i < n; i++)
+                    {
+                        upperBoundary[i] = InterpolateUniform(refinedUpper, tau, timeNodes[i]);
+                        lowerBoundary[i] = InterpolateUniform(refinedLower, tau, timeNodes[i]);
+                    }
                 }
                 catch (InvalidOperationException)
                 {
@@ -349,7 +592,7 @@ public sealed class CREN004A
         // Compute option value from refined boundaries
         double europeanValue = BlackScholesEuropean(spot, strike, tau, r, q, sigma, isCall);
         double eep = IntegrateDoubleBoundaryPremium(
-            spot, strike, tau, r, q, sigma, isCall, timeNodes, upperBoundary, lowerBoundary);
+            spot, strike, tau, r, q, sigma, timeNodes, upperBoundary, lowerBoundary);
 
         // Ensure no NaN propagation
         if (!double.IsFinite(eep))
@@ -364,8 +607,12 @@ public sealed class CREN004A
 
     // ========== Fixed-Point Iteration ==========
 
-    private double[] FixedPointIteration(
-        double[] boundary,
+    /// <summary>
+    /// Refines <paramref name="current"/> in place, using <paramref name="next"/> as scratch.
+    /// </summary>
+    private void FixedPointIteration(
+        double[] current,
+        double[] next,
         double[] timeNodes,
         double strike,
         double tau,
@@ -374,13 +621,15 @@ public sealed class CREN004A
         double sigma,
         bool isCall)
     {
-        double[] current = (double[])boundary.Clone();
+        int n = _chebyshevNodes;
+        Span<double> coefficients = stackalloc double[n + 1];
 
         for (int iter = 0; iter < _fixedPointIterations; iter++)
         {
-            double[] next = new double[_chebyshevNodes];
+            // The iterate is fixed for the whole sweep, so its Chebyshev series is built once
+            CRCH001A.NodeValuesToCoefficients(current.AsSpan(0, n), coefficients);
 
-            for (int i = 0; i < _chebyshevNodes; i++)
+            for (int i = 0; i < n; i++)
             {
                 double t = timeNodes[i];
                 double tauRemaining = tau - t;
@@ -392,29 +641,28 @@ public sealed class CREN004A
                 }
 
                 // Compute the fixed-point update
-                next[i] = FixedPointUpdate(current, timeNodes, i, strike, tau, r, q, sigma, isCall);
+                next[i] = FixedPointUpdate(current, coefficients, timeNodes, i, strike, tau, r, q, sigma, isCall);
             }
 
             // Check convergence
             double maxChange = 0.0;
-            for (int i = 0; i < _chebyshevNodes; i++)
+            for (int i = 0; i < n; i++)
             {
                 maxChange = System.Math.Max(maxChange, System.Math.Abs(next[i] - current[i]));
             }
 
-            current = next;
+            next.AsSpan(0, n).CopyTo(current);
 
             if (maxChange < Tolerance * strike)
             {
                 break;
             }
         }
-
-        return current;
     }
 
     private double FixedPointUpdate(
         double[] boundary,
+        ReadOnlySpan<double> coefficients,
         double[] timeNodes,
         int index,
         double strike,
@@ -436,8 +684,9 @@ public sealed class CREN004A
         double eta = isCall ? 1.0 : -1.0;
 
         // Compute the integral term using quadrature
-        double integralN = ComputeIntegralN(boundary, timeNodes, index, strike, r, q, sigma, isCall);
-        double integralD = ComputeIntegralD(boundary, timeNodes, index, strike, r, q, sigma, isCall);
+        (double integralN, double integralD) = _useTanhSinh
+            ? ComputeIntegralsTanhSinh(boundary, timeNodes, index, r, q, sigma, isCall)
+            : ComputeIntegralsGaussLegendre(boundary, coefficients, timeNodes, index, tau, r, q, sigma, isCall);
 
         // FP-A equation: B = K * N(d) / D(d)
         double Nd2 = CRMF001A.NormalCDF(eta * d2);
@@ -466,9 +715,11 @@ public sealed class CREN004A
         return newB;
     }
 
-    private (double[] Upper, double[] Lower) DoubleBoundaryFixedPointIteration(
-        double[] upper,
-        double[] lower,
+    /// <summary>
+    /// FP-B' iteration on <see cref="CRWS001A.Boundary"/> (upper) and <see cref="CRWS001A.Lower"/>, in place.
+    /// </summary>
+    private void DoubleBoundaryFixedPointIteration(
+        CRWS001A workspace,
         double[] timeNodes,
         double strike,
         double tau,
@@ -477,23 +728,29 @@ public sealed class CREN004A
         double sigma,
         bool isCall)
     {
-        double[] currentUpper = (double[])upper.Clone();
-        double[] currentLower = (double[])lower.Clone();
+        int n = _chebyshevNodes;
+        double[] currentUpper = workspace.Boundary;
+        double[] currentLower = workspace.Lower;
+        double[] nextUpper = workspace.Next;
+        double[] nextLower = workspace.LowerNext;
+        double[] tempUpper = workspace.TempUpper;
+
+        Span<double> coefficients = stackalloc double[n + 1];
 
         for (int iter = 0; iter < _fixedPointIterations; iter++)
         {
-            double[] nextUpper = new double[_chebyshevNodes];
-            double[] nextLower = new double[_chebyshevNodes];
+            currentUpper.AsSpan(0, n).CopyTo(tempUpper);
+            CRCH001A.NodeValuesToCoefficients(currentUpper.AsSpan(0, n), coefficients);
 
-            for (int i = 0; i < _chebyshevNodes; i++)
+            for (int i = 0; i < n; i++)
             {
                 // FP-B' stabilization: update upper first, then use updated upper for lower
-                nextUpper[i] = FixedPointUpdate(currentUpper, timeNodes, i, strike, tau, r, q, sigma, isCall);
+                nextUpper[i] = FixedPointUpdate(currentUpper, coefficients, timeNodes, i, strike, tau, r, q, sigma, isCall);
 
                 // Use just-computed upper for lower boundary update
-                double[] tempUpper = (double[])currentUpper.Clone();
                 tempUpper[i] = nextUpper[i];
-                nextLower[i] = FixedPointUpdateLower(currentLower, tempUpper, timeNodes, i, strike, tau, r, q, sigma, isCall);
+                nextLower[i] = FixedPointUpdateLower(currentLower, tempUpper, timeNodes, i, strike, tau, r, q, sigma);
+                tempUpper[i] = currentUpper[i];
 
                 // Enforce ordering constraint
                 if (!isCall && nextLower[i] >= nextUpper[i])
@@ -504,14 +761,12 @@ public sealed class CREN004A
                 }
             }
 
-            currentUpper = nextUpper;
-            currentLower = nextLower;
+            nextUpper.AsSpan(0, n).CopyTo(currentUpper);
+            nextLower.AsSpan(0, n).CopyTo(currentLower);
         }
-
-        return (currentUpper, currentLower);
     }
 
-    private double FixedPointUpdateLower(
+    private static double FixedPointUpdateLower(
         double[] lower,
         double[] upper,
         double[] timeNodes,
@@ -520,8 +775,7 @@ public sealed class CREN004A
         double tau,
         double r,
         double q,
-        double sigma,
-        bool isCall)
+        double sigma)
     {
         // Simplified lower boundary update using FP-B' modification
         double t = timeNodes[index];
@@ -563,78 +817,97 @@ public sealed class CREN004A
 
     // ========== Integration Methods ==========
 
-    private double ComputeIntegralN(
-        double[] boundary, double[] timeNodes, int index,
-        double strike, double r, double q, double sigma, bool isCall)
+    /// <summary>
+    /// N and D integrals over [t_i, t_(n-1)] by Gauss-Legendre, with the boundary at every
+    /// quadrature node evaluated in one Clenshaw pass from its Chebyshev series.
+    /// </summary>
+    private (double N, double D) ComputeIntegralsGaussLegendre(
+        double[] boundary, ReadOnlySpan<double> coefficients, double[] timeNodes, int index,
+        double tau, double r, double q, double sigma, bool isCall)
     {
         double t = timeNodes[index];
         if (index >= _chebyshevNodes - 1)
         {
-            return 0.0;
+            return (0.0, 0.0);
         }
 
-        double tMax = timeNodes[^1];
-        double B = boundary[index];
+        double end = timeNodes[_chebyshevNodes - 1];
+        if (t == end)
+        {
+            return (0.0, 0.0);
+        }
+
+        ReadOnlySpan<double> nodes = _tables.QuadratureNodes;
+        ReadOnlySpan<double> weights = _tables.QuadratureWeights;
+        int count = nodes.Length;
+        double halfWidth = (end - t) / 2.0;
+        double midPoint = (t + end) / 2.0;
 
-        Func<double, double> integrand = s =>
+        // Collocation nodes span [0, τ], so s maps to 2s/τ - 1 on the Chebyshev domain
+        Span<double> points = stackalloc double[count];
+        Span<double> interpolated = stackalloc double[count];
+        for (int j = 0; j < count; j++)
         {
-            double tau = s - t;
-            if (tau < NumericalEpsilon)
-            {
-                return 0.0;
-            }
+            double s = midPoint + (halfWidth * nodes[j]);
+            points[j] = ((2.0 * s) / tau) - 1.0;
+        }
 
-            double Bs = InterpolateBoundary(boundary, timeNodes, s);
-            double d2 = (System.Math.Log(B / Bs) + ((r - q - (0.5 * sigma * sigma)) * tau))
-                      / (sigma * System.Math.Sqrt(tau));
+        CRCH001A.EvaluateSeries(coefficients, points, interpolated);
 
-            double eta = isCall ? 1.0 : -1.0;
-            return r * System.Math.Exp(-r * tau) * CRMF001A.NormalCDF(eta * d2);
-        };
+        BoundaryIntegrand integrandN = new BoundaryIntegrand(boundary[index], r, r, q, sigma, -0.5, isCall);
+        BoundaryIntegrand integrandD = new BoundaryIntegrand(boundary[index], q, r, q, sigma, 0.5, isCall);
 
-        if (_useTanhSinh)
+        double sumN = 0.0;
+        double sumD = 0.0;
+        for (int j = 0; j < count; j++)
         {
-            return CRGQ001A.TanhSinhIntegrate(integrand, t, tMax, Tolerance);
+            double elapsed = midPoint + (halfWidth * nodes[j]) - t;
+            if (elapsed < NumericalEpsilon)
+            {
+                continue;
+            }
+
+            sumN += weights[j] * integrandN.Evaluate(elapsed, interpolated[j]);
+            sumD += weights[j] * integrandD.Evaluate(elapsed, interpolated[j]);
         }
 
-        return CRGQ001A.IntegrateWithScheme(integrand, _quadratureScheme, t, tMax);
+        return (halfWidth * sumN, halfWidth * sumD);
     }
 
-    private double ComputeIntegralD(
+    /// <summary>
+    /// N and D integrals in one tanh-sinh pass, sharing the nodes and the boundary interpolation.
+    /// </summary>
+    private (double N, double D) ComputeIntegralsTanhSinh(
         double[] boundary, double[] timeNodes, int index,
-        double strike, double r, double q, double sigma, bool isCall)
+        double r, double q, double sigma, bool isCall)
     {
         double t = timeNodes[index];
         if (index >= _chebyshevNodes - 1)
         {
-            return 0.0;
+            return (0.0, 0.0);
         }
 
-        double tMax = timeNodes[^1];
-        double B = boundary[index];
+        BoundaryIntegrand integrandN = new BoundaryIntegrand(boundary[index], r, r, q, sigma, -0.5, isCall);
+        BoundaryIntegrand integrandD = new BoundaryIntegrand(boundary[index], q, r, q, sigma, 0.5, isCall);
 
-        Func<double, double> integrand = s =>
-        {
-            double tau = s - t;
-            if (tau < NumericalEpsilon)
+        Span<double> integrals = stackalloc double[2];
+        CRGQ001A.TanhSinhIntegrate(
+            (s, values) =>
             {
-                return 0.0;
-            }
-
-            double Bs = InterpolateBoundary(boundary, timeNodes, s);
-            double d1 = (System.Math.Log(B / Bs) + ((r - q + (0.5 * sigma * sigma)) * tau))
-                      / (sigma * System.Math.Sqrt(tau));
+                double elapsed = s - t;
+                if (elapsed < NumericalEpsilon)
+                {
+                    values.Clear();
+                    return;
+                }
 
-            double eta = isCall ? 1.0 : -1.0;
-            return q * System.Math.Exp(-q * tau) * CRMF001A.NormalCDF(eta * d1);
-        };
+                double Bs = InterpolateBoundary(boundary, timeNodes, s);
+                values[0] = integrandN.Evaluate(elapsed, Bs);
+                values[1] = integrandD.Evaluate(elapsed, Bs);
+            },
+            t, timeNodes[_chebyshevNodes - 1], integrals, Tolerance);
 
-        if (_useTanhSinh)
-        {
-            return CRGQ001A.TanhSinhIntegrate(integrand, t, tMax, Tolerance);
-        }
-
-        return CRGQ001A.IntegrateWithScheme(integrand, _quadratureScheme, t, tMax);
+        return (integrals[0], integrals[1]);
     }
 
     private double IntegrateEarlyExercisePremium(
@@ -644,8 +917,120 @@ public sealed class CREN004A
         // The early exercise premium integral (Kim 1990, Andersen-Lake-Offengenden 2016):
         // For a put: EEP = ∫₀^τ [r*K*e^(-r*s)*N(-d₂(S,B(τ-s),s)) - q*S*e^(-q*s)*N(-d₁(S,B(τ-s),s))] ds
         // For a call: EEP = ∫₀^τ [q*S*e^(-q*s)*N(d₁(S,B(τ-s),s)) - r*K*e^(-r*s)*N(d₂(S,B(τ-s),s))] ds
+        PremiumIntegrand integrand = new PremiumIntegrand(
+            this, boundary, timeNodes, spot, strike, tau, r, q, sigma, isCall);
+        return Integrate(ref integrand, 0.0, tau);
+    }
 
-        Func<double, double> integrand = s =>
+    private double IntegrateDoubleBoundaryPremium(
+        double spot, double strike, double tau, double r, double q, double sigma,
+        double[] timeNodes, double[] upper, double[] lower)
+    {
+        // For double boundary, integrate the difference at both boundaries
+        DoubleBoundaryIntegrand integrand = new DoubleBoundaryIntegrand(
+            this, upper, lower, timeNodes, spot, strike, tau, r, q, sigma);
+        return Integrate(ref integrand, 0.0, tau);
+    }
+
+    /// <summary>
+    /// Integrates over [a, b] with the engine's rule without allocating on the Gauss-Legendre path.
+    /// </summary>
+    private double Integrate<TIntegrand>(ref TIntegrand integrand, double a, double b)
+        where TIntegrand : struct, ISpectralIntegrand
+    {
+        if (_useTanhSinh)
+        {
+            return CRGQ001A.TanhSinhIntegrate(integrand.Evaluate, a, b, Tolerance);
+        }
+
+        if (a == b)
+        {
+            return 0.0;
+        }
+
+        ReadOnlySpan<double> nodes = _tables.QuadratureNodes;
+        ReadOnlySpan<double> weights = _tables.QuadratureWeights;
+        double halfWidth = (b - a) / 2.0;
+        double midPoint = (a + b) / 2.0;
+
+        double sum = 0.0;
+        for (int i = 0; i < nodes.Length; i++)
+        {
+            double x = midPoint + (halfWidth * nodes[i]);
+            sum += weights[i] * integrand.Evaluate(x);
+        }
+
+        return halfWidth * sum;
+    }
+
+    private interface ISpectralIntegrand
+    {
+        public double Evaluate(double s);
+    }
+
+    /// <summary>
+    /// N (rate-weighted, d₂) and D (dividend-weighted, d₁) integrands of the FP-A equation.
+    /// </summary>
+    private readonly struct BoundaryIntegrand
+    {
+        private readonly double _b;
+        private readonly double _weightRate;
+        private readonly double _drift;
+        private readonly double _sigma;
+        private readonly double _eta;
+
+        public BoundaryIntegrand(
+            double b, double weightRate, double r, double q, double sigma, double varianceSign, bool isCall)
+        {
+            _b = b;
+            _weightRate = weightRate;
+            _drift = r - q + (varianceSign * sigma * sigma);
+            _sigma = sigma;
+            _eta = isCall ? 1.0 : -1.0;
+        }
+
+        /// <summary>
+        /// Integrand at elapsed time <paramref name="tau"/> given the interpolated boundary <paramref name="Bs"/>.
+        /// </summary>
+        public double Evaluate(double tau, double Bs)
+        {
+            double d = (System.Math.Log(_b / Bs) + (_drift * tau))
+                     / (_sigma * System.Math.Sqrt(tau));
+
+            return _weightRate * System.Math.Exp(-_weightRate * tau) * CRMF001A.NormalCDF(_eta * d);
+        }
+    }
+
+    private readonly struct PremiumIntegrand : ISpectralIntegrand
+    {
+        private readonly CREN004A _engine;
+        private readonly double[] _boundary;
+        private readonly double[] _timeNodes;
+        private readonly double _spot;
+        private readonly double _strike;
+        private readonly double _tau;
+        private readonly double _r;
+        private readonly double _q;
+        private readonly double _sigma;
+        private readonly bool _isCall;
+
+        public PremiumIntegrand(
+            CREN004A engine, double[] boundary, double[] timeNodes,
+            double spot, double strike, double tau, double r, double q, double sigma, bool isCall)
+        {
+            _engine = engine;
+            _boundary = boundary;
+            _timeNodes = timeNodes;
+            _spot = spot;
+            _strike = strike;
+            _tau = tau;
+            _r = r;
+            _q = q;
+            _sigma = sigma;
+            _isCall = isCall;
+        }
+
+        public double Evaluate(double s)
         {
             if (s < NumericalEpsilon)
             {
@@ -653,94 +1038,674 @@ public sealed class CREN004A
             }
 
             // Time remaining at evaluation point
-            double tRemaining = tau - s;
+            double tRemaining = _tau - s;
             if (tRemaining < NumericalEpsilon)
             {
                 tRemaining = NumericalEpsilon;
             }
 
             // Interpolate boundary at time (tau - s) from start
-            double Bt = InterpolateBoundary(boundary, timeNodes, tRemaining);
+            double Bt = _engine.InterpolateBoundary(_boundary, _timeNodes, tRemaining);
             if (Bt <= 0)
             {
                 return 0.0;
             }
 
             double sqrtS = System.Math.Sqrt(s);
-            double d1 = (System.Math.Log(spot / Bt) + ((r - q + (0.5 * sigma * sigma)) * s))
-                      / (sigma * sqrtS);
-            double d2 = d1 - (sigma * sqrtS);
+            double d1 = (System.Math.Log(_spot / Bt) + ((_r - _q + (0.5 * _sigma * _sigma)) * s))
+                      / (_sigma * sqrtS);
+            double d2 = d1 - (_sigma * sqrtS);
 
-            double discountR = System.Math.Exp(-r * s);
-            double discountQ = System.Math.Exp(-q * s);
+            double discountR = System.Math.Exp(-_r * s);
+            double discountQ = System.Math.Exp(-_q * s);
 
-            if (isCall)
+            if (_isCall)
             {
                 // Call: dividend income from early exercise
-                double term1 = q * spot * discountQ * CRMF001A.NormalCDF(d1);
-                double term2 = r * strike * discountR * CRMF001A.NormalCDF(d2);
-                return term1 - term2;
-            }
-            else
-            {
-                // Put: interest income from early exercise
-                double term1 = r * strike * discountR * CRMF001A.NormalCDF(-d2);
-                double term2 = q * spot * discountQ * CRMF001A.NormalCDF(-d1);
+                double term1 = _q * _spot * discountQ * CRMF001A.NormalCDF(d1);
+                double term2 = _r * _strike * discountR * CRMF001A.NormalCDF(d2);
                 return term1 - term2;
             }
-        };
 
-        if (_useTanhSinh)
-        {
-            return CRGQ001A.TanhSinhIntegrate(integrand, 0.0, tau, Tolerance);
+            // Put: interest income from early exercise
+            double putTerm1 = _r * _strike * discountR * CRMF001A.NormalCDF(-d2);
+            double putTerm2 = _q * _spot * discountQ * CRMF001A.NormalCDF(-d1);
+            return putTerm1 - putTerm2;
         }
-
-        return CRGQ001A.IntegrateWithScheme(integrand, _quadratureScheme, 0.0, tau);
     }
 
-    private double IntegrateDoubleBoundaryPremium(
-        double spot, double strike, double tau, double r, double q, double sigma, bool isCall,
-        double[] timeNodes, double[] upper, double[] lower)
+    private readonly struct DoubleBoundaryIntegrand : ISpectralIntegrand
     {
-        // For double boundary, integrate the difference at both boundaries
-        Func<double, double> integrand = t =>
+        private readonly CREN004A _engine;
+        private readonly double[] _upper;
+        private readonly double[] _lower;
+        private readonly double[] _timeNodes;
+        private readonly double _spot;
+        private readonly double _strike;
+        private readonly double _tau;
+        private readonly double _r;
+        private readonly double _q;
+        private readonly double _sigma;
+
+        public DoubleBoundaryIntegrand(
+            CREN004A engine, double[] upper, double[] lower, double[] timeNodes,
+            double spot, double strike, double tau, double r, double q, double sigma)
         {
-            double tauRemaining = tau - t;
+            _engine = engine;
+            _upper = upper;
+            _lower = lower;
+            _timeNodes = timeNodes;
+            _spot = spot;
+            _strike = strike;
+            _tau = tau;
+            _r = r;
+            _q = q;
+            _sigma = sigma;
+        }
+
+        public double Evaluate(double t)
+        {
+            double tauRemaining = _tau - t;
             if (tauRemaining < NumericalEpsilon)
             {
                 return 0.0;
             }
 
-            double Bu = InterpolateBoundary(upper, timeNodes, t);
-            double Bl = InterpolateBoundary(lower, timeNodes, t);
+            double Bu = _engine.InterpolateBoundary(_upper, _timeNodes, t);
+            double Bl = _engine.InterpolateBoundary(_lower, _timeNodes, t);
             double sqrtTau = System.Math.Sqrt(tauRemaining);
 
             // Upper boundary contribution
-            double d2u = (System.Math.Log(spot / Bu) + ((r - q - (0.5 * sigma * sigma)) * tauRemaining))
-                       / (sigma * sqrtTau);
+            double d2u = (System.Math.Log(_spot / Bu) + ((_r - _q - (0.5 * _sigma * _sigma)) * tauRemaining))
+                       / (_sigma * sqrtTau);
             // Lower boundary contribution
-            double d2l = (System.Math.Log(spot / Bl) + ((r - q - (0.5 * sigma * sigma)) * tauRemaining))
-                       / (sigma * sqrtTau);
+            double d2l = (System.Math.Log(_spot / Bl) + ((_r - _q - (0.5 * _sigma * _sigma)) * tauRemaining))
+                       / (_sigma * sqrtTau);
 
-            double termU = r * strike * System.Math.Exp(-r * tauRemaining) * CRMF001A.NormalCDF(-d2u);
-            double termL = r * strike * System.Math.Exp(-r * tauRemaining) * CRMF001A.NormalCDF(-d2l);
+            double termU = _r * _strike * System.Math.Exp(-_r * tauRemaining) * CRMF001A.NormalCDF(-d2u);
+            double termL = _r * _strike * System.Math.Exp(-_r * tauRemaining) * CRMF001A.NormalCDF(-d2l);
 
             return termL - termU;
-        };
+        }
+    }
 
-        if (_useTanhSinh)
+    // ========== Forward-Mode Greeks ==========
+
+    /// <summary>
+    /// Tangent counterpart of <see cref="SolveSingleBoundary"/>, writing <see cref="CRWS001A.DualBoundary"/>.
+    /// </summary>
+    private void SolveSingleBoundaryWithTangents(
+        CRWS001A workspace, double strike, CRAD001A tau, CRAD001A r, double q, CRAD001A sigma, bool isCall)
+    {
+        int n = _chebyshevNodes;
+        double[] timeNodes = workspace.TimeNodes;
+        CRAD001A[] boundary = workspace.DualBoundary;
+
+        _tables.MapNodes(tau.Value, timeNodes);
+
+        // The canonical seed is constant within its bucket, so it enters with zero tangents
+        Span<double> values = workspace.Boundary.AsSpan(0, n);
+        if (TrySeedFromCache(workspace, strike, tau.Value, r.Value, q, sigma.Value, isCall, values))
+        {
+            for (int i = 0; i < n; i++)
+            {
+                boundary[i] = CRAD001A.Constant(values[i]);
+            }
+        }
+        else
         {
-            return CRGQ001A.TanhSinhIntegrate(integrand, 0.0, tau, Tolerance);
+            CRAD001A bInfinity = ComputeQdPlusInitialGuess(strike, tau, r, q, sigma, isCall);
+            boundary.AsSpan(0, n).Fill(bInfinity);
         }
 
-        return CRGQ001A.IntegrateWithScheme(integrand, _quadratureScheme, 0.0, tau);
+        FixedPointIteration(boundary, workspace.DualNext, timeNodes, strike, tau, r, q, sigma, isCall);
+    }
+
+    /// <summary>Number of time nodes in the boundaries written by <see cref="TrySolveUnitBoundaryWithTangent"/>.</summary>
+    internal int NodeCount => _chebyshevNodes;
+
+    /// <summary>
+    /// Solves the unit-strike boundary at σ together with its σ-tangent ∂B/∂σ.
+    /// </summary>
+    /// <remarks>
+    /// Lets a solver that reprices one expiry at many volatilities move the boundary along
+    /// its tangent (<see cref="PriceOnUnitBoundary"/>) instead of solving it again.
+    /// </remarks>
+    /// <param name="boundary">Receives <see cref="NodeCount"/> boundary values for K = 1.</param>
+    /// <param name="sigmaTangent">Receives <see cref="NodeCount"/> values of ∂B/∂σ for K = 1.</param>
+    /// <returns>False when the inputs are in a double-boundary regime or the boundary is not usable.</returns>
+    internal bool TrySolveUnitBoundaryWithTangent(
+        double tau, double r, double q, double sigma, bool isCall, Span<double> boundary, Span<double> sigmaTangent)
+    {
+        if (tau < 1.0 / 365.0 || sigma <= 0 || ClassifyRegime(r, q, isCall) == RateRegime.DoubleBoundary)
+        {
+            return false;
+        }
+
+        CRWS001A workspace = CRWS001A.Current;
+        SolveSingleBoundaryWithTangents(
+            workspace, 1.0, CRAD001A.Constant(tau), CRAD001A.Constant(r), q, new CRAD001A(sigma, 1.0, 0.0, 0.0), isCall);
+
+        CRAD001A[] solved = workspace.DualBoundary;
+        for (int i = 0; i < _chebyshevNodes; i++)
+        {
+            if (!double.IsFinite(solved[i].Value) || solved[i].Value <= 0 || !double.IsFinite(solved[i].DSigma))
+            {
+                return false;
+            }
+
+            boundary[i] = solved[i].Value;
+            sigmaTangent[i] = solved[i].DSigma;
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Price and vega on a unit-strike boundary solved at <paramref name="boundarySigma"/>,
+    /// moved to σ along its tangent and rescaled to the strike. No boundary is solved.
+    /// </summary>
+    /// <remarks>
+    /// The boundary error is of second order in σ − <paramref name="boundarySigma"/>, and the
+    /// premium is stationary in the boundary, so the price is close to <see cref="Price"/>
+    /// near the solved σ but not equal to it.
+    /// </remarks>
+    internal (double Price, double Vega) PriceOnUnitBoundary(
+        double spot,
+        double strike,
+        double tau,
+        double r,
+        double q,
+        double sigma,
+        bool isCall,
+        ReadOnlySpan<double> boundary,
+        ReadOnlySpan<double> sigmaTangent,
+        double boundarySigma)
+    {
+        CRWS001A workspace = CRWS001A.Current;
+        double[] timeNodes = workspace.TimeNodes;
+        CRAD001A[] moved = workspace.DualBoundary;
+        _tables.MapNodes(tau, timeNodes);
+
+        double shift = sigma - boundarySigma;
+        for (int i = 0; i < _chebyshevNodes; i++)
+        {
+            moved[i] = new CRAD001A(strike * (boundary[i] + (sigmaTangent[i] * shift)), strike * sigmaTangent[i], 0.0, 0.0);
+        }
+
+        SpectralGreeks greeks = ValueWithGreeks(
+            spot, strike, CRAD001A.Constant(tau), CRAD001A.Constant(r), q, new CRAD001A(sigma, 1.0, 0.0, 0.0),
+            isCall, timeNodes, moved);
+        return (greeks.Price, greeks.Vega);
+    }
+
+    /// <summary>
+    /// Tangent counterpart of the scalar fixed-point iteration; convergence is judged on values.
+    /// </summary>
+    private void FixedPointIteration(
+        CRAD001A[] current,
+        CRAD001A[] next,
+        double[] timeNodes,
+        double strike,
+        CRAD001A tau,
+        CRAD001A r,
+        double q,
+        CRAD001A sigma,
+        bool isCall)
+    {
+        int n = _chebyshevNodes;
+        Span<double> coefficients = stackalloc double[DualComponents * (n + 1)];
+
+        for (int iter = 0; iter < _fixedPointIterations; iter++)
+        {
+            BuildDualCoefficients(current, coefficients);
+
+            for (int i = 0; i < n; i++)
+            {
+                if (tau.Value - timeNodes[i] < NumericalEpsilon)
+                {
+                    next[i] = CRAD001A.Constant(strike);
+                    continue;
+                }
+
+                next[i] = FixedPointUpdate(current, coefficients, timeNodes, i, strike, tau, r, q, sigma, isCall);
+            }
+
+            double maxChange = 0.0;
+            for (int i = 0; i < n; i++)
+            {
+                maxChange = System.Math.Max(maxChange, System.Math.Abs(next[i].Value - current[i].Value));
+            }
+
+            next.AsSpan(0, n).CopyTo(current);
+
+            if (maxChange < Tolerance * strike)
+            {
+                break;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Chebyshev series of the value and of each tangent of a dual boundary, one block of n + 1
+    /// coefficients per component.
+    /// </summary>
+    /// <remarks>
+    /// The transform is linear, so the series of the tangents are the tangents of the series.
+    /// The value block is the series the scalar iteration builds from the same values.
+    /// </remarks>
+    private void BuildDualCoefficients(CRAD001A[] boundary, Span<double> coefficients)
+    {
+        int n = _chebyshevNodes;
+        Span<double> component = stackalloc double[n];
+
+        for (int c = 0; c < DualComponents; c++)
+        {
+            for (int i = 0; i < n; i++)
+            {
+                CRAD001A b = boundary[i];
+                component[i] = c switch
+                {
+                    0 => b.Value,
+                    1 => b.DSigma,
+                    2 => b.DTau,
+                    _ => b.DRate
+                };
+            }
+
+            CRCH001A.NodeValuesToCoefficients(component, coefficients.Slice(c * (n + 1), n + 1));
+        }
+    }
+
+    private CRAD001A FixedPointUpdate(
+        CRAD001A[] boundary,
+        ReadOnlySpan<double> coefficients,
+        double[] timeNodes,
+        int index,
+        double strike,
+        CRAD001A tau,
+        CRAD001A r,
+        double q,
+        CRAD001A sigma,
+        bool isCall)
+    {
+        CRAD001A t = CRAD001A.TimePoint(timeNodes[index], tau.Value);
+        CRAD001A tauRemaining = tau - t;
+        CRAD001A B = boundary[index];
+
+        CRAD001A d1 = (CRAD001A.Log(B / strike) + ((r - q + (0.5 * sigma * sigma)) * tauRemaining))
+                    / (sigma * CRAD001A.Sqrt(tauRemaining));
+        CRAD001A d2 = d1 - (sigma * CRAD001A.Sqrt(tauRemaining));
+
+        double eta = isCall ? 1.0 : -1.0;
+
+        (CRAD001A integralN, CRAD001A integralD) = ComputeIntegrals(boundary, coefficients, timeNodes, index, tau, r, q, sigma, isCall);
+
+        CRAD001A Nd2 = CRAD001A.NormalCDF(eta * d2);
+        CRAD001A Nd1 = CRAD001A.NormalCDF(eta * d1);
+
+        CRAD001A numerator = 1.0 - (CRAD001A.Exp(-r * tauRemaining) * Nd2) - integralN;
+        CRAD001A denominator = 1.0 - (CRAD001A.Exp(-q * tauRemaining) * Nd1) - integralD;
+
+        if (System.Math.Abs(denominator.Value) < NumericalEpsilon)
+        {
+            return B;
+        }
+
+        CRAD001A newB = strike * numerator / denominator;
+
+        // A clamped node sits on a constant bound and carries no tangent
+        double lowerBound = isCall ? strike * 1.001 : strike * 0.01;
+        double upperBound = isCall ? double.PositiveInfinity : strike * 0.999;
+
+        if (newB.Value < lowerBound)
+        {
+            return CRAD001A.Constant(lowerBound);
+        }
+
+        if (newB.Value > upperBound)
+        {
+            return CRAD001A.Constant(upperBound);
+        }
+
+        return newB;
+    }
+
+    /// <summary>
+    /// Tangent counterpart of <see cref="ComputeIntegralsGaussLegendre"/>.
+    /// </summary>
+    /// <remarks>
+    /// Both integrals share their quadrature points, so the boundary interpolation, log-ratio
+    /// and square root are evaluated once per point for the pair. The boundary at the points
+    /// comes from the same Clenshaw evaluation as the scalar path, so the value part of every
+    /// iterate, and hence the price, is bit-identical to <see cref="Price"/>. The points are
+    /// fixed fractions of τ, so only the coefficients carry tangents.
+    /// </remarks>
+    private (CRAD001A IntegralN, CRAD001A IntegralD) ComputeIntegrals(
+        CRAD001A[] boundary, ReadOnlySpan<double> coefficients, double[] timeNodes, int index,
+        CRAD001A tau, CRAD001A r, double q, CRAD001A sigma, bool isCall)
+    {
+        CRAD001A zero = CRAD001A.Constant(0.0);
+        if (index >= _chebyshevNodes - 1)
+        {
+            return (zero, zero);
+        }
+
+        CRAD001A t = CRAD001A.TimePoint(timeNodes[index], tau.Value);
+        CRAD001A end = CRAD001A.TimePoint(timeNodes[_chebyshevNodes - 1], tau.Value);
+        if (t.Value == end.Value)
+        {
+            return (zero, zero);
+        }
+
+        CRAD001A driftN = r - q + (-0.5 * sigma * sigma);
+        CRAD001A driftD = r - q + (0.5 * sigma * sigma);
+        CRAD001A b = boundary[index];
+        double eta = isCall ? 1.0 : -1.0;
+
+        ReadOnlySpan<double> nodes = _tables.QuadratureNodes;
+        ReadOnlySpan<double> weights = _tables.QuadratureWeights;
+        CRAD001A halfWidth = (end - t) / 2.0;
+        CRAD001A midPoint = (t + end) / 2.0;
+
+        // Same point arithmetic as ComputeIntegralsGaussLegendre, then one Clenshaw pass per component
+        int count = nodes.Length;
+        int stride = _chebyshevNodes + 1;
+        Span<double> points = stackalloc double[count];
+        Span<double> interpolated = stackalloc double[DualComponents * count];
+        for (int j = 0; j < count; j++)
+        {
+            double s = midPoint.Value + (halfWidth.Value * nodes[j]);
+            points[j] = ((2.0 * s) / tau.Value) - 1.0;
+        }
+
+        for (int c = 0; c < DualComponents; c++)
+        {
+            CRCH001A.EvaluateSeries(coefficients.Slice(c * stride, stride), points, interpolated.Slice(c * count, count));
+        }
+
+        CRAD001A sumN = zero;
+        CRAD001A sumD = zero;
+        for (int i = 0; i < count; i++)
+        {
+            CRAD001A s = midPoint + (halfWidth * nodes[i]);
+            CRAD001A elapsed = s - t;
+            if (elapsed.Value < NumericalEpsilon)
+            {
+                continue;
+            }
+
+            CRAD001A Bs = new CRAD001A(
+                interpolated[i],
+                interpolated[count + i],
+                interpolated[(2 * count) + i],
+                interpolated[(3 * count) + i]);
+            CRAD001A logRatio = CRAD001A.Log(b / Bs);
+            CRAD001A scale = sigma * CRAD001A.Sqrt(elapsed);
+
+            CRAD001A dN = (logRatio + (driftN * elapsed)) / scale;
+            CRAD001A dD = (logRatio + (driftD * elapsed)) / scale;
+
+            sumN += weights[i] * (r * CRAD001A.Exp(-r * elapsed) * CRAD001A.NormalCDF(eta * dN));
+            sumD += weights[i] * (q * CRAD001A.Exp(-q * elapsed) * CRAD001A.NormalCDF(eta * dD));
+        }
+
+        return (halfWidth * sumN, halfWidth * sumD);
+    }
+
+    /// <summary>
+    /// European value plus early-exercise premium on the solved boundary, with Greeks.
+    /// </summary>
+    private SpectralGreeks ValueWithGreeks(
+        double spot, double strike, CRAD001A tau, CRAD001A r, double q, CRAD001A sigma, bool isCall,
+        double[] timeNodes, CRAD001A[] boundary)
+    {
+        (CRAD001A european, double europeanDelta, double europeanGamma) =
+            BlackScholesEuropean(spot, strike, tau, r, q, sigma, isCall);
+        (CRAD001A premium, double premiumDelta, double premiumGamma) =
+            IntegrateEarlyExercisePremium(spot, strike, tau, r, q, sigma, isCall, timeNodes, boundary);
+
+        CRAD001A american = european + premium;
+
+        // Below intrinsic the value is clamped to the exercise payoff
+        double intrinsic = CalculateIntrinsicValue(spot, strike, isCall ? OptionType.Call : OptionType.Put);
+        if (american.Value < intrinsic)
+        {
+            return IntrinsicGreeks(spot, strike, isCall);
+        }
+
+        return new SpectralGreeks(
+            american.Value,
+            europeanDelta + premiumDelta,
+            europeanGamma + premiumGamma,
+            -american.DTau,
+            american.DSigma,
+            american.DRate);
+    }
+
+    /// <summary>
+    /// Tangent counterpart of the scalar premium integral, with first and second spot derivatives.
+    /// </summary>
+    private (CRAD001A Premium, double Delta, double Gamma) IntegrateEarlyExercisePremium(
+        double spot, double strike, CRAD001A tau, CRAD001A r, double q, CRAD001A sigma, bool isCall,
+        double[] timeNodes, CRAD001A[] boundary)
+    {
+        ReadOnlySpan<double> nodes = _tables.QuadratureNodes;
+        ReadOnlySpan<double> weights = _tables.QuadratureWeights;
+        CRAD001A halfWidth = (tau - 0.0) / 2.0;
+        CRAD001A midPoint = (0.0 + tau) / 2.0;
+        double eta = isCall ? 1.0 : -1.0;
+
+        CRAD001A sum = CRAD001A.Constant(0.0);
+        double sumDelta = 0.0;
+        double sumGamma = 0.0;
+
+        for (int i = 0; i < nodes.Length; i++)
+        {
+            CRAD001A s = midPoint + (halfWidth * nodes[i]);
+            if (s.Value < NumericalEpsilon)
+            {
+                continue;
+            }
+
+            CRAD001A tRemaining = tau - s;
+            if (tRemaining.Value < NumericalEpsilon)
+            {
+                tRemaining = CRAD001A.Constant(NumericalEpsilon);
+            }
+
+            CRAD001A Bt = InterpolateBoundary(boundary, timeNodes, tRemaining.Value);
+            if (Bt.Value <= 0)
+            {
+                continue;
+            }
+
+            CRAD001A sqrtS = CRAD001A.Sqrt(s);
+            CRAD001A d1 = (CRAD001A.Log(spot / Bt) + ((r - q + (0.5 * sigma * sigma)) * s))
+                        / (sigma * sqrtS);
+            CRAD001A d2 = d1 - (sigma * sqrtS);
+
+            CRAD001A discountR = CRAD001A.Exp(-r * s);
+            CRAD001A discountQ = CRAD001A.Exp(-q * s);
+
+            // Same expression order as PremiumIntegrand so the value part is unchanged
+            CRAD001A f;
+            if (isCall)
+            {
+                CRAD001A term1 = q * spot * discountQ * CRAD001A.NormalCDF(d1);
+                CRAD001A term2 = r * strike * discountR * CRAD001A.NormalCDF(d2);
+                f = term1 - term2;
+            }
+            else
+            {
+                CRAD001A putTerm1 = r * strike * discountR * CRAD001A.NormalCDF(-d2);
+                CRAD001A putTerm2 = q * spot * discountQ * CRAD001A.NormalCDF(-d1);
+                f = putTerm1 - putTerm2;
+            }
+
+            // ∂d/∂S = 1/(Sσ√s) for both d₁ and d₂
+            double a = 1.0 / (spot * sigma.Value * sqrtS.Value);
+            double dividendLeg = q * spot * discountQ.Value;
+            double strikeLeg = r.Value * strike * discountR.Value;
+            double phi1 = CRMF001A.NormalPDF(d1.Value);
+            double phi2 = CRMF001A.NormalPDF(d2.Value);
+
+            double fS = (eta * q * discountQ.Value * CRMF001A.NormalCDF(eta * d1.Value))
+                      + (a * ((dividendLeg * phi1) - (strikeLeg * phi2)));
+            double fSS = (a * q * discountQ.Value * phi1)
+                       + (a * strikeLeg * phi2 / spot)
+                       - (a * a * ((dividendLeg * d1.Value * phi1) - (strikeLeg * d2.Value * phi2)));
+
+            sum += weights[i] * f;
+            sumDelta += weights[i] * fS;
+            sumGamma += weights[i] * fSS;
+        }
+
+        return (halfWidth * sum, halfWidth.Value * sumDelta, halfWidth.Value * sumGamma);
+    }
+
+    /// <summary>
+    /// Tangent counterpart of the scalar European value, with analytic delta and gamma.
+    /// </summary>
+    private static (CRAD001A Value, double Delta, double Gamma) BlackScholesEuropean(
+        double spot, double strike, CRAD001A tau, CRAD001A r, double q, CRAD001A sigma, bool isCall)
+    {
+        CRAD001A sqrtT = CRAD001A.Sqrt(tau);
+        CRAD001A d1 = (System.Math.Log(spot / strike) + ((r - q + (0.5 * sigma * sigma)) * tau)) / (sigma * sqrtT);
+        CRAD001A d2 = d1 - (sigma * sqrtT);
+
+        CRAD001A discountS = CRAD001A.Exp(-q * tau);
+        CRAD001A discountK = CRAD001A.Exp(-r * tau);
+
+        double gamma = discountS.Value * CRMF001A.NormalPDF(d1.Value) / (spot * sigma.Value * sqrtT.Value);
+
+        if (isCall)
+        {
+            CRAD001A call = (spot * discountS * CRAD001A.NormalCDF(d1)) - (strike * discountK * CRAD001A.NormalCDF(d2));
+            return (call, discountS.Value * CRMF001A.NormalCDF(d1.Value), gamma);
+        }
+
+        CRAD001A put = (strike * discountK * CRAD001A.NormalCDF(-d2)) - (spot * discountS * CRAD001A.NormalCDF(-d1));
+        return (put, -discountS.Value * CRMF001A.NormalCDF(-d1.Value), gamma);
+    }
+
+    /// <summary>
+    /// Tangent counterpart of the QD+ seed.
+    /// </summary>
+    private static CRAD001A ComputeQdPlusInitialGuess(
+        double strike, CRAD001A tau, CRAD001A r, double q, CRAD001A sigma, bool isCall)
+    {
+        CRAD001A h = 1.0 - CRAD001A.Exp(-r * tau);
+        CRAD001A sigma2 = sigma * sigma;
+
+        CRAD001A a = (2.0 * r) / sigma2;
+        CRAD001A b = (2.0 * (r - q)) / sigma2 - 1.0;
+
+        CRAD001A discriminant = (b * b) + (4.0 * a / h);
+        if (discriminant.Value < 0)
+        {
+            return CRAD001A.Constant(strike);
+        }
+
+        CRAD001A sqrtDisc = CRAD001A.Sqrt(discriminant);
+        CRAD001A lambda = isCall ? (-b + sqrtDisc) / 2.0 : (-b - sqrtDisc) / 2.0;
+
+        return isCall
+            ? strike * lambda / (lambda - 1.0)
+            : strike * lambda / (lambda + 1.0);
+    }
+
+    /// <summary>
+    /// Barycentric interpolation of a dual boundary.
+    /// </summary>
+    /// <remarks>
+    /// Every query point is a fixed fraction of τ, as are the collocation nodes, so the
+    /// Lagrange weights do not move with (σ, τ, r) and only the boundary values carry tangents.
+    /// </remarks>
+    private CRAD001A InterpolateBoundary(CRAD001A[] boundary, double[] timeNodes, double t)
+    {
+        int n = _chebyshevNodes;
+        ReadOnlySpan<double> weights = _tables.BarycentricWeights;
+
+        for (int k = 0; k < n; k++)
+        {
+            if (System.Math.Abs(t - timeNodes[k]) < NodeMatchTolerance)
+            {
+                return boundary[k];
+            }
+        }
+
+        CRAD001A numerator = CRAD001A.Constant(0.0);
+        double denominator = 0.0;
+
+        for (int k = 0; k < n; k++)
+        {
+            double term = weights[k] / (t - timeNodes[k]);
+            numerator += term * boundary[k];
+            denominator += term;
+        }
+
+        return numerator / denominator;
+    }
+
+    private static SpectralGreeks IntrinsicGreeks(double spot, double strike, bool isCall)
+    {
+        double intrinsic = CalculateIntrinsicValue(spot, strike, isCall ? OptionType.Call : OptionType.Put);
+        double delta = isCall
+            ? (spot > strike ? 1.0 : 0.0)
+            : (spot < strike ? -1.0 : 0.0);
+
+        return new SpectralGreeks(intrinsic, delta, 0.0, 0.0, 0.0, 0.0);
+    }
+
+    /// <summary>
+    /// Bump-and-reprice Greeks for the double-boundary regime.
+    /// </summary>
+    private SpectralGreeks BumpedGreeks(
+        double spot, double strike, double tau, double r, double q, double sigma, OptionType optionType)
+    {
+        double price = Price(spot, strike, tau, r, q, sigma, optionType);
+
+        double h = spot * 0.001;
+        double vUp = Price(spot + h, strike, tau, r, q, sigma, optionType);
+        double vDown = Price(spot - h, strike, tau, r, q, sigma, optionType);
+        double delta = (vUp - vDown) / (2.0 * h);
+        double gamma = (vUp - (2.0 * price) + vDown) / (h * h);
+
+        double dt = 1.0 / 365.0;
+        double theta = tau <= dt
+            ? 0.0
+            : (Price(spot, strike, tau - dt, r, q, sigma, optionType) - price) / dt;
+
+        double hSigma = sigma * 0.01;
+        double vega = (Price(spot, strike, tau, r, q, sigma + hSigma, optionType)
+                    - Price(spot, strike, tau, r, q, sigma - hSigma, optionType)) / (2.0 * hSigma);
+
+        double hRate = 0.0001;
+        double rho = (Price(spot, strike, tau, r + hRate, q, sigma, optionType)
+                   - Price(spot, strike, tau, r - hRate, q, sigma, optionType)) / (2.0 * hRate);
+
+        return new SpectralGreeks(price, delta, gamma, theta, vega, rho);
     }
 
     // ========== Helper Methods ==========
 
-    private static double InterpolateBoundary(double[] boundary, double[] timeNodes, double t)
+    private double InterpolateBoundary(double[] boundary, double[] timeNodes, double t)
+    {
+        int n = _chebyshevNodes;
+        return CRCH001A.Interpolate(
+            timeNodes.AsSpan(0, n), boundary.AsSpan(0, n), _tables.BarycentricWeights, t);
+    }
+
+    /// <summary>
+    /// Linear interpolation of values on the uniform grid t_i = iτ/(n − 1).
+    /// </summary>
+    private static double InterpolateUniform(ReadOnlySpan<double> values, double tau, double t)
     {
-        return CRCH001A.Interpolate(timeNodes, boundary, t);
+        double position = System.Math.Clamp(t / tau, 0.0, 1.0) * (values.Length - 1);
+        int i0 = System.Math.Min((int)position, values.Length - 2);
+        double w = position - i0;
+        return ((1.0 - w) * values[i0]) + (w * values[i0 + 1]);
     }
 
     private static double ComputeQdPlusInitialGuess(
@@ -840,3 +1805,20 @@ public sealed class CREN004A
         }
     }
 }
+
+/// <summary>
+/// Price and Greeks from one forward-mode pass (see <see cref="CREN004A.PriceWithGreeks"/>).
+/// </summary>
+/// <param name="Price">Option value at the spot.</param>
+/// <param name="Delta">∂V/∂S on the solved boundary.</param>
+/// <param name="Gamma">∂²V/∂S² on the solved boundary.</param>
+/// <param name="Theta">Time decay per year, −∂V/∂τ.</param>
+/// <param name="Vega">Sensitivity to a unit change in volatility.</param>
+/// <param name="Rho">Sensitivity to a unit change in the risk-free rate.</param>
+public readonly record struct SpectralGreeks(
+    double Price,
+    double Delta,
+    double Gamma,
+    double Theta,
+    double Vega,
+    double Rho);
@@ -0,0 +1,483 @@
+// CRIV001A.cs - American implied volatility for option chains
+// Component ID: CRIV001A
+//
+// Inverts American quotes on the spectral engine. Each quote is first
+// de-Americanized (the early-exercise premium is removed and the remainder
+// inverted with the European Householder solver), then polished with Newton
+// steps on a unit-strike boundary carried along its σ-tangent, and confirmed on
+// a full CREN004A solve. Quotes the Newton steps leave outside tolerance are
+// re-solved by Brent's method on the American price.
+//
+// References:
+// - Andersen, Lake & Offengenden (2016) "High Performance American Option Pricing"
+// - Burkovska et al. (2018) "Calibration to American Options: Numerical Investigation
+//   of the de-Americanization Method"
+
+using Alaris.Core.Math;
+using Alaris.Core.Options;
+
+namespace Alaris.Core.Pricing;
+
+/// <summary>
+/// Batched American implied-volatility solver.
+/// </summary>
+/// <remarks>
+/// <para>
+/// The early-exercise premium changes slowly with σ. Removing the premium evaluated at
+/// the European implied volatility leaves a European-equivalent quote, and inverting
+/// that quote lands within a few basis points of the American implied volatility.
+/// </para>
+/// <para>
+/// The premium, its vega and the Newton steps that remove the remaining error are all
+/// evaluated on one unit-strike boundary, solved with its σ-tangent at the starting σ
+/// (shared by every strike of an expiry in <see cref="ImpliedVolatilities"/>). Each step
+/// moves the previous iterate's boundary along the tangent and rescales it to the strike,
+/// so it costs one premium integral rather than a fixed-point solve. The result is then
+/// confirmed on a full <see cref="CREN004A.Price"/>, with chord Newton steps if needed. A σ
+/// is only returned once that price is within tolerance of the quote; when the Newton steps
+/// run out first, Brent's method brackets the root instead. Double-boundary regimes take
+/// the premium and vega from <see cref="CREN004A.PriceWithGreeks"/> and step on full prices.
+/// </para>
+/// <para>
+/// Every boundary is solved afresh at the scheme's fixed sweep count and depends only on
+/// the quote (or its expiry group). A <see cref="CRBC001A"/> cache only replaces the QD+
+/// seed with its bucket's canonical boundary, which depends on the bucket alone, so
+/// solving the same quote twice returns the same σ with or without one, whatever was
+/// solved in between.
+/// </para>
+/// </remarks>
+public sealed class CRIV001A
+{
+    /// <summary>Default absolute price tolerance for the Newton polish.</summary>
+    public const double DefaultTolerance = 1e-6;
+
+    /// <summary>Default maximum number of Newton steps after de-Americanization, on the tracked boundary and on full solves each.</summary>
+    public const int DefaultMaxNewtonSteps = 4;
+
+    private const double MinVolatility = 1e-3;
+    private const double MaxVolatility = 5.0;
+    private const double VolatilityPoint = 0.01;
+    private const int MaxBracketIterations = 60;
+    private const double BracketResolution = 1e-10;
+
+    private readonly CREN004A _engine;
+    private readonly double _tolerance;
+    private readonly int _maxNewtonSteps;
+
+    /// <summary>
+    /// Initializes a new American implied-volatility solver.
+    /// </summary>
+    /// <param name="scheme">Spectral scheme used for the American price.</param>
+    /// <param name="boundaryCache">Optional boundary cache to share; none is used when null.</param>
+    /// <param name="tolerance">Absolute price tolerance for the Newton polish.</param>
+    /// <param name="maxNewtonSteps">Maximum number of Newton steps per quote, on the tracked boundary and on full solves each.</param>
+    public CRIV001A(
+        SpectralScheme scheme = SpectralScheme.Accurate,
+        CRBC001A? boundaryCache = null,
+        double tolerance = DefaultTolerance,
+        int maxNewtonSteps = DefaultMaxNewtonSteps)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(tolerance);
+        ArgumentOutOfRangeException.ThrowIfNegative(maxNewtonSteps);
+
+        BoundaryCache = boundaryCache;
+        _engine = new CREN004A(scheme, BoundaryCache);
+        _tolerance = tolerance;
+        _maxNewtonSteps = maxNewtonSteps;
+    }
+
+    /// <summary>
+    /// Boundary cache shared by every solve of this instance, if any.
+    /// </summary>
+    public CRBC001A? BoundaryCache { get; }
+
+    /// <summary>
+    /// Computes the American implied volatility of a single quote.
+    /// </summary>
+    /// <returns>The implied volatility, or NaN when the quote admits none.</returns>
+    public double ImpliedVolatility(
+        double spot,
+        double strike,
+        double tau,
+        double r,
+        double q,
+        double marketPrice,
+        OptionType optionType)
+    {
+        if (!IsIdentified(spot, strike, tau, marketPrice, optionType))
+        {
+            return double.NaN;
+        }
+
+        // Within a day of expiry the engine returns intrinsic value and carries no σ information
+        double europeanGuess = CRMF001A.BSImpliedVolatility(spot, strike, tau, r, q, marketPrice, optionType == OptionType.Call);
+        if (tau < 1.0 / 365.0)
+        {
+            return europeanGuess;
+        }
+
+        double sigma = StartingVolatility(europeanGuess);
+        int n = _engine.NodeCount;
+        Span<double> boundary = stackalloc double[n];
+        Span<double> sigmaTangent = stackalloc double[n];
+        if (!_engine.TrySolveUnitBoundaryWithTangent(tau, r, q, sigma, optionType == OptionType.Call, boundary, sigmaTangent))
+        {
+            boundary = Span<double>.Empty;
+            sigmaTangent = Span<double>.Empty;
+        }
+
+        return Polish(spot, strike, tau, r, q, marketPrice, optionType, sigma, boundary, sigmaTangent, sigma);
+    }
+
+    /// <summary>
+    /// De-Americanizes a quote from <paramref name="sigma"/> and polishes it with Newton steps.
+    /// </summary>
+    /// <param name="boundary">Unit-strike boundary solved at <paramref name="boundarySigma"/>; empty in double-boundary regimes.</param>
+    /// <param name="sigmaTangent">Its σ-tangent, same length.</param>
+    private double Polish(
+        double spot,
+        double strike,
+        double tau,
+        double r,
+        double q,
+        double marketPrice,
+        OptionType optionType,
+        double sigma,
+        ReadOnlySpan<double> boundary,
+        ReadOnlySpan<double> sigmaTangent,
+        double boundarySigma)
+    {
+        bool isCall = optionType == OptionType.Call;
+        bool tracked = !boundary.IsEmpty;
+
+        // De-Americanize: strip the premium at the European guess and invert the remainder
+        (double guessPrice, double vega) = tracked
+            ? _engine.PriceOnUnitBoundary(spot, strike, tau, r, q, sigma, isCall, boundary, sigmaTangent, boundarySigma)
+            : GuessFromGreeks(_engine.PriceWithGreeks(spot, strike, tau, r, q, sigma, optionType));
+        double premium = guessPrice - CRMF001A.BSPrice(spot, strike, tau, sigma, r, q, isCall);
+
+        // A quote that moves by less than the tolerance per vol point does not pin σ
+        if (vega * VolatilityPoint < _tolerance)
+        {
+            return double.NaN;
+        }
+
+        double deAmericanized = CRMF001A.BSImpliedVolatility(spot, strike, tau, r, q, marketPrice - premium, isCall);
+        sigma = double.IsNaN(deAmericanized)
+            ? sigma - ((guessPrice - marketPrice) / vega)
+            : deAmericanized;
+        sigma = System.Math.Clamp(sigma, MinVolatility, MaxVolatility);
+
+        // Newton on the tracked boundary: each step moves the previous iterate's boundary along
+        // its σ-tangent instead of solving it again, so a step costs one premium integral
+        if (tracked)
+        {
+            for (int step = 0; step < _maxNewtonSteps; step++)
+            {
+                (double price, double slope) = _engine.PriceOnUnitBoundary(
+                    spot, strike, tau, r, q, sigma, isCall, boundary, sigmaTangent, boundarySigma);
+                double residual = price - marketPrice;
+                if (System.Math.Abs(residual) < _tolerance || slope * VolatilityPoint < _tolerance)
+                {
+                    break;
+                }
+
+                sigma = System.Math.Clamp(sigma - (residual / slope), MinVolatility, MaxVolatility);
+            }
+        }
+
+        // Confirm on the full solve. Chord Newton from there reuses the vega from the guess,
+        // since the residual left is a few basis points at most
+        for (int step = 0; step < _maxNewtonSteps; step++)
+        {
+            double residual = _engine.Price(spot, strike, tau, r, q, sigma, optionType) - marketPrice;
+            if (System.Math.Abs(residual) < _tolerance)
+            {
+                return sigma;
+            }
+
+            sigma = System.Math.Clamp(sigma - (residual / vega), MinVolatility, MaxVolatility);
+        }
+
+        double finalResidual = _engine.Price(spot, strike, tau, r, q, sigma, optionType) - marketPrice;
+        if (System.Math.Abs(finalResidual) < _tolerance)
+        {
+            return sigma;
+        }
+
+        return BracketedImpliedVolatility(spot, strike, tau, r, q, marketPrice, optionType, sigma, finalResidual);
+    }
+
+    /// <summary>
+    /// True when the quote is positive, above exercise value and so pins a σ.
+    /// </summary>
+    private bool IsIdentified(double spot, double strike, double tau, double marketPrice, OptionType optionType)
+    {
+        if (spot <= 0 || strike <= 0 || tau <= 0 || marketPrice <= 0)
+        {
+            return false;
+        }
+
+        double intrinsic = optionType == OptionType.Call
+            ? System.Math.Max(spot - strike, 0.0)
+            : System.Math.Max(strike - spot, 0.0);
+
+        // Below exercise value there is no solution; at exercise value σ is not identified
+        return marketPrice - intrinsic >= _tolerance;
+    }
+
+    private static double StartingVolatility(double europeanGuess)
+    {
+        return double.IsNaN(europeanGuess) ? 0.25 : System.Math.Clamp(europeanGuess, MinVolatility, MaxVolatility);
+    }
+
+    private static (double Price, double Vega) GuessFromGreeks(SpectralGreeks greeks)
+    {
+        return (greeks.Price, greeks.Vega);
+    }
+
+    /// <summary>
+    /// Brent's method on the American price, bracketing outward from the last Newton iterate.
+    /// </summary>
+    /// <returns>The implied volatility, or NaN when no bracket is found or Brent does not converge.</returns>
+    private double BracketedImpliedVolatility(
+        double spot,
+        double strike,
+        double tau,
+        double r,
+        double q,
+        double marketPrice,
+        OptionType optionType,
+        double sigma,
+        double residual)
+    {
+        if (double.IsNaN(residual))
+        {
+            return double.NaN;
+        }
+
+        // The price rises with σ, so double or halve away from the iterate until the sign flips.
+        // The engine is not defined at every σ up to MaxVolatility, hence no fixed outer bracket.
+        double a = sigma;
+        double fa = residual;
+        double b = sigma;
+        double fb = residual;
+
+        while (fb < 0)
+        {
+            (a, fa) = (b, fb);
+            b *= 2.0;
+            if (b > MaxVolatility)
+            {
+                return double.NaN;
+            }
+
+            fb = _engine.Price(spot, strike, tau, r, q, b, optionType) - marketPrice;
+        }
+
+        while (fa > 0)
+        {
+            (b, fb) = (a, fa);
+            a *= 0.5;
+            if (a < MinVolatility)
+            {
+                return double.NaN;
+            }
+
+            fa = _engine.Price(spot, strike, tau, r, q, a, optionType) - marketPrice;
+        }
+
+        if (double.IsNaN(fa) || double.IsNaN(fb))
+        {
+            return double.NaN;
+        }
+
+        double c = b;
+        double fc = fb;
+        double d = b - a;
+        double e = d;
+
+        for (int iter = 0; iter < MaxBracketIterations; iter++)
+        {
+            // Keep the root between b and c, with b the better estimate
+            if (fb * fc > 0)
+            {
+                c = a;
+                fc = fa;
+                d = e = b - a;
+            }
+
+            if (System.Math.Abs(fc) < System.Math.Abs(fb))
+            {
+                (a, b, c) = (b, c, b);
+                (fa, fb, fc) = (fb, fc, fb);
+            }
+
+            if (System.Math.Abs(fb) < _tolerance)
+            {
+                return b;
+            }
+
+            double half = 0.5 * (c - b);
+            if (System.Math.Abs(half) <= BracketResolution)
+            {
+                break;
+            }
+
+            if (System.Math.Abs(e) >= BracketResolution && System.Math.Abs(fa) > System.Math.Abs(fb))
+            {
+                // Secant or inverse quadratic interpolation step
+                double s = fb / fa;
+                double p;
+                double den;
+                if (a == c)
+                {
+                    p = 2.0 * half * s;
+                    den = 1.0 - s;
+                }
+                else
+                {
+                    double qa = fa / fc;
+                    double rb = fb / fc;
+                    p = s * ((2.0 * half * qa * (qa - rb)) - ((b - a) * (rb - 1.0)));
+                    den = (qa - 1.0) * (rb - 1.0) * (s - 1.0);
+                }
+
+                if (p > 0)
+                {
+                    den = -den;
+                }
+                else
+                {
+                    p = -p;
+                }
+
+                if (2.0 * p < System.Math.Min((3.0 * half * den) - System.Math.Abs(BracketResolution * den), System.Math.Abs(e * den)))
+                {
+                    e = d;
+                    d = p / den;
+                }
+                else
+                {
+                    d = half;
+                    e = d;
+                }
+            }
+            else
+            {
+                d = half;
+                e = d;
+            }
+
+            a = b;
+            fa = fb;
+            b += System.Math.Abs(d) > BracketResolution ? d : System.Math.CopySign(BracketResolution, half);
+            fb = _engine.Price(spot, strike, tau, r, q, b, optionType) - marketPrice;
+        }
+
+        return double.NaN;
+    }
+
+    /// <summary>
+    /// Computes American implied volatilities for a whole chain on one underlying.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Quotes may mix strikes, expiries and rights. Unsolvable quotes produce NaN.
+    /// </para>
+    /// <para>
+    /// As in <see cref="CREN004A.PriceChain"/>, quotes sharing an expiry and right share one
+    /// unit-strike boundary, solved once at the median of their European implied volatilities
+    /// and rescaled per strike. Each quote then costs premium integrals on that boundary plus
+    /// the full solve that confirms its σ. The median does not depend on quote order, so a
+    /// chain gives the same volatilities however it is ordered; they agree with
+    /// <see cref="ImpliedVolatility"/> to within the price tolerance.
+    /// </para>
+    /// </remarks>
+    /// <param name="spot">Underlying price.</param>
+    /// <param name="r">Risk-free rate.</param>
+    /// <param name="q">Dividend yield.</param>
+    /// <param name="strikes">Contract strikes.</param>
+    /// <param name="timesToExpiry">Contract times to expiry in years.</param>
+    /// <param name="optionTypes">Contract rights.</param>
+    /// <param name="marketPrices">Observed American prices.</param>
+    /// <param name="impliedVolatilities">Destination, same length as the inputs.</param>
+    public void ImpliedVolatilities(
+        double spot,
+        double r,
+        double q,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> timesToExpiry,
+        ReadOnlySpan<OptionType> optionTypes,
+        ReadOnlySpan<double> marketPrices,
+        Span<double> impliedVolatilities)
+    {
+        int count = strikes.Length;
+        if (timesToExpiry.Length != count || optionTypes.Length != count
+            || marketPrices.Length != count || impliedVolatilities.Length != count)
+        {
+            throw new ArgumentException("Input and output spans must have matching lengths.");
+        }
+
+        // Quotes that need no boundary are finished here; the rest start from their European guess
+        bool[] pending = new bool[count];
+        double[] starts = new double[count];
+        for (int i = 0; i < count; i++)
+        {
+            double tau = timesToExpiry[i];
+            if (tau < 1.0 / 365.0 || !IsIdentified(spot, strikes[i], tau, marketPrices[i], optionTypes[i]))
+            {
+                impliedVolatilities[i] = ImpliedVolatility(
+                    spot, strikes[i], tau, r, q, marketPrices[i], optionTypes[i]);
+                continue;
+            }
+
+            pending[i] = true;
+            starts[i] = StartingVolatility(CRMF001A.BSImpliedVolatility(
+                spot, strikes[i], tau, r, q, marketPrices[i], optionTypes[i] == OptionType.Call));
+        }
+
+        int n = _engine.NodeCount;
+        double[] boundary = new double[n];
+        double[] sigmaTangent = new double[n];
+        List<int> group = new List<int>();
+        List<double> groupStarts = new List<double>();
+
+        for (int first = 0; first < count; first++)
+        {
+            if (!pending[first])
+            {
+                continue;
+            }
+
+            double tau = timesToExpiry[first];
+            OptionType optionType = optionTypes[first];
+            group.Clear();
+            groupStarts.Clear();
+            for (int i = first; i < count; i++)
+            {
+                if (pending[i] && timesToExpiry[i] == tau && optionTypes[i] == optionType)
+                {
+                    pending[i] = false;
+                    group.Add(i);
+                    groupStarts.Add(starts[i]);
+                }
+            }
+
+            // Lower median, so the boundary is solved at one of the group's own guesses
+            groupStarts.Sort();
+            double boundarySigma = groupStarts[(groupStarts.Count - 1) / 2];
+            bool tracked = _engine.TrySolveUnitBoundaryWithTangent(
+                tau, r, q, boundarySigma, optionType == OptionType.Call, boundary, sigmaTangent);
+
+            foreach (int i in group)
+            {
+                impliedVolatilities[i] = Polish(
+                    spot, strikes[i], tau, r, q, marketPrices[i], optionType, starts[i],
+                    tracked ? boundary : ReadOnlySpan<double>.Empty,
+                    tracked ? sigmaTangent : ReadOnlySpan<double>.Empty,
+                    boundarySigma);
+            }
+        }
+    }
+}
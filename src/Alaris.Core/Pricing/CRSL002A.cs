@@ -13,14 +13,15 @@ namespace Alaris.Core.Pricing;
 /// </summary>
 public sealed class CRSL002A
 {
-    private readonly double _spot;
-    private readonly double _strike;
-    private readonly double _maturity;
-    private readonly double _rate;
-    private readonly double _dividendYield;
-    private readonly double _volatility;
-    private readonly bool _isCall;
-    private readonly int _collocationPoints;
+    private double _spot;
+    private double _strike;
+    private double _maturity;
+    private double _rate;
+    private double _dividendYield;
+    private double _volatility;
+    private bool _isCall;
+    private int _collocationPoints;
+    private CRAP001A? _qdPlus;
 
     /// <summary>
     /// Number of collocation points used for boundary refinement.
@@ -45,6 +46,29 @@ public sealed class CRSL002A
         double volatility,
         bool isCall,
         int collocationPoints = 50)
+    {
+        Reset(spot, strike, maturity, rate, dividendYield, volatility, isCall, collocationPoints);
+    }
+
+    /// <summary>
+    /// Creates a solver with no inputs, to be set by <see cref="Reset"/> before use.
+    /// </summary>
+    internal CRSL002A()
+    {
+    }
+
+    /// <summary>
+    /// Re-targets this solver at new inputs so a per-thread instance can serve every solve.
+    /// </summary>
+    internal void Reset(
+        double spot,
+        double strike,
+        double maturity,
+        double rate,
+        double dividendYield,
+        double volatility,
+        bool isCall,
+        int collocationPoints)
     {
         // Standardised bounds validation (Rule 9)
         AlgorithmBounds.ValidateDoubleBoundaryInputs(
@@ -74,59 +98,169 @@ public sealed class CRSL002A
     public (double[] Upper, double[] Lower, double CrossingTime) SolveBoundaries(
         double upperInitial, double lowerInitial)
     {
+        double[] upper = new double[_collocationPoints];
+        double[] lower = new double[_collocationPoints];
+
+        double crossingTime = SolveBoundaries(upperInitial, lowerInitial, upper, lower);
+
+        return (upper, lower, crossingTime);
+    }
+
+    /// <summary>
+    /// Solves for refined boundaries into caller-provided buffers without heap allocation.
+    /// </summary>
+    /// <param name="upperInitial">Initial upper boundary from QD+.</param>
+    /// <param name="lowerInitial">Initial lower boundary from QD+.</param>
+    /// <param name="upper">Receives the refined upper boundary (at least <see cref="CollocationPoints"/> long).</param>
+    /// <param name="lower">Receives the refined lower boundary (at least <see cref="CollocationPoints"/> long).</param>
+    /// <returns>Crossing time of the two boundaries.</returns>
+    public double SolveBoundaries(
+        double upperInitial, double lowerInitial, Span<double> upper, Span<double> lower)
+    {
+        ValidateBuffers(upper, lower);
+
         int m = _collocationPoints;
-        double[] upper = new double[m];
-        double[] lower = new double[m];
 
-        // Initialize with QD+ values as constant starting guess
-        for (int i = 0; i < m; i++)
+        // Rule 5: initial guesses come from the pool
+        double[] pooled = ArrayPool<double>.Shared.Rent(2 * m);
+
+        try
+        {
+            Span<double> upperGuess = pooled.AsSpan(0, m);
+            Span<double> lowerGuess = pooled.AsSpan(m, m);
+
+            // Initialize with QD+ values as constant starting guess
+            upperGuess.Fill(upperInitial);
+            lowerGuess.Fill(lowerInitial);
+
+            return Solve(upperGuess, lowerGuess, upper[..m], lower[..m]);
+        }
+        finally
+        {
+            ArrayPool<double>.Shared.Return(pooled);
+        }
+    }
+
+    /// <summary>
+    /// Solves for refined boundaries warm-started from whole initial boundaries.
+    /// </summary>
+    /// <remarks>
+    /// The seeds replace the constant QD+ guesses, typically with boundaries already refined
+    /// by a cheaper iteration, so the FP-B' refinement starts near its fixed point.
+    /// </remarks>
+    /// <param name="upperSeed">Initial upper boundary at t_i = iT/(m − 1), i = 0..m − 1.</param>
+    /// <param name="lowerSeed">Initial lower boundary on the same grid.</param>
+    /// <param name="upper">Receives the refined upper boundary (at least <see cref="CollocationPoints"/> long).</param>
+    /// <param name="lower">Receives the refined lower boundary (at least <see cref="CollocationPoints"/> long).</param>
+    /// <returns>Crossing time of the two boundaries.</returns>
+    public double SolveBoundaries(
+        ReadOnlySpan<double> upperSeed, ReadOnlySpan<double> lowerSeed, Span<double> upper, Span<double> lower)
+    {
+        ValidateBuffers(upper, lower);
+
+        int m = _collocationPoints;
+
+        if (upperSeed.Length < m)
+        {
+            throw new ArgumentException("Upper seed is shorter than the collocation grid", nameof(upperSeed));
+        }
+
+        if (lowerSeed.Length < m)
+        {
+            throw new ArgumentException("Lower seed is shorter than the collocation grid", nameof(lowerSeed));
+        }
+
+        // Rule 5: initial guesses come from the pool
+        double[] pooled = ArrayPool<double>.Shared.Rent(2 * m);
+
+        try
+        {
+            Span<double> upperGuess = pooled.AsSpan(0, m);
+            Span<double> lowerGuess = pooled.AsSpan(m, m);
+
+            upperSeed[..m].CopyTo(upperGuess);
+            lowerSeed[..m].CopyTo(lowerGuess);
+
+            return Solve(upperGuess, lowerGuess, upper[..m], lower[..m]);
+        }
+        finally
         {
-            upper[i] = upperInitial;
-            lower[i] = lowerInitial;
+            ArrayPool<double>.Shared.Return(pooled);
         }
+    }
 
+    private void ValidateBuffers(Span<double> upper, Span<double> lower)
+    {
+        if (upper.Length < _collocationPoints)
+        {
+            throw new ArgumentException("Upper buffer is shorter than the collocation grid", nameof(upper));
+        }
+
+        if (lower.Length < _collocationPoints)
+        {
+            throw new ArgumentException("Lower buffer is shorter than the collocation grid", nameof(lower));
+        }
+    }
+
+    /// <summary>
+    /// Crossing-time search and FP-B' refinement from initial guesses, which are adjusted in place.
+    /// </summary>
+    private double Solve(Span<double> upperGuess, Span<double> lowerGuess, Span<double> upper, Span<double> lower)
+    {
         // Find initial crossing time estimate
-        double crossingTime = FindCrossingTime(upper, lower);
+        double crossingTime = FindCrossingTime(upperGuess, lowerGuess);
 
         // Refine crossing time by subdivision (Healy p.12)
-        crossingTime = RefineCrossingTime(upper, lower, crossingTime);
+        crossingTime = RefineCrossingTime(upperGuess, lowerGuess, crossingTime);
 
         // Adjust initial guess if boundaries cross (Healy p.12 procedure)
-        AdjustCrossingInitialGuess(upper, lower, crossingTime);
+        AdjustCrossingInitialGuess(upperGuess, lowerGuess, crossingTime);
 
         // Refine using FP-B' stabilized iteration
-        (double[] refinedUpper, double[] refinedLower) = RefineUsingFpbPrime(upper, lower, crossingTime);
+        RefineUsingFpbPrime(upperGuess, lowerGuess, crossingTime, upper, lower);
 
-        return (refinedUpper, refinedLower, crossingTime);
+        return crossingTime;
     }
 
     /// <summary>
     /// Refines boundaries using FP-B' stabilized fixed point iteration (Healy Equations 33-35).
     /// Uses ArrayPool for zero-allocation iteration buffers (Rule 5: Zero-Allocation Hot Paths).
     /// </summary>
-    private (double[] Upper, double[] Lower) RefineUsingFpbPrime(
-        double[] upperInitial, double[] lowerInitial, double crossingTime)
+    private void RefineUsingFpbPrime(
+        ReadOnlySpan<double> upperInitial,
+        ReadOnlySpan<double> lowerInitial,
+        double crossingTime,
+        Span<double> upperOut,
+        Span<double> lowerOut)
     {
         int m = _collocationPoints;
 
         // Rule 13: Extract validation
         if (!ValidateInitialInputs(upperInitial, lowerInitial))
         {
-            return FallbackToQdPlusConstant(m);
+            FallbackToQdPlusConstant(upperOut, lowerOut);
+            return;
         }
 
         // Rule 5: Use ArrayPool to avoid heap allocations in hot path
-        double[] upper = ArrayPool<double>.Shared.Rent(m);
-        double[] lower = ArrayPool<double>.Shared.Rent(m);
-        double[] upperNew = ArrayPool<double>.Shared.Rent(m);
-        double[] lowerNew = ArrayPool<double>.Shared.Rent(m);
-        double[] tempUpper = ArrayPool<double>.Shared.Rent(m);
+        double[] upperBuffer = ArrayPool<double>.Shared.Rent(m);
+        double[] lowerBuffer = ArrayPool<double>.Shared.Rent(m);
+        double[] upperNewBuffer = ArrayPool<double>.Shared.Rent(m);
+        double[] lowerNewBuffer = ArrayPool<double>.Shared.Rent(m);
+        double[] tempUpperBuffer = ArrayPool<double>.Shared.Rent(m);
 
         try
         {
+            // Slice to the collocation grid: pooled arrays may be longer than m
+            Span<double> upper = upperBuffer.AsSpan(0, m);
+            Span<double> lower = lowerBuffer.AsSpan(0, m);
+            Span<double> upperNew = upperNewBuffer.AsSpan(0, m);
+            Span<double> lowerNew = lowerNewBuffer.AsSpan(0, m);
+            Span<double> tempUpper = tempUpperBuffer.AsSpan(0, m);
+
             // Copy initial values
-            Array.Copy(upperInitial, upper, m);
-            Array.Copy(lowerInitial, lower, m);
+            upperInitial.CopyTo(upper);
+            lowerInitial.CopyTo(lower);
 
             double previousMaxChange = double.MaxValue;
             int stagnationCount = 0;
@@ -136,7 +270,7 @@ public sealed class CRSL002A
                 double maxChange = 0.0;
                 double maxUpperChange = 0.0;
                 double maxLowerChange = 0.0;
-                Array.Copy(upper, tempUpper, m);
+                upper.CopyTo(tempUpper);
 
                 // FP-B' iteration (Equation 33)
                 for (int i = 0; i < m; i++)
@@ -170,19 +304,26 @@ public sealed class CRSL002A
                 // Check for early convergence on first iteration
                 if (iter == 0 && maxUpperChange < Tolerance * 10 && maxLowerChange < Tolerance * 10)
                 {
-                    // Return copies of initial (don't return pooled arrays)
-                    return ((double[])upperInitial.Clone(), (double[])lowerInitial.Clone());
+                    upperInitial.CopyTo(upperOut);
+                    lowerInitial.CopyTo(lowerOut);
+                    return;
                 }
 
                 // Rule 13: Extract stagnation check
                 if (CheckStagnation(iter, maxChange, ref previousMaxChange, ref stagnationCount))
                 {
-                    return FallbackToQdPlusConstant(m);
+                    FallbackToQdPlusConstant(upperOut, lowerOut);
+                    return;
                 }
 
                 // Swap buffers instead of allocating new arrays
-                (upper, upperNew) = (upperNew, upper);
-                (lower, lowerNew) = (lowerNew, lower);
+                Span<double> swap = upper;
+                upper = upperNew;
+                upperNew = swap;
+
+                swap = lower;
+                lower = lowerNew;
+                lowerNew = swap;
 
                 if (maxChange < Tolerance)
                 {
@@ -190,40 +331,34 @@ public sealed class CRSL002A
                 }
             }
 
-            // 1. Enforce Monotonicity (PAV Algorithm)
-            double[] upperMono = EnforceMonotonicity(upper, m, isIncreasing: false);
-            double[] lowerMono = EnforceMonotonicity(lower, m, isIncreasing: false);
+            // 1. Enforce Monotonicity (PAV Algorithm), in place
+            PoolAdjacentViolators(upper, increasing: false);
+            PoolAdjacentViolators(lower, increasing: false);
 
             // 2. Apply Smoothing (Savitzky-Golay)
-            double[] upperSmooth = SmoothBoundary(upperMono);
-            double[] lowerSmooth = SmoothBoundary(lowerMono);
+            SmoothBoundary(upper, upperOut);
+            SmoothBoundary(lower, lowerOut);
 
             // Rule 13: Extract result validation
-            if (!ValidateRefinementResult(upperSmooth, lowerSmooth, upperInitial, lowerInitial))
+            if (!ValidateRefinementResult(upperOut, lowerOut, upperInitial, lowerInitial))
             {
-                return ((double[])upperInitial.Clone(), (double[])lowerInitial.Clone());
+                upperInitial.CopyTo(upperOut);
+                lowerInitial.CopyTo(lowerOut);
             }
-
-            return (upperSmooth, lowerSmooth);
         }
         finally
         {
             // Always return pooled arrays
-            ArrayPool<double>.Shared.Return(upper);
-            ArrayPool<double>.Shared.Return(lower);
-            ArrayPool<double>.Shared.Return(upperNew);
-            ArrayPool<double>.Shared.Return(lowerNew);
-            ArrayPool<double>.Shared.Return(tempUpper);
+            ArrayPool<double>.Shared.Return(upperBuffer);
+            ArrayPool<double>.Shared.Return(lowerBuffer);
+            ArrayPool<double>.Shared.Return(upperNewBuffer);
+            ArrayPool<double>.Shared.Return(lowerNewBuffer);
+            ArrayPool<double>.Shared.Return(tempUpperBuffer);
         }
     }
 
-    private bool ValidateInitialInputs(double[] upper, double[] lower)
+    private bool ValidateInitialInputs(ReadOnlySpan<double> upper, ReadOnlySpan<double> lower)
     {
-        if (upper is null || lower is null)
-        {
-            return false;
-        }
-
         if (upper.Length < _collocationPoints || lower.Length < _collocationPoints)
         {
             return false;
@@ -240,13 +375,14 @@ public sealed class CRSL002A
         return upperReasonable && lowerReasonable && orderingCorrect;
     }
 
-    private (double[] Upper, double[] Lower) FallbackToQdPlusConstant(int m)
+    private void FallbackToQdPlusConstant(Span<double> upper, Span<double> lower)
     {
-        CRAP001A qdplus = new CRAP001A(
-            _spot, _strike, _maturity, _rate, _dividendYield, _volatility, _isCall);
-        (double qdUpper, double qdLower) = qdplus.CalculateBoundaries();
+        _qdPlus ??= new CRAP001A();
+        _qdPlus.Reset(_spot, _strike, _maturity, _rate, _dividendYield, _volatility, _isCall);
+        (double qdUpper, double qdLower) = _qdPlus.CalculateBoundaries();
 
-        return (CreateConstantArray(qdUpper, m), CreateConstantArray(qdLower, m));
+        upper.Fill(qdUpper);
+        lower.Fill(qdLower);
     }
 
     private static bool CheckStagnation(int iter, double maxChange, ref double previousMaxChange, ref int stagnationCount)
@@ -264,7 +400,8 @@ public sealed class CRSL002A
         return stagnationCount > 3;
     }
 
-    private bool ValidateRefinementResult(double[] upper, double[] lower, double[] upperInit, double[] lowerInit)
+    private bool ValidateRefinementResult(
+        ReadOnlySpan<double> upper, ReadOnlySpan<double> lower, ReadOnlySpan<double> upperInit, ReadOnlySpan<double> lowerInit)
     {
         int lastIdx = _collocationPoints - 1;
         double upperChange = System.Math.Abs(upper[lastIdx] - upperInit[lastIdx]);
@@ -286,7 +423,7 @@ public sealed class CRSL002A
         return !upperSuspicious && !lowerSuspicious;
     }
 
-    private double SolveUpperBoundaryPoint(double ti, double[] upper, double[] lower, double crossingTime)
+    private double SolveUpperBoundaryPoint(double ti, ReadOnlySpan<double> upper, ReadOnlySpan<double> lower, double crossingTime)
     {
         double Ni = CalculateNumerator(ti, upper, lower, crossingTime, isUpper: true);
         double Di = CalculateDenominator(ti, upper, lower, crossingTime, isUpper: true);
@@ -309,7 +446,7 @@ public sealed class CRSL002A
     }
 
     private double SolveLowerBoundaryPointStabilized(
-        double ti, double[] lowerOld, double[] upperNew, double crossingTime)
+        double ti, ReadOnlySpan<double> lowerOld, ReadOnlySpan<double> upperNew, double crossingTime)
     {
         double NiPrime = CalculateNumeratorPrime(ti, lowerOld, upperNew, crossingTime);
         double DiPrime = CalculateDenominatorPrime(ti, lowerOld);
@@ -371,10 +508,10 @@ public sealed class CRSL002A
                denominator < 0;
     }
 
-    private double CalculateNumerator(double ti, double[] upper, double[] lower,
+    private double CalculateNumerator(double ti, ReadOnlySpan<double> upper, ReadOnlySpan<double> lower,
         double crossingTime, bool isUpper)
     {
-        double[] boundary = isUpper ? upper : lower;
+        ReadOnlySpan<double> boundary = isUpper ? upper : lower;
         double Bi = InterpolateBoundary(boundary, ti);
 
         if (double.IsNaN(Bi) || Bi <= 0)
@@ -396,10 +533,10 @@ public sealed class CRSL002A
         return double.IsNaN(integral) ? nonIntegral : nonIntegral - integral;
     }
 
-    private double CalculateDenominator(double ti, double[] upper, double[] lower,
+    private double CalculateDenominator(double ti, ReadOnlySpan<double> upper, ReadOnlySpan<double> lower,
         double crossingTime, bool isUpper)
     {
-        double[] boundary = isUpper ? upper : lower;
+        ReadOnlySpan<double> boundary = isUpper ? upper : lower;
         double Bi = InterpolateBoundary(boundary, ti);
 
         if (double.IsNaN(Bi) || Bi <= 0)
@@ -421,7 +558,7 @@ public sealed class CRSL002A
         return double.IsNaN(integral) ? nonIntegral : nonIntegral - integral;
     }
 
-    private double CalculateNumeratorPrime(double ti, double[] lower, double[] upper, double crossingTime)
+    private double CalculateNumeratorPrime(double ti, ReadOnlySpan<double> lower, ReadOnlySpan<double> upper, double crossingTime)
     {
         double Bi = InterpolateBoundary(lower, ti);
         double N = CalculateNumerator(ti, upper, lower, crossingTime, isUpper: false);
@@ -431,7 +568,7 @@ public sealed class CRSL002A
         return double.IsNaN(integralD) ? N : N + (Bi / _strike * integralD);
     }
 
-    private double CalculateDenominatorPrime(double ti, double[] lower)
+    private double CalculateDenominatorPrime(double ti, ReadOnlySpan<double> lower)
     {
         double Bi = InterpolateBoundary(lower, ti);
         double tau = _maturity - ti;
@@ -443,7 +580,7 @@ public sealed class CRSL002A
     /// <summary>
     /// Unified integral calculation for N (r-weighted) and D (q-weighted).
     /// </summary>
-    private double CalculateIntegralTerm(double ti, double Bi, double[] upper, double[] lower,
+    private double CalculateIntegralTerm(double ti, double Bi, ReadOnlySpan<double> upper, ReadOnlySpan<double> lower,
         double crossingTime, bool isNumerator)
     {
         double tStart = System.Math.Max(ti, crossingTime);
@@ -508,7 +645,7 @@ public sealed class CRSL002A
                upper <= 0 || lower <= 0 || lower >= upper;
     }
 
-    private double FindCrossingTime(double[] upper, double[] lower)
+    private double FindCrossingTime(ReadOnlySpan<double> upper, ReadOnlySpan<double> lower)
     {
         for (int i = 1; i < _collocationPoints; i++)
         {
@@ -520,7 +657,7 @@ public sealed class CRSL002A
         return 0.0;
     }
 
-    private double RefineCrossingTime(double[] upper, double[] lower, double initialCrossing)
+    private double RefineCrossingTime(ReadOnlySpan<double> upper, ReadOnlySpan<double> lower, double initialCrossing)
     {
         if (initialCrossing <= 0 || initialCrossing >= _maturity)
         {
@@ -549,7 +686,7 @@ public sealed class CRSL002A
         return (left + right) / 2.0;
     }
 
-    private void AdjustCrossingInitialGuess(double[] upper, double[] lower, double crossingTime)
+    private void AdjustCrossingInitialGuess(Span<double> upper, Span<double> lower, double crossingTime)
     {
         if (crossingTime <= 0 || crossingTime >= _maturity)
         {
@@ -590,7 +727,7 @@ public sealed class CRSL002A
         return (upper, lower);
     }
 
-    private double InterpolateBoundary(double[] boundary, double t)
+    private double InterpolateBoundary(ReadOnlySpan<double> boundary, double t)
     {
         if (boundary.Length == 1)
         {
@@ -624,30 +761,20 @@ public sealed class CRSL002A
         return CalculateD1(S, K, tau) - (_volatility * System.Math.Sqrt(tau));
     }
 
-    private double[] EnforceMonotonicity(double[] boundary, int length, bool isIncreasing)
-    {
-        // Create properly sized array for PAV algorithm
-        double[] values = new double[length];
-        Array.Copy(boundary, values, length);
-        return PoolAdjacentViolators(values, isIncreasing);
-    }
-
     /// <summary>
-    /// Pool Adjacent Violators algorithm for isotonic regression.
-    /// Optimized to use stack-allocated spans for small arrays (Rule 5).
+    /// Pool Adjacent Violators algorithm for isotonic regression, in place.
+    /// Pool bookkeeping comes from ArrayPool (Rule 5).
     /// </summary>
-    private static double[] PoolAdjacentViolators(double[] values, bool increasing)
+    private static void PoolAdjacentViolators(Span<double> values, bool increasing)
     {
         int n = values.Length;
-        double[] result = new double[n];
-        Array.Copy(values, result, n);
 
         if (!increasing)
         {
-            Array.Reverse(result);
-            result = PoolAdjacentViolators(result, increasing: true);
-            Array.Reverse(result);
-            return result;
+            values.Reverse();
+            PoolAdjacentViolators(values, increasing: true);
+            values.Reverse();
+            return;
         }
 
         // Use fixed-size arrays instead of Lists to avoid heap allocations
@@ -660,7 +787,7 @@ public sealed class CRSL002A
         {
             for (int i = 0; i < n; i++)
             {
-                poolValues[poolCount] = result[i];
+                poolValues[poolCount] = values[i];
                 poolSizes[poolCount] = 1;
                 poolCount++;
 
@@ -677,17 +804,15 @@ public sealed class CRSL002A
                 }
             }
 
-            // Expand pools back to result array
+            // Expand pools back to the values span
             int idx = 0;
             for (int i = 0; i < poolCount; i++)
             {
                 for (int j = 0; j < poolSizes[i]; j++)
                 {
-                    result[idx++] = poolValues[i];
+                    values[idx++] = poolValues[i];
                 }
             }
-
-            return result;
         }
         finally
         {
@@ -700,16 +825,15 @@ public sealed class CRSL002A
     /// Apply Savitzky-Golay-style smoothing to reduce second-order oscillations.
     /// Uses weighted 5-point moving average for quadratic smoothing.
     /// </summary>
-    private static double[] SmoothBoundary(double[] boundary)
+    private static void SmoothBoundary(ReadOnlySpan<double> boundary, Span<double> smoothed)
     {
         int n = boundary.Length;
         if (n < 5)
         {
-            return (double[])boundary.Clone();
+            boundary.CopyTo(smoothed);
+            return;
         }
 
-        double[] smoothed = new double[n];
-
         // Savitzky-Golay weights: [-3, 12, 17, 12, -3] / 35
         const double w0 = -3.0 / 35.0;
         const double w1 = 12.0 / 35.0;
@@ -728,23 +852,8 @@ public sealed class CRSL002A
         // Edge handling (3-point smoothing)
         smoothed[0] = ((5.0 * boundary[0]) + (2.0 * boundary[1]) - boundary[2]) / 6.0;
         smoothed[1] = (boundary[0] + boundary[1] + boundary[2]) / 3.0;
-
         smoothed[n - 2] = (boundary[n - 3] + boundary[n - 2] + boundary[n - 1]) / 3.0;
         smoothed[n - 1] = (-boundary[n - 3] + (2.0 * boundary[n - 2]) + (5.0 * boundary[n - 1])) / 6.0;
-
-        return smoothed;
-    }
-
-    private static double[] CreateConstantArray(double value, int length)
-    {
-        if (length <= 0)
-        {
-            return Array.Empty<double>();
-        }
-
-        double[] result = new double[length];
-        Array.Fill(result, value);
-        return result;
     }
 
     // Use centralised CRMF001A for math utilities
@@ -0,0 +1,158 @@
+// CRWS001A.cs - Per-thread workspace and node tables for spectral pricing
+// Component ID: CRWS001A
+//
+// Holds the scratch buffers used by CREN004A so that a steady-state Price call
+// performs no heap allocation, plus the immutable Chebyshev/quadrature tables
+// shared by every engine built with the same SpectralScheme.
+//
+// References:
+// - Andersen, Lake & Offengenden (2016) "High Performance American Option Pricing"
+// - Alaris.Governance/Coding.md (Rule 5: Zero-Allocation Hot Paths)
+
+using Alaris.Core.Math;
+
+namespace Alaris.Core.Pricing;
+
+/// <summary>
+/// Immutable node and weight tables for one spectral configuration.
+/// </summary>
+/// <remarks>
+/// Every table is a view over the generated CRCH002A and CRGQ002A constant data, so
+/// building an engine allocates no node or weight arrays. Time nodes on [0, τ] are
+/// rebuilt from <see cref="NodeCosines"/> with the same arithmetic as
+/// <see cref="CRCH001A.ChebyshevNodes"/>, so tables change no prices.
+/// </remarks>
+internal sealed class SpectralTables
+{
+    private static readonly SpectralTables FastTables = new SpectralTables(8, 8);
+    private static readonly SpectralTables AccurateTables = new SpectralTables(12, 16);
+    private static readonly SpectralTables HighPrecisionTables = new SpectralTables(24, 32);
+
+    private readonly int _quadratureOrder;
+
+    private SpectralTables(int nodeCount, int quadratureOrder)
+    {
+        NodeCount = nodeCount;
+        _quadratureOrder = quadratureOrder;
+    }
+
+    /// <summary>Number of Chebyshev collocation nodes.</summary>
+    public int NodeCount { get; }
+
+    /// <summary>Chebyshev cosines, ordered so the mapped nodes ascend.</summary>
+    public ReadOnlySpan<double> NodeCosines => CRCH001A.ChebyshevCosines(NodeCount);
+
+    /// <summary>Barycentric weights for the collocation nodes.</summary>
+    public ReadOnlySpan<double> BarycentricWeights => CRCH001A.ChebyshevBarycentricWeights(NodeCount);
+
+    /// <summary>Gauss-Legendre nodes on [-1, 1].</summary>
+    public ReadOnlySpan<double> QuadratureNodes => CRGQ001A.GaussLegendreNodes(_quadratureOrder);
+
+    /// <summary>Gauss-Legendre weights on [-1, 1].</summary>
+    public ReadOnlySpan<double> QuadratureWeights => CRGQ001A.GaussLegendreWeights(_quadratureOrder);
+
+    /// <summary>
+    /// Gets the shared tables for a pre-defined scheme.
+    /// </summary>
+    public static SpectralTables For(SpectralScheme scheme)
+    {
+        return scheme switch
+        {
+            SpectralScheme.Fast => FastTables,
+            SpectralScheme.Accurate => AccurateTables,
+            SpectralScheme.HighPrecision => HighPrecisionTables,
+            _ => AccurateTables
+        };
+    }
+
+    /// <summary>
+    /// Builds tables for a custom node count, integrated with a Gauss-Legendre rule of
+    /// twice as many points (capped at 32).
+    /// </summary>
+    public static SpectralTables Create(int nodeCount)
+    {
+        ArgumentOutOfRangeException.ThrowIfLessThan(nodeCount, 1);
+        ArgumentOutOfRangeException.ThrowIfGreaterThan(nodeCount, CRWS001A.MaxNodes);
+        return new SpectralTables(nodeCount, System.Math.Min(nodeCount * 2, 32));
+    }
+
+    /// <summary>
+    /// Writes the collocation nodes on [0, τ] into <paramref name="destination"/>.
+    /// </summary>
+    public void MapNodes(double tau, Span<double> destination)
+    {
+        double mid = (0.0 + tau) / 2.0;
+        double halfWidth = (tau - 0.0) / 2.0;
+        ReadOnlySpan<double> cosines = NodeCosines;
+
+        for (int i = 0; i < cosines.Length; i++)
+        {
+            destination[i] = mid + (halfWidth * cosines[i]);
+        }
+    }
+}
+
+/// <summary>
+/// Per-thread scratch buffers for <see cref="CREN004A"/>.
+/// </summary>
+/// <remarks>
+/// Buffers are sized for <see cref="MaxNodes"/> once per thread and reused by every
+/// engine on that thread. A pricing call uses them only for its own duration and never
+/// re-enters itself, so no state leaks between calls.
+/// </remarks>
+internal sealed class CRWS001A
+{
+    /// <summary>Largest supported Chebyshev node count.</summary>
+    public const int MaxNodes = 64;
+
+    [ThreadStatic]
+    private static CRWS001A? _current;
+
+    private CRWS001A()
+    {
+    }
+
+    /// <summary>Workspace bound to the calling thread.</summary>
+    public static CRWS001A Current => _current ??= new CRWS001A();
+
+    /// <summary>
+    /// Creates a workspace bound to no thread, for a solve nested inside another on the same thread.
+    /// </summary>
+    public static CRWS001A CreateDetached() => new CRWS001A();
+
+    /// <summary>Collocation times on [0, τ].</summary>
+    internal double[] TimeNodes { get; } = new double[MaxNodes];
+
+    /// <summary>Normalized collocation times t/τ for the boundary cache.</summary>
+    internal double[] NormalizedTimes { get; } = new double[MaxNodes];
+
+    /// <summary>Current single (or upper) boundary iterate.</summary>
+    internal double[] Boundary { get; } = new double[MaxNodes];
+
+    /// <summary>Next single (or upper) boundary iterate.</summary>
+    internal double[] Next { get; } = new double[MaxNodes];
+
+    /// <summary>Strike-scaled boundary for chain pricing.</summary>
+    internal double[] Scaled { get; } = new double[MaxNodes];
+
+    /// <summary>Current lower boundary iterate.</summary>
+    internal double[] Lower { get; } = new double[MaxNodes];
+
+    /// <summary>Next lower boundary iterate.</summary>
+    internal double[] LowerNext { get; } = new double[MaxNodes];
+
+    /// <summary>Upper boundary with one node replaced, for the FP-B' lower update.</summary>
+    internal double[] TempUpper { get; } = new double[MaxNodes];
+
+    /// <summary>Boundary iterate with its (σ, τ, r) tangents, for forward-mode Greeks.</summary>
+    internal CRAD001A[] DualBoundary { get; } = new CRAD001A[MaxNodes];
+
+    /// <summary>Next boundary iterate with tangents.</summary>
+    internal CRAD001A[] DualNext { get; } = new CRAD001A[MaxNodes];
+
+    /// <summary>QD+ seed for the double-boundary solve, reset per call.</summary>
+    internal CRAP001A QdPlus { get; } = new CRAP001A();
+
+    /// <summary>Kim refinement for the double-boundary solve, reset per call.</summary>
+    internal CRSL002A Kim { get; } = new CRSL002A();
+}
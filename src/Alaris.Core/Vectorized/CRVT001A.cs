@@ -23,7 +23,7 @@ public static class CRVT001A
 
     /// <summary>
     /// Computes Black-Scholes prices for multiple options in vectorized batches.
-    /// Uses AVX2 intrinsics when available for maximum throughput.
+    /// Uses AVX-512 or AVX2 intrinsics according to <see cref="CRVT002A.ActivePath"/>.
     /// </summary>
     /// <param name="spots">Array of spot prices.</param>
     /// <param name="strikes">Array of strike prices.</param>
@@ -51,11 +51,30 @@ public static class CRVT001A
             return;
         }
 
-        // Use AVX2 accelerated path for batches of 4
-        if (CRVT002A.IsAvx2Supported && count >= 4)
+        int i = 0;
+
+        // AVX-512 path: 8 options per iteration
+        if (CRVT002A.ActivePath == SimdPath.Avx512)
+        {
+            int wideEnd = count - (count % 8);
+            for (; i < wideEnd; i += 8)
+            {
+                ComputePricesVector512(
+                    spots.Slice(i, 8),
+                    strikes.Slice(i, 8),
+                    taus.Slice(i, 8),
+                    sigmas.Slice(i, 8),
+                    r, q,
+                    isCalls.Slice(i, 8),
+                    results.Slice(i, 8));
+            }
+        }
+
+        // AVX2 path: remaining groups of 4
+        if (CRVT002A.ActivePath != SimdPath.Scalar)
         {
             int vectorEnd = count - (count % 4);
-            for (int i = 0; i < vectorEnd; i += 4)
+            for (; i < vectorEnd; i += 4)
             {
                 ComputePricesVector256(
                     spots.Slice(i, 4),
@@ -66,22 +85,13 @@ public static class CRVT001A
                     isCalls.Slice(i, 4),
                     results.Slice(i, 4));
             }
-
-            // Scalar fallback for remainder
-            for (int i = vectorEnd; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSPrice(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
-            }
         }
-        else
+
+        // Scalar remainder, or the whole batch without AVX2
+        for (; i < count; i++)
         {
-            // Scalar path for non-AVX2 or small batches
-            for (int i = 0; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSPrice(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
-            }
+            results[i] = Math.CRMF001A.BSPrice(
+                spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
         }
     }
 
@@ -167,7 +177,7 @@ public static class CRVT001A
 
     /// <summary>
     /// Computes Black-Scholes deltas for multiple options in vectorized batches.
-    /// Uses AVX2 intrinsics when available.
+    /// Uses AVX-512 or AVX2 intrinsics according to <see cref="CRVT002A.ActivePath"/>.
     /// </summary>
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     public static void ComputeDeltasBatch(
@@ -187,11 +197,30 @@ public static class CRVT001A
             return;
         }
 
-        // Use AVX2 accelerated path for batches of 4
-        if (CRVT002A.IsAvx2Supported && count >= 4)
+        int i = 0;
+
+        // AVX-512 path: 8 options per iteration
+        if (CRVT002A.ActivePath == SimdPath.Avx512)
+        {
+            int wideEnd = count - (count % 8);
+            for (; i < wideEnd; i += 8)
+            {
+                ComputeDeltasVector512(
+                    spots.Slice(i, 8),
+                    strikes.Slice(i, 8),
+                    taus.Slice(i, 8),
+                    sigmas.Slice(i, 8),
+                    r, q,
+                    isCalls.Slice(i, 8),
+                    results.Slice(i, 8));
+            }
+        }
+
+        // AVX2 path: remaining groups of 4
+        if (CRVT002A.ActivePath != SimdPath.Scalar)
         {
             int vectorEnd = count - (count % 4);
-            for (int i = 0; i < vectorEnd; i += 4)
+            for (; i < vectorEnd; i += 4)
             {
                 ComputeDeltasVector256(
                     spots.Slice(i, 4),
@@ -202,22 +231,13 @@ public static class CRVT001A
                     isCalls.Slice(i, 4),
                     results.Slice(i, 4));
             }
-
-            // Scalar fallback for remainder
-            for (int i = vectorEnd; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSDelta(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
-            }
         }
-        else
+
+        // Scalar remainder, or the whole batch without AVX2
+        for (; i < count; i++)
         {
-            // Scalar path for non-AVX2 or small batches
-            for (int i = 0; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSDelta(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
-            }
+            results[i] = Math.CRMF001A.BSDelta(
+                spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
         }
     }
 
@@ -285,7 +305,7 @@ public static class CRVT001A
 
     /// <summary>
     /// Computes Black-Scholes vegas for multiple options in vectorized batches.
-    /// Uses AVX2 intrinsics when available.
+    /// Uses AVX-512 or AVX2 intrinsics according to <see cref="CRVT002A.ActivePath"/>.
     /// </summary>
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     public static void ComputeVegasBatch(
@@ -304,11 +324,29 @@ public static class CRVT001A
             return;
         }
 
-        // Use AVX2 accelerated path for batches of 4
-        if (CRVT002A.IsAvx2Supported && count >= 4)
+        int i = 0;
+
+        // AVX-512 path: 8 options per iteration
+        if (CRVT002A.ActivePath == SimdPath.Avx512)
+        {
+            int wideEnd = count - (count % 8);
+            for (; i < wideEnd; i += 8)
+            {
+                ComputeVegasVector512(
+                    spots.Slice(i, 8),
+                    strikes.Slice(i, 8),
+                    taus.Slice(i, 8),
+                    sigmas.Slice(i, 8),
+                    r, q,
+                    results.Slice(i, 8));
+            }
+        }
+
+        // AVX2 path: remaining groups of 4
+        if (CRVT002A.ActivePath != SimdPath.Scalar)
         {
             int vectorEnd = count - (count % 4);
-            for (int i = 0; i < vectorEnd; i += 4)
+            for (; i < vectorEnd; i += 4)
             {
                 ComputeVegasVector256(
                     spots.Slice(i, 4),
@@ -318,22 +356,13 @@ public static class CRVT001A
                     r, q,
                     results.Slice(i, 4));
             }
-
-            // Scalar fallback for remainder
-            for (int i = vectorEnd; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSVega(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q);
-            }
         }
-        else
+
+        // Scalar remainder, or the whole batch without AVX2
+        for (; i < count; i++)
         {
-            // Scalar path for non-AVX2 or small batches
-            for (int i = 0; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSVega(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q);
-            }
+            results[i] = Math.CRMF001A.BSVega(
+                spots[i], strikes[i], taus[i], sigmas[i], r, q);
         }
     }
 
@@ -396,7 +425,7 @@ public static class CRVT001A
 
     /// <summary>
     /// Computes Black-Scholes gammas for multiple options in vectorized batches.
-    /// Uses AVX2 intrinsics when available.
+    /// Uses AVX-512 or AVX2 intrinsics according to <see cref="CRVT002A.ActivePath"/>.
     /// </summary>
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     public static void ComputeGammasBatch(
@@ -415,11 +444,29 @@ public static class CRVT001A
             return;
         }
 
-        // Use AVX2 accelerated path for batches of 4
-        if (CRVT002A.IsAvx2Supported && count >= 4)
+        int i = 0;
+
+        // AVX-512 path: 8 options per iteration
+        if (CRVT002A.ActivePath == SimdPath.Avx512)
+        {
+            int wideEnd = count - (count % 8);
+            for (; i < wideEnd; i += 8)
+            {
+                ComputeGammasVector512(
+                    spots.Slice(i, 8),
+                    strikes.Slice(i, 8),
+                    taus.Slice(i, 8),
+                    sigmas.Slice(i, 8),
+                    r, q,
+                    results.Slice(i, 8));
+            }
+        }
+
+        // AVX2 path: remaining groups of 4
+        if (CRVT002A.ActivePath != SimdPath.Scalar)
         {
             int vectorEnd = count - (count % 4);
-            for (int i = 0; i < vectorEnd; i += 4)
+            for (; i < vectorEnd; i += 4)
             {
                 ComputeGammasVector256(
                     spots.Slice(i, 4),
@@ -429,22 +476,13 @@ public static class CRVT001A
                     r, q,
                     results.Slice(i, 4));
             }
-
-            // Scalar fallback for remainder
-            for (int i = vectorEnd; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSGamma(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q);
-            }
         }
-        else
+
+        // Scalar remainder, or the whole batch without AVX2
+        for (; i < count; i++)
         {
-            // Scalar path
-            for (int i = 0; i < count; i++)
-            {
-                results[i] = Math.CRMF001A.BSGamma(
-                    spots[i], strikes[i], taus[i], sigmas[i], r, q);
-            }
+            results[i] = Math.CRMF001A.BSGamma(
+                spots[i], strikes[i], taus[i], sigmas[i], r, q);
         }
     }
 
@@ -506,6 +544,150 @@ public static class CRVT001A
         results[3] = gamma.GetElement(3);
     }
 
+    /// <summary>
+    /// AVX-512 price computation for 8 options.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static void ComputePricesVector512(
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        double r,
+        double q,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> results)
+    {
+        Vector512<double> S = Vector512.Create(spots);
+        Vector512<double> K = Vector512.Create(strikes);
+        Vector512<double> tau = Vector512.Create(taus);
+        Vector512<double> d1 = ComputeD1Vector512(S, K, tau, Vector512.Create(sigmas), r, q,
+            out Vector512<double> _, out Vector512<double> sigmaRootT);
+        Vector512<double> omega = CallSignVector512(isCalls);
+
+        Vector512<double> discountQ = CRVT002A.VectorExp512(Vector512.Create(-q) * tau);
+        Vector512<double> discountR = CRVT002A.VectorExp512(Vector512.Create(-r) * tau);
+
+        // ω(S e^(-qτ) N(ωd1) - K e^(-rτ) N(ωd2)) with ω = +1 for calls, -1 for puts
+        Vector512<double> Nd1 = CRVT002A.VectorNormalCDF512(omega * d1);
+        Vector512<double> Nd2 = CRVT002A.VectorNormalCDF512(omega * (d1 - sigmaRootT));
+        Vector512<double> price = omega * ((S * discountQ * Nd1) - (K * discountR * Nd2));
+
+        price.CopyTo(results);
+    }
+
+    /// <summary>
+    /// AVX-512 delta computation for 8 options.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static void ComputeDeltasVector512(
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        double r,
+        double q,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> results)
+    {
+        Vector512<double> tau = Vector512.Create(taus);
+        Vector512<double> d1 = ComputeD1Vector512(
+            Vector512.Create(spots), Vector512.Create(strikes), tau, Vector512.Create(sigmas), r, q,
+            out Vector512<double> _, out Vector512<double> _);
+        Vector512<double> omega = CallSignVector512(isCalls);
+
+        // Call delta = e^(-qτ) N(d1), put delta = -e^(-qτ) N(-d1)
+        Vector512<double> discountDiv = CRVT002A.VectorExp512(Vector512.Create(-q) * tau);
+        Vector512<double> delta = omega * discountDiv * CRVT002A.VectorNormalCDF512(omega * d1);
+
+        delta.CopyTo(results);
+    }
+
+    /// <summary>
+    /// AVX-512 vega computation for 8 options.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static void ComputeVegasVector512(
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        double r,
+        double q,
+        Span<double> results)
+    {
+        Vector512<double> S = Vector512.Create(spots);
+        Vector512<double> tau = Vector512.Create(taus);
+        Vector512<double> d1 = ComputeD1Vector512(S, Vector512.Create(strikes), tau, Vector512.Create(sigmas), r, q,
+            out Vector512<double> sqrtTau, out Vector512<double> _);
+
+        // Vega = S * e^(-qτ) * φ(d1) * √τ
+        Vector512<double> discountDiv = CRVT002A.VectorExp512(Vector512.Create(-q) * tau);
+        Vector512<double> vega = S * discountDiv * CRVT002A.VectorNormalPDF512(d1) * sqrtTau;
+
+        vega.CopyTo(results);
+    }
+
+    /// <summary>
+    /// AVX-512 gamma computation for 8 options.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static void ComputeGammasVector512(
+        ReadOnlySpan<double> spots,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        double r,
+        double q,
+        Span<double> results)
+    {
+        Vector512<double> S = Vector512.Create(spots);
+        Vector512<double> tau = Vector512.Create(taus);
+        Vector512<double> d1 = ComputeD1Vector512(S, Vector512.Create(strikes), tau, Vector512.Create(sigmas), r, q,
+            out Vector512<double> _, out Vector512<double> sigmaRootT);
+
+        // Gamma = e^(-qτ) * φ(d1) / (S * σ * √τ)
+        Vector512<double> discountDiv = CRVT002A.VectorExp512(Vector512.Create(-q) * tau);
+        Vector512<double> gamma = (discountDiv * CRVT002A.VectorNormalPDF512(d1)) / (S * sigmaRootT);
+
+        gamma.CopyTo(results);
+    }
+
+    /// <summary>
+    /// Computes d1 = (ln(S/K) + (r - q + σ²/2)τ) / (σ√τ) for 8 options.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static Vector512<double> ComputeD1Vector512(
+        Vector512<double> S,
+        Vector512<double> K,
+        Vector512<double> tau,
+        Vector512<double> sigma,
+        double r,
+        double q,
+        out Vector512<double> sqrtTau,
+        out Vector512<double> sigmaRootT)
+    {
+        sqrtTau = Vector512.Sqrt(tau);
+        sigmaRootT = sigma * sqrtTau;
+        Vector512<double> drift = (Vector512.Create(r - q) + (sigma * sigma * Vector512.Create(0.5))) * tau;
+        return (CRVT002A.VectorLog512(S / K) + drift) / sigmaRootT;
+    }
+
+    /// <summary>
+    /// Maps call/put flags to +1/-1 lanes.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static Vector512<double> CallSignVector512(ReadOnlySpan<bool> isCalls)
+    {
+        Span<double> signs = stackalloc double[8];
+        for (int i = 0; i < 8; i++)
+        {
+            signs[i] = isCalls[i] ? 1.0 : -1.0;
+        }
+
+        return Vector512.Create<double>(signs);
+    }
+
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     private static void ComputeDeltasVector(
         ReadOnlySpan<double> spots,
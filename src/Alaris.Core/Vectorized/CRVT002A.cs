@@ -7,7 +7,7 @@ using System.Runtime.Intrinsics.X86;
 namespace Alaris.Core.Vectorized;
 
 /// <summary>
-/// AVX2-accelerated transcendental functions for high-performance option pricing.
+/// AVX2/AVX-512-accelerated transcendental functions for high-performance option pricing.
 /// Component ID: CRVT002A
 /// </summary>
 /// <remarks>
@@ -15,7 +15,7 @@ namespace Alaris.Core.Vectorized;
 /// Provides hardware-intrinsic implementations of:
 /// <list type="bullet">
 ///   <item><description>VectorExp256 - Exponential (Cody-Waite reduction + polynomial)</description></item>
-///   <item><description>VectorLog256 - Natural logarithm (range reduction + Chebyshev)</description></item>
+///   <item><description>VectorLog256 - Natural logarithm (range reduction + atanh series)</description></item>
 ///   <item><description>VectorErf256 - Error function (Abramowitz-Stegun 7.1.26)</description></item>
 ///   <item><description>VectorNormalCDF256 - Standard normal CDF</description></item>
 ///   <item><description>VectorNormalPDF256 - Standard normal PDF</description></item>
@@ -26,8 +26,14 @@ namespace Alaris.Core.Vectorized;
 /// Erf maintains ≤ 1.5e-7 max error (same as scalar CRMF001A).
 /// </para>
 /// <para>
-/// Performance: 4 doubles per operation (256-bit vectors).
-/// Falls back to scalar when AVX2 is unavailable.
+/// Performance: 4 doubles per operation (256-bit vectors), or 8 with the *512 variants.
+/// Falls back to scalar when AVX2 is unavailable; the *512 variants fall back to two
+/// 256-bit halves when AVX-512F is unavailable.
+/// </para>
+/// <para>
+/// The widest usable path is chosen once, when the type is initialized, and exposed
+/// through <see cref="ActivePath"/>. The runtime knob DOTNET_EnableAVX512F=0 forces
+/// the AVX2 path on AVX-512 hardware.
 /// </para>
 /// </remarks>
 public static class CRVT002A
@@ -42,6 +48,16 @@ public static class CRVT002A
     /// </summary>
     public static bool IsFmaSupported => Fma.IsSupported;
 
+    /// <summary>
+    /// Indicates if AVX-512F is supported on this hardware.
+    /// </summary>
+    public static bool IsAvx512Supported => Avx512F.IsSupported;
+
+    /// <summary>
+    /// Widest SIMD path used by the batch kernels, selected once at startup.
+    /// </summary>
+    public static SimdPath ActivePath { get; } = SelectPath();
+
     // =========================================================================
     // Constants for vectorized computations
     // =========================================================================
@@ -51,19 +67,27 @@ public static class CRVT002A
     private static readonly Vector256<double> ExpLn2Lo = Vector256.Create(1.90821492927058770002e-10);
     private static readonly Vector256<double> ExpInvLn2 = Vector256.Create(1.44269504088896338700e+00);
     private static readonly Vector256<double> ExpMax = Vector256.Create(709.78271289338397);
-    private static readonly Vector256<double> ExpMin = Vector256.Create(-745.13321910194122);
+    // Lower clamp keeps 2^k a normal double (exp(-708) ≈ 3e-308); below it the exponent
+    // bits would wrap and the result would be garbage rather than underflow to zero
+    private static readonly Vector256<double> ExpMin = Vector256.Create(-708.0);
 
-    // Exp polynomial coefficients (minimax on [-ln2/2, ln2/2])
+    // Exp polynomial coefficients (Taylor 1/n! on [-ln2/2, ln2/2], truncation error < 1e-14)
     private static readonly Vector256<double> ExpC1 = Vector256.Create(1.0);
     private static readonly Vector256<double> ExpC2 = Vector256.Create(0.5);
     private static readonly Vector256<double> ExpC3 = Vector256.Create(1.6666666666666666e-01);
     private static readonly Vector256<double> ExpC4 = Vector256.Create(4.1666666666666664e-02);
     private static readonly Vector256<double> ExpC5 = Vector256.Create(8.3333333333333332e-03);
     private static readonly Vector256<double> ExpC6 = Vector256.Create(1.3888888888888889e-03);
+    private static readonly Vector256<double> ExpC7 = Vector256.Create(1.9841269841269841e-04);
+    private static readonly Vector256<double> ExpC8 = Vector256.Create(2.4801587301587302e-05);
+    private static readonly Vector256<double> ExpC9 = Vector256.Create(2.7557319223985893e-06);
+    private static readonly Vector256<double> ExpC10 = Vector256.Create(2.7557319223985888e-07);
+    private static readonly Vector256<double> ExpC11 = Vector256.Create(2.5052108385441720e-08);
 
     // Log constants
-    private static readonly Vector256<double> LogSqrt2 = Vector256.Create(0.7071067811865476);
+    private static readonly Vector256<double> LogSqrt2 = Vector256.Create(1.4142135623730951);
     private static readonly Vector256<double> LogLn2 = Vector256.Create(0.6931471805599453);
+    private static readonly Vector256<double> LogTwo52 = Vector256.Create(4503599627370496.0);
 
     // Erf constants (Abramowitz-Stegun 7.1.26)
     private static readonly Vector256<double> ErfA1 = Vector256.Create(0.254829592);
@@ -89,7 +113,7 @@ public static class CRVT002A
     /// <param name="x">Input vector.</param>
     /// <returns>Vector of exp(x) values.</returns>
     /// <remarks>
-    /// Uses Cody-Waite range reduction + 6th order polynomial.
+    /// Uses Cody-Waite range reduction + 11th order polynomial.
     /// Handles overflow/underflow correctly.
     /// </remarks>
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
@@ -113,10 +137,24 @@ public static class CRVT002A
         r = Avx.Subtract(r, Avx.Multiply(k, ExpLn2Lo));
 
         // Polynomial approximation of exp(r) - 1 for r in [-ln2/2, ln2/2]
-        // Using Horner's method: p = c1 + r*(c2 + r*(c3 + r*(c4 + r*(c5 + r*c6))))
-        Vector256<double> r2 = Avx.Multiply(r, r);
+        // Using Horner's method: p = c1 + r*(c2 + r*(c3 + ... + r*c11))
 
-        Vector256<double> p = ExpC6;
+        Vector256<double> p = ExpC11;
+        p = Fma.IsSupported
+            ? Fma.MultiplyAdd(p, r, ExpC10)
+            : Avx.Add(Avx.Multiply(p, r), ExpC10);
+        p = Fma.IsSupported
+            ? Fma.MultiplyAdd(p, r, ExpC9)
+            : Avx.Add(Avx.Multiply(p, r), ExpC9);
+        p = Fma.IsSupported
+            ? Fma.MultiplyAdd(p, r, ExpC8)
+            : Avx.Add(Avx.Multiply(p, r), ExpC8);
+        p = Fma.IsSupported
+            ? Fma.MultiplyAdd(p, r, ExpC7)
+            : Avx.Add(Avx.Multiply(p, r), ExpC7);
+        p = Fma.IsSupported
+            ? Fma.MultiplyAdd(p, r, ExpC6)
+            : Avx.Add(Avx.Multiply(p, r), ExpC6);
         p = Fma.IsSupported
             ? Fma.MultiplyAdd(p, r, ExpC5)
             : Avx.Add(Avx.Multiply(p, r), ExpC5);
@@ -170,13 +208,12 @@ public static class CRVT002A
         Vector256<long> xBits = x.AsInt64();
         Vector256<long> expMask = Vector256.Create(0x7FF0000000000000L);
         Vector256<long> mantMask = Vector256.Create(0x000FFFFFFFFFFFFFL);
-        Vector256<long> expBias = Vector256.Create(1023L);
 
-        // Get exponent
-        Vector256<long> expBits = Avx2.And(xBits, expMask);
-        expBits = Avx2.ShiftRightLogical(expBits, 52);
+        // Biased exponent as double: OR the 11-bit integer into the mantissa of 2^52
+        // and subtract 2^52 (AVX2 has no int64 -> double conversion)
+        Vector256<long> expBits = Avx2.ShiftRightLogical(Avx2.And(xBits, expMask), 52);
         Vector256<double> e = Avx.Subtract(
-            Avx.ConvertToVector256Double(expBits.AsInt32().GetLower()),
+            Avx.Subtract(Avx2.Or(expBits, LogTwo52.AsInt64()).AsDouble(), LogTwo52),
             Vector256.Create(1023.0));
 
         // Get mantissa in [1, 2)
@@ -185,20 +222,24 @@ public static class CRVT002A
             Vector256.Create(0x3FF0000000000000L));
         Vector256<double> m = mantBits.AsDouble();
 
-        // Reduce to [sqrt(2)/2, sqrt(2)] for better polynomial convergence
-        Vector256<double> needsAdjust = Avx.Compare(m, LogSqrt2, FloatComparisonMode.OrderedGreaterThanSignaling);
-        m = Avx.BlendVariable(Avx.Multiply(m, Half), m, needsAdjust);
-        e = Avx.BlendVariable(Avx.Add(e, One), e, needsAdjust);
+        // Reduce to [sqrt(2)/2, sqrt(2)) for better polynomial convergence
+        Vector256<double> needsAdjust = Avx.Compare(m, LogSqrt2, FloatComparisonMode.OrderedGreaterThanOrEqualNonSignaling);
+        m = Avx.BlendVariable(m, Avx.Multiply(m, Half), needsAdjust);
+        e = Avx.BlendVariable(e, Avx.Add(e, One), needsAdjust);
 
-        // Polynomial approximation of log(1 + f) where f = m - 1
-        Vector256<double> f = Avx.Subtract(m, One);
-        Vector256<double> f2 = Avx.Multiply(f, f);
+        // log(m) = 2·atanh(s) with s = (m - 1)/(m + 1), |s| ≤ 0.172:
+        // 2s·(1 + s²/3 + s⁴/5 + ... + s¹⁸/19), truncation error < 1e-16
+        Vector256<double> s = Avx.Divide(Avx.Subtract(m, One), Avx.Add(m, One));
+        Vector256<double> s2 = Avx.Multiply(s, s);
 
-        // Simple polynomial: log(1+f) ≈ f - f²/2 + f³/3 - f⁴/4 + ...
-        Vector256<double> logM = f;
-        logM = Avx.Subtract(logM, Avx.Multiply(f2, Half));
-        logM = Avx.Add(logM, Avx.Multiply(Avx.Multiply(f2, f), Vector256.Create(1.0 / 3.0)));
-        logM = Avx.Subtract(logM, Avx.Multiply(Avx.Multiply(f2, f2), Vector256.Create(0.25)));
+        Vector256<double> series = Vector256.Create(1.0 / 19.0);
+        for (int k = 17; k >= 1; k -= 2)
+        {
+            series = Fma.IsSupported
+                ? Fma.MultiplyAdd(series, s2, Vector256.Create(1.0 / k))
+                : Avx.Add(Avx.Multiply(series, s2), Vector256.Create(1.0 / k));
+        }
+        Vector256<double> logM = Avx.Multiply(Avx.Add(s, s), series);
 
         // log(x) = e * ln(2) + log(m)
         return Fma.IsSupported
@@ -294,6 +335,191 @@ public static class CRVT002A
         return Avx.Multiply(expPart, InvSqrt2Pi);
     }
 
+    // =========================================================================
+    // Vector512 variants (AVX-512F)
+    // =========================================================================
+
+    // Adding 1.5·2^52 rounds to the nearest integer and leaves it in the low mantissa bits
+    private static readonly Vector512<double> WideRoundMagic = Vector512.Create(6755399441055744.0);
+    private static readonly Vector512<double> WideTwo52 = Vector512.Create(4503599627370496.0);
+
+    // 512-bit copies of the 256-bit constants above
+    private static readonly Vector512<double> WideExpLn2Hi = Vector512.Create(ExpLn2Hi, ExpLn2Hi);
+    private static readonly Vector512<double> WideExpLn2Lo = Vector512.Create(ExpLn2Lo, ExpLn2Lo);
+    private static readonly Vector512<double> WideExpInvLn2 = Vector512.Create(ExpInvLn2, ExpInvLn2);
+    private static readonly Vector512<double> WideExpMax = Vector512.Create(ExpMax, ExpMax);
+    private static readonly Vector512<double> WideExpMin = Vector512.Create(ExpMin, ExpMin);
+    private static readonly Vector512<double> WideExpC2 = Vector512.Create(ExpC2, ExpC2);
+    private static readonly Vector512<double> WideExpC3 = Vector512.Create(ExpC3, ExpC3);
+    private static readonly Vector512<double> WideExpC4 = Vector512.Create(ExpC4, ExpC4);
+    private static readonly Vector512<double> WideExpC5 = Vector512.Create(ExpC5, ExpC5);
+    private static readonly Vector512<double> WideExpC6 = Vector512.Create(ExpC6, ExpC6);
+    private static readonly Vector512<double> WideExpC7 = Vector512.Create(ExpC7, ExpC7);
+    private static readonly Vector512<double> WideExpC8 = Vector512.Create(ExpC8, ExpC8);
+    private static readonly Vector512<double> WideExpC9 = Vector512.Create(ExpC9, ExpC9);
+    private static readonly Vector512<double> WideExpC10 = Vector512.Create(ExpC10, ExpC10);
+    private static readonly Vector512<double> WideExpC11 = Vector512.Create(ExpC11, ExpC11);
+    private static readonly Vector512<double> WideLogSqrt2 = Vector512.Create(LogSqrt2, LogSqrt2);
+    private static readonly Vector512<double> WideLogLn2 = Vector512.Create(LogLn2, LogLn2);
+    private static readonly Vector512<double> WideErfA1 = Vector512.Create(ErfA1, ErfA1);
+    private static readonly Vector512<double> WideErfA2 = Vector512.Create(ErfA2, ErfA2);
+    private static readonly Vector512<double> WideErfA3 = Vector512.Create(ErfA3, ErfA3);
+    private static readonly Vector512<double> WideErfA4 = Vector512.Create(ErfA4, ErfA4);
+    private static readonly Vector512<double> WideErfA5 = Vector512.Create(ErfA5, ErfA5);
+    private static readonly Vector512<double> WideErfP = Vector512.Create(ErfP, ErfP);
+    private static readonly Vector512<double> WideSqrt2Inv = Vector512.Create(Sqrt2Inv, Sqrt2Inv);
+    private static readonly Vector512<double> WideInvSqrt2Pi = Vector512.Create(InvSqrt2Pi, InvSqrt2Pi);
+
+    /// <summary>
+    /// Computes exp(x) for 8 doubles using AVX-512F.
+    /// </summary>
+    /// <param name="x">Input vector.</param>
+    /// <returns>Vector of exp(x) values.</returns>
+    /// <remarks>
+    /// Same Cody-Waite reduction and polynomial as <see cref="VectorExp256"/>.
+    /// </remarks>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static Vector512<double> VectorExp512(Vector512<double> x)
+    {
+        if (!Avx512F.IsSupported)
+        {
+            return Vector512.Create(VectorExp256(x.GetLower()), VectorExp256(x.GetUpper()));
+        }
+
+        x = Vector512.Max(x, WideExpMin);
+        x = Vector512.Min(x, WideExpMax);
+
+        // k = round(x / ln(2)), both as double and as integer
+        Vector512<double> shifted = Avx512F.FusedMultiplyAdd(x, WideExpInvLn2, WideRoundMagic);
+        Vector512<double> k = shifted - WideRoundMagic;
+        Vector512<long> kLong = shifted.AsInt64() - WideRoundMagic.AsInt64();
+
+        // r = x - k*ln2_hi - k*ln2_lo
+        Vector512<double> r = Avx512F.FusedMultiplyAddNegated(k, WideExpLn2Hi, x);
+        r = Avx512F.FusedMultiplyAddNegated(k, WideExpLn2Lo, r);
+
+        Vector512<double> p = WideExpC11;
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC10);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC9);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC8);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC7);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC6);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC5);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC4);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC3);
+        p = Avx512F.FusedMultiplyAdd(p, r, WideExpC2);
+        p = Avx512F.FusedMultiplyAdd(p, r, Vector512<double>.One);
+        p = Avx512F.FusedMultiplyAdd(r, p, Vector512<double>.One);
+
+        // Scale by 2^k = reinterpret((1023 + k) << 52)
+        Vector512<double> scale = Vector512.ShiftLeft(kLong + Vector512.Create(1023L), 52).AsDouble();
+        return p * scale;
+    }
+
+    /// <summary>
+    /// Computes ln(x) for 8 doubles using AVX-512F.
+    /// </summary>
+    /// <param name="x">Input vector (must be positive).</param>
+    /// <returns>Vector of ln(x) values.</returns>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static Vector512<double> VectorLog512(Vector512<double> x)
+    {
+        if (!Avx512F.IsSupported)
+        {
+            return Vector512.Create(VectorLog256(x.GetLower()), VectorLog256(x.GetUpper()));
+        }
+
+        // x = 2^e * m, m in [1, 2)
+        Vector512<long> xBits = x.AsInt64();
+        Vector512<long> expBits = Vector512.ShiftRightLogical(xBits & Vector512.Create(0x7FF0000000000000L), 52);
+        Vector512<double> e = ((expBits | WideTwo52.AsInt64()).AsDouble() - WideTwo52) - Vector512.Create(1023.0);
+        Vector512<double> m = ((xBits & Vector512.Create(0x000FFFFFFFFFFFFFL)) | Vector512.Create(0x3FF0000000000000L)).AsDouble();
+
+        // Reduce to [sqrt(2)/2, sqrt(2))
+        Vector512<double> needsAdjust = Vector512.GreaterThanOrEqual(m, WideLogSqrt2);
+        m = Vector512.ConditionalSelect(needsAdjust, m * 0.5, m);
+        e = Vector512.ConditionalSelect(needsAdjust, e + Vector512<double>.One, e);
+
+        // log(m) = 2·atanh(s), s = (m - 1)/(m + 1)
+        Vector512<double> s = (m - Vector512<double>.One) / (m + Vector512<double>.One);
+        Vector512<double> s2 = s * s;
+
+        Vector512<double> series = Vector512.Create(1.0 / 19.0);
+        for (int k = 17; k >= 1; k -= 2)
+        {
+            series = Avx512F.FusedMultiplyAdd(series, s2, Vector512.Create(1.0 / k));
+        }
+        Vector512<double> logM = (s + s) * series;
+
+        return Avx512F.FusedMultiplyAdd(e, WideLogLn2, logM);
+    }
+
+    /// <summary>
+    /// Computes erf(x) for 8 doubles using AVX-512F.
+    /// </summary>
+    /// <param name="x">Input vector.</param>
+    /// <returns>Vector of erf(x) values in [-1, 1].</returns>
+    /// <remarks>
+    /// Abramowitz-Stegun 7.1.26, as <see cref="VectorErf256"/>. Maximum error: 1.5e-7.
+    /// </remarks>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static Vector512<double> VectorErf512(Vector512<double> x)
+    {
+        if (!Avx512F.IsSupported)
+        {
+            return Vector512.Create(VectorErf256(x.GetLower()), VectorErf256(x.GetUpper()));
+        }
+
+        Vector512<double> signMask = Vector512.Create(-0.0);
+        Vector512<double> sign = x & signMask;
+        Vector512<double> absX = Vector512.AndNot(x, signMask);
+
+        // t = 1 / (1 + p*|x|)
+        Vector512<double> t = Vector512<double>.One / Avx512F.FusedMultiplyAdd(
+            WideErfP, absX, Vector512<double>.One);
+
+        Vector512<double> poly = WideErfA5;
+        poly = Avx512F.FusedMultiplyAdd(poly, t, WideErfA4);
+        poly = Avx512F.FusedMultiplyAdd(poly, t, WideErfA3);
+        poly = Avx512F.FusedMultiplyAdd(poly, t, WideErfA2);
+        poly = Avx512F.FusedMultiplyAdd(poly, t, WideErfA1);
+        poly *= t;
+
+        // erf(|x|) = 1 - poly * exp(-x²)
+        Vector512<double> result = Vector512<double>.One - (poly * VectorExp512(-(absX * absX)));
+        return result ^ sign;
+    }
+
+    /// <summary>
+    /// Computes Φ(x) = (1 + erf(x/√2))/2 for 8 doubles using AVX-512F.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static Vector512<double> VectorNormalCDF512(Vector512<double> x)
+    {
+        Vector512<double> erf = VectorErf512(x * WideSqrt2Inv);
+        return Vector512.Create(0.5) * (Vector512<double>.One + erf);
+    }
+
+    /// <summary>
+    /// Computes φ(x) = exp(-x²/2)/√(2π) for 8 doubles using AVX-512F.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static Vector512<double> VectorNormalPDF512(Vector512<double> x)
+    {
+        Vector512<double> expPart = VectorExp512(x * x * Vector512.Create(-0.5));
+        return expPart * WideInvSqrt2Pi;
+    }
+
+    private static SimdPath SelectPath()
+    {
+        if (Avx512F.IsSupported && Vector512.IsHardwareAccelerated)
+        {
+            return SimdPath.Avx512;
+        }
+
+        return Avx2.IsSupported ? SimdPath.Avx2 : SimdPath.Scalar;
+    }
+
     // =========================================================================
     // Fallback implementations for non-AVX2 hardware
     // =========================================================================
@@ -337,3 +563,18 @@ public static class CRVT002A
         return Vector256.Create(output[0], output[1], output[2], output[3]);
     }
 }
+
+/// <summary>
+/// SIMD path used by the vectorized batch kernels.
+/// </summary>
+public enum SimdPath
+{
+    /// <summary>No usable SIMD; scalar loops.</summary>
+    Scalar,
+
+    /// <summary>256-bit AVX2 lanes (4 doubles).</summary>
+    Avx2,
+
+    /// <summary>512-bit AVX-512F lanes (8 doubles).</summary>
+    Avx512
+}
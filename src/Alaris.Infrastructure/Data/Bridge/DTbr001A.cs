@@ -44,6 +44,10 @@ public sealed class AlarisDataBridge
     private static readonly JsonSerializerOptions JsonOptions =
         new JsonSerializerOptions { PropertyNameCaseInsensitive = true };
 
+    // Snapshot cache bounds; a liquid underlying's snapshot is a few megabytes at most
+    private const int SnapshotCacheMaxEntries = 64;
+    private const long SnapshotCacheMaxBytes = 512L * 1024 * 1024;
+
     /// <summary>
     /// Initializes a new instance of the <see cref="AlarisDataBridge"/> class.
     /// </summary>
@@ -66,6 +70,24 @@ public sealed class AlarisDataBridge
         _logger = logger ?? throw new ArgumentNullException(nameof(logger));
     }
 
+    /// <summary>
+    /// Gets the session's per-contract implied-volatility history, filled as chains are loaded.
+    /// </summary>
+    public DTiv001A ImpliedVolatilityHistory { get; } = new DTiv001A();
+
+    /// <summary>
+    /// Gets the cache of validated snapshots, keyed by symbol and evaluation date.
+    /// </summary>
+    /// <remarks>
+    /// Shared with the strategy's market data adapter, which invalidates it when the
+    /// evaluation date moves on.
+    /// </remarks>
+    public DTch002A<(string Symbol, DateTime EvaluationDate), MarketDataSnapshot> SnapshotCache { get; } =
+        new DTch002A<(string Symbol, DateTime EvaluationDate), MarketDataSnapshot>(
+            SnapshotCacheMaxEntries,
+            SnapshotCacheMaxBytes,
+            EstimateSnapshotBytes);
+
     /// <summary>
     /// Gets the market data provider or throws if not available.
     /// Used for operations that require live API access.
@@ -112,7 +134,11 @@ public sealed class AlarisDataBridge
     /// <param name="cancellationToken">Cancellation token.</param>
     /// <returns>Validated market data snapshot.</returns>
     /// <exception cref="InvalidOperationException">If data quality validation fails.</exception>
-    public async Task<MarketDataSnapshot> GetMarketDataSnapshotAsync(
+    /// <remarks>
+    /// Snapshots for an explicit evaluation date are served from <see cref="SnapshotCache"/>;
+    /// concurrent requests for the same symbol and date share a single build.
+    /// </remarks>
+    public Task<MarketDataSnapshot> GetMarketDataSnapshotAsync(
         string symbol,
         DateTime? evaluationDate = null,
         CancellationToken cancellationToken = default)
@@ -120,7 +146,22 @@ public sealed class AlarisDataBridge
         ArgumentException.ThrowIfNullOrWhiteSpace(symbol);
 
         // Use provided date or fall back to UTC now for live trading
-        DateTime effectiveDate = evaluationDate ?? DateTime.UtcNow;
+        if (evaluationDate is not DateTime effectiveDate)
+        {
+            return BuildMarketDataSnapshotAsync(symbol, DateTime.UtcNow, cancellationToken);
+        }
+
+        return SnapshotCache.GetOrAddAsync(
+            (symbol, effectiveDate),
+            (key, ct) => BuildMarketDataSnapshotAsync(key.Symbol, key.EvaluationDate, ct),
+            cancellationToken);
+    }
+
+    private async Task<MarketDataSnapshot> BuildMarketDataSnapshotAsync(
+        string symbol,
+        DateTime effectiveDate,
+        CancellationToken cancellationToken)
+    {
         _logger.LogInformation("Building market data snapshot for {Symbol} as of {Date:yyyy-MM-dd}", symbol, effectiveDate);
 
         try
@@ -179,36 +220,9 @@ public sealed class AlarisDataBridge
                 // Fallback to live spot price only if no historical data
                 spotPrice = await RequireMarketDataProvider().GetSpotPriceAsync(symbol, cancellationToken);
             }
-            // Get risk-free rate from cache first (backtest mode), then live API
-            decimal riskFreeRate;
-            decimal? cachedRate = GetRiskFreeRateFromCache(effectiveDate);
-            
-            if (cachedRate.HasValue && cachedRate.Value > 0)
-            {
-                riskFreeRate = cachedRate.Value;
-                _logger.LogDebug("Using cached risk-free rate {Rate:P4} for {Date:yyyy-MM-dd}", 
-                    riskFreeRate, effectiveDate);
-            }
-            else
-            {
-                // Try live API if no cache
-                try
-                {
-                    riskFreeRate = await _riskFreeRateProvider.GetCurrentRateAsync(cancellationToken);
-                    if (riskFreeRate <= 0)
-                    {
-                        riskFreeRate = 0.045m; // Fallback: typical 2024 rate
-                        _logger.LogDebug("Treasury returned 0%, using fallback rate {Rate:P4}", riskFreeRate);
-                    }
-                }
-                catch (Exception ex)
-                {
-                    _logger.LogWarning(ex, "Failed to fetch risk-free rate, using fallback");
-                    riskFreeRate = 0.045m; // Fallback: typical 2024 rate
-                }
-            }
-
+            decimal riskFreeRate = await GetRiskFreeRateAsync(effectiveDate, cancellationToken);
             decimal dividendYield = EstimateDividendYield(optionChain, spotPrice, riskFreeRate, effectiveDate);
+            ImpliedVolatilityHistory.Record(symbol, optionChain, effectiveDate, riskFreeRate, dividendYield);
 
             // Step 2: Construct snapshot
             MarketDataSnapshot snapshot = new MarketDataSnapshot
@@ -298,6 +312,96 @@ public sealed class AlarisDataBridge
         }
     }
 
+    /// <summary>
+    /// Records the option chains of an underlying for every date in a range that
+    /// <see cref="ImpliedVolatilityHistory"/> does not hold yet.
+    /// </summary>
+    /// <param name="symbol">The underlying symbol.</param>
+    /// <param name="from">First date of the range.</param>
+    /// <param name="to">Last date of the range.</param>
+    /// <param name="cancellationToken">Cancellation token.</param>
+    /// <returns>The number of days loaded.</returns>
+    /// <remarks>
+    /// Loads only the option chain and the inputs its volatilities need (rate and implied
+    /// dividend yield, at the chain's spot), not a full validated snapshot. Each day is loaded
+    /// at most once per session. A day whose chain fails to load is skipped rather than
+    /// recorded, so a later call tries it again; a chain that loads empty is recorded.
+    /// </remarks>
+    public async Task<int> LoadImpliedVolatilityHistoryAsync(
+        string symbol,
+        DateTime from,
+        DateTime to,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(symbol);
+
+        int loaded = 0;
+        for (DateTime date = to.Date; date >= from.Date; date = date.AddDays(-1))
+        {
+            if (ImpliedVolatilityHistory.HasDay(symbol, date))
+            {
+                continue;
+            }
+
+            OptionChainSnapshot chain;
+            try
+            {
+                chain = await GetOptionChainWithCacheFallbackAsync(symbol, date, cancellationToken);
+            }
+            catch (Exception ex) when (ex is not OperationCanceledException)
+            {
+                // Not recorded, so a later call retries the day
+                _logger.LogDebug(ex, "No option chain for {Symbol} @ {Date:yyyy-MM-dd} in volatility history", symbol, date);
+                continue;
+            }
+
+            decimal riskFreeRate = 0m;
+            decimal dividendYield = 0m;
+            if (chain.Contracts.Count > 0 && chain.SpotPrice > 0m)
+            {
+                riskFreeRate = await GetRiskFreeRateAsync(date, cancellationToken);
+                dividendYield = EstimateDividendYield(chain, chain.SpotPrice, riskFreeRate, date);
+            }
+
+            ImpliedVolatilityHistory.Record(symbol, chain, date, riskFreeRate, dividendYield);
+            loaded++;
+        }
+
+        return loaded;
+    }
+
+    /// <summary>
+    /// Gets the risk-free rate for a date from the session cache, then the live API.
+    /// </summary>
+    private async Task<decimal> GetRiskFreeRateAsync(DateTime effectiveDate, CancellationToken cancellationToken)
+    {
+        decimal? cachedRate = GetRiskFreeRateFromCache(effectiveDate);
+        if (cachedRate.HasValue && cachedRate.Value > 0)
+        {
+            _logger.LogDebug("Using cached risk-free rate {Rate:P4} for {Date:yyyy-MM-dd}", 
+                cachedRate.Value, effectiveDate);
+            return cachedRate.Value;
+        }
+
+        // Try live API if no cache
+        try
+        {
+            decimal riskFreeRate = await _riskFreeRateProvider.GetCurrentRateAsync(cancellationToken);
+            if (riskFreeRate <= 0)
+            {
+                riskFreeRate = 0.045m; // Fallback: typical 2024 rate
+                _logger.LogDebug("Treasury returned 0%, using fallback rate {Rate:P4}", riskFreeRate);
+            }
+
+            return riskFreeRate;
+        }
+        catch (Exception ex)
+        {
+            _logger.LogWarning(ex, "Failed to fetch risk-free rate, using fallback");
+            return 0.045m; // Fallback: typical 2024 rate
+        }
+    }
+
     private decimal EstimateDividendYield(
         OptionChainSnapshot optionChain,
         decimal spotPrice,
@@ -368,6 +472,22 @@ public sealed class AlarisDataBridge
         return 0m;
     }
 
+    /// <summary>
+    /// Estimates the retained size of a snapshot from its collection counts.
+    /// </summary>
+    private static long EstimateSnapshotBytes(MarketDataSnapshot snapshot)
+    {
+        const long OverheadBytes = 1024;
+        const long ContractBytes = 256;
+        const long BarBytes = 96;
+        const long EarningsBytes = 64;
+
+        return OverheadBytes
+            + (snapshot.OptionChain.Contracts.Count * ContractBytes)
+            + (snapshot.HistoricalBars.Count * BarBytes)
+            + (snapshot.HistoricalEarnings.Count * EarningsBytes);
+    }
+
     private static Dictionary<DateTime, List<OptionContract>> BuildContractsByExpiration(
         IReadOnlyList<OptionContract> contracts,
         DateTime effectiveDate)
@@ -0,0 +1,292 @@
+// DTch002A.cs - Bounded LRU cache with single-flight loading
+
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace Alaris.Infrastructure.Data;
+
+/// <summary>
+/// Least-recently-used cache bounded by entry count and estimated size, with single-flight loading.
+/// Component ID: DTch002A
+/// </summary>
+/// <typeparam name="TKey">Cache key.</typeparam>
+/// <typeparam name="TValue">Cached value.</typeparam>
+/// <remarks>
+/// <para>
+/// Holds whole objects that are expensive to build (decoded and validated market data
+/// snapshots) for as long as they are used. An entry is evicted when the cache holds too
+/// many entries or too many estimated bytes, least recently used first.
+/// </para>
+/// <para>
+/// Concurrent requests for a key that is still loading share that one load instead of
+/// starting their own; they also share its outcome, including a failure or a
+/// cancellation of the first caller's token. Failures are not cached.
+/// </para>
+/// <para>
+/// <see cref="Invalidate"/> drops entries and abandons in-flight loads whose key matches,
+/// so a value loaded for an outdated key is returned to its callers but never cached.
+/// </para>
+/// </remarks>
+public sealed class DTch002A<TKey, TValue>
+    where TKey : notnull
+{
+    private readonly object _gate = new object();
+    private readonly Dictionary<TKey, LinkedListNode<Entry>> _entries = new Dictionary<TKey, LinkedListNode<Entry>>();
+    private readonly LinkedList<Entry> _recency = new LinkedList<Entry>();
+    private readonly Dictionary<TKey, Task<TValue>> _loading = new Dictionary<TKey, Task<TValue>>();
+    private readonly Func<TValue, long> _weigher;
+    private readonly int _maxEntries;
+    private readonly long _maxWeight;
+    private long _weight;
+    private long _hits;
+    private long _misses;
+    private long _coalesced;
+    private long _evictions;
+
+    /// <summary>
+    /// Initializes a new cache.
+    /// </summary>
+    /// <param name="maxEntries">Maximum number of cached values.</param>
+    /// <param name="maxWeight">Maximum total estimated size of the cached values, in bytes.</param>
+    /// <param name="weigher">Estimates the size of a value in bytes.</param>
+    public DTch002A(int maxEntries, long maxWeight, Func<TValue, long> weigher)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxEntries);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxWeight);
+        _weigher = weigher ?? throw new ArgumentNullException(nameof(weigher));
+        _maxEntries = maxEntries;
+        _maxWeight = maxWeight;
+    }
+
+    /// <summary>Lookups served from a cached value.</summary>
+    public long Hits => Interlocked.Read(ref _hits);
+
+    /// <summary>Lookups that started a load.</summary>
+    public long Misses => Interlocked.Read(ref _misses);
+
+    /// <summary>Lookups that joined a load already in flight.</summary>
+    public long Coalesced => Interlocked.Read(ref _coalesced);
+
+    /// <summary>Values evicted to respect the entry or size bound.</summary>
+    public long Evictions => Interlocked.Read(ref _evictions);
+
+    /// <summary>Number of cached values.</summary>
+    public int Count
+    {
+        get
+        {
+            lock (_gate)
+            {
+                return _entries.Count;
+            }
+        }
+    }
+
+    /// <summary>Total estimated size of the cached values, in bytes.</summary>
+    public long Weight
+    {
+        get
+        {
+            lock (_gate)
+            {
+                return _weight;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Gets a cached value, or loads it once however many callers ask concurrently.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="factory">Loads the value for a key that is neither cached nor loading.</param>
+    /// <param name="cancellationToken">Cancels this caller's wait, and the load if this caller started it.</param>
+    /// <returns>The cached or loaded value.</returns>
+    public async Task<TValue> GetOrAddAsync(
+        TKey key,
+        Func<TKey, CancellationToken, Task<TValue>> factory,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentNullException.ThrowIfNull(factory);
+
+        TaskCompletionSource<TValue>? completion = null;
+        Task<TValue>? pending;
+        lock (_gate)
+        {
+            if (_entries.TryGetValue(key, out LinkedListNode<Entry>? node))
+            {
+                _recency.Remove(node);
+                _recency.AddFirst(node);
+                Interlocked.Increment(ref _hits);
+                return node.Value.Value;
+            }
+
+            if (_loading.TryGetValue(key, out pending))
+            {
+                Interlocked.Increment(ref _coalesced);
+            }
+            else
+            {
+                completion = new TaskCompletionSource<TValue>(TaskCreationOptions.RunContinuationsAsynchronously);
+                _loading.Add(key, completion.Task);
+                Interlocked.Increment(ref _misses);
+            }
+        }
+
+        if (completion is null)
+        {
+            return await pending!.WaitAsync(cancellationToken).ConfigureAwait(false);
+        }
+
+        return await LoadAsync(key, factory, completion, cancellationToken).ConfigureAwait(false);
+    }
+
+    /// <summary>
+    /// Drops cached values and abandons in-flight loads whose key matches a predicate.
+    /// </summary>
+    /// <param name="predicate">Selects the keys to invalidate.</param>
+    /// <returns>The number of cached values dropped.</returns>
+    public int Invalidate(Func<TKey, bool> predicate)
+    {
+        ArgumentNullException.ThrowIfNull(predicate);
+
+        lock (_gate)
+        {
+            int removed = 0;
+            LinkedListNode<Entry>? node = _recency.First;
+            while (node != null)
+            {
+                LinkedListNode<Entry>? next = node.Next;
+                if (predicate(node.Value.Key))
+                {
+                    RemoveNode(node);
+                    removed++;
+                }
+
+                node = next;
+            }
+
+            List<TKey>? abandoned = null;
+            foreach (TKey key in _loading.Keys)
+            {
+                if (predicate(key))
+                {
+                    (abandoned ??= new List<TKey>()).Add(key);
+                }
+            }
+
+            if (abandoned != null)
+            {
+                foreach (TKey key in abandoned)
+                {
+                    _loading.Remove(key);
+                }
+            }
+
+            return removed;
+        }
+    }
+
+    /// <summary>
+    /// Removes all values and resets the counters.
+    /// </summary>
+    public void Clear()
+    {
+        lock (_gate)
+        {
+            _entries.Clear();
+            _recency.Clear();
+            _loading.Clear();
+            _weight = 0;
+        }
+
+        Interlocked.Exchange(ref _hits, 0);
+        Interlocked.Exchange(ref _misses, 0);
+        Interlocked.Exchange(ref _coalesced, 0);
+        Interlocked.Exchange(ref _evictions, 0);
+    }
+
+    private async Task<TValue> LoadAsync(
+        TKey key,
+        Func<TKey, CancellationToken, Task<TValue>> factory,
+        TaskCompletionSource<TValue> completion,
+        CancellationToken cancellationToken)
+    {
+        TValue value;
+        try
+        {
+            value = await factory(key, cancellationToken).ConfigureAwait(false);
+        }
+        catch (Exception ex)
+        {
+            lock (_gate)
+            {
+                RemoveLoading(key, completion.Task);
+            }
+
+            if (ex is OperationCanceledException canceled)
+            {
+                completion.TrySetCanceled(canceled.CancellationToken);
+            }
+            else
+            {
+                completion.TrySetException(ex);
+            }
+
+            throw;
+        }
+
+        lock (_gate)
+        {
+            // A load abandoned by Invalidate is handed to its callers but not cached
+            if (RemoveLoading(key, completion.Task))
+            {
+                Insert(key, value);
+            }
+        }
+
+        completion.TrySetResult(value);
+        return value;
+    }
+
+    private bool RemoveLoading(TKey key, Task<TValue> task)
+    {
+        if (_loading.TryGetValue(key, out Task<TValue>? current) && ReferenceEquals(current, task))
+        {
+            _loading.Remove(key);
+            return true;
+        }
+
+        return false;
+    }
+
+    private void Insert(TKey key, TValue value)
+    {
+        long weight = Math.Max(0L, _weigher(value));
+        if (_entries.TryGetValue(key, out LinkedListNode<Entry>? existing))
+        {
+            RemoveNode(existing);
+        }
+
+        LinkedListNode<Entry> node = _recency.AddFirst(new Entry(key, value, weight));
+        _entries.Add(key, node);
+        _weight += weight;
+
+        // Always keep the newest value, even one heavier than the whole budget
+        while (_recency.Count > 1 && (_recency.Count > _maxEntries || _weight > _maxWeight))
+        {
+            RemoveNode(_recency.Last!);
+            Interlocked.Increment(ref _evictions);
+        }
+    }
+
+    private void RemoveNode(LinkedListNode<Entry> node)
+    {
+        _recency.Remove(node);
+        _entries.Remove(node.Value.Key);
+        _weight -= node.Value.Weight;
+    }
+
+    private sealed record Entry(TKey Key, TValue Value, long Weight);
+}
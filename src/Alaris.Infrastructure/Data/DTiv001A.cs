@@ -0,0 +1,279 @@
+// DTiv001A.cs - Session-scoped implied-volatility history per option contract
+
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using Alaris.Infrastructure.Data.Model;
+
+namespace Alaris.Infrastructure.Data;
+
+/// <summary>
+/// Session-scoped implied-volatility time series, keyed by option contract.
+/// Component ID: DTiv001A
+/// </summary>
+/// <remarks>
+/// <para>
+/// Every option chain the data bridge loads is recorded once, contract by contract, so
+/// the volatility history of a spread leg is a single range query rather than one
+/// market data snapshot per look-back day.
+/// </para>
+/// <para>
+/// Each observation keeps the vendor implied volatility when the chain carries one, and
+/// otherwise the mid price together with the day's spot, rate and dividend yield, so the
+/// caller can solve it once and store the result with <see cref="SetImpliedVolatility"/>.
+/// </para>
+/// <para>
+/// Recording and queries are safe to run concurrently. Series are kept sorted by date;
+/// <see cref="Evict"/> drops days that have left every look-back window.
+/// </para>
+/// </remarks>
+public sealed class DTiv001A
+{
+    private readonly ConcurrentDictionary<IvSeriesKey, Series> _series = new ConcurrentDictionary<IvSeriesKey, Series>();
+    private readonly ConcurrentDictionary<(string Underlying, DateTime Date), IvDayContext> _days =
+        new ConcurrentDictionary<(string Underlying, DateTime Date), IvDayContext>();
+
+    /// <summary>
+    /// Gets the number of contract series currently held.
+    /// </summary>
+    public int SeriesCount => _series.Count;
+
+    /// <summary>
+    /// Returns whether the chain of an underlying has been recorded for a date.
+    /// </summary>
+    /// <param name="underlying">The underlying symbol.</param>
+    /// <param name="date">The observation date.</param>
+    public bool HasDay(string underlying, DateTime date)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(underlying);
+        return _days.ContainsKey((underlying, date.Date));
+    }
+
+    /// <summary>
+    /// Gets the spot, rate and dividend yield an underlying's chain was recorded with.
+    /// </summary>
+    /// <param name="underlying">The underlying symbol.</param>
+    /// <param name="date">The observation date.</param>
+    /// <param name="context">The recorded day context.</param>
+    /// <returns>True if the day has been recorded.</returns>
+    public bool TryGetDay(string underlying, DateTime date, out IvDayContext context)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(underlying);
+        return _days.TryGetValue((underlying, date.Date), out context);
+    }
+
+    /// <summary>
+    /// Records every contract of an option chain as observed on a date.
+    /// </summary>
+    /// <param name="underlying">The underlying symbol the chain was requested for.</param>
+    /// <param name="chain">The option chain.</param>
+    /// <param name="date">The observation date (the date the chain was requested for).</param>
+    /// <param name="riskFreeRate">Risk-free rate on that date.</param>
+    /// <param name="dividendYield">Dividend yield on that date.</param>
+    /// <remarks>
+    /// Recording the same underlying and date again replaces the earlier observations.
+    /// An empty chain still marks the day as recorded, so it is not loaded again.
+    /// </remarks>
+    public void Record(string underlying, OptionChainSnapshot chain, DateTime date, decimal riskFreeRate, decimal dividendYield)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(underlying);
+        ArgumentNullException.ThrowIfNull(chain);
+        DateTime day = date.Date;
+
+        foreach (OptionContract contract in chain.Contracts)
+        {
+            IvSeriesKey key = new IvSeriesKey(underlying, contract.Expiration.Date, contract.Strike, contract.Right);
+            double vendorIv = contract.ImpliedVolatility is decimal iv && iv > 0m ? (double)iv : double.NaN;
+            IvObservation observation = new IvObservation(day, vendorIv, vendorIv > 0.0, contract.Mid);
+
+            _series.GetOrAdd(key, static _ => new Series()).Upsert(observation);
+        }
+
+        _days[(underlying, day)] = new IvDayContext(chain.SpotPrice, riskFreeRate, dividendYield);
+    }
+
+    /// <summary>
+    /// Copies the observations of one contract between two dates, inclusive, in date order.
+    /// </summary>
+    /// <param name="key">The contract.</param>
+    /// <param name="from">First date of the range.</param>
+    /// <param name="to">Last date of the range.</param>
+    /// <param name="destination">Receives the observations; it is not cleared first.</param>
+    /// <returns>The number of observations copied.</returns>
+    public int GetRange(IvSeriesKey key, DateTime from, DateTime to, List<IvObservation> destination)
+    {
+        ArgumentNullException.ThrowIfNull(destination);
+        if (!_series.TryGetValue(key, out Series? series))
+        {
+            return 0;
+        }
+
+        return series.CopyRange(from.Date, to.Date, destination);
+    }
+
+    /// <summary>
+    /// Stores an implied volatility the caller solved for an observation without a vendor value.
+    /// </summary>
+    /// <param name="key">The contract.</param>
+    /// <param name="date">The observation date.</param>
+    /// <param name="impliedVolatility">The solved volatility, or NaN if it could not be solved.</param>
+    /// <returns>True if the observation exists and was updated.</returns>
+    public bool SetImpliedVolatility(IvSeriesKey key, DateTime date, double impliedVolatility)
+    {
+        return _series.TryGetValue(key, out Series? series)
+            && series.SetImpliedVolatility(date.Date, impliedVolatility);
+    }
+
+    /// <summary>
+    /// Drops every observation dated before a cutoff.
+    /// </summary>
+    /// <param name="before">The first date to keep.</param>
+    public void Evict(DateTime before)
+    {
+        DateTime cutoff = before.Date;
+        foreach (KeyValuePair<IvSeriesKey, Series> entry in _series)
+        {
+            if (entry.Key.Expiry < cutoff || entry.Value.RemoveBefore(cutoff) == 0)
+            {
+                _series.TryRemove(entry.Key, out _);
+            }
+        }
+
+        foreach ((string Underlying, DateTime Date) day in _days.Keys)
+        {
+            if (day.Date < cutoff)
+            {
+                _days.TryRemove(day, out _);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Date-sorted observations of one contract.
+    /// </summary>
+    private sealed class Series
+    {
+        private readonly List<IvObservation> _observations = new List<IvObservation>();
+
+        public void Upsert(IvObservation observation)
+        {
+            lock (_observations)
+            {
+                int index = FindIndex(observation.Date);
+                if (index >= 0)
+                {
+                    _observations[index] = observation;
+                }
+                else
+                {
+                    _observations.Insert(~index, observation);
+                }
+            }
+        }
+
+        public int CopyRange(DateTime from, DateTime to, List<IvObservation> destination)
+        {
+            lock (_observations)
+            {
+                int index = FindIndex(from);
+                if (index < 0)
+                {
+                    index = ~index;
+                }
+
+                int copied = 0;
+                for (; index < _observations.Count && _observations[index].Date <= to; index++)
+                {
+                    destination.Add(_observations[index]);
+                    copied++;
+                }
+
+                return copied;
+            }
+        }
+
+        public bool SetImpliedVolatility(DateTime date, double impliedVolatility)
+        {
+            lock (_observations)
+            {
+                int index = FindIndex(date);
+                if (index < 0)
+                {
+                    return false;
+                }
+
+                _observations[index] = _observations[index] with
+                {
+                    ImpliedVolatility = impliedVolatility,
+                    IsResolved = true
+                };
+                return true;
+            }
+        }
+
+        public int RemoveBefore(DateTime cutoff)
+        {
+            lock (_observations)
+            {
+                int index = FindIndex(cutoff);
+                _observations.RemoveRange(0, index >= 0 ? index : ~index);
+                return _observations.Count;
+            }
+        }
+
+        private int FindIndex(DateTime date)
+        {
+            int lo = 0;
+            int hi = _observations.Count - 1;
+            while (lo <= hi)
+            {
+                int mid = lo + ((hi - lo) >> 1);
+                int comparison = _observations[mid].Date.CompareTo(date);
+                if (comparison == 0)
+                {
+                    return mid;
+                }
+
+                if (comparison < 0)
+                {
+                    lo = mid + 1;
+                }
+                else
+                {
+                    hi = mid - 1;
+                }
+            }
+
+            return ~lo;
+        }
+    }
+}
+
+/// <summary>
+/// Identifies one option contract's implied-volatility series.
+/// </summary>
+/// <param name="Underlying">The underlying symbol.</param>
+/// <param name="Expiry">The expiration date.</param>
+/// <param name="Strike">The strike price.</param>
+/// <param name="Right">Call or put.</param>
+public readonly record struct IvSeriesKey(string Underlying, DateTime Expiry, decimal Strike, OptionRight Right);
+
+/// <summary>
+/// One day's observation of an option contract.
+/// </summary>
+/// <param name="Date">The observation date.</param>
+/// <param name="ImpliedVolatility">Implied volatility, or NaN if none is known.</param>
+/// <param name="IsResolved">
+/// True once <see cref="ImpliedVolatility"/> is final: a vendor value, or one the caller solved
+/// (NaN then means it could not be solved).
+/// </param>
+/// <param name="Mid">Mid price, for solving the volatility when the vendor supplied none.</param>
+public readonly record struct IvObservation(DateTime Date, double ImpliedVolatility, bool IsResolved, decimal Mid);
+
+/// <summary>
+/// Market inputs an underlying's chain was recorded with.
+/// </summary>
+/// <param name="SpotPrice">Spot price of the chain.</param>
+/// <param name="RiskFreeRate">Risk-free rate.</param>
+/// <param name="DividendYield">Dividend yield.</param>
+public readonly record struct IvDayContext(decimal SpotPrice, decimal RiskFreeRate, decimal DividendYield);
@@ -311,7 +311,7 @@ public sealed class PolygonApiClient : DTpr003A, IDisposable
                 contractsToFetch.Count);
 
             // 3. Fetch daily bars for each contract - WITH PARALLELISM and LIMITS
-            ConcurrentBag<OptionContract> contracts = new ConcurrentBag<OptionContract>();
+            ConcurrentBag<ContractBar> contractBars = new ConcurrentBag<ContractBar>();
             int subscriptionLimitHit = 0;
             
             // Use semaphore to limit concurrent requests (Polygon rate limits apply)
@@ -358,33 +358,9 @@ public sealed class PolygonApiClient : DTpr003A, IDisposable
                     // Use the most recent bar (last in array) as the price reference
                     PolygonBar bar = aggResponse.Results[^1];
                     
-                    // Parse contract details from OCC ticker format
+                    // Parse contract details from OCC ticker format; IVs are solved for the whole chain below
                     (string underlying, decimal strike, DateTime expiration, OptionRight right) = ParseOptionTicker(refContract.Ticker);
-                    
-                    // Calculate IV using CRMF001A Black-Scholes solver (industry standard for backtesting)
-                    double riskFreeRate = 0.05;
-                    double timeToExpiry = (expiration - effectiveDate).TotalDays / 365.25;
-                    double impliedVol = CRMF001A.BSImpliedVolatility(
-                        (double)spotPrice, (double)strike, timeToExpiry, riskFreeRate, 0.0,
-                        (double)bar.Close, right == OptionRight.Call);
-                    
-                    OptionContract contract = new OptionContract
-                    {
-                        OptionSymbol = refContract.Ticker,
-                        UnderlyingSymbol = underlying,
-                        Strike = strike,
-                        Expiration = expiration,
-                        Right = right,
-                        Bid = Math.Max(0, bar.Close - 0.10m),
-                        Ask = bar.Close + 0.10m,
-                        Last = bar.Close,
-                        Volume = (long)bar.Volume,
-                        OpenInterest = (long)bar.Volume,
-                        ImpliedVolatility = !double.IsNaN(impliedVol) && impliedVol > 0 ? (decimal)impliedVol : null,
-                        Timestamp = DateTimeOffset.FromUnixTimeMilliseconds(bar.Timestamp).DateTime
-                    };
-                    
-                    contracts.Add(contract);
+                    contractBars.Add(new ContractBar(refContract.Ticker, underlying, strike, expiration, right, bar));
                 }
                 catch (OperationCanceledException)
                 {
@@ -407,14 +383,14 @@ public sealed class PolygonApiClient : DTpr003A, IDisposable
                 }
             }
 
-            _logger.LogInformation("Retrieved {Count} contracts with pricing for {Symbol}", contracts.Count, symbol);
+            _logger.LogInformation("Retrieved {Count} contracts with pricing for {Symbol}", contractBars.Count, symbol);
 
             return new OptionChainSnapshot
             {
                 Symbol = symbol,
                 SpotPrice = spotPrice,
                 Timestamp = effectiveDate,
-                Contracts = ToContractList(contracts)
+                Contracts = BuildContracts(contractBars.ToArray(), spotPrice, effectiveDate)
             };
         }
         catch (Exception ex)
@@ -479,16 +455,73 @@ public sealed class PolygonApiClient : DTpr003A, IDisposable
         return avgVolume;
     }
 
-    private static List<OptionContract> ToContractList(IEnumerable<OptionContract> contracts)
+    /// <summary>
+    /// Builds snapshot contracts from daily bars, solving the chain's implied volatilities in one batch.
+    /// </summary>
+    private static List<OptionContract> BuildContracts(ContractBar[] bars, decimal spotPrice, DateTime effectiveDate)
     {
-        List<OptionContract> list = new List<OptionContract>();
-        foreach (OptionContract contract in contracts)
+        // Black-Scholes IV via CRMF001A (industry standard for backtesting)
+        const double riskFreeRate = 0.05;
+
+        int count = bars.Length;
+        double[] spots = new double[count];
+        double[] strikes = new double[count];
+        double[] taus = new double[count];
+        double[] rates = new double[count];
+        double[] yields = new double[count];
+        double[] prices = new double[count];
+        bool[] isCalls = new bool[count];
+        double[] impliedVols = new double[count];
+
+        for (int i = 0; i < count; i++)
         {
-            list.Add(contract);
+            spots[i] = (double)spotPrice;
+            strikes[i] = (double)bars[i].Strike;
+            taus[i] = (bars[i].Expiration - effectiveDate).TotalDays / 365.25;
+            rates[i] = riskFreeRate;
+            prices[i] = (double)bars[i].Bar.Close;
+            isCalls[i] = bars[i].Right == OptionRight.Call;
+        }
+
+        CRMF001A.BSImpliedVolatilityBatch(spots, strikes, taus, rates, yields, prices, isCalls, impliedVols);
+
+        List<OptionContract> list = new List<OptionContract>(count);
+        for (int i = 0; i < count; i++)
+        {
+            ContractBar contractBar = bars[i];
+            PolygonBar bar = contractBar.Bar;
+            double impliedVol = impliedVols[i];
+
+            list.Add(new OptionContract
+            {
+                OptionSymbol = contractBar.Ticker,
+                UnderlyingSymbol = contractBar.Underlying,
+                Strike = contractBar.Strike,
+                Expiration = contractBar.Expiration,
+                Right = contractBar.Right,
+                Bid = Math.Max(0, bar.Close - 0.10m),
+                Ask = bar.Close + 0.10m,
+                Last = bar.Close,
+                Volume = (long)bar.Volume,
+                OpenInterest = (long)bar.Volume,
+                ImpliedVolatility = !double.IsNaN(impliedVol) && impliedVol > 0 ? (decimal)impliedVol : null,
+                Timestamp = DateTimeOffset.FromUnixTimeMilliseconds(bar.Timestamp).DateTime
+            });
         }
         return list;
     }
 
+    /// <summary>
+    /// Daily bar fetched for one option contract, awaiting the chain-wide IV solve.
+    /// </summary>
+    private readonly record struct ContractBar(
+        string Ticker,
+        string Underlying,
+        decimal Strike,
+        DateTime Expiration,
+        OptionRight Right,
+        PolygonBar Bar);
+
     private IReadOnlyList<PolygonOptionContract> SelectContractsForSnapshot(
         IReadOnlyList<PolygonOptionContract> contracts,
         decimal spotPrice,
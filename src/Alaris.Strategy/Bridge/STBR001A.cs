@@ -3,8 +3,8 @@
 //
 // This is a complete native implementation that replaces all QuantLib dependencies
 // with native Alaris pricing engines (CREN002A for standard FD, DBAP002A for double boundary).
+// Implied volatilities are inverted against American prices with CRIV001A.
 
-using Alaris.Core.Math;
 using Alaris.Core.Options;
 using Alaris.Core.Pricing;
 using Alaris.Core.Time;
@@ -22,6 +22,7 @@ public sealed class STBR001A : STBR002A, IDisposable
 {
     private readonly ILogger<STBR001A>? _logger;
     private readonly CREN003A _nativeEngine;
+    private readonly CRIV001A _impliedVolatilitySolver;
     private bool _disposed;
 
     // LoggerMessage delegates
@@ -61,6 +62,10 @@ public sealed class STBR001A : STBR002A, IDisposable
     {
         _logger = logger;
         _nativeEngine = new CREN003A(scheme);
+
+        // The daily evaluation inverts quotes concurrently; cached seeds depend only on their
+        // bucket, so results stay independent of which solves ran before them
+        _impliedVolatilitySolver = new CRIV001A(scheme, new CRBC001A());
     }
 
     /// <summary>
@@ -209,8 +214,12 @@ public sealed class STBR001A : STBR002A, IDisposable
     }
 
     /// <summary>
-    /// Calculates implied volatility from market price using high-order Householder method.
+    /// Calculates implied volatility from an American market price.
     /// </summary>
+    /// <remarks>
+    /// The quote is de-Americanized and polished with spectral Newton steps (CRIV001A),
+    /// so the early-exercise premium is not misread as extra volatility.
+    /// </remarks>
     public Task<double> CalculateImpliedVolatility(double marketPrice, STDT003A parameters)
     {
         ArgumentNullException.ThrowIfNull(parameters);
@@ -222,14 +231,14 @@ public sealed class STBR001A : STBR002A, IDisposable
 
         return Task.Run(() =>
         {
-            double iv = CRMF001A.BSImpliedVolatility(
+            double iv = _impliedVolatilitySolver.ImpliedVolatility(
                 parameters.UnderlyingPrice,
                 parameters.Strike,
                 parameters.TimeToExpiry(),
                 parameters.RiskFreeRate,
                 parameters.DividendYield,
                 marketPrice,
-                parameters.OptionType == OptionType.Call);
+                parameters.OptionType);
 
             SafeLog(() => LogImpliedVolatilityCalculated(_logger!, iv, null));
             return iv;
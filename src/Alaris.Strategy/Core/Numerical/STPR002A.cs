@@ -116,11 +116,14 @@ public static class STPR002A
         {
             double currentEnd = currentStart + currentStepSize;
 
-            // Integrate Real and Imaginary parts separately over this chunk
-            double realPart = GaussLegendreRule.Integrate(x => f(x).Real, currentStart, currentEnd, GaussLegendreOrder);
-            double imagPart = GaussLegendreRule.Integrate(x => f(x).Imaginary, currentStart, currentEnd, GaussLegendreOrder);
-            
-            Complex chunkValue = new Complex(realPart, imagPart);
+            // Real and Imaginary parts share one evaluation of f per node
+            GaussLegendreRule rule = new GaussLegendreRule(currentStart, currentEnd, GaussLegendreOrder);
+            Complex chunkValue = Complex.Zero;
+            for (int i = 0; i < rule.Abscissas.Length; i++)
+            {
+                chunkValue += rule.Weights[i] * f(rule.Abscissas[i]);
+            }
+
             double chunkMagnitude = chunkValue.Magnitude;
             totalSum += chunkValue;
 
@@ -143,4 +146,73 @@ public static class STPR002A
 
         return (totalSum, 1.0);
     }
-}
\ No newline at end of file
+
+    /// <summary>
+    /// Integrates every component of a vector-valued function from a to infinity using
+    /// Adaptive Truncation. Components share the quadrature nodes and one chunk schedule,
+    /// driven by the largest component contribution.
+    /// </summary>
+    /// <returns>Error estimate shared by all components.</returns>
+    public static double IntegrateToInfinity(
+        VectorIntegrand f,
+        double a,
+        Span<double> results,
+        double absoluteTolerance = 1e-8,
+        double relativeTolerance = 1e-6)
+    {
+        ArgumentNullException.ThrowIfNull(f);
+
+        results.Clear();
+        int count = results.Length;
+        if (count == 0)
+        {
+            return 0.0;
+        }
+
+        double[] values = new double[count];
+        double[] chunkValues = new double[count];
+        double currentStart = a;
+        int chunkCount = 0;
+        double currentStepSize = IntegrationStepSize;
+        double previousMagnitude = double.MaxValue;
+
+        while (chunkCount < MaxChunks)
+        {
+            double currentEnd = currentStart + currentStepSize;
+
+            GaussLegendreRule rule = new GaussLegendreRule(currentStart, currentEnd, GaussLegendreOrder);
+            Array.Clear(chunkValues);
+            for (int i = 0; i < rule.Abscissas.Length; i++)
+            {
+                f(rule.Abscissas[i], values);
+                for (int k = 0; k < count; k++)
+                {
+                    chunkValues[k] += rule.Weights[i] * values[k];
+                }
+            }
+
+            double chunkMagnitude = 0.0;
+            for (int k = 0; k < count; k++)
+            {
+                results[k] += chunkValues[k];
+                chunkMagnitude = Math.Max(chunkMagnitude, Math.Abs(chunkValues[k]));
+            }
+
+            if (chunkMagnitude < absoluteTolerance && chunkCount > 0)
+            {
+                return absoluteTolerance;
+            }
+
+            if (chunkCount > 2 && chunkMagnitude < previousMagnitude * 0.1)
+            {
+                currentStepSize = Math.Min(currentStepSize * 2.0, IntegrationStepSize * 16);
+            }
+
+            previousMagnitude = chunkMagnitude;
+            currentStart = currentEnd;
+            chunkCount++;
+        }
+
+        return 1.0;
+    }
+}
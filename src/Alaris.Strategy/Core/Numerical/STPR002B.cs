@@ -2,6 +2,7 @@
 //
 // Uses batch evaluation of quadrature points with SIMD for Heston/Kou pricing.
 
+using System.Buffers;
 using System.Numerics;
 using System.Runtime.CompilerServices;
 using System.Runtime.Intrinsics;
@@ -10,6 +11,15 @@ using Alaris.Core.Vectorized;
 
 namespace Alaris.Strategy.Core.Numerical;
 
+/// <summary>
+/// Vector-valued integrand: writes every component of the integrand at <paramref name="x"/> into
+/// <paramref name="values"/>, so components that share expensive work (a characteristic function
+/// evaluation) are computed once per quadrature node.
+/// </summary>
+/// <param name="x">Integration variable.</param>
+/// <param name="values">Destination for the integrand components.</param>
+public delegate void VectorIntegrand(double x, Span<double> values);
+
 /// <summary>
 /// AVX2-accelerated Gauss-Legendre integration for characteristic function pricing.
 /// Component ID: STPR002B
@@ -37,6 +47,9 @@ public static class STPR002B
     private const double IntegrationStepSize = 50.0;
     private const int MaxChunks = 200;
 
+    // Integrand components kept on the stack; wider integrands rent from the pool
+    private const int StackallocThreshold = 32;
+
     /// <summary>
     /// Indicates if AVX2 acceleration is available.
     /// </summary>
@@ -154,6 +167,7 @@ public static class STPR002B
 
     /// <summary>
     /// Integrates a complex function from a to infinity.
+    /// Real and imaginary parts share each evaluation of <paramref name="f"/>.
     /// </summary>
     public static (Complex Value, double Error) IntegrateComplexToInfinity(
         Func<double, Complex> f,
@@ -162,40 +176,155 @@ public static class STPR002B
     {
         ArgumentNullException.ThrowIfNull(f);
 
-        Complex totalSum = Complex.Zero;
-        double currentStart = a;
-        double currentStepSize = IntegrationStepSize;
-        double previousMagnitude = double.MaxValue;
+        Span<double> parts = stackalloc double[2];
+        double error = IntegrateToInfinity(
+            (x, values) =>
+            {
+                Complex value = f(x);
+                values[0] = value.Real;
+                values[1] = value.Imaginary;
+            },
+            a,
+            parts,
+            absoluteTolerance);
+
+        return (new Complex(parts[0], parts[1]), error);
+    }
 
-        for (int chunk = 0; chunk < MaxChunks; chunk++)
-        {
-            double currentEnd = currentStart + currentStepSize;
+    /// <summary>
+    /// Integrates every component of a vector-valued function over [a, b] on shared
+    /// 32-point Gauss-Legendre nodes.
+    /// </summary>
+    /// <param name="f">Integrand writing <c>results.Length</c> components per node.</param>
+    /// <param name="a">Lower bound.</param>
+    /// <param name="b">Upper bound.</param>
+    /// <param name="results">Receives one integral per component.</param>
+    public static void Integrate(VectorIntegrand f, double a, double b, Span<double> results)
+    {
+        ArgumentNullException.ThrowIfNull(f);
 
-            // Integrate real and imaginary parts
-            double realPart = Integrate(x => f(x).Real, currentStart, currentEnd);
-            double imagPart = Integrate(x => f(x).Imaginary, currentStart, currentEnd);
+        results.Clear();
+        if (a >= b || results.IsEmpty)
+        {
+            return;
+        }
 
-            Complex chunkValue = new Complex(realPart, imagPart);
-            double chunkMagnitude = chunkValue.Magnitude;
-            totalSum += chunkValue;
+        int count = results.Length;
+        double[]? rented = null;
+        Span<double> values = count <= StackallocThreshold
+            ? stackalloc double[count]
+            : (rented = ArrayPool<double>.Shared.Rent(count)).AsSpan(0, count);
 
-            // Convergence check
-            if (chunkMagnitude < absoluteTolerance && chunk > 0)
+        try
+        {
+            IntegrateChunk(f, a, b, values, results);
+        }
+        finally
+        {
+            if (rented is not null)
             {
-                return (totalSum, absoluteTolerance);
+                ArrayPool<double>.Shared.Return(rented);
             }
+        }
+    }
 
-            // Adaptive step sizing
-            if (chunk > 2 && chunkMagnitude < previousMagnitude * 0.1)
+    /// <summary>
+    /// Integrates every component of a vector-valued function from a to infinity.
+    /// All components share the quadrature nodes and a single adaptive chunk schedule, which
+    /// stops once the largest component contribution of a chunk falls below the tolerance.
+    /// </summary>
+    /// <param name="f">Integrand writing <c>results.Length</c> components per node.</param>
+    /// <param name="a">Lower bound.</param>
+    /// <param name="results">Receives one integral per component.</param>
+    /// <param name="absoluteTolerance">Convergence threshold on the largest chunk contribution.</param>
+    /// <returns>Error estimate shared by all components.</returns>
+    public static double IntegrateToInfinity(
+        VectorIntegrand f,
+        double a,
+        Span<double> results,
+        double absoluteTolerance = 1e-8)
+    {
+        ArgumentNullException.ThrowIfNull(f);
+
+        results.Clear();
+        if (results.IsEmpty)
+        {
+            return 0.0;
+        }
+
+        int count = results.Length;
+        double[]? rented = null;
+        Span<double> scratch = count <= StackallocThreshold / 2
+            ? stackalloc double[2 * count]
+            : (rented = ArrayPool<double>.Shared.Rent(2 * count)).AsSpan(0, 2 * count);
+        Span<double> values = scratch[..count];
+        Span<double> chunkValues = scratch[count..];
+
+        try
+        {
+            double currentStart = a;
+            double currentStepSize = IntegrationStepSize;
+            double previousMagnitude = double.MaxValue;
+
+            for (int chunk = 0; chunk < MaxChunks; chunk++)
             {
-                currentStepSize = System.Math.Min(currentStepSize * 2.0, IntegrationStepSize * 16);
+                double currentEnd = currentStart + currentStepSize;
+                chunkValues.Clear();
+                IntegrateChunk(f, currentStart, currentEnd, values, chunkValues);
+
+                double chunkMagnitude = 0.0;
+                for (int k = 0; k < count; k++)
+                {
+                    results[k] += chunkValues[k];
+                    chunkMagnitude = System.Math.Max(chunkMagnitude, System.Math.Abs(chunkValues[k]));
+                }
+
+                // Convergence check
+                if (chunkMagnitude < absoluteTolerance && chunk > 0)
+                {
+                    return absoluteTolerance;
+                }
+
+                // Adaptive step sizing
+                if (chunk > 2 && chunkMagnitude < previousMagnitude * 0.1)
+                {
+                    currentStepSize = System.Math.Min(currentStepSize * 2.0, IntegrationStepSize * 16);
+                }
+
+                previousMagnitude = chunkMagnitude;
+                currentStart = currentEnd;
             }
 
-            previousMagnitude = chunkMagnitude;
-            currentStart = currentEnd;
+            return 1.0;
         }
+        finally
+        {
+            if (rented is not null)
+            {
+                ArrayPool<double>.Shared.Return(rented);
+            }
+        }
+    }
 
-        return (totalSum, 1.0);
+    /// <summary>
+    /// Accumulates the 32-point rule over [a, b] into <paramref name="sums"/>.
+    /// </summary>
+    private static void IntegrateChunk(VectorIntegrand f, double a, double b, Span<double> values, Span<double> sums)
+    {
+        double scale = (b - a) * 0.5;
+        double shift = (a + b) * 0.5;
+        int count = sums.Length;
+
+        for (int i = 0; i < GLNodes32.Length; i++)
+        {
+            f((scale * GLNodes32[i]) + shift, values);
+
+            double weight = scale * GLWeights32[i];
+            for (int k = 0; k < count; k++)
+            {
+                sums[k] += weight * values[k];
+            }
+        }
     }
 
     // =========================================================================
@@ -92,4 +92,32 @@ public static class STPR002C
 
         return STPR002A.IntegrateComplexToInfinity(f, a, absoluteTolerance, relativeTolerance);
     }
+
+    /// <summary>
+    /// Integrates every component of a vector-valued function from a to infinity using optimal
+    /// implementation. Components share quadrature nodes and one adaptive schedule.
+    /// </summary>
+    /// <param name="f">Integrand writing <c>results.Length</c> components per node.</param>
+    /// <param name="a">Lower bound.</param>
+    /// <param name="results">Receives one integral per component.</param>
+    /// <param name="absoluteTolerance">Convergence threshold on the largest chunk contribution.</param>
+    /// <param name="relativeTolerance">Relative tolerance (MathNet fallback only).</param>
+    /// <returns>Error estimate shared by all components.</returns>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    public static double IntegrateToInfinity(
+        VectorIntegrand f,
+        double a,
+        Span<double> results,
+        double absoluteTolerance = 1e-8,
+        double relativeTolerance = 1e-6)
+    {
+        ArgumentNullException.ThrowIfNull(f);
+
+        if (IsAvx2Supported)
+        {
+            return STPR002B.IntegrateToInfinity(f, a, results, absoluteTolerance);
+        }
+
+        return STPR002A.IntegrateToInfinity(f, a, results, absoluteTolerance, relativeTolerance);
+    }
 }
@@ -36,6 +36,9 @@ namespace Alaris.Strategy.Core.Numerical;
 /// </remarks>
 public sealed class STPR005A
 {
+    // DE/rand/1 needs three distinct donors besides the target individual
+    private const int MinPopulationSize = 4;
+
     /// <summary>
     /// Population size (typically 10 * dimension). 0 means auto-select.
     /// </summary>
@@ -65,20 +68,44 @@ public sealed class STPR005A
 
     /// <summary>
     /// Random number generator seed (null for random).
+    /// Results are reproducible for a given seed regardless of <see cref="MaxDegreeOfParallelism"/>.
     /// </summary>
     public int? RandomSeed { get; set; }
 
+    /// <summary>
+    /// Maximum number of concurrent fitness evaluations (-1 for all cores, 1 for serial).
+    /// The objective must be thread-safe unless this is 1.
+    /// </summary>
+    public int MaxDegreeOfParallelism { get; set; } = -1;
+
+    /// <summary>
+    /// Early termination threshold on population diversity: the largest per-parameter
+    /// standard deviation as a fraction of its bound width. 0 disables the check.
+    /// </summary>
+    public double DiversityTolerance { get; set; }
+
     /// <summary>
     /// Minimizes an objective function using Differential Evolution.
     /// </summary>
     /// <param name="objective">Objective function to minimize.</param>
     /// <param name="lowerBounds">Lower bounds for parameters (required).</param>
     /// <param name="upperBounds">Upper bounds for parameters (required).</param>
+    /// <param name="initialGuess">
+    /// Optional known-good point (e.g. a previous optimum) seeded into the initial population.
+    /// </param>
     /// <returns>Optimization result.</returns>
+    /// <remarks>
+    /// The population lives in one contiguous row-major buffer and trial vectors in
+    /// per-individual buffers allocated once, so generations do not allocate. Each individual
+    /// owns an RNG stream derived from <see cref="RandomSeed"/>; mutation, crossover and the
+    /// fitness call for all individuals run in parallel against the frozen parent generation,
+    /// and selection then updates the population in place.
+    /// </remarks>
     public OptimizationResult Minimize(
         Func<double[], double> objective,
         double[] lowerBounds,
-        double[] upperBounds)
+        double[] upperBounds,
+        double[]? initialGuess = null)
     {
         ArgumentNullException.ThrowIfNull(objective);
         ArgumentNullException.ThrowIfNull(lowerBounds);
@@ -91,117 +118,117 @@ public sealed class STPR005A
             throw new ArgumentException("Bounds must have same dimension.");
         }
 
+        if (initialGuess is not null && initialGuess.Length != dimension)
+        {
+            throw new ArgumentException("Initial guess must match bounds dimension.", nameof(initialGuess));
+        }
+
         // Auto-select population size if not specified
         int popSize = PopulationSize > 0 ? PopulationSize : 10 * dimension;
 
-        // CA5394: Random is acceptable for optimization algorithms (no security context)
-#pragma warning disable CA5394
-        Random rng = RandomSeed.HasValue ? new Random(RandomSeed.Value) : new Random();
-#pragma warning restore CA5394
+        if (popSize < MinPopulationSize)
+        {
+            throw new ArgumentException(
+                $"Population size must be at least {MinPopulationSize} for DE/rand/1 mutation.", nameof(lowerBounds));
+        }
+
+        Random[] streams = CreateStreams(popSize);
+        ParallelOptions parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = MaxDegreeOfParallelism };
 
-        // Initialize population randomly
-        double[][] population = new double[popSize][];
+        // Parent generation (row-major, one row per individual) and per-individual trial buffers
+        double[] population = new double[popSize * dimension];
         double[] fitness = new double[popSize];
+        double[][] trials = new double[popSize][];
+        double[] trialFitness = new double[popSize];
 
         for (int i = 0; i < popSize; i++)
         {
-            population[i] = new double[dimension];
+            trials[i] = new double[dimension];
+        }
+
+        // Initialize population randomly; each individual draws from its own stream
+        ForEachIndividual(popSize, parallelOptions, i =>
+        {
+            double[] individual = trials[i];
             for (int j = 0; j < dimension; j++)
             {
+                individual[j] = (i == 0 && initialGuess is not null)
+                    ? Math.Clamp(initialGuess[j], lowerBounds[j], upperBounds[j])
 #pragma warning disable CA5394 // Random is acceptable for optimization algorithms (no security context)
-                population[i][j] = lowerBounds[j] +
-                    (rng.NextDouble() * (upperBounds[j] - lowerBounds[j]));
+                    : lowerBounds[j] + (streams[i].NextDouble() * (upperBounds[j] - lowerBounds[j]));
 #pragma warning restore CA5394
             }
 
-            fitness[i] = EvaluateIndividual(population, i, objective);
-        }
+            Array.Copy(individual, 0, population, i * dimension, dimension);
+            fitness[i] = objective(individual);
+        });
 
         // Track best solution
         int bestIndex = FindMinIndex(fitness);
-        double[] bestSolution = GetIndividual(population, bestIndex);
+        double[] bestSolution = new double[dimension];
+        Array.Copy(population, bestIndex * dimension, bestSolution, 0, dimension);
         double bestFitness = fitness[bestIndex];
 
-        int generation = 0;
-        int stagnationCount = 0;
-        const int maxStagnation = 50;
-
-        while (generation < MaxGenerations)
+        // Mutation, crossover and evaluation read only the parent generation, so individuals are independent
+        Action<int> breed = i =>
         {
-            double[][] newPopulation = new double[popSize][];
-            double[] newFitness = new double[popSize];
+            Random rng = streams[i];
+            double[] trial = trials[i];
+            (int a, int b, int c) = SelectDistinctIndices(rng, popSize, i);
 
-            for (int i = 0; i < popSize; i++)
-            {
-                newPopulation[i] = new double[dimension];
-
-                // Select three random distinct individuals (different from i)
-                int a = SelectRandomIndex(rng, popSize, i);
-                int b = SelectRandomIndex(rng, popSize, i, a);
-                int c = SelectRandomIndex(rng, popSize, i, a, b);
-
-                // Create mutant vector: v = x_a + F * (x_b - x_c)
-                double[] mutant = new double[dimension];
-                for (int j = 0; j < dimension; j++)
-                {
-                    mutant[j] = population[a][j] +
-                        (DifferentialWeight * (population[b][j] - population[c][j]));
-
-                    // Ensure bounds
-                    mutant[j] = Math.Clamp(mutant[j], lowerBounds[j], upperBounds[j]);
-                }
-
-                // Crossover: create trial vector
-                double[] trial = new double[dimension];
 #pragma warning disable CA5394 // Random is acceptable for optimization algorithms (no security context)
-                int forcedIndex = rng.Next(dimension); // Ensure at least one parameter from mutant
+            int forcedIndex = rng.Next(dimension); // Ensure at least one parameter from mutant
 #pragma warning restore CA5394
 
-                for (int j = 0; j < dimension; j++)
-                {
+            for (int j = 0; j < dimension; j++)
+            {
 #pragma warning disable CA5394 // Random is acceptable for optimization algorithms (no security context)
-                    if (rng.NextDouble() < CrossoverProbability || j == forcedIndex)
+                bool fromMutant = rng.NextDouble() < CrossoverProbability || j == forcedIndex;
 #pragma warning restore CA5394
-                    {
-                        trial[j] = mutant[j];
-                    }
-                    else
-                    {
-                        trial[j] = population[i][j];
-                    }
-                }
 
-                // Selection: keep better of trial and current
-                double trialFitness = objective(trial);
+                // Mutant component: v = x_a + F * (x_b - x_c), clamped to bounds
+                trial[j] = fromMutant
+                    ? Math.Clamp(
+                        population[(a * dimension) + j] +
+                            (DifferentialWeight * (population[(b * dimension) + j] - population[(c * dimension) + j])),
+                        lowerBounds[j],
+                        upperBounds[j])
+                    : population[(i * dimension) + j];
+            }
+
+            trialFitness[i] = objective(trial);
+        };
+
+        int generation = 0;
+        int stagnationCount = 0;
+        const int maxStagnation = 50;
+
+        while (generation < MaxGenerations)
+        {
+            ForEachIndividual(popSize, parallelOptions, breed);
 
-                if (trialFitness < fitness[i])
+            // Selection: keep better of trial and current
+            for (int i = 0; i < popSize; i++)
+            {
+                if (trialFitness[i] < fitness[i])
                 {
-                    // Trial is better - accept it
-                    newPopulation[i] = trial;
-                    newFitness[i] = trialFitness;
+                    Array.Copy(trials[i], 0, population, i * dimension, dimension);
+                    fitness[i] = trialFitness[i];
 
                     // Update global best
-                    if (trialFitness < bestFitness)
+                    if (trialFitness[i] < bestFitness)
                     {
-                        bestSolution = (double[])trial.Clone();
-                        bestFitness = trialFitness;
+                        Array.Copy(trials[i], bestSolution, dimension);
+                        bestFitness = trialFitness[i];
                         stagnationCount = 0;
                     }
                 }
-                else
-                {
-                    // Keep current individual
-                    newPopulation[i] = (double[])population[i].Clone();
-                    newFitness[i] = fitness[i];
-                }
             }
 
-            population = newPopulation;
-            fitness = newFitness;
             generation++;
             stagnationCount++;
 
-            // Check convergence: population diversity
+            // Check convergence: spread of objective values
             double fitnessStd = ComputeStandardDeviation(fitness);
             if (fitnessStd < Tolerance)
             {
@@ -209,6 +236,14 @@ public sealed class STPR005A
                     OptimizationStatus.ObjectiveConvergence);
             }
 
+            // Diversity collapse: the population has contracted onto a point
+            if (DiversityTolerance > 0 &&
+                ComputeDiversity(population, popSize, dimension, lowerBounds, upperBounds) < DiversityTolerance)
+            {
+                return CreateResult(bestSolution, bestFitness, generation,
+                    OptimizationStatus.ParameterConvergence);
+            }
+
             // Early stopping if stagnant
             if (stagnationCount > maxStagnation)
             {
@@ -221,14 +256,37 @@ public sealed class STPR005A
             OptimizationStatus.MaxIterationsReached);
     }
 
-    private static double EvaluateIndividual(double[][] population, int index, Func<double[], double> objective)
+    /// <summary>
+    /// Creates one RNG stream per individual. Stream seeds are drawn from a master generator,
+    /// so a fixed <see cref="RandomSeed"/> fixes every stream independently of thread scheduling.
+    /// </summary>
+    private Random[] CreateStreams(int popSize)
     {
-        return objective(population[index]);
+#pragma warning disable CA5394 // Random is acceptable for optimization algorithms (no security context)
+        Random master = RandomSeed.HasValue ? new Random(RandomSeed.Value) : new Random();
+        Random[] streams = new Random[popSize];
+        for (int i = 0; i < popSize; i++)
+        {
+            streams[i] = new Random(master.Next());
+        }
+#pragma warning restore CA5394
+
+        return streams;
     }
 
-    private static double[] GetIndividual(double[][] population, int index)
+    private static void ForEachIndividual(int popSize, ParallelOptions parallelOptions, Action<int> body)
     {
-        return (double[])population[index].Clone();
+        if (parallelOptions.MaxDegreeOfParallelism == 1)
+        {
+            for (int i = 0; i < popSize; i++)
+            {
+                body(i);
+            }
+
+            return;
+        }
+
+        Parallel.For(0, popSize, parallelOptions, body);
     }
 
     private static int FindMinIndex(double[] values)
@@ -246,18 +304,32 @@ public sealed class STPR005A
         return minIndex;
     }
 
-    private static int SelectRandomIndex(Random rng, int popSize, params int[] exclude)
+    private static (int A, int B, int C) SelectDistinctIndices(Random rng, int popSize, int current)
     {
-        while (true)
-        {
 #pragma warning disable CA5394 // Random is acceptable for optimization algorithms (no security context)
-            int index = rng.Next(popSize);
-#pragma warning restore CA5394
-            if (!IsExcluded(index, exclude))
-            {
-                return index;
-            }
+        int a;
+        do
+        {
+            a = rng.Next(popSize);
         }
+        while (a == current);
+
+        int b;
+        do
+        {
+            b = rng.Next(popSize);
+        }
+        while (b == current || b == a);
+
+        int c;
+        do
+        {
+            c = rng.Next(popSize);
+        }
+        while (c == current || c == a || c == b);
+#pragma warning restore CA5394
+
+        return (a, b, c);
     }
 
     private static double ComputeStandardDeviation(double[] values)
@@ -280,17 +352,44 @@ public sealed class STPR005A
         return Math.Sqrt(sumSquaredDiff / values.Length);
     }
 
-    private static bool IsExcluded(int index, int[] exclude)
+    /// <summary>
+    /// Largest per-parameter standard deviation across the population, relative to the bound width.
+    /// </summary>
+    private static double ComputeDiversity(
+        double[] population,
+        int popSize,
+        int dimension,
+        double[] lowerBounds,
+        double[] upperBounds)
     {
-        for (int i = 0; i < exclude.Length; i++)
+        double diversity = 0.0;
+        for (int j = 0; j < dimension; j++)
         {
-            if (exclude[i] == index)
+            double width = upperBounds[j] - lowerBounds[j];
+            if (width <= 0)
+            {
+                continue;
+            }
+
+            double mean = 0.0;
+            for (int i = 0; i < popSize; i++)
             {
-                return true;
+                mean += population[(i * dimension) + j];
             }
+
+            mean /= popSize;
+
+            double sumSquaredDiff = 0.0;
+            for (int i = 0; i < popSize; i++)
+            {
+                double diff = population[(i * dimension) + j] - mean;
+                sumSquaredDiff += diff * diff;
+            }
+
+            diversity = Math.Max(diversity, Math.Sqrt(sumSquaredDiff / popSize) / width);
         }
 
-        return false;
+        return diversity;
     }
 
     private static OptimizationResult CreateResult(
@@ -1,6 +1,8 @@
-// STPR010A.cs - AVX2-accelerated option chain batch pricing for high-throughput Greeks
+// STPR010A.cs - AVX2/AVX-512 accelerated option chain batch pricing for high-throughput Greeks
 
 using System.Runtime.CompilerServices;
+using System.Runtime.Intrinsics;
+using Alaris.Core.Math;
 using Alaris.Core.Vectorized;
 
 namespace Alaris.Strategy.Core.Numerical;
@@ -15,11 +17,32 @@ namespace Alaris.Strategy.Core.Numerical;
 /// Processes entire chains of options for a single underlying in one call.
 /// </para>
 /// <para>
+/// Greeks come from a fused kernel: d1, d2, N(±d1), N(±d2), φ(d1) and the discount
+/// factors are evaluated once per lane and every Greek is formed from them, instead of
+/// one batch pass per Greek. Outputs are written to caller-provided spans; no path
+/// allocates on the heap.
+/// </para>
+/// <para>
 /// Target use case: Computing Greeks for all strikes/expiries in a chain for delta hedging.
 /// </para>
 /// </remarks>
 public static class STPR010A
 {
+    // Contracts per Vector256 lane group
+    private const int LaneCount = 4;
+
+    // Contracts per Vector512 lane group
+    private const int WideLaneCount = 8;
+
+    // Contracts per stack block when assembling GreeksResult or filling spot buffers
+    private const int BlockSize = 64;
+
+    // |d| cap before the vectorized N(·) and φ(·), whose exp does not flush to zero below about -708
+    private const double MaxAbsD = 37.0;
+
+    // Days per year used by GreeksResult.Theta
+    private const double DaysPerYear = 252.0;
+
     /// <summary>
     /// Greeks results for a batch of options.
     /// </summary>
@@ -35,6 +58,8 @@ public static class STPR010A
         public required double Vega { get; init; }
         /// <summary>Theta (∂V/∂t) per day.</summary>
         public required double Theta { get; init; }
+        /// <summary>Rho (∂V/∂r).</summary>
+        public required double Rho { get; init; }
     }
 
     /// <summary>
@@ -48,7 +73,10 @@ public static class STPR010A
     /// <param name="q">Dividend yield.</param>
     /// <param name="isCalls">Call/put flags for each option.</param>
     /// <param name="results">Output array for Greeks results.</param>
-    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    /// <remarks>
+    /// Runs the fused kernel in stack blocks of 64 contracts, so chains of any length
+    /// are processed without heap allocation.
+    /// </remarks>
     public static void ComputeChainGreeks(
         double spot,
         ReadOnlySpan<double> strikes,
@@ -60,60 +88,189 @@ public static class STPR010A
         Span<GreeksResult> results)
     {
         int count = strikes.Length;
-        if (count == 0)
+        ValidateChainInputs(strikes, taus, sigmas, isCalls, results.Length);
+
+        Span<double> prices = stackalloc double[BlockSize];
+        Span<double> deltas = stackalloc double[BlockSize];
+        Span<double> gammas = stackalloc double[BlockSize];
+        Span<double> vegas = stackalloc double[BlockSize];
+        Span<double> thetas = stackalloc double[BlockSize];
+        Span<double> rhos = stackalloc double[BlockSize];
+
+        for (int start = 0; start < count; start += BlockSize)
         {
-            return;
+            int length = System.Math.Min(BlockSize, count - start);
+            ComputeChainGreeks(
+                spot,
+                strikes.Slice(start, length),
+                taus.Slice(start, length),
+                sigmas.Slice(start, length),
+                r,
+                q,
+                isCalls.Slice(start, length),
+                prices[..length],
+                deltas[..length],
+                gammas[..length],
+                vegas[..length],
+                thetas[..length],
+                rhos[..length]);
+
+            for (int i = 0; i < length; i++)
+            {
+                results[start + i] = new GreeksResult
+                {
+                    Price = prices[i],
+                    Delta = deltas[i],
+                    Gamma = gammas[i],
+                    Vega = vegas[i],
+                    Theta = thetas[i] / DaysPerYear,
+                    Rho = rhos[i]
+                };
+            }
+        }
+    }
+
+    /// <summary>
+    /// Computes price and Greeks for an option chain into structure-of-arrays outputs.
+    /// </summary>
+    /// <param name="spot">Current spot price of underlying.</param>
+    /// <param name="strikes">Strike prices for each option.</param>
+    /// <param name="taus">Times to expiry (years) for each option.</param>
+    /// <param name="sigmas">Implied volatilities for each option.</param>
+    /// <param name="r">Risk-free rate.</param>
+    /// <param name="q">Dividend yield.</param>
+    /// <param name="isCalls">Call/put flags for each option.</param>
+    /// <param name="prices">Output prices.</param>
+    /// <param name="deltas">Output deltas (∂V/∂S).</param>
+    /// <param name="gammas">Output gammas (∂²V/∂S²).</param>
+    /// <param name="vegas">Output vegas (∂V/∂σ).</param>
+    /// <param name="thetas">Output thetas (∂V/∂t) per year, as <see cref="CRMF001A.BSTheta"/>.</param>
+    /// <param name="rhos">Output rhos (∂V/∂r).</param>
+    /// <remarks>
+    /// Each lane group costs one log, two discount exponentials, two N(·) and one φ(·),
+    /// shared by all six outputs. On the AVX-512 path chains run eight contracts per
+    /// group, then at most one four-wide group; the remainder is padded into a final
+    /// lane group. Hosts without AVX2 use the same formulas in scalar arithmetic.
+    /// </remarks>
+    public static void ComputeChainGreeks(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        double r,
+        double q,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices,
+        Span<double> deltas,
+        Span<double> gammas,
+        Span<double> vegas,
+        Span<double> thetas,
+        Span<double> rhos)
+    {
+        int count = strikes.Length;
+        ValidateChainInputs(strikes, taus, sigmas, isCalls, prices.Length);
+        if (deltas.Length != count || gammas.Length != count || vegas.Length != count
+            || thetas.Length != count || rhos.Length != count)
+        {
+            throw new ArgumentException("All output spans must match the number of strikes.");
         }
 
-        // Create spot array for batch processing
-        Span<double> spots = stackalloc double[count < 256 ? count : 256];
-        if (count > 256)
+        if (CRVT002A.ActivePath == SimdPath.Scalar)
         {
-            spots = new double[count];
+            for (int i = 0; i < count; i++)
+            {
+                ComputeGreeksScalar(
+                    spot, strikes[i], taus[i], sigmas[i], r, q, isCalls[i],
+                    out prices[i], out deltas[i], out gammas[i], out vegas[i], out thetas[i], out rhos[i]);
+            }
+            return;
         }
-        spots[..count].Fill(spot);
 
-        // Allocate intermediate results
-        Span<double> prices = stackalloc double[count < 256 ? count : 256];
-        Span<double> deltas = stackalloc double[count < 256 ? count : 256];
-        Span<double> gammas = stackalloc double[count < 256 ? count : 256];
-        Span<double> vegas = stackalloc double[count < 256 ? count : 256];
+        int start = 0;
+        if (CRVT002A.ActivePath == SimdPath.Avx512)
+        {
+            int wideEnd = count - (count % WideLaneCount);
+            for (; start < wideEnd; start += WideLaneCount)
+            {
+                ComputeGreeksLaneGroup512(
+                    spot,
+                    strikes.Slice(start, WideLaneCount),
+                    taus.Slice(start, WideLaneCount),
+                    sigmas.Slice(start, WideLaneCount),
+                    r,
+                    q,
+                    isCalls.Slice(start, WideLaneCount),
+                    prices.Slice(start, WideLaneCount),
+                    deltas.Slice(start, WideLaneCount),
+                    gammas.Slice(start, WideLaneCount),
+                    vegas.Slice(start, WideLaneCount),
+                    thetas.Slice(start, WideLaneCount),
+                    rhos.Slice(start, WideLaneCount));
+            }
+        }
 
-        if (count > 256)
+        int vectorEnd = count - (count % LaneCount);
+        for (int i = start; i < vectorEnd; i += LaneCount)
         {
-            prices = new double[count];
-            deltas = new double[count];
-            gammas = new double[count];
-            vegas = new double[count];
+            ComputeGreeksLaneGroup(
+                spot,
+                strikes.Slice(i, LaneCount),
+                taus.Slice(i, LaneCount),
+                sigmas.Slice(i, LaneCount),
+                r,
+                q,
+                isCalls.Slice(i, LaneCount),
+                prices.Slice(i, LaneCount),
+                deltas.Slice(i, LaneCount),
+                gammas.Slice(i, LaneCount),
+                vegas.Slice(i, LaneCount),
+                thetas.Slice(i, LaneCount),
+                rhos.Slice(i, LaneCount));
         }
 
-        // Use AVX2-accelerated batch Greeks from CRVT001A
-        CRVT001A.ComputePricesBatch(spots[..count], strikes, taus, sigmas, r, q, isCalls, prices[..count]);
-        CRVT001A.ComputeDeltasBatch(spots[..count], strikes, taus, sigmas, r, q, isCalls, deltas[..count]);
-        CRVT001A.ComputeGammasBatch(spots[..count], strikes, taus, sigmas, r, q, gammas[..count]);
-        CRVT001A.ComputeVegasBatch(spots[..count], strikes, taus, sigmas, r, q, vegas[..count]);
+        int remainder = count - vectorEnd;
+        if (remainder == 0)
+        {
+            return;
+        }
 
-        // Compute theta as time decay (simplified: -∂V/∂τ per day)
-        // θ = -(V(τ) - V(τ-Δτ)) / Δτ  approximated
-        const double daysPerYear = 252.0;
+        // Pad the tail with copies of its first contract and run one more lane group
+        Span<double> tailStrikes = stackalloc double[LaneCount];
+        Span<double> tailTaus = stackalloc double[LaneCount];
+        Span<double> tailSigmas = stackalloc double[LaneCount];
+        Span<bool> tailIsCalls = stackalloc bool[LaneCount];
+        Span<double> tailOutputs = stackalloc double[6 * LaneCount];
 
-        // Assemble results
-        for (int i = 0; i < count; i++)
+        for (int lane = 0; lane < LaneCount; lane++)
         {
-            // Simplified theta: assume theta ≈ -vega * σ / (2 * sqrt(τ)) - other terms
-            // For accurate theta, would need full BS theta calculation
-            double sqrtTau = System.Math.Sqrt(taus[i]);
-            double theta = -(sigmas[i] * vegas[i]) / (2 * sqrtTau * daysPerYear);
-
-            results[i] = new GreeksResult
-            {
-                Price = prices[i],
-                Delta = deltas[i],
-                Gamma = gammas[i],
-                Vega = vegas[i],
-                Theta = theta
-            };
+            int source = vectorEnd + (lane < remainder ? lane : 0);
+            tailStrikes[lane] = strikes[source];
+            tailTaus[lane] = taus[source];
+            tailSigmas[lane] = sigmas[source];
+            tailIsCalls[lane] = isCalls[source];
         }
+
+        ComputeGreeksLaneGroup(
+            spot,
+            tailStrikes,
+            tailTaus,
+            tailSigmas,
+            r,
+            q,
+            tailIsCalls,
+            tailOutputs.Slice(0, LaneCount),
+            tailOutputs.Slice(LaneCount, LaneCount),
+            tailOutputs.Slice(2 * LaneCount, LaneCount),
+            tailOutputs.Slice(3 * LaneCount, LaneCount),
+            tailOutputs.Slice(4 * LaneCount, LaneCount),
+            tailOutputs.Slice(5 * LaneCount, LaneCount));
+
+        tailOutputs.Slice(0, remainder).CopyTo(prices[vectorEnd..]);
+        tailOutputs.Slice(LaneCount, remainder).CopyTo(deltas[vectorEnd..]);
+        tailOutputs.Slice(2 * LaneCount, remainder).CopyTo(gammas[vectorEnd..]);
+        tailOutputs.Slice(3 * LaneCount, remainder).CopyTo(vegas[vectorEnd..]);
+        tailOutputs.Slice(4 * LaneCount, remainder).CopyTo(thetas[vectorEnd..]);
+        tailOutputs.Slice(5 * LaneCount, remainder).CopyTo(rhos[vectorEnd..]);
     }
 
     /// <summary>
@@ -131,20 +288,22 @@ public static class STPR010A
         Span<double> prices)
     {
         int count = strikes.Length;
-        if (count == 0)
-        {
-            return;
-        }
+        Span<double> spots = stackalloc double[BlockSize];
+        spots.Fill(spot);
 
-        // Create spot array
-        Span<double> spots = stackalloc double[count < 256 ? count : 256];
-        if (count > 256)
+        for (int start = 0; start < count; start += BlockSize)
         {
-            spots = new double[count];
+            int length = System.Math.Min(BlockSize, count - start);
+            CRVT001A.ComputePricesBatch(
+                spots[..length],
+                strikes.Slice(start, length),
+                taus.Slice(start, length),
+                sigmas.Slice(start, length),
+                r,
+                q,
+                isCalls.Slice(start, length),
+                prices.Slice(start, length));
         }
-        spots[..count].Fill(spot);
-
-        CRVT001A.ComputePricesBatch(spots[..count], strikes, taus, sigmas, r, q, isCalls, prices);
     }
 
     /// <summary>
@@ -162,18 +321,207 @@ public static class STPR010A
         Span<double> deltas)
     {
         int count = strikes.Length;
-        if (count == 0)
+        Span<double> spots = stackalloc double[BlockSize];
+        spots.Fill(spot);
+
+        for (int start = 0; start < count; start += BlockSize)
         {
-            return;
+            int length = System.Math.Min(BlockSize, count - start);
+            CRVT001A.ComputeDeltasBatch(
+                spots[..length],
+                strikes.Slice(start, length),
+                taus.Slice(start, length),
+                sigmas.Slice(start, length),
+                r,
+                q,
+                isCalls.Slice(start, length),
+                deltas.Slice(start, length));
         }
+    }
+
+    /// <summary>
+    /// Fused Black-Scholes price and Greeks for four contracts.
+    /// </summary>
+    /// <remarks>
+    /// With ω = +1 for calls and -1 for puts:
+    /// V = ω(S·e^(-qτ)·N(ωd1) - K·e^(-rτ)·N(ωd2)), Δ = ω·e^(-qτ)·N(ωd1),
+    /// Γ = e^(-qτ)·φ(d1)/(Sσ√τ), ν = S·e^(-qτ)·φ(d1)·√τ,
+    /// Θ = -S·e^(-qτ)·φ(d1)·σ/(2√τ) + ω(q·S·e^(-qτ)·N(ωd1) - r·K·e^(-rτ)·N(ωd2)),
+    /// ρ = ω·K·τ·e^(-rτ)·N(ωd2).
+    /// </remarks>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static void ComputeGreeksLaneGroup(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        double r,
+        double q,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices,
+        Span<double> deltas,
+        Span<double> gammas,
+        Span<double> vegas,
+        Span<double> thetas,
+        Span<double> rhos)
+    {
+        Vector256<double> S = Vector256.Create(spot);
+        Vector256<double> K = Vector256.Create(strikes);
+        Vector256<double> tau = Vector256.Create(taus);
+        Vector256<double> sigma = Vector256.Create(sigmas);
+        Vector256<double> omega = Vector256.Create(
+            isCalls[0] ? 1.0 : -1.0,
+            isCalls[1] ? 1.0 : -1.0,
+            isCalls[2] ? 1.0 : -1.0,
+            isCalls[3] ? 1.0 : -1.0);
+        Vector256<double> rVec = Vector256.Create(r);
+        Vector256<double> qVec = Vector256.Create(q);
+        Vector256<double> half = Vector256.Create(0.5);
+        Vector256<double> maxAbsD = Vector256.Create(MaxAbsD);
+        Vector256<double> minAbsD = Vector256.Create(-MaxAbsD);
+
+        // Shared terms: one log, two exp, two N(·), one φ(·)
+        Vector256<double> sqrtTau = Vector256.Sqrt(tau);
+        Vector256<double> sigmaRootT = sigma * sqrtTau;
+        Vector256<double> d1 = (CRVT002A.VectorLog256(S / K) + ((rVec - qVec + (half * sigma * sigma)) * tau)) / sigmaRootT;
+        Vector256<double> d2 = Vector256.Min(Vector256.Max(d1 - sigmaRootT, minAbsD), maxAbsD);
+        d1 = Vector256.Min(Vector256.Max(d1, minAbsD), maxAbsD);
 
-        Span<double> spots = stackalloc double[count < 256 ? count : 256];
-        if (count > 256)
+        Vector256<double> discountQ = CRVT002A.VectorExp256(-(qVec * tau));
+        Vector256<double> discountR = CRVT002A.VectorExp256(-(rVec * tau));
+        Vector256<double> nd1 = CRVT002A.VectorNormalCDF256(omega * d1);
+        Vector256<double> nd2 = CRVT002A.VectorNormalCDF256(omega * d2);
+        Vector256<double> pdf = CRVT002A.VectorNormalPDF256(d1);
+
+        Vector256<double> forwardTerm = S * discountQ;
+        Vector256<double> strikeTerm = K * discountR;
+        Vector256<double> forwardLeg = forwardTerm * nd1;
+        Vector256<double> strikeLeg = strikeTerm * nd2;
+        Vector256<double> forwardDensity = forwardTerm * pdf;
+
+        (omega * (forwardLeg - strikeLeg)).CopyTo(prices);
+        (omega * discountQ * nd1).CopyTo(deltas);
+        (discountQ * pdf / (S * sigmaRootT)).CopyTo(gammas);
+        (forwardDensity * sqrtTau).CopyTo(vegas);
+        ((-(forwardDensity * sigma) / (sqrtTau + sqrtTau)) + (omega * ((qVec * forwardLeg) - (rVec * strikeLeg)))).CopyTo(thetas);
+        (omega * tau * strikeLeg).CopyTo(rhos);
+    }
+
+    /// <summary>
+    /// Eight-lane AVX-512 form of <see cref="ComputeGreeksLaneGroup"/>.
+    /// </summary>
+    [MethodImpl(MethodImplOptions.AggressiveInlining)]
+    private static void ComputeGreeksLaneGroup512(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        double r,
+        double q,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices,
+        Span<double> deltas,
+        Span<double> gammas,
+        Span<double> vegas,
+        Span<double> thetas,
+        Span<double> rhos)
+    {
+        Span<double> signs = stackalloc double[WideLaneCount];
+        for (int lane = 0; lane < WideLaneCount; lane++)
         {
-            spots = new double[count];
+            signs[lane] = isCalls[lane] ? 1.0 : -1.0;
         }
-        spots[..count].Fill(spot);
 
-        CRVT001A.ComputeDeltasBatch(spots[..count], strikes, taus, sigmas, r, q, isCalls, deltas);
+        Vector512<double> S = Vector512.Create(spot);
+        Vector512<double> K = Vector512.Create(strikes);
+        Vector512<double> tau = Vector512.Create(taus);
+        Vector512<double> sigma = Vector512.Create(sigmas);
+        Vector512<double> omega = Vector512.Create<double>(signs);
+        Vector512<double> rVec = Vector512.Create(r);
+        Vector512<double> qVec = Vector512.Create(q);
+        Vector512<double> half = Vector512.Create(0.5);
+        Vector512<double> maxAbsD = Vector512.Create(MaxAbsD);
+        Vector512<double> minAbsD = Vector512.Create(-MaxAbsD);
+
+        Vector512<double> sqrtTau = Vector512.Sqrt(tau);
+        Vector512<double> sigmaRootT = sigma * sqrtTau;
+        Vector512<double> d1 = (CRVT002A.VectorLog512(S / K) + ((rVec - qVec + (half * sigma * sigma)) * tau)) / sigmaRootT;
+        Vector512<double> d2 = Vector512.Min(Vector512.Max(d1 - sigmaRootT, minAbsD), maxAbsD);
+        d1 = Vector512.Min(Vector512.Max(d1, minAbsD), maxAbsD);
+
+        Vector512<double> discountQ = CRVT002A.VectorExp512(-(qVec * tau));
+        Vector512<double> discountR = CRVT002A.VectorExp512(-(rVec * tau));
+        Vector512<double> nd1 = CRVT002A.VectorNormalCDF512(omega * d1);
+        Vector512<double> nd2 = CRVT002A.VectorNormalCDF512(omega * d2);
+        Vector512<double> pdf = CRVT002A.VectorNormalPDF512(d1);
+
+        Vector512<double> forwardTerm = S * discountQ;
+        Vector512<double> strikeTerm = K * discountR;
+        Vector512<double> forwardLeg = forwardTerm * nd1;
+        Vector512<double> strikeLeg = strikeTerm * nd2;
+        Vector512<double> forwardDensity = forwardTerm * pdf;
+
+        (omega * (forwardLeg - strikeLeg)).CopyTo(prices);
+        (omega * discountQ * nd1).CopyTo(deltas);
+        (discountQ * pdf / (S * sigmaRootT)).CopyTo(gammas);
+        (forwardDensity * sqrtTau).CopyTo(vegas);
+        ((-(forwardDensity * sigma) / (sqrtTau + sqrtTau)) + (omega * ((qVec * forwardLeg) - (rVec * strikeLeg)))).CopyTo(thetas);
+        (omega * tau * strikeLeg).CopyTo(rhos);
+    }
+
+    /// <summary>
+    /// Scalar form of <see cref="ComputeGreeksLaneGroup"/> for hosts without AVX2.
+    /// </summary>
+    private static void ComputeGreeksScalar(
+        double spot,
+        double strike,
+        double tau,
+        double sigma,
+        double r,
+        double q,
+        bool isCall,
+        out double price,
+        out double delta,
+        out double gamma,
+        out double vega,
+        out double theta,
+        out double rho)
+    {
+        double omega = isCall ? 1.0 : -1.0;
+        double sqrtTau = System.Math.Sqrt(tau);
+        double sigmaRootT = sigma * sqrtTau;
+        double d1 = CRMF001A.BSd1(spot, strike, tau, sigma, r, q);
+        double d2 = d1 - sigmaRootT;
+
+        double discountQ = System.Math.Exp(-q * tau);
+        double discountR = System.Math.Exp(-r * tau);
+        double nd1 = CRMF001A.NormalCDF(omega * d1);
+        double nd2 = CRMF001A.NormalCDF(omega * d2);
+        double pdf = CRMF001A.NormalPDF(d1);
+
+        double forwardLeg = spot * discountQ * nd1;
+        double strikeLeg = strike * discountR * nd2;
+        double forwardDensity = spot * discountQ * pdf;
+
+        price = omega * (forwardLeg - strikeLeg);
+        delta = omega * discountQ * nd1;
+        gamma = discountQ * pdf / (spot * sigmaRootT);
+        vega = forwardDensity * sqrtTau;
+        theta = (-(forwardDensity * sigma) / (2.0 * sqrtTau)) + (omega * ((q * forwardLeg) - (r * strikeLeg)));
+        rho = omega * tau * strikeLeg;
+    }
+
+    private static void ValidateChainInputs(
+        ReadOnlySpan<double> strikes,
+        ReadOnlySpan<double> taus,
+        ReadOnlySpan<double> sigmas,
+        ReadOnlySpan<bool> isCalls,
+        int outputLength)
+    {
+        int count = strikes.Length;
+        if (taus.Length != count || sigmas.Length != count || isCalls.Length != count || outputLength != count)
+        {
+            throw new ArgumentException("All input and output spans must have the same length.");
+        }
     }
 }
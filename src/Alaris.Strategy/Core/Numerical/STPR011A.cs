@@ -0,0 +1,207 @@
+// STPR011A.cs - COS expansion kernels shared by the model slice pricers
+
+using System.Numerics;
+using System.Runtime.Intrinsics;
+
+namespace Alaris.Strategy.Core.Numerical;
+
+/// <summary>
+/// Fang-Oosterlee (2008) COS expansion kernels shared by the characteristic function slice pricers.
+/// Component ID: STPR011A
+/// </summary>
+/// <remarks>
+/// <para>
+/// A slice pricer expands the density of ln(S_T/K) in cosines on [a, b] and fills one
+/// coefficient H_k = w_k·φ(u_k)·e^(-iu_k·a)·V_k per node, where φ is the model's
+/// characteristic function of ln(S_T/S_0) and V_k the unit-strike put payoff coefficient
+/// from <see cref="PutPayoffWeight"/>. The unit-strike put value of each strike is then
+/// Σ Re[H_k·e^(iu_k·ln(S/K))], which <see cref="SumSlice"/> accumulates by phase rotation,
+/// four strikes per Vector256 lane group.
+/// </para>
+/// <para>
+/// Several series (e.g. a price and its parameter derivatives) can share the nodes; their
+/// coefficients are interleaved by node so one rotation serves all of them.
+/// </para>
+/// </remarks>
+public static class STPR011A
+{
+    // Strikes per Vector256 lane group in the COS summation
+    private const int LaneCount = 4;
+
+    /// <summary>
+    /// Unit-strike put payoff coefficient of node <paramref name="k"/>, with the first-term
+    /// half weight and the e^(-iu_k·a) shift applied.
+    /// </summary>
+    /// <param name="k">Node index.</param>
+    /// <param name="step">Frequency spacing π/(b - a).</param>
+    /// <param name="a">Lower bound of the truncation interval.</param>
+    /// <param name="b">Upper bound of the truncation interval.</param>
+    /// <returns>w_k·V_k·e^(-iu_k·a).</returns>
+    public static Complex PutPayoffWeight(int k, double step, double a, double b)
+    {
+        double upper = Math.Min(0.0, b);
+        double u = k * step;
+        double cosUpper = Math.Cos(u * (upper - a));
+        double sinUpper = Math.Sin(u * (upper - a));
+        double expUpper = Math.Exp(upper);
+        double chi = ((cosUpper * expUpper) - Math.Exp(a) + (u * sinUpper * expUpper)) / (1.0 + (u * u));
+        double psi = k == 0 ? upper - a : sinUpper / u;
+        double payoff = 2.0 / (b - a) * (psi - chi);
+
+        return Complex.FromPolarCoordinates(k == 0 ? 0.5 * payoff : payoff, -u * a);
+    }
+
+    /// <summary>
+    /// Sums every COS series for every strike of a slice.
+    /// </summary>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="strikes">Strike prices in the slice.</param>
+    /// <param name="step">Frequency spacing π/(b - a).</param>
+    /// <param name="hRe">Real parts of the coefficients, interleaved by node.</param>
+    /// <param name="hIm">Imaginary parts of the coefficients, interleaved by node.</param>
+    /// <param name="seriesCount">Series sharing each node.</param>
+    /// <param name="sums">Output unit-strike put values, series-major: series j of strike i at j·count + i.</param>
+    public static void SumSlice(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double step,
+        ReadOnlySpan<double> hRe,
+        ReadOnlySpan<double> hIm,
+        int seriesCount,
+        Span<double> sums)
+    {
+        int count = strikes.Length;
+        if (sums.Length < seriesCount * count)
+        {
+            throw new ArgumentException("Sum span must hold every series for every strike.", nameof(sums));
+        }
+
+        Span<double> laneSums = stackalloc double[seriesCount * LaneCount];
+        int vectorEnd = Vector256.IsHardwareAccelerated ? count - (count % LaneCount) : 0;
+        for (int i = 0; i < vectorEnd; i += LaneCount)
+        {
+            SumLaneGroup(spot, strikes.Slice(i, LaneCount), step, hRe, hIm, seriesCount, laneSums);
+            for (int series = 0; series < seriesCount; series++)
+            {
+                laneSums.Slice(series * LaneCount, LaneCount).CopyTo(sums.Slice((series * count) + i, LaneCount));
+            }
+        }
+
+        for (int i = vectorEnd; i < count; i++)
+        {
+            SumSeries(Math.Log(spot / strikes[i]), step, hRe, hIm, seriesCount, laneSums);
+            for (int series = 0; series < seriesCount; series++)
+            {
+                sums[(series * count) + i] = laneSums[series];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Validates the inputs common to every slice pricer.
+    /// </summary>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="strikes">Strike prices in the slice.</param>
+    /// <param name="timeToExpiry">Time to expiry in years.</param>
+    /// <param name="outputLength">Length of the caller's output span.</param>
+    public static void ValidateSliceInputs(double spot, ReadOnlySpan<double> strikes, double timeToExpiry, int outputLength)
+    {
+        if (spot <= 0 || timeToExpiry <= 0)
+        {
+            throw new ArgumentException("Spot and time to expiry must be positive.");
+        }
+
+        if (outputLength != strikes.Length)
+        {
+            throw new ArgumentException("Output span must match the number of strikes.");
+        }
+
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            if (strikes[i] <= 0)
+            {
+                throw new ArgumentException("Strikes must be positive.", nameof(strikes));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Sums the COS series Σ Re[H_k·e^(iu_k·x)] for four strikes, rotating the phase per term.
+    /// Results are laid out series-major, four lanes each.
+    /// </summary>
+    private static void SumLaneGroup(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double step,
+        ReadOnlySpan<double> hRe,
+        ReadOnlySpan<double> hIm,
+        int seriesCount,
+        Span<double> results)
+    {
+        Span<double> rotation = stackalloc double[2 * LaneCount];
+        for (int lane = 0; lane < LaneCount; lane++)
+        {
+            double x = Math.Log(spot / strikes[lane]);
+            rotation[lane] = Math.Cos(step * x);
+            rotation[LaneCount + lane] = Math.Sin(step * x);
+        }
+
+        Vector256<double> cosStep = Vector256.Create<double>(rotation[..LaneCount]);
+        Vector256<double> sinStep = Vector256.Create<double>(rotation[LaneCount..]);
+        Vector256<double> cos = Vector256<double>.One;
+        Vector256<double> sin = Vector256<double>.Zero;
+        Span<Vector256<double>> sums = stackalloc Vector256<double>[seriesCount];
+        sums.Clear();
+
+        int terms = hRe.Length / seriesCount;
+        for (int k = 0; k < terms; k++)
+        {
+            int offset = k * seriesCount;
+            for (int series = 0; series < seriesCount; series++)
+            {
+                sums[series] += (Vector256.Create(hRe[offset + series]) * cos) - (Vector256.Create(hIm[offset + series]) * sin);
+            }
+
+            Vector256<double> nextCos = (cos * cosStep) - (sin * sinStep);
+            sin = (sin * cosStep) + (cos * sinStep);
+            cos = nextCos;
+        }
+
+        for (int series = 0; series < seriesCount; series++)
+        {
+            sums[series].CopyTo(results.Slice(series * LaneCount, LaneCount));
+        }
+    }
+
+    /// <summary>
+    /// Scalar form of <see cref="SumLaneGroup"/> for a single strike.
+    /// </summary>
+    private static void SumSeries(
+        double x,
+        double step,
+        ReadOnlySpan<double> hRe,
+        ReadOnlySpan<double> hIm,
+        int seriesCount,
+        Span<double> results)
+    {
+        double cosStep = Math.Cos(step * x);
+        double sinStep = Math.Sin(step * x);
+        double cos = 1.0;
+        double sin = 0.0;
+        results[..seriesCount].Clear();
+
+        int terms = hRe.Length / seriesCount;
+        for (int k = 0; k < terms; k++)
+        {
+            int offset = k * seriesCount;
+            for (int series = 0; series < seriesCount; series++)
+            {
+                results[series] += (hRe[offset + series] * cos) - (hIm[offset + series] * sin);
+            }
+
+            double nextCos = (cos * cosStep) - (sin * sinStep);
+            sin = (sin * cosStep) + (cos * sinStep);
+            cos = nextCos;
+        }
+    }
+}
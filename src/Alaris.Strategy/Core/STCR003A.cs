@@ -165,7 +165,8 @@ public sealed class STCR003A
 
     /// <summary>
     /// Calculates a rolling Yang-Zhang volatility series.
-    /// Optimized to reuse buffers across rolling window calculations.
+    /// Slides an <see cref="STCR008A"/> window over the bars, so the series costs a single
+    /// linear pass rather than one full window per point.
     /// </summary>
     public IReadOnlyList<(DateTime Date, double Volatility)> CalculateRolling(
         IReadOnlyList<PriceBar> priceBars,
@@ -179,43 +180,18 @@ public sealed class STCR003A
             return Array.Empty<(DateTime, double)>();
         }
 
-        int resultCount = priceBars.Count - window;
-        List<(DateTime Date, double Volatility)> results = new(resultCount);
+        List<(DateTime Date, double Volatility)> results = new(priceBars.Count - window);
+        STCR008A rollingWindow = new STCR008A(window);
 
-        // Rule 5: Rent buffers once and reuse for entire rolling calculation
-        double[] openReturns = ArrayPool<double>.Shared.Rent(window);
-        double[] closeReturns = ArrayPool<double>.Shared.Rent(window);
-        double[] rogersReturns = ArrayPool<double>.Shared.Rent(window);
-
-        try
+        for (int i = 0; i < priceBars.Count; i++)
         {
-            double annualizationFactor = annualized ? Math.Sqrt(TradingDaysPerYear) : 1.0;
-
-            for (int i = window; i < priceBars.Count; i++)
+            rollingWindow.Push(priceBars[i]);
+            if (rollingWindow.IsFull)
             {
-                int startIdx = i - window;
-
-                // Calculate returns directly into pooled arrays
-                CalculateLogReturnsInPlace(priceBars, startIdx, window, openReturns, closeReturns, rogersReturns);
-
-                // Calculate variance from spans
-                double yangZhangVariance = CalculateSTCR003AVarianceFromSpan(
-                    openReturns.AsSpan(0, window),
-                    closeReturns.AsSpan(0, window),
-                    rogersReturns.AsSpan(0, window),
-                    window);
-
-                double volatility = Math.Sqrt(Math.Max(0, yangZhangVariance)) * annualizationFactor;
-                results.Add((priceBars[i].Date, volatility));
+                results.Add((priceBars[i].Date, rollingWindow.GetVolatility(annualized)));
             }
-
-            return results;
-        }
-        finally
-        {
-            ArrayPool<double>.Shared.Return(openReturns);
-            ArrayPool<double>.Shared.Return(closeReturns);
-            ArrayPool<double>.Shared.Return(rogersReturns);
         }
+
+        return results;
     }
 }
\ No newline at end of file
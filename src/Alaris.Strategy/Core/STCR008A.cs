@@ -0,0 +1,211 @@
+// STCR008A.cs - sliding-window yang-zhang variance with constant-time updates
+
+using Alaris.Strategy.Bridge;
+
+namespace Alaris.Strategy.Core;
+
+/// <summary>
+/// Maintains the Yang-Zhang (2000) variance of a sliding window of OHLC bars.
+/// </summary>
+/// <remarks>
+/// <para>
+/// The overnight and open-to-close log returns are tracked by running means and sums of
+/// squared deviations (Welford updates, which also run in reverse), and the
+/// Rogers-Satchell terms by a running sum. <see cref="Push"/> and <see cref="Pop"/> are
+/// O(1) whatever the window, so a rolling series costs one pass over the bars.
+/// </para>
+/// <para>
+/// The per-bar terms are kept in a ring buffer so that a bar leaving the window is
+/// removed with exactly the values it was added with.
+/// </para>
+/// </remarks>
+public sealed class STCR008A
+{
+    private const int TradingDaysPerYear = 252;
+
+    private readonly double[] _openReturns;
+    private readonly double[] _closeReturns;
+    private readonly double[] _rogersTerms;
+    private int _head;
+    private int _count;
+    private double _previousClose = double.NaN;
+
+    private double _openMean;
+    private double _openSquaredDeviations;
+    private double _closeMean;
+    private double _closeSquaredDeviations;
+    private double _rogersSum;
+
+    /// <summary>
+    /// Initialises an empty window.
+    /// </summary>
+    /// <param name="window">Number of daily returns in the window (at least 2).</param>
+    public STCR008A(int window)
+    {
+        if (window < 2)
+        {
+            throw new ArgumentException("Window must be at least 2", nameof(window));
+        }
+
+        Window = window;
+        _openReturns = new double[window];
+        _closeReturns = new double[window];
+        _rogersTerms = new double[window];
+    }
+
+    /// <summary>
+    /// Gets the maximum number of daily returns in the window.
+    /// </summary>
+    public int Window { get; }
+
+    /// <summary>
+    /// Gets the number of daily returns currently in the window.
+    /// </summary>
+    public int Count => _count;
+
+    /// <summary>
+    /// Gets whether the window holds <see cref="Window"/> returns.
+    /// </summary>
+    public bool IsFull => _count == Window;
+
+    /// <summary>
+    /// Gets the daily Yang-Zhang variance of the returns in the window.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">Fewer than two returns are in the window.</exception>
+    public double Variance
+    {
+        get
+        {
+            if (_count < 2)
+            {
+                throw new InvalidOperationException("Need at least 2 returns in the window");
+            }
+
+            double openVariance = Math.Max(0, _openSquaredDeviations) / (_count - 1);
+            double closeVariance = Math.Max(0, _closeSquaredDeviations) / (_count - 1);
+            double rogersVariance = _rogersSum / _count;
+
+            // k = 0.34 / (1.34 + (n+1)/(n-1))
+            double k = 0.34 / (1.34 + ((_count + 1.0) / (_count - 1.0)));
+
+            return openVariance + (k * closeVariance) + ((1 - k) * rogersVariance);
+        }
+    }
+
+    /// <summary>
+    /// Gets the Yang-Zhang volatility of the returns in the window.
+    /// </summary>
+    /// <param name="annualized">Whether to annualize the daily volatility.</param>
+    /// <returns>The volatility estimate.</returns>
+    /// <exception cref="InvalidOperationException">Fewer than two returns are in the window.</exception>
+    public double GetVolatility(bool annualized = true)
+    {
+        double volatility = Math.Sqrt(Math.Max(0, Variance));
+        return annualized ? volatility * Math.Sqrt(TradingDaysPerYear) : volatility;
+    }
+
+    /// <summary>
+    /// Adds the next bar, dropping the oldest return once the window is full.
+    /// </summary>
+    /// <param name="bar">The bar following the previously pushed one.</param>
+    /// <remarks>
+    /// The first bar only anchors the overnight return of the second, so a full window
+    /// takes <see cref="Window"/> + 1 bars.
+    /// </remarks>
+    public void Push(PriceBar bar)
+    {
+        ArgumentNullException.ThrowIfNull(bar);
+
+        double previousClose = _previousClose;
+        _previousClose = bar.Close;
+        if (double.IsNaN(previousClose))
+        {
+            return;
+        }
+
+        if (_count == Window)
+        {
+            Pop();
+        }
+
+        // o = ln(O/C_prev), c = ln(C/O), RS = u(u - c) + d(d - c)
+        double o = Math.Log(bar.Open / previousClose);
+        double c = Math.Log(bar.Close / bar.Open);
+        double u = Math.Log(bar.High / bar.Open);
+        double d = Math.Log(bar.Low / bar.Open);
+        double rs = (u * (u - c)) + (d * (d - c));
+
+        int slot = _head + _count;
+        if (slot >= Window)
+        {
+            slot -= Window;
+        }
+
+        _openReturns[slot] = o;
+        _closeReturns[slot] = c;
+        _rogersTerms[slot] = rs;
+        _count++;
+
+        AddObservation(o, _count, ref _openMean, ref _openSquaredDeviations);
+        AddObservation(c, _count, ref _closeMean, ref _closeSquaredDeviations);
+        _rogersSum += rs;
+    }
+
+    /// <summary>
+    /// Removes the oldest return from the window.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">The window is empty.</exception>
+    public void Pop()
+    {
+        if (_count == 0)
+        {
+            throw new InvalidOperationException("The window is empty");
+        }
+
+        double o = _openReturns[_head];
+        double c = _closeReturns[_head];
+        double rs = _rogersTerms[_head];
+        _head = _head + 1 == Window ? 0 : _head + 1;
+        _count--;
+
+        if (_count == 0)
+        {
+            // Restart from exact zeros rather than carry rounding residue forward
+            _openMean = _openSquaredDeviations = 0;
+            _closeMean = _closeSquaredDeviations = 0;
+            _rogersSum = 0;
+            return;
+        }
+
+        RemoveObservation(o, _count, ref _openMean, ref _openSquaredDeviations);
+        RemoveObservation(c, _count, ref _closeMean, ref _closeSquaredDeviations);
+        _rogersSum -= rs;
+    }
+
+    /// <summary>
+    /// Empties the window and forgets the previous close.
+    /// </summary>
+    public void Reset()
+    {
+        _head = 0;
+        _count = 0;
+        _previousClose = double.NaN;
+        _openMean = _openSquaredDeviations = 0;
+        _closeMean = _closeSquaredDeviations = 0;
+        _rogersSum = 0;
+    }
+
+    private static void AddObservation(double value, int count, ref double mean, ref double squaredDeviations)
+    {
+        double delta = value - mean;
+        mean += delta / count;
+        squaredDeviations += delta * (value - mean);
+    }
+
+    private static void RemoveObservation(double value, int remaining, ref double mean, ref double squaredDeviations)
+    {
+        double delta = value - mean;
+        mean -= delta / remaining;
+        squaredDeviations -= delta * (value - mean);
+    }
+}
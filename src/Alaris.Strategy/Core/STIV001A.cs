@@ -140,6 +140,28 @@ public sealed class HestonParameters
     };
 }
 
+/// <summary>
+/// Residual definition used by <see cref="STIV001A.Calibrate"/>.
+/// </summary>
+public enum HestonCalibrationObjective
+{
+    /// <summary>
+    /// Model minus market implied volatility, with a finite-difference Jacobian.
+    /// </summary>
+    ImpliedVolatility,
+
+    /// <summary>
+    /// Model minus market option price, with the analytic Heston Jacobian.
+    /// </summary>
+    Price,
+
+    /// <summary>
+    /// Price residuals divided by the market Black-Scholes vega, a first-order proxy for
+    /// implied volatility residuals, with the analytic Heston Jacobian.
+    /// </summary>
+    VegaWeightedPrice
+}
+
 /// <summary>
 /// Implements the Heston (1993) stochastic volatility model for implied volatility.
 /// Stock price dynamics under risk-neutral measure Q:
@@ -163,6 +185,9 @@ public sealed class HestonParameters
 /// </summary>
 public sealed class STIV001A
 {
+    // Vega floor for vega-weighted residuals, as a fraction of spot
+    private const double MinVegaWeightFraction = 1e-4;
+
     private readonly HestonParameters _params;
 
     public STIV001A(HestonParameters parameters)
@@ -319,7 +344,8 @@ public sealed class STIV001A
     }
 
     /// <summary>
-    /// Computes the IV smile across strikes using parallel computation.
+    /// Computes the IV smile across strikes from a single COS slice pricing pass.
+    /// Strikes whose model price cannot be inverted are reported as NaN.
     /// </summary>
     public (double Strike, double TheoreticalIV)[] ComputeSmile(
         double spot,
@@ -328,14 +354,15 @@ public sealed class STIV001A
     {
         ArgumentNullException.ThrowIfNull(strikes);
 
+        double[] impliedVolatilities = new double[strikes.Length];
+        STPR003A.ComputeSliceImpliedVolatilities(spot, strikes, timeToExpiry, _params, impliedVolatilities);
+
         (double Strike, double TheoreticalIV)[] result =
             new (double Strike, double TheoreticalIV)[strikes.Length];
-
-        // Parallel computation for independent strikes
-        Parallel.For(0, strikes.Length, i =>
+        for (int i = 0; i < strikes.Length; i++)
         {
-            result[i] = (strikes[i], ComputeTheoreticalIV(spot, strikes[i], timeToExpiry));
-        });
+            result[i] = (strikes[i], impliedVolatilities[i]);
+        }
 
         return result;
     }
@@ -344,11 +371,78 @@ public sealed class STIV001A
     /// Calibrates Heston parameters from market IV surface using Levenberg-Marquardt optimization.
     /// PRODUCTION VERSION: Uses nonlinear least squares optimization for accurate parameter estimation.
     /// </summary>
+    /// <remarks>
+    /// The price objectives compare out-of-the-money option prices and hand the optimizer the
+    /// analytic Jacobian from <see cref="STPR003A.ComputeSlicePriceGradients"/>, so an LM
+    /// iteration costs one COS pass per expiry instead of ten finite-difference surfaces,
+    /// each with a Brent inversion per quote.
+    /// A supplied <paramref name="initialGuess"/> (typically the previous session's optimum)
+    /// replaces the ATM-derived starting point.
+    /// </remarks>
     public static HestonParameters Calibrate(
         double spot,
         IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
         double riskFreeRate,
-        double dividendYield)
+        double dividendYield,
+        HestonCalibrationObjective objective = HestonCalibrationObjective.VegaWeightedPrice,
+        HestonParameters? initialGuess = null)
+    {
+        OptimizationResult result = MinimizeFrom(spot, marketData, riskFreeRate, dividendYield, objective, initialGuess);
+        if (result.Converged)
+        {
+            return ToParameters(result.OptimalParameters, riskFreeRate, dividendYield);
+        }
+
+        // Fallback: Try grid search with coarse grid to find better initial guess
+        return CalibrateGridSearch(spot, marketData, riskFreeRate, dividendYield);
+    }
+
+    /// <summary>
+    /// Refines a known fit with Levenberg-Marquardt only, without the grid-search fallback.
+    /// </summary>
+    /// <remarks>
+    /// Meant for a start that already prices the surface well, such as yesterday's optimum on
+    /// a surface that has barely moved. The final iterate is returned even when LM stops on
+    /// its iteration limit, since it is never worse than the start on the LM objective.
+    /// </remarks>
+    public static HestonParameters Refine(
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
+        double riskFreeRate,
+        double dividendYield,
+        HestonParameters start,
+        HestonCalibrationObjective objective = HestonCalibrationObjective.VegaWeightedPrice)
+    {
+        ArgumentNullException.ThrowIfNull(start);
+
+        OptimizationResult result = MinimizeFrom(spot, marketData, riskFreeRate, dividendYield, objective, start);
+        return ToParameters(result.OptimalParameters, riskFreeRate, dividendYield);
+    }
+
+    private static HestonParameters ToParameters(IReadOnlyList<double> x, double riskFreeRate, double dividendYield)
+    {
+        return new HestonParameters
+        {
+            V0 = x[0],
+            Theta = x[1],
+            Kappa = x[2],
+            SigmaV = x[3],
+            Rho = x[4],
+            RiskFreeRate = riskFreeRate,
+            DividendYield = dividendYield
+        };
+    }
+
+    /// <summary>
+    /// Levenberg-Marquardt run shared by <see cref="Calibrate"/> and <see cref="Refine"/>.
+    /// </summary>
+    private static OptimizationResult MinimizeFrom(
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
+        double riskFreeRate,
+        double dividendYield,
+        HestonCalibrationObjective objective,
+        HestonParameters? initialGuess)
     {
         ArgumentNullException.ThrowIfNull(marketData);
 
@@ -382,19 +476,29 @@ public sealed class STIV001A
 
         double atmIV = atmCount > 0 ? atmSum / atmCount : 0.25;
 
-        double[] initialGuess =
-        {
-            atmIV * atmIV,  // v0
-            atmIV * atmIV,  // theta
-            2.0,            // kappa
-            0.3,            // sigmaV
-            -0.7            // rho
-        };
+        double[] startingPoint = initialGuess is null
+            ? new[]
+            {
+                atmIV * atmIV,  // v0
+                atmIV * atmIV,  // theta
+                2.0,            // kappa
+                0.3,            // sigmaV
+                -0.7            // rho
+            }
+            : new[] { initialGuess.V0, initialGuess.Theta, initialGuess.Kappa, initialGuess.SigmaV, initialGuess.Rho };
 
         // Parameter bounds
         double[] lowerBounds = { 0.001, 0.001, 0.01, 0.01, -0.99 };
         double[] upperBounds = { 2.0, 2.0, 10.0, 2.0, 0.99 };
 
+        for (int i = 0; i < startingPoint.Length; i++)
+        {
+            startingPoint[i] = Math.Clamp(startingPoint[i], lowerBounds[i], upperBounds[i]);
+        }
+
+        // Observations grouped by expiry so each residual pass prices one COS slice per DTE
+        CalibrationSlice[] slices = BuildSlices(marketData);
+
         // Residual function
         double[] Residuals(double[] x)
         {
@@ -422,51 +526,36 @@ public sealed class STIV001A
                 return invalid;
             }
 
-            STIV001A model = new STIV001A(candidateParams);
             double[] residuals = new double[marketData.Count];
+            ComputeModelIVs(candidateParams, spot, slices, residuals);
 
-            for (int i = 0; i < marketData.Count; i++)
+            for (int i = 0; i < residuals.Length; i++)
             {
-                (double strike, int dte, double marketIV) = marketData[i];
-                double timeToExpiry = TradingCalendarDefaults.DteToYears(dte);
-
-                try
-                {
-                    double modelIV = model.ComputeTheoreticalIV(spot, strike, timeToExpiry);
-                    residuals[i] = modelIV - marketIV;
-                }
-#pragma warning disable CA1031 // Do not catch general exception types
-                catch (Exception)
-#pragma warning restore CA1031
-                {
-                    // Pricing can fail for many reasons during calibration (e.g., invalid parameters,
-                    // numerical instability, convergence issues). Penalize rather than failing the entire calibration.
-                    residuals[i] = 10.0;
-                }
+                // Penalize strikes the slice could not price or invert
+                residuals[i] = double.IsNaN(residuals[i]) ? 10.0 : residuals[i] - marketData[i].MarketIV;
             }
 
             return residuals;
         }
 
         // Run optimization
-        OptimizationResult result = optimizer.Minimize(Residuals, initialGuess, lowerBounds, upperBounds);
-
-        if (result.Converged)
+        OptimizationResult result;
+        if (objective == HestonCalibrationObjective.ImpliedVolatility)
         {
-            return new HestonParameters
-            {
-                V0 = result.OptimalParameters[0],
-                Theta = result.OptimalParameters[1],
-                Kappa = result.OptimalParameters[2],
-                SigmaV = result.OptimalParameters[3],
-                Rho = result.OptimalParameters[4],
-                RiskFreeRate = riskFreeRate,
-                DividendYield = dividendYield
-            };
+            result = optimizer.Minimize(Residuals, startingPoint, lowerBounds, upperBounds);
+        }
+        else
+        {
+            (double[] marketPrices, double[] weights) = BuildPriceTargets(
+                spot, marketData, riskFreeRate, dividendYield, objective);
+            result = optimizer.Minimize(
+                x => ComputePriceResiduals(x, spot, slices, marketPrices, weights, riskFreeRate, dividendYield),
+                startingPoint,
+                lowerBounds,
+                upperBounds);
         }
 
-        // Fallback: Try grid search with coarse grid to find better initial guess
-        return CalibrateGridSearch(spot, marketData, riskFreeRate, dividendYield);
+        return result;
     }
 
     /// <summary>
@@ -483,6 +572,7 @@ public sealed class STIV001A
         double bestError = double.MaxValue;
         HestonParameters? bestParams = null;
         object lockObj = new object();
+        CalibrationSlice[] slices = BuildSlices(marketData);
 
         // Parameter grid (coarse grid for demo)
         double[] v0s = { 0.02, 0.04, 0.06, 0.09 };
@@ -536,8 +626,7 @@ public sealed class STIV001A
                 return;
             }
 
-            STIV001A model = new STIV001A(candidateParams);
-            double error = ComputeCalibrationError(model, spot, marketData);
+            double error = ComputeCalibrationError(candidateParams, spot, slices, marketData);
 
             lock (lockObj)
             {
@@ -552,24 +641,231 @@ public sealed class STIV001A
         return bestParams ?? HestonParameters.DefaultEquity;
     }
 
+    /// <summary>
+    /// Root-mean-square implied volatility error of <paramref name="parameters"/> against
+    /// market quotes. Quotes the model cannot price or invert add the calibration penalty error of 10.
+    /// </summary>
+    public static double ComputeSurfaceRmse(
+        HestonParameters parameters,
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData)
+    {
+        ArgumentNullException.ThrowIfNull(parameters);
+        ArgumentNullException.ThrowIfNull(marketData);
+
+        if (marketData.Count == 0)
+        {
+            throw new ArgumentException("Need at least one market observation.", nameof(marketData));
+        }
+
+        return Math.Sqrt(ComputeCalibrationError(parameters, spot, BuildSlices(marketData), marketData));
+    }
+
     private static double ComputeCalibrationError(
-        STIV001A model,
+        HestonParameters parameters,
         double spot,
+        CalibrationSlice[] slices,
         IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData)
     {
-        double totalError = 0;
+        double[] modelIVs = new double[marketData.Count];
+        ComputeModelIVs(parameters, spot, slices, modelIVs);
 
-        foreach ((double strike, int dte, double marketIV) in marketData)
+        double totalError = 0;
+        for (int i = 0; i < modelIVs.Length; i++)
         {
-            double timeToExpiry = TradingCalendarDefaults.DteToYears(dte);
-            double modelIV = model.ComputeTheoreticalIV(spot, strike, timeToExpiry);
-            double error = modelIV - marketIV;
+            double error = double.IsNaN(modelIVs[i]) ? 10.0 : modelIVs[i] - marketData[i].MarketIV;
             totalError += error * error;
         }
 
         return totalError / marketData.Count;
     }
 
+    /// <summary>
+    /// Computes model IVs for every observation, one COS slice pricing pass per expiry.
+    /// A slice that fails to price leaves NaN for all of its observations.
+    /// </summary>
+    private static void ComputeModelIVs(
+        HestonParameters parameters,
+        double spot,
+        CalibrationSlice[] slices,
+        double[] modelIVs)
+    {
+        foreach (CalibrationSlice slice in slices)
+        {
+            double[] sliceIVs = new double[slice.Strikes.Length];
+            try
+            {
+                STPR003A.ComputeSliceImpliedVolatilities(spot, slice.Strikes, slice.TimeToExpiry, parameters, sliceIVs);
+            }
+#pragma warning disable CA1031 // Do not catch general exception types
+            catch (Exception)
+#pragma warning restore CA1031
+            {
+                // Pricing can fail for many reasons during calibration (e.g., invalid parameters,
+                // numerical instability). Penalize rather than failing the entire calibration.
+                Array.Fill(sliceIVs, double.NaN);
+            }
+
+            for (int j = 0; j < slice.Indices.Length; j++)
+            {
+                modelIVs[slice.Indices[j]] = sliceIVs[j];
+            }
+        }
+    }
+
+    /// <summary>
+    /// Market prices of the out-of-the-money option at each quote and the residual weight:
+    /// 1 for <see cref="HestonCalibrationObjective.Price"/>, 1/vega otherwise.
+    /// </summary>
+    private static (double[] MarketPrices, double[] Weights) BuildPriceTargets(
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
+        double riskFreeRate,
+        double dividendYield,
+        HestonCalibrationObjective objective)
+    {
+        double[] marketPrices = new double[marketData.Count];
+        double[] weights = new double[marketData.Count];
+
+        for (int i = 0; i < marketData.Count; i++)
+        {
+            (double strike, int dte, double marketIV) = marketData[i];
+            double timeToExpiry = TradingCalendarDefaults.DteToYears(dte);
+            bool isCall = strike >= spot;
+
+            marketPrices[i] = Alaris.Core.Math.CRMF001A.BSPrice(
+                spot, strike, timeToExpiry, marketIV, riskFreeRate, dividendYield, isCall);
+
+            // Floor the vega so far out-of-the-money quotes do not dominate the fit
+            double vega = Alaris.Core.Math.CRMF001A.BSVega(
+                spot, strike, timeToExpiry, marketIV, riskFreeRate, dividendYield);
+            weights[i] = objective == HestonCalibrationObjective.Price
+                ? 1.0
+                : 1.0 / Math.Max(vega, MinVegaWeightFraction * spot);
+        }
+
+        return (marketPrices, weights);
+    }
+
+    /// <summary>
+    /// Weighted price residuals and their analytic Jacobian, one COS pass per expiry.
+    /// Jacobian columns follow the calibration vector [v0, theta, kappa, sigmaV, rho].
+    /// </summary>
+    [System.Diagnostics.CodeAnalysis.SuppressMessage("Performance", "CA1814:Prefer jagged arrays over multidimensional", Justification = "Jacobian matches the optimizer's matrix layout")]
+    private static (double[] Residuals, double[,] Jacobian) ComputePriceResiduals(
+        double[] x,
+        double spot,
+        CalibrationSlice[] slices,
+        double[] marketPrices,
+        double[] weights,
+        double riskFreeRate,
+        double dividendYield)
+    {
+        double[] residuals = new double[marketPrices.Length];
+        double[,] jacobian = new double[marketPrices.Length, STPR003A.GradientParameterCount];
+
+        HestonParameters candidateParams = new HestonParameters
+        {
+            V0 = x[0],
+            Theta = x[1],
+            Kappa = x[2],
+            SigmaV = x[3],
+            Rho = x[4],
+            RiskFreeRate = riskFreeRate,
+            DividendYield = dividendYield
+        };
+
+        if (!candidateParams.Validate().IsValid)
+        {
+            Array.Fill(residuals, 100.0);
+            return (residuals, jacobian);
+        }
+
+        foreach (CalibrationSlice slice in slices)
+        {
+            int count = slice.Strikes.Length;
+            bool[] isCalls = new bool[count];
+            for (int j = 0; j < count; j++)
+            {
+                isCalls[j] = slice.Strikes[j] >= spot;
+            }
+
+            double[] prices = new double[count];
+            double[] gradients = new double[count * STPR003A.GradientParameterCount];
+            try
+            {
+                STPR003A.ComputeSlicePriceGradients(
+                    spot, slice.Strikes, slice.TimeToExpiry, candidateParams, isCalls, prices, gradients);
+            }
+#pragma warning disable CA1031 // Do not catch general exception types
+            catch (Exception)
+#pragma warning restore CA1031
+            {
+                // Penalize the slice; its Jacobian rows stay zero
+                for (int j = 0; j < count; j++)
+                {
+                    residuals[slice.Indices[j]] = 10.0;
+                }
+
+                continue;
+            }
+
+            for (int j = 0; j < count; j++)
+            {
+                int index = slice.Indices[j];
+                double weight = weights[index];
+                residuals[index] = weight * (prices[j] - marketPrices[index]);
+                for (int p = 0; p < STPR003A.GradientParameterCount; p++)
+                {
+                    jacobian[index, p] = weight * gradients[(j * STPR003A.GradientParameterCount) + p];
+                }
+            }
+        }
+
+        return (residuals, jacobian);
+    }
+
+    /// <summary>
+    /// Groups market observations by DTE.
+    /// </summary>
+    private static CalibrationSlice[] BuildSlices(
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData)
+    {
+        Dictionary<int, List<int>> byDte = new Dictionary<int, List<int>>();
+        for (int i = 0; i < marketData.Count; i++)
+        {
+            int dte = marketData[i].DTE;
+            if (!byDte.TryGetValue(dte, out List<int>? indices))
+            {
+                indices = new List<int>();
+                byDte[dte] = indices;
+            }
+
+            indices.Add(i);
+        }
+
+        CalibrationSlice[] slices = new CalibrationSlice[byDte.Count];
+        int sliceIndex = 0;
+        foreach (KeyValuePair<int, List<int>> entry in byDte)
+        {
+            int[] indices = entry.Value.ToArray();
+            double[] strikes = new double[indices.Length];
+            for (int j = 0; j < indices.Length; j++)
+            {
+                strikes[j] = marketData[indices[j]].Strike;
+            }
+
+            slices[sliceIndex++] = new CalibrationSlice(TradingCalendarDefaults.DteToYears(entry.Key), strikes, indices);
+        }
+
+        return slices;
+    }
+
+    /// <summary>
+    /// Market observations sharing one expiry, with their positions in the market data.
+    /// </summary>
+    private sealed record CalibrationSlice(double TimeToExpiry, double[] Strikes, int[] Indices);
+
     private static void ValidateInputs(double spot, double strike, double timeToExpiry)
     {
         if (spot <= 0)
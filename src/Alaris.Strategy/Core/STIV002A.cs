@@ -142,6 +142,16 @@ public sealed class KouParameters
 /// </summary>
 public sealed class STIV002A
 {
+    // Parameter vector: [sigma, lambda, p, eta1, eta2]
+    private static readonly double[] LowerBounds = { 0.05, 0.0, 0.0, 1.01, 0.1 };
+    private static readonly double[] UpperBounds = { 1.0, 20.0, 1.0, 50.0, 50.0 };
+
+    // A seeded search only has to explore around a known optimum
+    private const int ColdGenerations = 500;
+    private const int ColdPopulationSize = 50; // 10 * dimension (5 parameters)
+    private const int WarmGenerations = 100;
+    private const int WarmPopulationSize = 20;
+
     private readonly KouParameters _params;
 
     public STIV002A(KouParameters parameters)
@@ -153,7 +163,7 @@ public sealed class STIV002A
 
     /// <summary>
     /// Computes the theoretical implied volatility at a given strike and time to expiry.
-    /// PRODUCTION VERSION: Uses full characteristic function integration and Fourier inversion.
+    /// PRODUCTION VERSION: Prices with Kou's closed-form Hh series and inverts with Brent's method.
     /// </summary>
     /// <param name="spot">Current spot price.</param>
     /// <param name="strike">Strike price.</param>
@@ -163,7 +173,7 @@ public sealed class STIV002A
     {
         ValidateInputs(spot, strike, timeToExpiry);
 
-        // Production implementation: Full characteristic function integration
+        // Production implementation: closed-form series price, no Fourier integration
         return STPR006A.ComputeImpliedVolatility(spot, strike, timeToExpiry, _params);
     }
 
@@ -270,6 +280,7 @@ public sealed class STIV002A
 
     /// <summary>
     /// Computes the IV term structure for a given moneyness level.
+    /// Each expiry is a single strike, so it is priced by the closed-form series rather than a COS slice.
     /// </summary>
     /// <param name="spot">Current spot price.</param>
     /// <param name="strike">Strike price.</param>
@@ -302,7 +313,8 @@ public sealed class STIV002A
     }
 
     /// <summary>
-    /// Computes the IV smile across strikes at a given expiry.
+    /// Computes the IV smile across strikes from a single COS slice pricing pass.
+    /// Strikes whose model price cannot be inverted are reported as NaN.
     /// </summary>
     /// <param name="spot">Current spot price.</param>
     /// <param name="strikes">Array of strike prices.</param>
@@ -315,12 +327,14 @@ public sealed class STIV002A
     {
         ArgumentNullException.ThrowIfNull(strikes);
 
+        double[] impliedVolatilities = new double[strikes.Length];
+        STPR006A.ComputeSliceImpliedVolatilities(spot, strikes, timeToExpiry, _params, impliedVolatilities);
+
         (double Strike, double TheoreticalIV)[] result =
             new (double Strike, double TheoreticalIV)[strikes.Length];
-
         for (int i = 0; i < strikes.Length; i++)
         {
-            result[i] = (strikes[i], ComputeTheoreticalIV(spot, strikes[i], timeToExpiry));
+            result[i] = (strikes[i], impliedVolatilities[i]);
         }
 
         return result;
@@ -336,12 +350,17 @@ public sealed class STIV002A
     /// <param name="marketData">Market IV observations (strike, dte, iv).</param>
     /// <param name="riskFreeRate">Risk-free rate.</param>
     /// <param name="dividendYield">Dividend yield.</param>
+    /// <param name="initialGuess">
+    /// Optional previous optimum seeded into the DE population. A seeded run uses a smaller
+    /// population for fewer generations.
+    /// </param>
     /// <returns>Calibrated parameters.</returns>
     public static KouParameters Calibrate(
         double spot,
         IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
         double riskFreeRate,
-        double dividendYield)
+        double dividendYield,
+        KouParameters? initialGuess = null)
     {
         ArgumentNullException.ThrowIfNull(marketData);
 
@@ -354,18 +373,13 @@ public sealed class STIV002A
         // Jump-diffusion models often have multi-modal error surfaces
         Numerical.STPR005A optimizer = new Numerical.STPR005A
         {
-            MaxGenerations = 500,
-            PopulationSize = 50, // 10 * dimension (5 parameters)
+            MaxGenerations = initialGuess is null ? ColdGenerations : WarmGenerations,
+            PopulationSize = initialGuess is null ? ColdPopulationSize : WarmPopulationSize,
             DifferentialWeight = 0.8,
             CrossoverProbability = 0.9,
             Tolerance = 1e-6
         };
 
-        // Parameter vector: [sigma, lambda, p, eta1, eta2]
-        // Parameter bounds
-        double[] lowerBounds = { 0.05, 0.0, 0.0, 1.01, 0.1 };
-        double[] upperBounds = { 1.0, 20.0, 1.0, 50.0, 50.0 };
-
         // Objective function (mean squared error)
         double Objective(double[] x)
         {
@@ -416,26 +430,107 @@ public sealed class STIV002A
         }
 
         // Run optimization
-        OptimizationResult result = optimizer.Minimize(Objective, lowerBounds, upperBounds);
+        double[]? seed = initialGuess is null
+            ? null
+            : new[] { initialGuess.Sigma, initialGuess.Lambda, initialGuess.P, initialGuess.Eta1, initialGuess.Eta2 };
+        OptimizationResult result = optimizer.Minimize(Objective, LowerBounds, UpperBounds, seed);
 
         if (result.Converged && result.OptimalValue < 1e9)
         {
-            return new KouParameters
-            {
-                Sigma = result.OptimalParameters[0],
-                Lambda = result.OptimalParameters[1],
-                P = result.OptimalParameters[2],
-                Eta1 = result.OptimalParameters[3],
-                Eta2 = result.OptimalParameters[4],
-                RiskFreeRate = riskFreeRate,
-                DividendYield = dividendYield
-            };
+            return ToParameters(result.OptimalParameters, riskFreeRate, dividendYield);
         }
 
         // Fallback: Try grid search if DE fails
         return CalibrateGridSearch(spot, marketData, riskFreeRate, dividendYield);
     }
 
+    /// <summary>
+    /// Refines a known fit with Levenberg-Marquardt on the IV residuals, without the global search.
+    /// </summary>
+    /// <remarks>
+    /// Meant for a start that already prices the surface well, such as yesterday's optimum on
+    /// a surface that has barely moved. The final iterate is returned even when LM stops on
+    /// its iteration limit, since it is never worse than the start.
+    /// </remarks>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="marketData">Market IV observations (strike, dte, iv).</param>
+    /// <param name="riskFreeRate">Risk-free rate.</param>
+    /// <param name="dividendYield">Dividend yield.</param>
+    /// <param name="start">Parameters to refine.</param>
+    /// <returns>Refined parameters.</returns>
+    public static KouParameters Refine(
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
+        double riskFreeRate,
+        double dividendYield,
+        KouParameters start)
+    {
+        ArgumentNullException.ThrowIfNull(marketData);
+        ArgumentNullException.ThrowIfNull(start);
+
+        Numerical.STPR004A optimizer = new Numerical.STPR004A
+        {
+            MaxIterations = 50,
+            ParameterTolerance = 1e-8,
+            ObjectiveTolerance = 1e-8
+        };
+
+        double[] Residuals(double[] x)
+        {
+            KouParameters candidateParams = ToParameters(x, riskFreeRate, dividendYield);
+            double[] residuals = new double[marketData.Count];
+
+            // Same penalties as the DE objective, per observation
+            if (!candidateParams.Validate().IsValid)
+            {
+                Array.Fill(residuals, 100.0);
+                return residuals;
+            }
+
+            STIV002A model = new STIV002A(candidateParams);
+            for (int i = 0; i < residuals.Length; i++)
+            {
+                (double strike, int dte, double marketIV) = marketData[i];
+
+                try
+                {
+                    residuals[i] = model.ComputeTheoreticalIV(spot, strike, TradingCalendarDefaults.DteToYears(dte)) - marketIV;
+                }
+#pragma warning disable CA1031 // Do not catch general exception types
+                catch (Exception)
+#pragma warning restore CA1031
+                {
+                    residuals[i] = 10.0;
+                }
+            }
+
+            return residuals;
+        }
+
+        double[] startingPoint = { start.Sigma, start.Lambda, start.P, start.Eta1, start.Eta2 };
+        for (int i = 0; i < startingPoint.Length; i++)
+        {
+            startingPoint[i] = Math.Clamp(startingPoint[i], LowerBounds[i], UpperBounds[i]);
+        }
+
+        OptimizationResult result = optimizer.Minimize(Residuals, startingPoint, LowerBounds, UpperBounds);
+        return ToParameters(result.OptimalParameters, riskFreeRate, dividendYield);
+    }
+
+    private static KouParameters ToParameters(IReadOnlyList<double> x, double riskFreeRate, double dividendYield)
+    {
+        return new KouParameters
+        {
+            Sigma = x[0],
+            Lambda = x[1],
+            P = x[2],
+            Eta1 = x[3],
+            Eta2 = x[4],
+            RiskFreeRate = riskFreeRate,
+            DividendYield = dividendYield
+        };
+    }
+
     /// <summary>
     /// Calibrates Kou parameters using grid search.
     /// LEGACY VERSION: Used as fallback when Differential Evolution fails.
@@ -500,6 +595,46 @@ public sealed class STIV002A
         return bestParams ?? KouParameters.DefaultEquity;
     }
 
+    /// <summary>
+    /// Root-mean-square implied volatility error of <paramref name="parameters"/> against
+    /// market quotes. Quotes the model cannot price add the calibration penalty error of 10.
+    /// </summary>
+    public static double ComputeSurfaceRmse(
+        KouParameters parameters,
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData)
+    {
+        ArgumentNullException.ThrowIfNull(parameters);
+        ArgumentNullException.ThrowIfNull(marketData);
+
+        if (marketData.Count == 0)
+        {
+            throw new ArgumentException("Need at least one market observation.", nameof(marketData));
+        }
+
+        STIV002A model = new STIV002A(parameters);
+        double sumSquaredError = 0;
+
+        foreach ((double strike, int dte, double marketIV) in marketData)
+        {
+            double timeToExpiry = TradingCalendarDefaults.DteToYears(dte);
+
+            try
+            {
+                double error = model.ComputeTheoreticalIV(spot, strike, timeToExpiry) - marketIV;
+                sumSquaredError += error * error;
+            }
+#pragma warning disable CA1031 // Do not catch general exception types
+            catch (Exception)
+#pragma warning restore CA1031
+            {
+                sumSquaredError += 100.0;
+            }
+        }
+
+        return Math.Sqrt(sumSquaredError / marketData.Count);
+    }
+
     private static double ComputeCalibrationError(
         STIV002A model,
         double spot,
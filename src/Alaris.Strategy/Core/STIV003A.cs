@@ -1,6 +1,8 @@
 // STIV003A.cs - selects the optimal IV model based on market conditions, fit metrics, and reg...
 
+using System.Diagnostics;
 using Alaris.Core.HotPath;
+using Alaris.Core.Math;
 using Alaris.Strategy.Calendar;
 
 namespace Alaris.Strategy.Core;
@@ -36,35 +38,43 @@ public sealed class STIV003A
     /// </summary>
     /// <param name="context">Market context including spot, IV surface, and regime.</param>
     /// <returns>Model selection result with fit metrics.</returns>
+    /// <remarks>
+    /// Market inputs shared by every candidate (year fractions, log-moneyness, vega weights,
+    /// expiry groups) are derived once, then the candidates are evaluated concurrently.
+    /// With <see cref="RegimeModelConfig.DominantFitRmse"/> or
+    /// <see cref="RegimeModelConfig.SelectionLatencyBudget"/> set, outstanding candidates are
+    /// cancelled once a dominant fit arrives, or once the budget has run out and a selectable
+    /// fit is in hand; cancelled candidates are reported but never selected.
+    /// </remarks>
     public ModelSelectionResult SelectBestModel(ModelSelectionContext context)
     {
         ArgumentNullException.ThrowIfNull(context);
 
+        Stopwatch selectionTimer = Stopwatch.StartNew();
+
         // Detect regime
         STTM002A regime = context.Regime ?? STTM002A.Detect(context.TimeParams);
 
         // Get candidate models based on regime
         IReadOnlyList<RecommendedModel> candidates = GetCandidateModels(regime);
 
-        // Evaluate each candidate
-        List<ModelEvaluation> evaluations = new List<ModelEvaluation>();
+        // Inputs shared by every candidate
+        SelectionInputs inputs = SelectionInputs.Create(context);
 
-        foreach (RecommendedModel candidate in candidates)
-        {
-            ModelEvaluation evaluation = EvaluateModel(candidate, context, regime);
-            evaluations.Add(evaluation);
-        }
+        // Evaluate candidates concurrently
+        List<ModelEvaluation> evaluations = EvaluateCandidates(candidates, context, inputs, selectionTimer);
 
         // Select best based on composite score - ZERO ALLOC
         ModelEvaluation? best = CRFN001A.FindMinBy<ModelEvaluation>(
             (IReadOnlyList<ModelEvaluation>)evaluations,
             e => e.CompositeScore,
-            e => e.MartingaleValid);
+            e => e.MartingaleValid && !e.Cancelled);
 
         if (best == null)
         {
             // Fall back to simplest valid model - ZERO ALLOC
-            best = CRFN001A.FindMinBy<ModelEvaluation>((IReadOnlyList<ModelEvaluation>)evaluations, e => e.Complexity)!;
+            best = CRFN001A.FindMinBy<ModelEvaluation>(
+                (IReadOnlyList<ModelEvaluation>)evaluations, e => e.Complexity, e => !e.Cancelled)!;
         }
 
         return new ModelSelectionResult
@@ -73,10 +83,95 @@ public sealed class STIV003A
             Regime = regime,
             Evaluations = evaluations.AsReadOnly(),
             BestEvaluation = best,
-            SelectionReason = GenerateSelectionReason(best, regime)
+            SelectionReason = GenerateSelectionReason(best, regime),
+            SelectionTime = selectionTimer.Elapsed
         };
     }
 
+    /// <summary>
+    /// Runs every candidate on the thread pool and applies the dominance and latency-budget
+    /// cancellation rules. Evaluations are returned in candidate order.
+    /// </summary>
+    private List<ModelEvaluation> EvaluateCandidates(
+        IReadOnlyList<RecommendedModel> candidates,
+        ModelSelectionContext context,
+        SelectionInputs inputs,
+        Stopwatch selectionTimer)
+    {
+        using CancellationTokenSource cancellation = new CancellationTokenSource();
+        CancellationToken token = cancellation.Token;
+
+        Task<ModelEvaluation>[] tasks = new Task<ModelEvaluation>[candidates.Count];
+        for (int i = 0; i < tasks.Length; i++)
+        {
+            RecommendedModel candidate = candidates[i];
+            tasks[i] = Task.Run(() => EvaluateModel(candidate, context, inputs, token), CancellationToken.None);
+        }
+
+        TimeSpan budget = _config.SelectionLatencyBudget;
+        List<Task<ModelEvaluation>> pending = new List<Task<ModelEvaluation>>(tasks);
+        bool haveSelectable = false;
+        bool budgetExpired = false;
+
+        while (pending.Count > 0)
+        {
+            TimeSpan remaining = budgetExpired || budget == Timeout.InfiniteTimeSpan
+                ? Timeout.InfiniteTimeSpan
+                : TimeSpan.FromTicks(Math.Max(0, (budget - selectionTimer.Elapsed).Ticks));
+
+#pragma warning disable CA1849 // Selection is synchronous; WaitAny bounds the wait by the latency budget
+            int completed = Task.WaitAny(pending.ToArray(), remaining);
+#pragma warning restore CA1849
+
+            if (completed < 0)
+            {
+                if (haveSelectable)
+                {
+                    // Budget spent and something selectable is in hand
+                    cancellation.Cancel();
+                    break;
+                }
+
+                // Nothing to select yet: wait for the first selectable result, then stop
+                budgetExpired = true;
+                continue;
+            }
+
+            ModelEvaluation evaluation = pending[completed].GetAwaiter().GetResult();
+            pending.RemoveAt(completed);
+
+            if (!evaluation.Cancelled && evaluation.MartingaleValid)
+            {
+                haveSelectable = true;
+
+                if (budgetExpired
+                    || (_config.DominantFitRmse > 0 && evaluation.FitMetrics.RMSE <= _config.DominantFitRmse))
+                {
+                    cancellation.Cancel();
+                    break;
+                }
+            }
+        }
+
+        // Cancelled candidates stop at their next checkpoint and report their elapsed time.
+        // Selection only considered results taken before the cancel, so a candidate that was
+        // still pending is reported as cancelled even if it finished before its next checkpoint.
+        bool cancelled = cancellation.IsCancellationRequested;
+        List<ModelEvaluation> evaluations = new List<ModelEvaluation>(tasks.Length);
+        foreach (Task<ModelEvaluation> task in tasks)
+        {
+            ModelEvaluation evaluation = task.GetAwaiter().GetResult();
+            if (cancelled && !evaluation.Cancelled && pending.Contains(task))
+            {
+                evaluation = CancelledEvaluation(evaluation.ModelType, evaluation.Complexity, evaluation.EvaluationTime);
+            }
+
+            evaluations.Add(evaluation);
+        }
+
+        return evaluations;
+    }
+
     /// <summary>
     /// Gets candidate models appropriate for the regime.
     /// </summary>
@@ -111,13 +206,24 @@ public sealed class STIV003A
     private ModelEvaluation EvaluateModel(
         RecommendedModel modelType,
         ModelSelectionContext context,
-        STTM002A regime)
+        SelectionInputs inputs,
+        CancellationToken cancellationToken)
     {
+        Stopwatch timer = Stopwatch.StartNew();
+
         // Get model complexity (number of parameters)
         int complexity = GetModelComplexity(modelType);
 
         // Compute fit metrics
-        FitMetrics fitMetrics = ComputeFitMetrics(modelType, context);
+        FitMetrics fitMetrics;
+        try
+        {
+            fitMetrics = ComputeFitMetrics(modelType, context, inputs, cancellationToken);
+        }
+        catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
+        {
+            return CancelledEvaluation(modelType, complexity, timer.Elapsed);
+        }
 
         // Validate martingale condition
         bool martingaleValid = _martingaleValidator.Validate(modelType, context);
@@ -138,7 +244,26 @@ public sealed class STIV003A
             AIC = aic,
             BIC = bic,
             MartingaleValid = martingaleValid,
-            CompositeScore = compositeScore
+            CompositeScore = compositeScore,
+            EvaluationTime = timer.Elapsed
+        };
+    }
+
+    /// <summary>
+    /// Evaluation reported for a candidate cancelled by the dominance or latency-budget rule.
+    /// </summary>
+    private static ModelEvaluation CancelledEvaluation(RecommendedModel modelType, int complexity, TimeSpan elapsed)
+    {
+        return new ModelEvaluation
+        {
+            ModelType = modelType,
+            FitMetrics = FitMetrics.Default,
+            Complexity = complexity,
+            AIC = double.MaxValue,
+            BIC = double.MaxValue,
+            CompositeScore = double.MaxValue,
+            Cancelled = true,
+            EvaluationTime = elapsed
         };
     }
 
@@ -147,54 +272,39 @@ public sealed class STIV003A
     /// </summary>
     private static FitMetrics ComputeFitMetrics(
         RecommendedModel modelType,
-        ModelSelectionContext context)
+        ModelSelectionContext context,
+        SelectionInputs inputs,
+        CancellationToken cancellationToken)
     {
-        if (context.MarketIVs == null || context.MarketIVs.Count == 0)
+        int n = inputs.Count;
+        if (n == 0)
         {
             return FitMetrics.Default;
         }
 
-        IReadOnlyList<double> modelIVs = ComputeModelIVs(modelType, context);
-
-        if (modelIVs.Count != context.MarketIVs.Count)
-        {
-            return FitMetrics.Default;
-        }
+        double[] modelIVs = ComputeModelIVs(modelType, context, inputs, cancellationToken);
 
         // Compute error metrics
         double sumSquaredError = 0;
         double sumAbsError = 0;
         double maxError = 0;
+        double weightedSquaredError = 0;
 
-        for (int i = 0; i < context.MarketIVs.Count; i++)
+        for (int i = 0; i < n; i++)
         {
-            double error = modelIVs[i] - context.MarketIVs[i].IV;
+            double error = modelIVs[i] - inputs.MarketIVs[i];
             sumSquaredError += error * error;
             sumAbsError += Math.Abs(error);
             maxError = Math.Max(maxError, Math.Abs(error));
+            weightedSquaredError += inputs.VegaWeights[i] * error * error;
         }
 
-        int n = context.MarketIVs.Count;
         double mse = sumSquaredError / n;
         double rmse = Math.Sqrt(mse);
         double mae = sumAbsError / n;
 
         // Compute R-squared
-        double meanIV = 0.0;
-        for (int i = 0; i < context.MarketIVs.Count; i++)
-        {
-            meanIV += context.MarketIVs[i].IV;
-        }
-
-        meanIV /= context.MarketIVs.Count;
-
-        double totalSS = 0.0;
-        for (int i = 0; i < context.MarketIVs.Count; i++)
-        {
-            double diff = context.MarketIVs[i].IV - meanIV;
-            totalSS += diff * diff;
-        }
-        double rSquared = totalSS > 0 ? 1 - (sumSquaredError / totalSS) : 0;
+        double rSquared = inputs.TotalSumOfSquares > 0 ? 1 - (sumSquaredError / inputs.TotalSumOfSquares) : 0;
 
         return new FitMetrics
         {
@@ -202,28 +312,54 @@ public sealed class STIV003A
             RMSE = rmse,
             MAE = mae,
             MaxError = maxError,
-            RSquared = Math.Max(0, rSquared)
+            RSquared = Math.Max(0, rSquared),
+            VegaWeightedRMSE = Math.Sqrt(weightedSquaredError)
         };
     }
 
     /// <summary>
     /// Computes model IVs for comparison with market.
+    /// Heston prices each expiry as one COS slice; the other models go quote by quote.
     /// </summary>
-    private static IReadOnlyList<double> ComputeModelIVs(
+    private static double[] ComputeModelIVs(
         RecommendedModel modelType,
-        ModelSelectionContext context)
+        ModelSelectionContext context,
+        SelectionInputs inputs,
+        CancellationToken cancellationToken)
     {
-        List<double> result = new List<double>();
+        double[] result = new double[inputs.Count];
 
-        if (context.MarketIVs == null)
+        if (modelType == RecommendedModel.Heston && context.HestonParams != null)
         {
+            STIV001A heston = new STIV001A(context.HestonParams);
+            foreach (SelectionInputs.ExpiryGroup group in inputs.Expiries)
+            {
+                cancellationToken.ThrowIfCancellationRequested();
+
+                (double Strike, double TheoreticalIV)[] smile =
+                    heston.ComputeSmile(context.Spot, group.Strikes, group.TimeToExpiry);
+                for (int j = 0; j < smile.Length; j++)
+                {
+                    // Strikes the slice cannot invert fall back to the per-strike solver
+                    result[group.Indices[j]] = double.IsNaN(smile[j].TheoreticalIV)
+                        ? heston.ComputeTheoreticalIV(context.Spot, group.Strikes[j], group.TimeToExpiry)
+                        : smile[j].TheoreticalIV;
+                }
+            }
+
             return result;
         }
 
-        foreach ((double strike, int dte, double _) in context.MarketIVs)
+        STIV002A? kou = modelType == RecommendedModel.Kou && context.KouParams != null
+            ? new STIV002A(context.KouParams)
+            : null;
+
+        for (int i = 0; i < inputs.Count; i++)
         {
-            double timeToExpiry = TradingCalendarDefaults.DteToYears(dte);
-            double modelIV = modelType switch
+            cancellationToken.ThrowIfCancellationRequested();
+
+            double timeToExpiry = inputs.TimeToExpiries[i];
+            result[i] = modelType switch
             {
                 RecommendedModel.BlackScholes =>
                     context.BaseVolatility,
@@ -234,18 +370,11 @@ public sealed class STIV003A
                         context.EarningsJumpVolatility.Value,
                         timeToExpiry),
 
-                RecommendedModel.Heston when context.HestonParams != null =>
-                    new STIV001A(context.HestonParams)
-                        .ComputeTheoreticalIV(context.Spot, strike, timeToExpiry),
-
-                RecommendedModel.Kou when context.KouParams != null =>
-                    new STIV002A(context.KouParams)
-                        .ComputeTheoreticalIV(context.Spot, strike, timeToExpiry),
+                RecommendedModel.Kou when kou != null =>
+                    kou.ComputeTheoreticalIV(context.Spot, inputs.Strikes[i], timeToExpiry),
 
                 _ => context.BaseVolatility
             };
-
-            result.Add(modelIV);
         }
 
         return result;
@@ -319,6 +448,117 @@ public sealed class STIV003A
                $"RMSE={best.FitMetrics.RMSE:P2}, R²={best.FitMetrics.RSquared:F3}, " +
                $"Martingale={best.MartingaleValid}";
     }
+
+    /// <summary>
+    /// Market inputs derived once per selection and shared read-only by every candidate.
+    /// </summary>
+    private sealed class SelectionInputs
+    {
+        private SelectionInputs(int count)
+        {
+            Strikes = new double[count];
+            MarketIVs = new double[count];
+            TimeToExpiries = new double[count];
+            LogMoneyness = new double[count];
+            VegaWeights = new double[count];
+        }
+
+        public int Count => Strikes.Length;
+
+        public double[] Strikes { get; }
+
+        public double[] MarketIVs { get; }
+
+        /// <summary>Year fractions from the trading calendar.</summary>
+        public double[] TimeToExpiries { get; }
+
+        /// <summary>Normalized strikes, ln(K/S).</summary>
+        public double[] LogMoneyness { get; }
+
+        /// <summary>Black-Scholes vega at the market IV, normalized to sum to one.</summary>
+        public double[] VegaWeights { get; }
+
+        /// <summary>Total sum of squares of the market IVs about their mean, for R-squared.</summary>
+        public double TotalSumOfSquares { get; private set; }
+
+        /// <summary>Quotes grouped by expiry for slice pricers.</summary>
+        public IReadOnlyList<ExpiryGroup> Expiries { get; private set; } = Array.Empty<ExpiryGroup>();
+
+        public static SelectionInputs Create(ModelSelectionContext context)
+        {
+            IReadOnlyList<(double Strike, int DTE, double IV)>? quotes = context.MarketIVs;
+            SelectionInputs inputs = new SelectionInputs(quotes?.Count ?? 0);
+            if (quotes is null || quotes.Count == 0)
+            {
+                return inputs;
+            }
+
+            Dictionary<int, List<int>> byDte = new Dictionary<int, List<int>>();
+            double meanIV = 0.0;
+            double totalVega = 0.0;
+
+            for (int i = 0; i < quotes.Count; i++)
+            {
+                (double strike, int dte, double iv) = quotes[i];
+                double timeToExpiry = TradingCalendarDefaults.DteToYears(dte);
+
+                inputs.Strikes[i] = strike;
+                inputs.MarketIVs[i] = iv;
+                inputs.TimeToExpiries[i] = timeToExpiry;
+                inputs.LogMoneyness[i] = Math.Log(strike / context.Spot);
+
+                double vega = iv > 0 && timeToExpiry > 0
+                    ? CRMF001A.BSVega(context.Spot, strike, timeToExpiry, iv, context.RiskFreeRate, context.DividendYield)
+                    : 0.0;
+                inputs.VegaWeights[i] = vega;
+                totalVega += vega;
+                meanIV += iv;
+
+                if (!byDte.TryGetValue(dte, out List<int>? indices))
+                {
+                    indices = new List<int>();
+                    byDte[dte] = indices;
+                }
+
+                indices.Add(i);
+            }
+
+            meanIV /= quotes.Count;
+
+            double totalSS = 0.0;
+            for (int i = 0; i < quotes.Count; i++)
+            {
+                double diff = inputs.MarketIVs[i] - meanIV;
+                totalSS += diff * diff;
+
+                // Equal weights when no quote carries vega
+                inputs.VegaWeights[i] = totalVega > 0 ? inputs.VegaWeights[i] / totalVega : 1.0 / quotes.Count;
+            }
+
+            inputs.TotalSumOfSquares = totalSS;
+
+            List<ExpiryGroup> expiries = new List<ExpiryGroup>(byDte.Count);
+            foreach (KeyValuePair<int, List<int>> entry in byDte)
+            {
+                int[] indices = entry.Value.ToArray();
+                double[] strikes = new double[indices.Length];
+                for (int j = 0; j < indices.Length; j++)
+                {
+                    strikes[j] = inputs.Strikes[indices[j]];
+                }
+
+                expiries.Add(new ExpiryGroup(inputs.TimeToExpiries[indices[0]], strikes, indices));
+            }
+
+            inputs.Expiries = expiries;
+            return inputs;
+        }
+
+        /// <summary>
+        /// Quotes sharing one expiry.
+        /// </summary>
+        public sealed record ExpiryGroup(double TimeToExpiry, double[] Strikes, int[] Indices);
+    }
 }
 
 /// <summary>
@@ -499,6 +739,11 @@ public sealed class ModelSelectionResult
     /// Human-readable selection reason.
     /// </summary>
     public string SelectionReason { get; init; } = string.Empty;
+
+    /// <summary>
+    /// Wall-clock time spent selecting, including concurrent candidate evaluation.
+    /// </summary>
+    public TimeSpan SelectionTime { get; init; }
 }
 
 /// <summary>
@@ -540,6 +785,17 @@ public sealed class ModelEvaluation
     /// Composite selection score (lower is better).
     /// </summary>
     public double CompositeScore { get; init; }
+
+    /// <summary>
+    /// Whether the evaluation was cancelled by the selection latency budget or a dominant fit.
+    /// Cancelled evaluations carry default metrics and are never selected.
+    /// </summary>
+    public bool Cancelled { get; init; }
+
+    /// <summary>
+    /// Time spent evaluating this model.
+    /// </summary>
+    public TimeSpan EvaluationTime { get; init; }
 }
 
 /// <summary>
@@ -572,6 +828,11 @@ public sealed class FitMetrics
     /// </summary>
     public double RSquared { get; init; }
 
+    /// <summary>
+    /// Root mean squared error with quotes weighted by their Black-Scholes vega.
+    /// </summary>
+    public double VegaWeightedRMSE { get; init; }
+
     /// <summary>
     /// Default metrics for missing data.
     /// </summary>
@@ -581,6 +842,7 @@ public sealed class FitMetrics
         RMSE = 1.0,
         MAE = 1.0,
         MaxError = 1.0,
-        RSquared = 0.0
+        RSquared = 0.0,
+        VegaWeightedRMSE = 1.0
     };
 }
@@ -0,0 +1,303 @@
+// STIV011A.cs - warm-start calibration store for Heston and Kou models
+
+using System.Collections.Concurrent;
+using System.Text.Json;
+
+namespace Alaris.Strategy.Core;
+
+/// <summary>
+/// Per-symbol store of the last Heston and Kou calibrations, used to warm-start the next one.
+/// </summary>
+/// <remarks>
+/// A daily backtest recalibrates each symbol against a surface that has barely moved.
+/// Before optimizing, the stored optimum is priced against today's quotes:
+/// - RMSE within <see cref="ReuseTolerance"/>: Levenberg-Marquardt refines the stored fit; the
+///   global search (Kou's differential evolution, either model's grid search) is skipped.
+/// - Otherwise: the optimizer is seeded with the stored optimum instead of the ATM-derived guess,
+///   and a seeded Kou search runs a smaller population for fewer generations.
+/// - No stored fit: a cold calibration is run.
+/// The store is thread-safe and can be persisted to a session folder between runs.
+/// </remarks>
+public sealed class STIV011A
+{
+    /// <summary>
+    /// Default IV RMSE below which a stored fit is only refined locally (50 bps).
+    /// </summary>
+    public const double DefaultReuseTolerance = 0.005;
+
+    /// <summary>
+    /// File name used when the store is persisted to a directory.
+    /// </summary>
+    public const string FileName = "calibration-store.json";
+
+    private static readonly JsonSerializerOptions JsonOptions = new JsonSerializerOptions
+    {
+        WriteIndented = true
+    };
+
+    private readonly ConcurrentDictionary<string, CalibrationSeed<HestonParameters>> _heston =
+        new ConcurrentDictionary<string, CalibrationSeed<HestonParameters>>(StringComparer.OrdinalIgnoreCase);
+    private readonly ConcurrentDictionary<string, CalibrationSeed<KouParameters>> _kou =
+        new ConcurrentDictionary<string, CalibrationSeed<KouParameters>>(StringComparer.OrdinalIgnoreCase);
+    private readonly string? _persistencePath;
+
+    private long _reuseHits;
+    private long _warmStarts;
+    private long _coldStarts;
+
+    /// <summary>
+    /// Initialises a new calibration store.
+    /// </summary>
+    /// <param name="persistenceDirectory">
+    /// Optional directory (e.g. the session folder). An existing store file there is loaded,
+    /// and <see cref="Save"/> writes back to it.
+    /// </param>
+    /// <param name="reuseTolerance">IV RMSE below which a stored fit is only refined locally.</param>
+    public STIV011A(string? persistenceDirectory = null, double reuseTolerance = DefaultReuseTolerance)
+    {
+        if (reuseTolerance < 0 || double.IsNaN(reuseTolerance))
+        {
+            throw new ArgumentOutOfRangeException(nameof(reuseTolerance), "Reuse tolerance must be non-negative.");
+        }
+
+        ReuseTolerance = reuseTolerance;
+
+        if (persistenceDirectory is not null)
+        {
+            _persistencePath = Path.Combine(persistenceDirectory, FileName);
+            Load(_persistencePath);
+        }
+    }
+
+    /// <summary>
+    /// IV RMSE below which a stored fit is only refined locally, without the global search.
+    /// </summary>
+    public double ReuseTolerance { get; }
+
+    /// <summary>
+    /// Calibrations answered by refining a stored fit locally, without the global search.
+    /// </summary>
+    public long ReuseHits => Interlocked.Read(ref _reuseHits);
+
+    /// <summary>
+    /// Calibrations seeded from a stored fit.
+    /// </summary>
+    public long WarmStarts => Interlocked.Read(ref _warmStarts);
+
+    /// <summary>
+    /// Calibrations run without a stored fit.
+    /// </summary>
+    public long ColdStarts => Interlocked.Read(ref _coldStarts);
+
+    /// <summary>
+    /// Number of symbols with at least one stored fit.
+    /// </summary>
+    public int SymbolCount => _heston.Keys.Union(_kou.Keys, StringComparer.OrdinalIgnoreCase).Count();
+
+    /// <summary>
+    /// Calibrates Heston parameters for a symbol, refining or warm-starting from its stored fit.
+    /// </summary>
+    public HestonParameters CalibrateHeston(
+        string symbol,
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
+        double riskFreeRate,
+        double dividendYield,
+        HestonCalibrationObjective objective = HestonCalibrationObjective.VegaWeightedPrice)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(symbol);
+        ArgumentNullException.ThrowIfNull(marketData);
+
+        HestonParameters? previous = null;
+        if (_heston.TryGetValue(symbol, out CalibrationSeed<HestonParameters>? seed))
+        {
+            previous = new HestonParameters
+            {
+                V0 = seed.Parameters.V0,
+                Theta = seed.Parameters.Theta,
+                Kappa = seed.Parameters.Kappa,
+                SigmaV = seed.Parameters.SigmaV,
+                Rho = seed.Parameters.Rho,
+                RiskFreeRate = riskFreeRate,
+                DividendYield = dividendYield
+            };
+
+            double previousRmse = STIV001A.ComputeSurfaceRmse(previous, spot, marketData);
+            if (previousRmse <= ReuseTolerance)
+            {
+                Interlocked.Increment(ref _reuseHits);
+                HestonParameters refined = STIV001A.Refine(spot, marketData, riskFreeRate, dividendYield, previous, objective);
+                return StoreBetter(_heston, symbol, refined, STIV001A.ComputeSurfaceRmse(refined, spot, marketData), previous, previousRmse);
+            }
+
+            Interlocked.Increment(ref _warmStarts);
+        }
+        else
+        {
+            Interlocked.Increment(ref _coldStarts);
+        }
+
+        HestonParameters fitted = STIV001A.Calibrate(
+            spot, marketData, riskFreeRate, dividendYield, objective, previous);
+        double rmse = STIV001A.ComputeSurfaceRmse(fitted, spot, marketData);
+        _heston[symbol] = new CalibrationSeed<HestonParameters>(fitted, rmse);
+
+        return fitted;
+    }
+
+    /// <summary>
+    /// Calibrates Kou parameters for a symbol, refining or warm-starting from its stored fit.
+    /// </summary>
+    public KouParameters CalibrateKou(
+        string symbol,
+        double spot,
+        IReadOnlyList<(double Strike, int DTE, double MarketIV)> marketData,
+        double riskFreeRate,
+        double dividendYield)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(symbol);
+        ArgumentNullException.ThrowIfNull(marketData);
+
+        KouParameters? previous = null;
+        if (_kou.TryGetValue(symbol, out CalibrationSeed<KouParameters>? seed))
+        {
+            previous = new KouParameters
+            {
+                Sigma = seed.Parameters.Sigma,
+                Lambda = seed.Parameters.Lambda,
+                P = seed.Parameters.P,
+                Eta1 = seed.Parameters.Eta1,
+                Eta2 = seed.Parameters.Eta2,
+                RiskFreeRate = riskFreeRate,
+                DividendYield = dividendYield
+            };
+
+            double previousRmse = STIV002A.ComputeSurfaceRmse(previous, spot, marketData);
+            if (previousRmse <= ReuseTolerance)
+            {
+                Interlocked.Increment(ref _reuseHits);
+                KouParameters refined = STIV002A.Refine(spot, marketData, riskFreeRate, dividendYield, previous);
+                return StoreBetter(_kou, symbol, refined, STIV002A.ComputeSurfaceRmse(refined, spot, marketData), previous, previousRmse);
+            }
+
+            Interlocked.Increment(ref _warmStarts);
+        }
+        else
+        {
+            Interlocked.Increment(ref _coldStarts);
+        }
+
+        KouParameters fitted = STIV002A.Calibrate(spot, marketData, riskFreeRate, dividendYield, previous);
+        double rmse = STIV002A.ComputeSurfaceRmse(fitted, spot, marketData);
+        _kou[symbol] = new CalibrationSeed<KouParameters>(fitted, rmse);
+
+        return fitted;
+    }
+
+    /// <summary>
+    /// Stores and returns the refined fit, or the stored one if refining raised the IV RMSE
+    /// (the Heston LM objective is price-based, so it need not lower the IV RMSE).
+    /// </summary>
+    private static TParameters StoreBetter<TParameters>(
+        ConcurrentDictionary<string, CalibrationSeed<TParameters>> store,
+        string symbol,
+        TParameters refined,
+        double refinedRmse,
+        TParameters previous,
+        double previousRmse)
+        where TParameters : class
+    {
+        CalibrationSeed<TParameters> kept = refinedRmse <= previousRmse
+            ? new CalibrationSeed<TParameters>(refined, refinedRmse)
+            : new CalibrationSeed<TParameters>(previous, previousRmse);
+        store[symbol] = kept;
+        return kept.Parameters;
+    }
+
+    /// <summary>
+    /// Gets the stored Heston fit for a symbol.
+    /// </summary>
+    public bool TryGetHeston(string symbol, out CalibrationSeed<HestonParameters>? seed)
+    {
+        ArgumentNullException.ThrowIfNull(symbol);
+        return _heston.TryGetValue(symbol, out seed);
+    }
+
+    /// <summary>
+    /// Gets the stored Kou fit for a symbol.
+    /// </summary>
+    public bool TryGetKou(string symbol, out CalibrationSeed<KouParameters>? seed)
+    {
+        ArgumentNullException.ThrowIfNull(symbol);
+        return _kou.TryGetValue(symbol, out seed);
+    }
+
+    /// <summary>
+    /// Writes the store to the persistence directory given at construction.
+    /// </summary>
+    /// <exception cref="InvalidOperationException">The store was created without a persistence directory.</exception>
+    public void Save()
+    {
+        if (_persistencePath is null)
+        {
+            throw new InvalidOperationException("Calibration store was created without a persistence directory.");
+        }
+
+        CalibrationStoreDocument document = new CalibrationStoreDocument
+        {
+            Heston = new Dictionary<string, CalibrationSeed<HestonParameters>>(_heston, StringComparer.OrdinalIgnoreCase),
+            Kou = new Dictionary<string, CalibrationSeed<KouParameters>>(_kou, StringComparer.OrdinalIgnoreCase)
+        };
+
+        // Write-then-rename so a crash mid-write never leaves a truncated store behind
+        string temporaryPath = _persistencePath + ".tmp";
+        File.WriteAllText(temporaryPath, JsonSerializer.Serialize(document, JsonOptions));
+        File.Move(temporaryPath, _persistencePath, overwrite: true);
+    }
+
+    private void Load(string path)
+    {
+        if (!File.Exists(path))
+        {
+            return;
+        }
+
+        CalibrationStoreDocument? document =
+            JsonSerializer.Deserialize<CalibrationStoreDocument>(File.ReadAllText(path), JsonOptions);
+        if (document is null)
+        {
+            return;
+        }
+
+        foreach (KeyValuePair<string, CalibrationSeed<HestonParameters>> entry in document.Heston)
+        {
+            _heston[entry.Key] = entry.Value;
+        }
+
+        foreach (KeyValuePair<string, CalibrationSeed<KouParameters>> entry in document.Kou)
+        {
+            _kou[entry.Key] = entry.Value;
+        }
+    }
+
+    /// <summary>
+    /// Serialized form of the store.
+    /// </summary>
+    private sealed class CalibrationStoreDocument
+    {
+        public Dictionary<string, CalibrationSeed<HestonParameters>> Heston { get; init; } =
+            new Dictionary<string, CalibrationSeed<HestonParameters>>();
+
+        public Dictionary<string, CalibrationSeed<KouParameters>> Kou { get; init; } =
+            new Dictionary<string, CalibrationSeed<KouParameters>>();
+    }
+}
+
+/// <summary>
+/// A stored calibration: the fitted parameters and their IV RMSE on the quotes they were last checked against.
+/// </summary>
+/// <typeparam name="TParameters">Model parameter type.</typeparam>
+/// <param name="Parameters">Fitted model parameters.</param>
+/// <param name="Rmse">Implied volatility RMSE of the fit.</param>
+public sealed record CalibrationSeed<TParameters>(TParameters Parameters, double Rmse)
+    where TParameters : class;
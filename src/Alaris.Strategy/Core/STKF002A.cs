@@ -0,0 +1,308 @@
+// STKF002A.cs - cross-sectional kalman volatility filter over a symbol universe
+
+using System.Numerics;
+using System.Runtime.Intrinsics;
+
+namespace Alaris.Strategy.Core;
+
+/// <summary>
+/// Runs the <see cref="STKF001A"/> Kalman volatility filter for a whole universe of symbols at once.
+/// </summary>
+/// <remarks>
+/// <para>
+/// State, covariance, process parameters and diagnostics are held in one array per field,
+/// indexed by symbol, and <see cref="UpdateAll"/> advances every symbol by one step four
+/// lanes at a time on <see cref="Vector256{T}"/>. A NaN measurement takes the
+/// <see cref="STKF001A.SkipMeasurement"/> path for that symbol: its lane keeps the
+/// predicted state and leaves the diagnostics of its last measurement untouched.
+/// </para>
+/// <para>
+/// Each step performs the same operations in the same order as the per-symbol filter, so
+/// the two agree bit for bit.
+/// </para>
+/// </remarks>
+public sealed class STKF002A
+{
+    // Symbols per Vector256 lane group in the filter step
+    private const int LaneCount = 4;
+
+    // Same prior as a freshly constructed STKF001A
+    private const double DefaultInitialVolatility = 0.20;
+    private const double DefaultInitialUncertainty = 0.01;
+
+    // Yang-Zhang efficiency η in Var(σ̂_YZ) ≈ σ²/(2n×η)
+    private const double YangZhangEfficiency = 8.0;
+
+    // State estimate [σ, dσ/dt] and covariance P per symbol
+    private readonly double[] _sigma;
+    private readonly double[] _sigmaDot;
+    private readonly double[] _p11;
+    private readonly double[] _p12;
+    private readonly double[] _p22;
+
+    // Process parameters per symbol
+    private readonly double[] _deltaT;
+    private readonly double[] _phi;
+    private readonly double[] _qSigma;
+    private readonly double[] _qSigmaDot;
+
+    // Diagnostics of the last measurement per symbol
+    private readonly double[] _lastYangZhang;
+    private readonly double[] _lastKalmanGain;
+    private readonly double[] _lastInnovation;
+    private readonly int[] _updateCount;
+
+    /// <summary>
+    /// Initialises a filter for a universe of symbols, each at the <see cref="STKF001A"/> default prior.
+    /// </summary>
+    /// <param name="count">Number of symbols.</param>
+    /// <param name="parameters">Filter parameters for every symbol; uses defaults if null.</param>
+    public STKF002A(int count, KalmanParameters? parameters = null)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegative(count);
+
+        Count = count;
+        _sigma = new double[count];
+        _sigmaDot = new double[count];
+        _p11 = new double[count];
+        _p12 = new double[count];
+        _p22 = new double[count];
+        _deltaT = new double[count];
+        _phi = new double[count];
+        _qSigma = new double[count];
+        _qSigmaDot = new double[count];
+        _lastYangZhang = new double[count];
+        _lastKalmanGain = new double[count];
+        _lastInnovation = new double[count];
+        _updateCount = new int[count];
+
+        KalmanParameters initial = parameters ?? KalmanParameters.Default;
+        for (int i = 0; i < count; i++)
+        {
+            SetParameters(i, initial);
+            Reset(i, DefaultInitialVolatility, DefaultInitialUncertainty);
+        }
+    }
+
+    /// <summary>
+    /// Gets the number of symbols in the universe.
+    /// </summary>
+    public int Count { get; }
+
+    /// <summary>
+    /// Gets the filtered volatility estimate of every symbol.
+    /// </summary>
+    public ReadOnlySpan<double> Volatility => _sigma;
+
+    /// <summary>
+    /// Gets the volatility drift estimate of every symbol.
+    /// </summary>
+    public ReadOnlySpan<double> VolatilityDrift => _sigmaDot;
+
+    /// <summary>
+    /// Gets the estimation variance P[1,1] of every symbol.
+    /// </summary>
+    public ReadOnlySpan<double> Variance => _p11;
+
+    /// <summary>
+    /// Gets the number of measurement updates a symbol has received since its last reset.
+    /// </summary>
+    /// <param name="index">The symbol index.</param>
+    public int GetUpdateCount(int index) => _updateCount[index];
+
+    /// <summary>
+    /// Sets the process parameters of one symbol, effective from the next step.
+    /// </summary>
+    /// <param name="index">The symbol index.</param>
+    /// <param name="parameters">The filter parameters.</param>
+    /// <remarks>The drift prior P[2,2] is only taken from the parameters on <see cref="Reset"/>.</remarks>
+    public void SetParameters(int index, KalmanParameters parameters)
+    {
+        _deltaT[index] = parameters.DeltaT;
+        _phi[index] = parameters.Phi;
+        _qSigma[index] = parameters.QSigma;
+        _qSigmaDot[index] = parameters.QSigmaDot;
+    }
+
+    /// <summary>
+    /// Resets one symbol to initial conditions.
+    /// </summary>
+    /// <param name="index">The symbol index.</param>
+    /// <param name="initialVolatility">Initial volatility estimate.</param>
+    /// <param name="initialUncertainty">Initial standard error of the estimate.</param>
+    public void Reset(int index, double initialVolatility, double initialUncertainty)
+    {
+        _sigma[index] = initialVolatility;
+        _sigmaDot[index] = 0.0;
+        _p11[index] = initialUncertainty * initialUncertainty;
+        _p12[index] = 0.0;
+        _p22[index] = _qSigmaDot[index];
+        _updateCount[index] = 0;
+        _lastYangZhang[index] = initialVolatility;
+        _lastKalmanGain[index] = 0.0;
+        _lastInnovation[index] = 0.0;
+    }
+
+    /// <summary>
+    /// Gets the current complete filter state of one symbol.
+    /// </summary>
+    /// <param name="index">The symbol index.</param>
+    /// <returns>The estimate, as <see cref="STKF001A.CurrentEstimate"/> reports it.</returns>
+    public KalmanVolatilityEstimate GetEstimate(int index) => new(
+        Volatility: _sigma[index],
+        VolatilityDrift: _sigmaDot[index],
+        Variance: _p11[index],
+        StandardError: Math.Sqrt(Math.Max(0, _p11[index])),
+        YangZhangRaw: _lastYangZhang[index],
+        KalmanGain: _lastKalmanGain[index],
+        Innovation: _lastInnovation[index],
+        MeasurementNoise: double.NaN);
+
+    /// <summary>
+    /// Advances every symbol by one filter step.
+    /// </summary>
+    /// <param name="measurements">Yang-Zhang volatility per symbol; NaN skips the measurement update.</param>
+    /// <param name="sampleSizes">Number of bars behind each measurement.</param>
+    public void UpdateAll(ReadOnlySpan<double> measurements, ReadOnlySpan<int> sampleSizes)
+    {
+        if (measurements.Length != Count)
+        {
+            throw new ArgumentException($"Expected {Count} measurements", nameof(measurements));
+        }
+
+        if (sampleSizes.Length != Count)
+        {
+            throw new ArgumentException($"Expected {Count} sample sizes", nameof(sampleSizes));
+        }
+
+        int vectorEnd = Vector256.IsHardwareAccelerated ? Count - (Count % LaneCount) : 0;
+        for (int i = 0; i < vectorEnd; i += LaneCount)
+        {
+            UpdateLaneGroup(i, measurements.Slice(i, LaneCount), sampleSizes.Slice(i, LaneCount));
+        }
+
+        for (int i = vectorEnd; i < Count; i++)
+        {
+            UpdateLane(i, measurements[i], sampleSizes[i]);
+        }
+    }
+
+    /// <summary>
+    /// One predict/update step for four symbols; skipped lanes keep the prediction.
+    /// </summary>
+    private void UpdateLaneGroup(int start, ReadOnlySpan<double> measurements, ReadOnlySpan<int> sampleSizes)
+    {
+        Vector256<double> sigma = Load(_sigma, start);
+        Vector256<double> sigmaDot = Load(_sigmaDot, start);
+        Vector256<double> p11 = Load(_p11, start);
+        Vector256<double> p12 = Load(_p12, start);
+        Vector256<double> p22 = Load(_p22, start);
+        Vector256<double> deltaT = Load(_deltaT, start);
+        Vector256<double> phi = Load(_phi, start);
+        Vector256<double> two = Vector256.Create(2.0);
+
+        // Predict: x̂ = F·x̂, P = F·P·Fᵀ + Q
+        Vector256<double> sigmaPred = sigma + (deltaT * sigmaDot);
+        Vector256<double> sigmaDotPred = phi * sigmaDot;
+        Vector256<double> p11Pred = p11 + (two * deltaT * p12)
+                                    + (deltaT * deltaT * p22) + Load(_qSigma, start);
+        Vector256<double> p12Pred = phi * (p12 + (deltaT * p22));
+        Vector256<double> p22Pred = (phi * phi * p22) + Load(_qSigmaDot, start);
+
+        // Measurement noise R = max(z²/(2n×η), 1e-8)
+        Vector256<double> z = Vector256.Create(measurements);
+        Vector256<double> n = Vector256.Create(
+            (double)sampleSizes[0], sampleSizes[1], sampleSizes[2], sampleSizes[3]);
+        Vector256<double> measurementNoise = Vector256.Max(
+            z * z / (two * n * Vector256.Create(YangZhangEfficiency)),
+            Vector256.Create(1e-8));
+
+        // Update with gain K = P·Hᵀ/S, S = P[1,1] + R
+        Vector256<double> innovation = z - sigmaPred;
+        Vector256<double> innovationCov = p11Pred + measurementNoise;
+        Vector256<double> k1 = p11Pred / innovationCov;
+        Vector256<double> k2 = p12Pred / innovationCov;
+
+        Vector256<double> sigmaUpd = sigmaPred + (k1 * innovation);
+        Vector256<double> sigmaDotUpd = sigmaDotPred + (k2 * innovation);
+
+        // Joseph-form covariance, as in STKF001A
+        Vector256<double> oneMinusK1 = Vector256<double>.One - k1;
+        Vector256<double> p11Upd = (oneMinusK1 * oneMinusK1 * p11Pred) + (k1 * k1 * measurementNoise);
+        Vector256<double> p12Upd = (oneMinusK1 * p12Pred) - (k1 * k2 * p11Pred) + (k2 * oneMinusK1 * p12Pred);
+        Vector256<double> p22Upd = p22Pred - (k2 * p12Pred) - (k2 * (p12Pred - (k2 * p22Pred)));
+        Vector256<double> floor = Vector256.Create(1e-10);
+        p11Upd = Vector256.Max(p11Upd, floor);
+        p22Upd = Vector256.Max(p22Upd, floor);
+
+        // NaN measurements fail z == z and keep the predict-only result
+        Vector256<double> measured = Vector256.Equals(z, z);
+        Store(Vector256.ConditionalSelect(measured, sigmaUpd, sigmaPred), _sigma, start);
+        Store(Vector256.ConditionalSelect(measured, sigmaDotUpd, sigmaDotPred), _sigmaDot, start);
+        Store(Vector256.ConditionalSelect(measured, p11Upd, p11Pred), _p11, start);
+        Store(Vector256.ConditionalSelect(measured, p12Upd, p12Pred), _p12, start);
+        Store(Vector256.ConditionalSelect(measured, p22Upd, p22Pred), _p22, start);
+        Store(Vector256.ConditionalSelect(measured, z, Load(_lastYangZhang, start)), _lastYangZhang, start);
+        Store(Vector256.ConditionalSelect(measured, k1, Load(_lastKalmanGain, start)), _lastKalmanGain, start);
+        Store(Vector256.ConditionalSelect(measured, innovation, Load(_lastInnovation, start)), _lastInnovation, start);
+
+        uint lanes = measured.ExtractMostSignificantBits();
+        while (lanes != 0)
+        {
+            _updateCount[start + BitOperations.TrailingZeroCount(lanes)]++;
+            lanes &= lanes - 1;
+        }
+    }
+
+    /// <summary>
+    /// One predict/update step for a single symbol, mirroring <see cref="UpdateLaneGroup"/>.
+    /// </summary>
+    private void UpdateLane(int i, double z, int sampleSize)
+    {
+        double deltaT = _deltaT[i];
+        double phi = _phi[i];
+
+        double sigmaPred = _sigma[i] + (deltaT * _sigmaDot[i]);
+        double sigmaDotPred = phi * _sigmaDot[i];
+        double p11Pred = _p11[i] + (2 * deltaT * _p12[i])
+                         + (deltaT * deltaT * _p22[i]) + _qSigma[i];
+        double p12Pred = phi * (_p12[i] + (deltaT * _p22[i]));
+        double p22Pred = (phi * phi * _p22[i]) + _qSigmaDot[i];
+
+        if (double.IsNaN(z))
+        {
+            _sigma[i] = sigmaPred;
+            _sigmaDot[i] = sigmaDotPred;
+            _p11[i] = p11Pred;
+            _p12[i] = p12Pred;
+            _p22[i] = p22Pred;
+            return;
+        }
+
+        double measurementNoise = Math.Max(z * z / (2.0 * sampleSize * YangZhangEfficiency), 1e-8);
+
+        double innovation = z - sigmaPred;
+        double innovationCov = p11Pred + measurementNoise;
+        double k1 = p11Pred / innovationCov;
+        double k2 = p12Pred / innovationCov;
+
+        _sigma[i] = sigmaPred + (k1 * innovation);
+        _sigmaDot[i] = sigmaDotPred + (k2 * innovation);
+
+        double oneMinusK1 = 1.0 - k1;
+        _p11[i] = Math.Max((oneMinusK1 * oneMinusK1 * p11Pred) + (k1 * k1 * measurementNoise), 1e-10);
+        _p12[i] = (oneMinusK1 * p12Pred) - (k1 * k2 * p11Pred) + (k2 * oneMinusK1 * p12Pred);
+        _p22[i] = Math.Max(p22Pred - (k2 * p12Pred) - (k2 * (p12Pred - (k2 * p22Pred))), 1e-10);
+
+        _lastYangZhang[i] = z;
+        _lastKalmanGain[i] = k1;
+        _lastInnovation[i] = innovation;
+        _updateCount[i]++;
+    }
+
+    private static Vector256<double> Load(double[] values, int start) =>
+        Vector256.Create<double>(values.AsSpan(start, LaneCount));
+
+    private static void Store(Vector256<double> value, double[] values, int start) =>
+        value.CopyTo(values.AsSpan(start, LaneCount));
+}
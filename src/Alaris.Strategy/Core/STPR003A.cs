@@ -1,5 +1,6 @@
 // STPR003A.cs - production-grade Heston model pricing using characteristic function integrati...
 
+using System.Buffers;
 using System.Numerics;
 using Alaris.Strategy.Core.Numerical;
 
@@ -10,6 +11,8 @@ namespace Alaris.Strategy.Core;
 /// Implements the semi-analytical pricing formula from Heston (1993).
 /// Uses Carr-Madan Fourier inversion or Lewis (2001) approach for option pricing,
 /// then backs out implied volatility using Newton-Raphson iteration.
+/// Whole maturity slices are priced with the Fang-Oosterlee (2008) COS expansion:
+/// the characteristic function is evaluated once per slice and shared by every strike.
 /// </summary>
 public static class STPR003A
 {
@@ -17,6 +20,19 @@ public static class STPR003A
     private const double MaxIV = 5.0;
     private const double IVTolerance = 1e-6;
 
+    // COS truncation half-width in standard deviations of the log-return
+    private const double CosTruncation = 12.0;
+
+    // Cosine terms per log-return standard deviation of the truncation interval
+    private const double CosTermsPerStdDev = 32.0;
+    private const int CosMinTerms = 128;
+    private const int CosMaxTerms = 8192;
+
+    /// <summary>
+    /// Parameters in a slice price gradient, ordered V0, Theta, Kappa, SigmaV, Rho.
+    /// </summary>
+    public const int GradientParameterCount = 5;
+
     /// <summary>
     /// Computes call option price using Heston semi-analytical formula.
     /// Uses the characteristic function approach with numerical integration.
@@ -48,8 +64,7 @@ public static class STPR003A
         double discountFactor = Math.Exp(-@params.RiskFreeRate * timeToExpiry);
         double forwardFactor = Math.Exp(-@params.DividendYield * timeToExpiry);
 
-        double p1 = ComputeProbability(spot, strike, timeToExpiry, @params, 1);
-        double p2 = ComputeProbability(spot, strike, timeToExpiry, @params, 2);
+        (double p1, double p2) = ComputeProbabilities(spot, strike, timeToExpiry, @params);
 
         double callPrice = (spot * forwardFactor * p1) - (strike * discountFactor * p2);
 
@@ -95,19 +110,379 @@ public static class STPR003A
     }
 
     /// <summary>
-    /// Computes P_j probability using characteristic function integration.
+    /// Prices every strike of one maturity slice with the COS method.
+    /// </summary>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="strikes">Strike prices in the slice.</param>
+    /// <param name="timeToExpiry">Time to expiry in years, shared by the slice.</param>
+    /// <param name="params">Heston model parameters.</param>
+    /// <param name="isCalls">Call/put flag per strike.</param>
+    /// <param name="prices">Output option prices.</param>
+    /// <remarks>
+    /// The density of ln(S_T/K) is expanded in cosines on [a, b], sized from the first two
+    /// Heston cumulants and widened to cover every strike in the slice. The characteristic
+    /// function and the put payoff coefficients are computed once; each strike then only
+    /// needs the phase e^(iu·ln(S/K)), accumulated by rotation four strikes at a time.
+    /// Puts are expanded directly and calls follow from put-call parity.
+    /// </remarks>
+    public static void ComputeSlicePrices(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double timeToExpiry,
+        HestonParameters @params,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices)
+    {
+        ArgumentNullException.ThrowIfNull(@params);
+        STPR011A.ValidateSliceInputs(spot, strikes, timeToExpiry, prices.Length);
+        if (isCalls.Length != strikes.Length)
+        {
+            throw new ArgumentException("Call/put flags must match the number of strikes.", nameof(isCalls));
+        }
+
+        PriceSlice(spot, strikes, timeToExpiry, @params, isCalls, prices, Span<double>.Empty);
+    }
+
+    /// <summary>
+    /// Prices every strike of one maturity slice and differentiates each price with respect
+    /// to the Heston parameters, using the same COS nodes for prices and gradients.
+    /// </summary>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="strikes">Strike prices in the slice.</param>
+    /// <param name="timeToExpiry">Time to expiry in years, shared by the slice.</param>
+    /// <param name="params">Heston model parameters.</param>
+    /// <param name="isCalls">Call/put flag per strike.</param>
+    /// <param name="prices">Output option prices.</param>
+    /// <param name="gradients">
+    /// Output price gradients, <see cref="GradientParameterCount"/> entries per strike ordered
+    /// ∂V/∂V0, ∂V/∂Theta, ∂V/∂Kappa, ∂V/∂SigmaV, ∂V/∂Rho.
+    /// </param>
+    /// <remarks>
+    /// Uses the Cui, del Baño Rollin and Germano (2017) representation of the characteristic
+    /// function, whose parameter derivatives are closed-form multiples ∂φ/∂Θ = φ·h(u). Each
+    /// node therefore adds five coefficient series to the price series and no further
+    /// characteristic function evaluations. Calls and puts share gradients by parity.
+    /// </remarks>
+    public static void ComputeSlicePriceGradients(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double timeToExpiry,
+        HestonParameters @params,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices,
+        Span<double> gradients)
+    {
+        ArgumentNullException.ThrowIfNull(@params);
+        STPR011A.ValidateSliceInputs(spot, strikes, timeToExpiry, prices.Length);
+        if (isCalls.Length != strikes.Length)
+        {
+            throw new ArgumentException("Call/put flags must match the number of strikes.", nameof(isCalls));
+        }
+
+        if (gradients.Length != strikes.Length * GradientParameterCount)
+        {
+            throw new ArgumentException("Gradient span must hold five entries per strike.", nameof(gradients));
+        }
+
+        PriceSlice(spot, strikes, timeToExpiry, @params, isCalls, prices, gradients);
+    }
+
+    /// <summary>
+    /// COS slice pricing shared by <see cref="ComputeSlicePrices"/> and
+    /// <see cref="ComputeSlicePriceGradients"/>; gradients are skipped when the span is empty.
+    /// </summary>
+    private static void PriceSlice(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double timeToExpiry,
+        HestonParameters @params,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices,
+        Span<double> gradients)
+    {
+        int count = strikes.Length;
+        if (count == 0)
+        {
+            return;
+        }
+
+        double minLogMoneyness = double.MaxValue;
+        double maxLogMoneyness = double.MinValue;
+        for (int i = 0; i < count; i++)
+        {
+            double x = Math.Log(spot / strikes[i]);
+            minLogMoneyness = Math.Min(minLogMoneyness, x);
+            maxLogMoneyness = Math.Max(maxLogMoneyness, x);
+        }
+
+        (double c1, double c2) = ComputeCumulants(timeToExpiry, @params);
+        double stdDev = Math.Sqrt(c2);
+        double a = minLogMoneyness + c1 - (CosTruncation * stdDev);
+        double b = maxLogMoneyness + c1 + (CosTruncation * stdDev);
+        int terms = (int)Math.Clamp(Math.Ceiling(CosTermsPerStdDev * (b - a) / stdDev), CosMinTerms, CosMaxTerms);
+
+        // Series 0 is the price; with gradients, series 1..5 are its parameter derivatives
+        int seriesCount = gradients.IsEmpty ? 1 : 1 + GradientParameterCount;
+        double[] coefficients = ArrayPool<double>.Shared.Rent(2 * seriesCount * terms);
+        double[] sums = ArrayPool<double>.Shared.Rent(seriesCount * count);
+        try
+        {
+            // Interleaved by node: series j of node k sits at k·seriesCount + j
+            Span<double> hRe = coefficients.AsSpan(0, seriesCount * terms);
+            Span<double> hIm = coefficients.AsSpan(seriesCount * terms, seriesCount * terms);
+            Span<Complex> sensitivities = stackalloc Complex[GradientParameterCount];
+            double step = Math.PI / (b - a);
+
+            // H_k = w_k · φ(u_k) · e^(-iu_k·a) · V_k, with V_k the unit-strike put payoff coefficient
+            for (int k = 0; k < terms; k++)
+            {
+                double u = k * step;
+                Complex weight = STPR011A.PutPayoffWeight(k, step, a, b);
+
+                int offset = k * seriesCount;
+                if (seriesCount == 1)
+                {
+                    Complex h = CharacteristicFunction(u, timeToExpiry, @params, 2) * weight;
+                    hRe[offset] = h.Real;
+                    hIm[offset] = h.Imaginary;
+                    continue;
+                }
+
+                Complex hPrice = CharacteristicFunctionWithGradient(u, timeToExpiry, @params, sensitivities) * weight;
+                hRe[offset] = hPrice.Real;
+                hIm[offset] = hPrice.Imaginary;
+                for (int j = 0; j < GradientParameterCount; j++)
+                {
+                    Complex hGradient = hPrice * sensitivities[j];
+                    hRe[offset + 1 + j] = hGradient.Real;
+                    hIm[offset + 1 + j] = hGradient.Imaginary;
+                }
+            }
+
+            STPR011A.SumSlice(spot, strikes, step, hRe, hIm, seriesCount, sums);
+
+            double discountFactor = Math.Exp(-@params.RiskFreeRate * timeToExpiry);
+            double forwardFactor = Math.Exp(-@params.DividendYield * timeToExpiry);
+
+            for (int i = 0; i < count; i++)
+            {
+                double strikeDiscount = strikes[i] * discountFactor;
+                double putPrice = Math.Max(strikeDiscount * sums[i], 0);
+                prices[i] = isCalls[i]
+                    ? Math.Max(putPrice + (spot * forwardFactor) - strikeDiscount, 0)
+                    : putPrice;
+
+                for (int j = 0; j < seriesCount - 1; j++)
+                {
+                    gradients[(i * GradientParameterCount) + j] = strikeDiscount * sums[((j + 1) * count) + i];
+                }
+            }
+        }
+        finally
+        {
+            ArrayPool<double>.Shared.Return(coefficients);
+            ArrayPool<double>.Shared.Return(sums);
+        }
+    }
+
+    /// <summary>
+    /// Computes implied volatilities for one maturity slice from a single COS pricing pass.
+    /// </summary>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="strikes">Strike prices in the slice.</param>
+    /// <param name="timeToExpiry">Time to expiry in years, shared by the slice.</param>
+    /// <param name="params">Heston model parameters.</param>
+    /// <param name="impliedVolatilities">Output implied volatilities.</param>
+    /// <remarks>
+    /// Each strike is inverted from its out-of-the-money option, as in
+    /// <see cref="ComputeImpliedVolatility"/>. Strikes whose model price cannot be
+    /// bracketed by Brent's method are reported as NaN rather than failing the slice.
+    /// </remarks>
+    public static void ComputeSliceImpliedVolatilities(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double timeToExpiry,
+        HestonParameters @params,
+        Span<double> impliedVolatilities)
+    {
+        ArgumentNullException.ThrowIfNull(@params);
+        STPR011A.ValidateSliceInputs(spot, strikes, timeToExpiry, impliedVolatilities.Length);
+
+        int count = strikes.Length;
+        bool[] rentedFlags = ArrayPool<bool>.Shared.Rent(count);
+        try
+        {
+            Span<bool> isCalls = rentedFlags.AsSpan(0, count);
+            for (int i = 0; i < count; i++)
+            {
+                isCalls[i] = strikes[i] >= spot;
+            }
+
+            ComputeSlicePrices(spot, strikes, timeToExpiry, @params, isCalls, impliedVolatilities);
+
+            for (int i = 0; i < count; i++)
+            {
+                double strike = strikes[i];
+                bool isCall = isCalls[i];
+                double hestonPrice = impliedVolatilities[i];
+                if (!double.IsFinite(hestonPrice))
+                {
+                    impliedVolatilities[i] = double.NaN;
+                    continue;
+                }
+
+                try
+                {
+                    impliedVolatilities[i] = STPR007A.SolveImpliedVolatility(
+                        iv => BlackScholesPrice(spot, strike, timeToExpiry,
+                            @params.RiskFreeRate, @params.DividendYield, iv, isCall),
+                        hestonPrice,
+                        MinIV,
+                        MaxIV,
+                        IVTolerance);
+                }
+                catch (ArgumentException)
+                {
+                    // Price outside the Black-Scholes range for [MinIV, MaxIV]
+                    impliedVolatilities[i] = double.NaN;
+                }
+            }
+        }
+        finally
+        {
+            ArrayPool<bool>.Shared.Return(rentedFlags);
+        }
+    }
+
+    /// <summary>
+    /// Heston characteristic function of ln(S_T/S_0) in the Cui, del Baño Rollin and Germano
+    /// (2017) form, with its parameter sensitivities h = (∂φ/∂Θ)/φ.
+    /// </summary>
+    /// <param name="u">Real frequency.</param>
+    /// <param name="timeToExpiry">Time to expiry in years.</param>
+    /// <param name="params">Heston model parameters.</param>
+    /// <param name="sensitivities">Output h for V0, Theta, Kappa, SigmaV, Rho.</param>
+    /// <returns>φ(u).</returns>
+    /// <remarks>
+    /// sinh(dτ/2) and cosh(dτ/2) only enter through ratios, so both are scaled by 2e^(-dτ/2)
+    /// to 1 ∓ e^(-dτ); this keeps the expressions finite for large |u|·τ.
+    /// </remarks>
+    private static Complex CharacteristicFunctionWithGradient(
+        double u,
+        double timeToExpiry,
+        HestonParameters @params,
+        Span<Complex> sensitivities)
+    {
+        if (u == 0.0)
+        {
+            // φ(0) = 1 for every parameter set
+            sensitivities.Clear();
+            return Complex.One;
+        }
+
+        double kappa = @params.Kappa;
+        double theta = @params.Theta;
+        double sigma = @params.SigmaV;
+        double rho = @params.Rho;
+        double v0 = @params.V0;
+        double tau = timeToExpiry;
+        double sigmaSq = sigma * sigma;
+
+        Complex iu = new Complex(0, u);
+        Complex uu = new Complex(u * u, u);
+        Complex xi = kappa - (sigma * rho * iu);
+        Complex d = Complex.Sqrt((xi * xi) + (sigmaSq * uu));
+        Complex decay = Complex.Exp(-d * tau);
+        Complex ch = 1.0 + decay;
+        Complex sh = 1.0 - decay;
+
+        Complex a1 = uu * sh;
+        Complex a2 = ((d * ch) + (xi * sh)) / v0;
+        Complex a = a1 / a2;
+        Complex logB = Complex.Log(d) + ((kappa - d) * tau / 2.0)
+            - Complex.Log(((d + xi) / 2.0) + ((d - xi) / 2.0 * decay));
+
+        Complex phi = Complex.Exp(
+            (iu * (@params.RiskFreeRate - @params.DividendYield) * tau)
+            - (kappa * theta * rho * tau * iu / sigma)
+            - a
+            + (2.0 * kappa * theta / sigmaSq * logB));
+
+        // Derivatives of d, A1, A2, A and B (Cui et al., eqs. 23-32)
+        Complex dDRho = -xi * sigma * iu / d;
+        Complex dA2DRho = -sigma * iu * (2.0 + (xi * tau)) / (2.0 * d * v0) * ((xi * ch) + (d * sh));
+        Complex dA1DRho = -iu * uu * tau * xi * sigma / (2.0 * d) * ch;
+        Complex dADRho = (dA1DRho / a2) - (a / a2 * dA2DRho);
+        Complex dLogBDRho = (dDRho / d) - (dA2DRho / a2);
+        Complex dLogBDKappa = (new Complex(0, 1.0 / (sigma * u)) * dLogBDRho) + (tau / 2.0);
+        Complex dDSigma = (((rho / sigma) - (1.0 / xi)) * dDRho) + (sigma * u * u / d);
+        Complex dA1DSigma = uu * tau / 2.0 * dDSigma * ch;
+        Complex dA2DSigma = (rho / sigma * dA2DRho)
+            - ((2.0 + (tau * xi)) / (v0 * tau * xi * iu) * dA1DRho)
+            + (sigma * tau * a1 / (2.0 * v0));
+        Complex dADSigma = (dA1DSigma / a2) - (a / a2 * dA2DSigma);
+
+        double twoKappaThetaOverSigmaSq = 2.0 * kappa * theta / sigmaSq;
+        sensitivities[0] = -a / v0;
+        sensitivities[1] = (2.0 * kappa / sigmaSq * logB) - (kappa * rho * tau * iu / sigma);
+        sensitivities[2] = (dADRho / (sigma * iu)) + (2.0 * theta / sigmaSq * logB)
+            + (twoKappaThetaOverSigmaSq * dLogBDKappa) - (theta * rho * tau * iu / sigma);
+        sensitivities[3] = -dADSigma - (4.0 * kappa * theta / (sigmaSq * sigma) * logB)
+            + (twoKappaThetaOverSigmaSq / d * (dDSigma - (d / a2 * dA2DSigma)))
+            + (kappa * theta * rho * tau * iu / sigmaSq);
+        sensitivities[4] = -dADRho + (twoKappaThetaOverSigmaSq / d * (dDRho - (d / a2 * dA2DRho)))
+            - (kappa * theta * tau * iu / sigma);
+
+        return phi;
+    }
+
+    /// <summary>
+    /// First two cumulants of ln(S_T/S_0) under Heston (Fang and Oosterlee 2008, Table 11).
+    /// </summary>
+    private static (double C1, double C2) ComputeCumulants(double timeToExpiry, HestonParameters @params)
+    {
+        double kappa = @params.Kappa;
+        double theta = @params.Theta;
+        double sigmaV = @params.SigmaV;
+        double rho = @params.Rho;
+        double v0 = @params.V0;
+        double t = timeToExpiry;
+        double e1 = Math.Exp(-kappa * t);
+        double e2 = Math.Exp(-2.0 * kappa * t);
+
+        double c1 = ((@params.RiskFreeRate - @params.DividendYield) * t)
+            + ((1.0 - e1) * (theta - v0) / (2.0 * kappa))
+            - (0.5 * theta * t);
+
+        double c2 = 1.0 / (8.0 * kappa * kappa * kappa) * (
+            (sigmaV * t * kappa * e1 * (v0 - theta) * ((8.0 * kappa * rho) - (4.0 * sigmaV)))
+            + (kappa * rho * sigmaV * (1.0 - e1) * ((16.0 * theta) - (8.0 * v0)))
+            + (2.0 * theta * kappa * t * ((-4.0 * kappa * rho * sigmaV) + (sigmaV * sigmaV) + (4.0 * kappa * kappa)))
+            + (sigmaV * sigmaV * (((theta - (2.0 * v0)) * e2) + (theta * ((6.0 * e1) - 7.0)) + (2.0 * v0)))
+            + (8.0 * kappa * kappa * (v0 - theta) * (1.0 - e1)));
+
+        // Guard against cancellation for extreme parameters
+        if (!(c2 > 0))
+        {
+            c2 = Math.Max(v0, theta) * t;
+        }
+
+        return (c1, c2);
+    }
+
+    /// <summary>
+    /// Computes P1 and P2 using characteristic function integration.
+    /// Both integrands are evaluated at the same nodes in one adaptive pass.
     /// </summary>
     /// <param name="spot">Current spot price.</param>
     /// <param name="strike">Strike price.</param>
     /// <param name="timeToExpiry">Time to expiration in years.</param>
     /// <param name="params">Heston model parameters.</param>
-    /// <param name="j">Probability index (1 or 2).</param>
-    private static double ComputeProbability(
+    private static (double P1, double P2) ComputeProbabilities(
         double spot,
         double strike,
         double timeToExpiry,
-        HestonParameters @params,
-        int j)
+        HestonParameters @params)
     {
         double logMoneyness = Math.Log(spot / strike);
 
@@ -115,29 +490,32 @@ public static class STPR003A
         // P_j = 0.5 + (1/pi) * integral from 0 to inf of Re[(exp(i*phi*log(S/K)) * f_j(phi)) / (i*phi)]
         // where f_j is the characteristic function of the log-return
 
-        double Integrand(double phi)
+        void Integrand(double phi, Span<double> values)
         {
             // UPDATED: Removed the "if (phi < 1e-10) return 0;" check to ensure smoothness
             // for high-order quadrature. The integration lower bound handles the singularity.
 
             Complex iPhi = new Complex(0, phi);
-            Complex charFunc = CharacteristicFunction(phi, timeToExpiry, @params, j);
-            Complex exponent = Complex.Exp(iPhi * logMoneyness);
+            Complex kernel = Complex.Exp(iPhi * logMoneyness) / iPhi;
 
-            return (exponent * charFunc / iPhi).Real;
+            values[0] = (kernel * CharacteristicFunction(phi, timeToExpiry, @params, 1)).Real;
+            values[1] = (kernel * CharacteristicFunction(phi, timeToExpiry, @params, 2)).Real;
         }
 
         // Numerical integration from slightly above 0 to infinity using adaptive quadrature
         // Uses STPR002C unified facade for automatic AVX2 dispatch
-        (double integralValue, double _) = STPR002C.IntegrateToInfinity(
+        Span<double> integrals = stackalloc double[2];
+        STPR002C.IntegrateToInfinity(
             Integrand,
             1e-8,
+            integrals,
             absoluteTolerance: 1e-8,
             relativeTolerance: 1e-6);
 
-        double probability = 0.5 + (integralValue / Math.PI);
+        double p1 = 0.5 + (integrals[0] / Math.PI);
+        double p2 = 0.5 + (integrals[1] / Math.PI);
 
-        return Math.Clamp(probability, 0, 1);
+        return (Math.Clamp(p1, 0, 1), Math.Clamp(p2, 0, 1));
     }
 
     /// <summary>
@@ -1,15 +1,17 @@
-// STPR006A.cs - production-grade Kou model pricing using characteristic function integration....
+// STPR006A.cs - production-grade Kou model pricing using the closed-form Hh series and COS slices
 
+using System.Buffers;
 using System.Numerics;
 using Alaris.Strategy.Core.Numerical;
+using MathNet.Numerics;
 
 namespace Alaris.Strategy.Core;
 
 /// <summary>
-/// Production-grade Kou model pricing using characteristic function integration.
-/// Implements semi-analytical pricing for double-exponential jump-diffusion model.
+/// Production-grade Kou model pricing for the double-exponential jump-diffusion model.
 /// The Kou (2002) model extends Black-Scholes with asymmetric jumps:
-/// - Uses Fourier inversion for option pricing
+/// - Single options are priced with Kou's closed-form Hh-function series
+/// - Whole maturity slices are priced with the Fang-Oosterlee (2008) COS expansion
 /// - Handles fat tails and skewness
 /// - Calibrates to market implied volatility smile
 /// </summary>
@@ -19,8 +21,32 @@ public static class STPR006A
     private const double MaxIV = 5.0;
     private const double IVTolerance = 1e-6;
 
+    // Bound on the Poisson truncation error of the closed-form series, as a fraction of spot
+    private const double SeriesTolerance = 1e-10;
+
+    // Jump counts kept by the closed-form series before pricing falls back to the COS expansion
+    private const int MaxJumpTerms = 100;
+
+    // Forward Hh recursion is kept while it amplifies rounding by at most e^10 ~ 2e4;
+    // beyond that the backward recursion starts where the discarded solution has decayed by e^(-37)
+    private const double HhForwardGrowthLimit = 10.0;
+    private const double HhConvergenceExponent = 37.0;
+
+    // COS truncation half-width in standard deviations of the log-return
+    private const double CosTruncation = 12.0;
+
+    // Jump tails decay as e^(-eta·|x|); each side of the interval spans at least this many decay lengths
+    private const double CosJumpTailDecay = 36.0;
+
+    // Highest COS frequency kept: beyond it |φ(u)| ≤ e^(-σ²Tu²/2) < e^(-36)
+    private const double CosDecayExponent = 36.0;
+    private const int CosMinTerms = 128;
+    private const int CosMaxTerms = 8192;
+
+    private static readonly double SqrtTwoPi = Math.Sqrt(2.0 * Math.PI);
+
     /// <summary>
-    /// Computes call option price using Kou model characteristic function.
+    /// Computes option price using Kou's closed-form Hh-function series.
     /// </summary>
     /// <param name="spot">Current spot price.</param>
     /// <param name="strike">Strike price.</param>
@@ -28,6 +54,11 @@ public static class STPR006A
     /// <param name="params">Kou model parameters.</param>
     /// <param name="isCall">True for call, false for put.</param>
     /// <returns>Option price.</returns>
+    /// <remarks>
+    /// The Poisson sum over jump counts is truncated at the first N whose tail bound keeps the
+    /// price error below 1e-10 of spot. When the expected jump count is too large for that
+    /// within <see cref="MaxJumpTerms"/> terms, the option is priced by the COS expansion.
+    /// </remarks>
     public static double ComputePrice(
         double spot,
         double strike,
@@ -42,40 +73,19 @@ public static class STPR006A
             throw new ArgumentException("Spot, strike, and time to expiry must be positive.");
         }
 
-        // Compute using characteristic function approach
-        double discountFactor = Math.Exp(-@params.RiskFreeRate * timeToExpiry);
-        double forwardFactor = Math.Exp(-@params.DividendYield * timeToExpiry);
-
-        // Use Carr-Madan formula: C(K) = exp(-alpha*k) / pi * integral...
-        // where k = log(K), alpha is damping parameter
-        double logStrike = Math.Log(strike);
-        double alpha = 1.5; // Damping parameter for call options
-
-        double Integrand(double v)
+        if (!TryComputeSeriesCallPrice(spot, strike, timeToExpiry, @params, out double callPrice))
         {
-            if (v < 1e-10)
-            {
-                return 0;
-            }
-
-            Complex iV = new Complex(0, v);
-            Complex charFunc = CharacteristicFunction(v - ((alpha + 1) * Complex.ImaginaryOne), spot, timeToExpiry, @params);
-
-            // Carr-Madan denominator: α² + α - v² + i*v*(2α + 1)
-            Complex denominator = (alpha * alpha) + alpha - (v * v) + (iV * ((2 * alpha) + 1));
-
-            return (Complex.Exp(-iV * logStrike) * charFunc / denominator).Real;
+            double price = 0;
+            PriceSlice(
+                spot,
+                new ReadOnlySpan<double>(in strike),
+                timeToExpiry,
+                @params,
+                new ReadOnlySpan<bool>(in isCall),
+                new Span<double>(ref price));
+            return price;
         }
 
-        // Numerical integration using STPR002C unified facade for automatic AVX2 dispatch
-        (double integralValue, double _) = STPR002C.IntegrateToInfinity(
-            Integrand,
-            0,
-            absoluteTolerance: 1e-6,
-            relativeTolerance: 1e-4);
-
-        double callPrice = discountFactor * Math.Exp(-alpha * logStrike) * integralValue / Math.PI;
-
         if (isCall)
         {
             return Math.Max(callPrice, 0);
@@ -83,6 +93,8 @@ public static class STPR006A
         else
         {
             // Put-call parity
+            double discountFactor = Math.Exp(-@params.RiskFreeRate * timeToExpiry);
+            double forwardFactor = Math.Exp(-@params.DividendYield * timeToExpiry);
             double putPrice = callPrice - (spot * forwardFactor) + (strike * discountFactor);
             return Math.Max(putPrice, 0);
         }
@@ -118,12 +130,477 @@ public static class STPR006A
     }
 
     /// <summary>
-    /// Kou model characteristic function.
+    /// Prices every strike of one maturity slice from a single COS expansion.
+    /// </summary>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="strikes">Strike prices in the slice.</param>
+    /// <param name="timeToExpiry">Time to expiry in years, shared by the slice.</param>
+    /// <param name="params">Kou model parameters.</param>
+    /// <param name="isCalls">Call/put flag per strike.</param>
+    /// <param name="prices">Output option prices.</param>
+    /// <remarks>
+    /// The interval [a, b] is sized from the Kou cumulants and widened on each side by
+    /// <see cref="CosJumpTailDecay"/> mean jump sizes, so the exponential jump tails are
+    /// covered as well as the diffusive core. The jump factor of φ does not decay in u, so
+    /// the number of terms is set by the diffusion alone: the series stops where
+    /// e^(-σ²Tu²/2) falls below e^(-36). Puts are expanded directly and calls follow
+    /// from put-call parity.
+    /// </remarks>
+    public static void ComputeSlicePrices(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double timeToExpiry,
+        KouParameters @params,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices)
+    {
+        ArgumentNullException.ThrowIfNull(@params);
+        STPR011A.ValidateSliceInputs(spot, strikes, timeToExpiry, prices.Length);
+        if (isCalls.Length != strikes.Length)
+        {
+            throw new ArgumentException("Call/put flags must match the number of strikes.", nameof(isCalls));
+        }
+
+        PriceSlice(spot, strikes, timeToExpiry, @params, isCalls, prices);
+    }
+
+    /// <summary>
+    /// Computes implied volatilities for one maturity slice from a single COS pricing pass.
+    /// </summary>
+    /// <param name="spot">Current spot price.</param>
+    /// <param name="strikes">Strike prices in the slice.</param>
+    /// <param name="timeToExpiry">Time to expiry in years, shared by the slice.</param>
+    /// <param name="params">Kou model parameters.</param>
+    /// <param name="impliedVolatilities">Output implied volatilities.</param>
+    /// <remarks>
+    /// Each strike is inverted from its out-of-the-money option, as in
+    /// <see cref="ComputeImpliedVolatility"/>. Strikes whose model price cannot be
+    /// bracketed by Brent's method are reported as NaN rather than failing the slice.
+    /// </remarks>
+    public static void ComputeSliceImpliedVolatilities(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double timeToExpiry,
+        KouParameters @params,
+        Span<double> impliedVolatilities)
+    {
+        ArgumentNullException.ThrowIfNull(@params);
+        STPR011A.ValidateSliceInputs(spot, strikes, timeToExpiry, impliedVolatilities.Length);
+
+        int count = strikes.Length;
+        bool[] rentedFlags = ArrayPool<bool>.Shared.Rent(count);
+        try
+        {
+            Span<bool> isCalls = rentedFlags.AsSpan(0, count);
+            for (int i = 0; i < count; i++)
+            {
+                isCalls[i] = strikes[i] >= spot;
+            }
+
+            PriceSlice(spot, strikes, timeToExpiry, @params, isCalls, impliedVolatilities);
+
+            for (int i = 0; i < count; i++)
+            {
+                double strike = strikes[i];
+                bool isCall = isCalls[i];
+                double kouPrice = impliedVolatilities[i];
+                if (!double.IsFinite(kouPrice))
+                {
+                    impliedVolatilities[i] = double.NaN;
+                    continue;
+                }
+
+                try
+                {
+                    impliedVolatilities[i] = STPR007A.SolveImpliedVolatility(
+                        iv => BlackScholesPrice(spot, strike, timeToExpiry,
+                            @params.RiskFreeRate, @params.DividendYield, iv, isCall),
+                        kouPrice,
+                        MinIV,
+                        MaxIV,
+                        IVTolerance);
+                }
+                catch (ArgumentException)
+                {
+                    // Price outside the Black-Scholes range for [MinIV, MaxIV]
+                    impliedVolatilities[i] = double.NaN;
+                }
+            }
+        }
+        finally
+        {
+            ArrayPool<bool>.Shared.Return(rentedFlags);
+        }
+    }
+
+    /// <summary>
+    /// COS slice pricing behind <see cref="ComputeSlicePrices"/> and the series fallback.
+    /// </summary>
+    private static void PriceSlice(
+        double spot,
+        ReadOnlySpan<double> strikes,
+        double timeToExpiry,
+        KouParameters @params,
+        ReadOnlySpan<bool> isCalls,
+        Span<double> prices)
+    {
+        int count = strikes.Length;
+        if (count == 0)
+        {
+            return;
+        }
+
+        double minLogMoneyness = double.MaxValue;
+        double maxLogMoneyness = double.MinValue;
+        for (int i = 0; i < count; i++)
+        {
+            double x = Math.Log(spot / strikes[i]);
+            minLogMoneyness = Math.Min(minLogMoneyness, x);
+            maxLogMoneyness = Math.Max(maxLogMoneyness, x);
+        }
+
+        (double c1, double c2, double c4) = ComputeCumulants(timeToExpiry, @params);
+        double coreWidth = CosTruncation * Math.Sqrt(c2 + Math.Sqrt(c4));
+        double lowerWidth = @params.Lambda > 0 ? Math.Max(coreWidth, CosJumpTailDecay / @params.Eta2) : coreWidth;
+        double upperWidth = @params.Lambda > 0 ? Math.Max(coreWidth, CosJumpTailDecay / @params.Eta1) : coreWidth;
+        double a = minLogMoneyness + c1 - lowerWidth;
+        double b = maxLogMoneyness + c1 + upperWidth;
+        double maxFrequency = Math.Sqrt(2.0 * CosDecayExponent / timeToExpiry) / @params.Sigma;
+        int terms = (int)Math.Clamp(Math.Ceiling(maxFrequency * (b - a) / Math.PI), CosMinTerms, CosMaxTerms);
+
+        double[] coefficients = ArrayPool<double>.Shared.Rent(2 * terms);
+        double[] sums = ArrayPool<double>.Shared.Rent(count);
+        try
+        {
+            Span<double> hRe = coefficients.AsSpan(0, terms);
+            Span<double> hIm = coefficients.AsSpan(terms, terms);
+            double step = Math.PI / (b - a);
+
+            for (int k = 0; k < terms; k++)
+            {
+                Complex h = CharacteristicFunction(k * step, timeToExpiry, @params)
+                    * STPR011A.PutPayoffWeight(k, step, a, b);
+                hRe[k] = h.Real;
+                hIm[k] = h.Imaginary;
+            }
+
+            STPR011A.SumSlice(spot, strikes, step, hRe, hIm, 1, sums);
+
+            double discountFactor = Math.Exp(-@params.RiskFreeRate * timeToExpiry);
+            double forwardFactor = Math.Exp(-@params.DividendYield * timeToExpiry);
+
+            for (int i = 0; i < count; i++)
+            {
+                double strikeDiscount = strikes[i] * discountFactor;
+                double putPrice = Math.Max(strikeDiscount * sums[i], 0);
+                prices[i] = isCalls[i]
+                    ? Math.Max(putPrice + (spot * forwardFactor) - strikeDiscount, 0)
+                    : putPrice;
+            }
+        }
+        finally
+        {
+            ArrayPool<double>.Shared.Return(coefficients);
+            ArrayPool<double>.Shared.Return(sums);
+        }
+    }
+
+    /// <summary>
+    /// Kou (2002) Theorem 2 call price:
+    /// C = S·e^(-dT)·Υ(μ + σ²/2, σ, λ̃, p̃, η1 - 1, η2 + 1) - K·e^(-rT)·Υ(μ - σ²/2, σ, λ, p, η1, η2),
+    /// with μ = r - d - λζ, ζ = E[e^Y] - 1, λ̃ = λ(ζ + 1) and p̃ = p·η1 / ((ζ + 1)(η1 - 1)).
+    /// </summary>
+    /// <returns>False when the series cannot meet its error bound; the caller then uses COS.</returns>
+    private static bool TryComputeSeriesCallPrice(
+        double spot,
+        double strike,
+        double timeToExpiry,
+        KouParameters @params,
+        out double callPrice)
+    {
+        double sigma = @params.Sigma;
+        double lambda = @params.Lambda;
+        double p = @params.P;
+        double eta1 = @params.Eta1;
+        double eta2 = @params.Eta2;
+        double zeta = (p * eta1 / (eta1 - 1)) + ((1 - p) * eta2 / (eta2 + 1)) - 1.0;
+
+        double forward = spot * Math.Exp(-@params.DividendYield * timeToExpiry);
+        double strikeDiscount = strike * Math.Exp(-@params.RiskFreeRate * timeToExpiry);
+        double tiltedLambda = lambda * (zeta + 1.0);
+        double tiltedP = Math.Clamp(p * eta1 / ((zeta + 1.0) * (eta1 - 1.0)), 0.0, 1.0);
+
+        int jumpTerms = SelectJumpTerms(
+            lambda * timeToExpiry, tiltedLambda * timeToExpiry, forward, strikeDiscount, SeriesTolerance * spot);
+        if (jumpTerms < 0)
+        {
+            callPrice = double.NaN;
+            return false;
+        }
+
+        double logStrike = Math.Log(strike / spot);
+        double drift = @params.RiskFreeRate - @params.DividendYield - (lambda * zeta);
+        double stockProbability = Upsilon(
+            drift + (0.5 * sigma * sigma), sigma, tiltedLambda, tiltedP, eta1 - 1.0, eta2 + 1.0,
+            logStrike, timeToExpiry, jumpTerms);
+        double strikeProbability = Upsilon(
+            drift - (0.5 * sigma * sigma), sigma, lambda, p, eta1, eta2,
+            logStrike, timeToExpiry, jumpTerms);
+
+        callPrice = (forward * stockProbability) - (strikeDiscount * strikeProbability);
+        return double.IsFinite(callPrice);
+    }
+
+    /// <summary>
+    /// Smallest jump count N whose Poisson tails bound the price error below
+    /// <paramref name="tolerance"/>, or -1 if none within <see cref="MaxJumpTerms"/>.
+    /// </summary>
+    /// <remarks>
+    /// Every omitted term of Υ is a Poisson weight times a probability, so truncating after N
+    /// jumps costs at most S·e^(-dT)·P(Ñ > N) + K·e^(-rT)·P(N_T > N). For N + 2 > m the
+    /// Poisson(m) tail is dominated by a geometric series: P(N_T > N) ≤ π_(N+1) / (1 - m/(N+2)).
+    /// </remarks>
+    private static int SelectJumpTerms(
+        double expectedJumps,
+        double expectedTiltedJumps,
+        double forward,
+        double strikeDiscount,
+        double tolerance)
+    {
+        double poisson = Math.Exp(-expectedJumps);
+        double tiltedPoisson = Math.Exp(-expectedTiltedJumps);
+
+        for (int terms = 0; terms <= MaxJumpTerms; terms++)
+        {
+            // Probabilities of exactly terms + 1 jumps
+            poisson *= expectedJumps / (terms + 1);
+            tiltedPoisson *= expectedTiltedJumps / (terms + 1);
+
+            double bound = (forward * PoissonTailBound(tiltedPoisson, expectedTiltedJumps, terms))
+                + (strikeDiscount * PoissonTailBound(poisson, expectedJumps, terms));
+            if (bound <= tolerance)
+            {
+                return terms;
+            }
+        }
+
+        return -1;
+    }
+
+    private static double PoissonTailBound(double nextProbability, double mean, int terms)
+    {
+        if (nextProbability == 0)
+        {
+            return 0;
+        }
+
+        double ratio = mean / (terms + 2);
+        return ratio < 1 ? nextProbability / (1 - ratio) : double.PositiveInfinity;
+    }
+
+    /// <summary>
+    /// Υ(μ, σ, λ, p, η1, η2; a, T) = P(Z_T ≥ a) for Z_T = μT + σW_T + Σ Y_i (Kou 2002, Theorem B.1),
+    /// truncated after <paramref name="jumpTerms"/> jumps.
+    /// </summary>
+    /// <remarks>
+    /// With s = σ√T and c = a - μT, the I_n integrals of the theorem reduce to
+    /// Υ = Σπ_n·Φ(-c/s) + [G(sη1, sη1 - c/s; P) - G(sη2, sη2 + c/s; Q)] / √(2π), where
+    /// G(z, x; W) = e^(x²/2 - c²/2s²)·Σ_i z^i·Hh_i(x)·Σ_(k>i) W_k and
+    /// W_k = Σ_n π_n·P_(n,k) (resp. Q_(n,k)). Folding the Gaussian factors together this way
+    /// keeps every exponential bounded; the raw theorem multiplies e^(σ²η²T/2) against
+    /// integrals that cancel it.
+    /// </remarks>
+    private static double Upsilon(
+        double mu,
+        double sigma,
+        double lambda,
+        double p,
+        double eta1,
+        double eta2,
+        double logStrike,
+        double timeToExpiry,
+        int jumpTerms)
+    {
+        double s = sigma * Math.Sqrt(timeToExpiry);
+        double c = logStrike - (mu * timeToExpiry);
+        double gaussian = NormalTail(c / s);
+        if (jumpTerms == 0 || lambda == 0)
+        {
+            return Math.Exp(-lambda * timeToExpiry) * gaussian;
+        }
+
+        Span<double> upWeights = stackalloc double[jumpTerms];
+        Span<double> downWeights = stackalloc double[jumpTerms];
+        Span<double> hh = stackalloc double[jumpTerms];
+        double poissonMass = ComputeJumpWeights(lambda * timeToExpiry, p, eta1, eta2, upWeights, downWeights);
+
+        double upward = WeightedHhSum(s * eta1, (s * eta1) - (c / s), c / s, upWeights, hh);
+        double downward = WeightedHhSum(s * eta2, (s * eta2) + (c / s), c / s, downWeights, hh);
+
+        return (poissonMass * gaussian) + ((upward - downward) / SqrtTwoPi);
+    }
+
+    /// <summary>
+    /// Poisson-weighted jump-size coefficients W_k = Σ_(n≥k) π_n·P_(n,k) and Σ_(n≥k) π_n·Q_(n,k)
+    /// for k = 1..N, stored at index k - 1.
+    /// </summary>
+    /// <returns>Σ_(n≤N) π_n.</returns>
+    /// <remarks>
+    /// P_(n,k) is the probability that, of n double-exponential jumps, the sum reduces to k
+    /// upward exponentials (Kou 2002, Proposition B.1):
+    /// P_(n,k) = Σ_(i=k)^(n-1) C(n-k-1, i-k)·C(n, i)·ϖ1^(i-k)·ϖ2^(n-i)·p^i·q^(n-i), P_(n,n) = p^n,
+    /// with ϖ1 = η1/(η1+η2), ϖ2 = η2/(η1+η2); Q_(n,k) swaps the roles of the two sides.
+    /// </remarks>
+    private static double ComputeJumpWeights(
+        double expectedJumps,
+        double p,
+        double eta1,
+        double eta2,
+        Span<double> upWeights,
+        Span<double> downWeights)
+    {
+        int jumpTerms = upWeights.Length;
+        double q = 1.0 - p;
+        double upShare = eta1 / (eta1 + eta2) * p;
+        double downShare = eta2 / (eta1 + eta2) * q;
+
+        // Power tables: p^j, q^j, (ϖ1·p)^j, (ϖ2·q)^j
+        Span<double> powers = stackalloc double[4 * (jumpTerms + 1)];
+        Span<double> pPowers = powers[..(jumpTerms + 1)];
+        Span<double> qPowers = powers.Slice(jumpTerms + 1, jumpTerms + 1);
+        Span<double> upPowers = powers.Slice(2 * (jumpTerms + 1), jumpTerms + 1);
+        Span<double> downPowers = powers.Slice(3 * (jumpTerms + 1), jumpTerms + 1);
+        pPowers[0] = qPowers[0] = upPowers[0] = downPowers[0] = 1.0;
+        for (int j = 1; j <= jumpTerms; j++)
+        {
+            pPowers[j] = pPowers[j - 1] * p;
+            qPowers[j] = qPowers[j - 1] * q;
+            upPowers[j] = upPowers[j - 1] * upShare;
+            downPowers[j] = downPowers[j - 1] * downShare;
+        }
+
+        upWeights.Clear();
+        downWeights.Clear();
+        double poisson = Math.Exp(-expectedJumps);
+        double poissonMass = poisson;
+
+        for (int n = 1; n <= jumpTerms; n++)
+        {
+            poisson *= expectedJumps / n;
+            poissonMass += poisson;
+            upWeights[n - 1] += poisson * pPowers[n];
+            downWeights[n - 1] += poisson * qPowers[n];
+
+            // C(n, k) for k = 1..n-1
+            double binomialK = n;
+            for (int k = 1; k < n; k++)
+            {
+                // P term: C(n-k-1, i-k)·C(n, i)·p^k·(ϖ1·p)^(i-k)·(ϖ2·q)^(n-i); Q mirrors it
+                double inner = 1.0;
+                double outer = binomialK;
+                double up = 0;
+                double down = 0;
+                for (int i = k; i < n; i++)
+                {
+                    double coefficient = inner * outer;
+                    up += coefficient * upPowers[i - k] * downPowers[n - i];
+                    down += coefficient * downPowers[i - k] * upPowers[n - i];
+
+                    inner *= (double)(n - i - 1) / (i - k + 1);
+                    outer *= (double)(n - i) / (i + 1);
+                }
+
+                upWeights[k - 1] += poisson * pPowers[k] * up;
+                downWeights[k - 1] += poisson * qPowers[k] * down;
+                binomialK *= (double)(n - k) / (k + 1);
+            }
+        }
+
+        return poissonMass;
+    }
+
+    /// <summary>
+    /// G(z, x; W) = e^(x²/2 - y²/2)·Σ_i z^i·Hh_i(x)·Σ_(k>i) W_k for the jump weights W.
+    /// </summary>
+    /// <param name="z">s·η.</param>
+    /// <param name="x">Hh argument.</param>
+    /// <param name="y">c/s; e^(-y²/2) is the Gaussian factor folded in.</param>
+    /// <param name="weights">W_k at index k - 1.</param>
+    /// <param name="hh">Scratch for the Hh sequence.</param>
+    private static double WeightedHhSum(double z, double x, double y, ReadOnlySpan<double> weights, Span<double> hh)
+    {
+        double shift = ComputeHh(x, hh);
+
+        double sum = 0;
+        double tailWeight = 0;
+        for (int i = weights.Length - 1; i >= 0; i--)
+        {
+            tailWeight += weights[i];
+            sum = (sum * z) + (hh[i] * tailWeight);
+        }
+
+        // Horner in z gives Σ z^i·Hh_i·tail_i; hh carries e^(shift)
+        return sum == 0 ? 0 : sum * Math.Exp((0.5 * x * x) - shift - (0.5 * y * y));
+    }
+
+    /// <summary>
+    /// Fills Hh_i(x), i = 0..n-1, scaled by e^(shift), and returns the shift.
+    /// </summary>
+    /// <remarks>
+    /// Hh_n(x) = ∫_x^∞ (t - x)^n/n!·e^(-t²/2) dt satisfies n·Hh_n = Hh_(n-2) - x·Hh_(n-1).
+    /// For x ≤ 0 every term of the forward recursion is positive and it is stable. For x &gt; 0
+    /// Hh_n is the recessive solution, so the ratios r_n = Hh_n/Hh_(n-1) are run backward
+    /// (Miller), r_(n-1) = 1/(x + n·r_n), from a start index where the dominant solution has
+    /// decayed by e^(-37); the values are scaled by e^(x²/2), which makes Hh_(-1) = 1 and
+    /// r_0 the Mills ratio. Small positive arguments, where the backward start would be far
+    /// out and the forward recursion loses at most four digits, stay on the forward recursion.
+    /// </remarks>
+    private static double ComputeHh(double x, Span<double> values)
+    {
+        int count = values.Length;
+
+        // The two solutions of the recursion separate like e^(2x·√(2n))
+        double reach = Math.Sqrt(2.0 * count);
+        if (2.0 * x * reach > HhForwardGrowthLimit)
+        {
+            double root = reach + (HhConvergenceExponent / (2.0 * x));
+            int start = (int)Math.Ceiling(0.5 * root * root);
+            double ratio = 0;
+            for (int n = start; n >= 1; n--)
+            {
+                ratio = 1.0 / (x + (n * ratio));
+                if (n <= count)
+                {
+                    values[n - 1] = ratio;
+                }
+            }
+
+            for (int n = 1; n < count; n++)
+            {
+                values[n] *= values[n - 1];
+            }
+
+            return 0.5 * x * x;
+        }
+
+        double previous = Math.Exp(-0.5 * x * x);
+        values[0] = SqrtTwoPi * NormalTail(x);
+        for (int n = 1; n < count; n++)
+        {
+            double current = (previous - (x * values[n - 1])) / n;
+            previous = values[n - 1];
+            values[n] = current;
+        }
+
+        return 0;
+    }
+
+    /// <summary>
+    /// Kou characteristic function of ln(S_T/S_0).
     /// This captures the jump-diffusion dynamics including asymmetric jumps.
     /// </summary>
     private static Complex CharacteristicFunction(
-        Complex u,
-        double spot,
+        double u,
         double timeToExpiry,
         KouParameters @params)
     {
@@ -159,9 +636,29 @@ public static class STPR006A
             jumpTransform = lambda * (upwardTerm + downwardTerm - 1);
         }
 
-        Complex exponent = (diffusionTerm + jumpTransform) * timeToExpiry;
+        return Complex.Exp((diffusionTerm + jumpTransform) * timeToExpiry);
+    }
+
+    /// <summary>
+    /// First, second and fourth cumulants of ln(S_T/S_0) under Kou.
+    /// </summary>
+    private static (double C1, double C2, double C4) ComputeCumulants(double timeToExpiry, KouParameters @params)
+    {
+        double sigma = @params.Sigma;
+        double lambda = @params.Lambda;
+        double p = @params.P;
+        double q = 1 - p;
+        double eta1 = @params.Eta1;
+        double eta2 = @params.Eta2;
+        double kappa = (p * eta1 / (eta1 - 1)) + (q * eta2 / (eta2 + 1)) - 1.0;
+        double t = timeToExpiry;
 
-        return Complex.Exp(exponent + (i * u * Math.Log(spot)));
+        double c1 = ((@params.RiskFreeRate - @params.DividendYield - (0.5 * sigma * sigma) - (lambda * kappa)) * t)
+            + (lambda * t * ((p / eta1) - (q / eta2)));
+        double c2 = t * ((sigma * sigma) + (2.0 * lambda * ((p / (eta1 * eta1)) + (q / (eta2 * eta2)))));
+        double c4 = 24.0 * lambda * t * ((p / Math.Pow(eta1, 4)) + (q / Math.Pow(eta2, 4)));
+
+        return (c1, c2, c4);
     }
 
     /// <summary>
@@ -218,4 +715,7 @@ public static class STPR006A
     // Use centralised CRMF001A for math utilities
     private static double NormalCDF(double x) => Alaris.Core.Math.CRMF001A.NormalCDF(x);
     private static double NormalPDF(double x) => Alaris.Core.Math.CRMF001A.NormalPDF(x);
+
+    // The series needs Φ(-x) to full precision, beyond the 1.5e-7 of CRMF001A.NormalCDF
+    private static double NormalTail(double x) => 0.5 * SpecialFunctions.Erfc(x / Math.Sqrt(2.0));
 }
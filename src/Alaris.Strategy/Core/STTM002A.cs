@@ -309,6 +309,18 @@ public sealed class RegimeModelConfig
     /// </summary>
     public double TransitionSmoothing { get; init; } = 0.5;
 
+    /// <summary>
+    /// IV RMSE at or below which a martingale-valid candidate is taken as dominant and the
+    /// remaining model-selection candidates are cancelled. 0 evaluates every candidate.
+    /// </summary>
+    public double DominantFitRmse { get; init; }
+
+    /// <summary>
+    /// Wall-clock budget for model selection. Once spent, candidates still running are cancelled
+    /// if a selectable evaluation is available. Infinite by default.
+    /// </summary>
+    public TimeSpan SelectionLatencyBudget { get; init; } = Timeout.InfiniteTimeSpan;
+
     /// <summary>
     /// Default configuration.
     /// </summary>
@@ -216,6 +216,31 @@ public sealed class DTbr001ATests : IDisposable
 
         act.Should().Throw<ArgumentNullException>().WithParameterName("riskFreeRateProvider");
     }
+
+    [Fact]
+    public async Task LoadImpliedVolatilityHistoryAsync_FailedDay_IsRetriedByLaterCall()
+    {
+        // Arrange: the chain provider fails once for the first date, then recovers
+        DateTime failingDate = new DateTime(2024, 3, 4);
+        BridgeTestMarketDataProviderFailingOnce marketDataProvider = new BridgeTestMarketDataProviderFailingOnce(failingDate);
+        AlarisDataBridge bridge = new AlarisDataBridge(
+            marketDataProvider,
+            new BridgeTestEarningsProvider(),
+            new BridgeTestRiskFreeRateProvider(),
+            new DTqc002A[] { new BridgeTestPassingValidator() },
+            _logger);
+
+        // Act
+        int firstLoad = await bridge.LoadImpliedVolatilityHistoryAsync("AAPL", failingDate, failingDate.AddDays(1));
+        bool recordedAfterFailure = bridge.ImpliedVolatilityHistory.HasDay("AAPL", failingDate);
+        int secondLoad = await bridge.LoadImpliedVolatilityHistoryAsync("AAPL", failingDate, failingDate.AddDays(1));
+
+        // Assert
+        firstLoad.Should().Be(1);
+        recordedAfterFailure.Should().BeFalse();
+        secondLoad.Should().Be(1);
+        bridge.ImpliedVolatilityHistory.HasDay("AAPL", failingDate).Should().BeTrue();
+    }
 }
 
 // Mock Implementations for Data Bridge Testing
@@ -276,6 +301,28 @@ internal class BridgeTestMarketDataProvider : DTpr003A
         => Task.FromResult(5_000_000m);
 }
 
+internal class BridgeTestMarketDataProviderFailingOnce : BridgeTestMarketDataProvider
+{
+    private readonly DateTime _failingDate;
+    private bool _failed;
+
+    public BridgeTestMarketDataProviderFailingOnce(DateTime failingDate)
+    {
+        _failingDate = failingDate.Date;
+    }
+
+    public override Task<OptionChainSnapshot> GetOptionChainAsync(string symbol, DateTime? asOfDate = null, CancellationToken cancellationToken = default)
+    {
+        if (!_failed && asOfDate?.Date == _failingDate)
+        {
+            _failed = true;
+            throw new InvalidOperationException("Transient chain failure");
+        }
+
+        return base.GetOptionChainAsync(symbol, asOfDate, cancellationToken);
+    }
+}
+
 internal class BridgeTestMarketDataProviderWithDelay : BridgeTestMarketDataProvider
 {
     private readonly TimeSpan _delay;
@@ -0,0 +1,100 @@
+// CRMF001ATests.cs - Tests for Black-Scholes implied volatility solvers
+// Tests the batched SIMD solver against the scalar Householder/Brent solver
+
+using System;
+using Alaris.Core.Math;
+using Xunit;
+
+namespace Alaris.Test.Unit.Core.Math;
+
+/// <summary>
+/// Unit tests for CRMF001A implied volatility.
+/// </summary>
+public class CRMF001ATests
+{
+    #region Batch Implied Volatility Tests
+
+    [Fact]
+    public void BSImpliedVolatilityBatch_MatchesScalarSolver()
+    {
+        // Arrange: 4 full lane groups plus a scalar remainder; alternating OTM calls and puts
+        const int count = 19;
+        double[] spots = new double[count];
+        double[] strikes = new double[count];
+        double[] taus = new double[count];
+        double[] rates = new double[count];
+        double[] yields = new double[count];
+        double[] prices = new double[count];
+        bool[] isCalls = new bool[count];
+        double[] volatilities = new double[count];
+
+        for (int i = 0; i < count; i++)
+        {
+            spots[i] = 100.0;
+            isCalls[i] = i % 2 == 0;
+            strikes[i] = isCalls[i] ? 100.0 + (1.5 * i) : 100.0 - (1.5 * i);
+            taus[i] = 0.1 + (0.1 * (i % 7));
+            rates[i] = 0.04;
+            yields[i] = 0.01;
+            volatilities[i] = 0.15 + (0.03 * (i % 5));
+            prices[i] = CRMF001A.BSPrice(spots[i], strikes[i], taus[i], volatilities[i], rates[i], yields[i], isCalls[i]);
+        }
+
+        // Act
+        double[] batch = new double[count];
+        CRMF001A.BSImpliedVolatilityBatch(spots, strikes, taus, rates, yields, prices, isCalls, batch);
+
+        // Assert
+        for (int i = 0; i < count; i++)
+        {
+            double scalar = CRMF001A.BSImpliedVolatility(
+                spots[i], strikes[i], taus[i], rates[i], yields[i], prices[i], isCalls[i]);
+            Assert.True(System.Math.Abs(batch[i] - scalar) < 1e-5,
+                $"Contract {i}: batch IV {batch[i]} should match scalar IV {scalar}");
+            Assert.True(System.Math.Abs(batch[i] - volatilities[i]) < 1e-4,
+                $"Contract {i}: batch IV {batch[i]} should recover {volatilities[i]}");
+        }
+    }
+
+    [Fact]
+    public void BSImpliedVolatilityBatch_InvalidLanes_ReturnNaNWithoutAffectingOthers()
+    {
+        // Arrange: one lane group with a negative price and a price above the forward
+        double[] spots = { 100.0, 100.0, 100.0, 100.0 };
+        double[] strikes = { 100.0, 100.0, 110.0, 90.0 };
+        double[] taus = { 0.5, 0.5, 0.5, 0.5 };
+        double[] rates = { 0.05, 0.05, 0.05, 0.05 };
+        double[] yields = { 0.0, 0.0, 0.0, 0.0 };
+        bool[] isCalls = { true, true, false, true };
+        double[] prices =
+        {
+            -1.0,
+            CRMF001A.BSPrice(100.0, 100.0, 0.5, 0.25, 0.05, 0.0, true),
+            CRMF001A.BSPrice(100.0, 110.0, 0.5, 0.30, 0.05, 0.0, false),
+            150.0
+        };
+
+        // Act
+        double[] batch = new double[4];
+        CRMF001A.BSImpliedVolatilityBatch(spots, strikes, taus, rates, yields, prices, isCalls, batch);
+
+        // Assert
+        Assert.True(double.IsNaN(batch[0]), $"Negative price should give NaN, got {batch[0]}");
+        Assert.True(System.Math.Abs(batch[1] - 0.25) < 1e-4, $"ATM call IV {batch[1]} should recover 0.25");
+        Assert.True(System.Math.Abs(batch[2] - 0.30) < 1e-4, $"OTM put IV {batch[2]} should recover 0.30");
+        Assert.True(double.IsNaN(batch[3]), $"Price above forward should give NaN, got {batch[3]}");
+    }
+
+    [Fact]
+    public void BSImpliedVolatilityBatch_MismatchedSpans_Throws()
+    {
+        double[] inputs = new double[4];
+        bool[] isCalls = new bool[3];
+        double[] results = new double[4];
+
+        Assert.Throws<ArgumentException>(() =>
+            CRMF001A.BSImpliedVolatilityBatch(inputs, inputs, inputs, inputs, inputs, inputs, isCalls, results));
+    }
+
+    #endregion
+}
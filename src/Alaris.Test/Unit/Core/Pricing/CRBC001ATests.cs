@@ -0,0 +1,163 @@
+// CRBC001ATests.cs - Unit tests for the exercise boundary cache
+// Component ID: CRBC001A Tests
+
+using System;
+using Xunit;
+using Alaris.Core.Options;
+using Alaris.Core.Pricing;
+
+namespace Alaris.Test.Unit.Core.Pricing;
+
+/// <summary>
+/// Unit tests for the exercise boundary cache and spectral warm-starts.
+/// </summary>
+public class CRBC001ATests
+{
+    private static readonly double[] Times = { 0.05, 0.25, 0.5, 0.75, 0.95 };
+
+    // ========== Cache Behaviour ==========
+
+    [Fact]
+    public void TrySeed_EmptyCache_SolvesCanonicalBoundary()
+    {
+        CRBC001A cache = new CRBC001A();
+        BoundaryCacheKey key = cache.CreateKey(0.5, 0.05, 0.02, 0.25, isCall: false);
+        double[] seeded = new double[Times.Length];
+
+        bool found = cache.TrySeed(key, Times, 100.0, seeded);
+
+        Assert.True(found);
+        Assert.Equal(1, cache.Misses);
+        Assert.Equal(0, cache.Hits);
+        Assert.Equal(1, cache.Count);
+        Assert.All(seeded, b => Assert.InRange(b, 1.0, 99.9));
+    }
+
+    [Fact]
+    public void TrySeed_TwoStrikes_RescalesByStrike()
+    {
+        CRBC001A cache = new CRBC001A();
+        BoundaryCacheKey key = cache.CreateKey(0.5, 0.05, 0.02, 0.25, isCall: false);
+        double[] atHundred = new double[Times.Length];
+        double[] atTwoHundred = new double[Times.Length];
+
+        Assert.True(cache.TrySeed(key, Times, 100.0, atHundred));
+        Assert.True(cache.TrySeed(key, Times, 200.0, atTwoHundred));
+
+        Assert.Equal(1, cache.Hits);
+        for (int i = 0; i < Times.Length; i++)
+        {
+            Assert.Equal(2.0 * atHundred[i], atTwoHundred[i]);
+        }
+    }
+
+    [Fact]
+    public void TrySeed_InputsInSameBucket_ReturnSameSeed()
+    {
+        CRBC001A cache = new CRBC001A();
+        BoundaryCacheKey first = cache.CreateKey(0.500, 0.0500, 0.0200, 0.251, isCall: false);
+        BoundaryCacheKey second = cache.CreateKey(0.503, 0.0505, 0.0198, 0.249, isCall: false);
+        double[] firstSeed = new double[Times.Length];
+        double[] secondSeed = new double[Times.Length];
+
+        Assert.Equal(first, second);
+        Assert.True(cache.TrySeed(first, Times, 100.0, firstSeed));
+        Assert.True(cache.TrySeed(second, Times, 100.0, secondSeed));
+
+        Assert.Equal(firstSeed, secondSeed);
+    }
+
+    [Fact]
+    public void TrySeed_BeyondCapacity_EvictsLeastRecentlyUsedAndResolvesIdentically()
+    {
+        CRBC001A cache = new CRBC001A(capacity: 2);
+        BoundaryCacheKey first = cache.CreateKey(0.5, 0.05, 0.02, 0.25, isCall: false);
+        BoundaryCacheKey second = cache.CreateKey(1.0, 0.05, 0.02, 0.25, isCall: false);
+        BoundaryCacheKey third = cache.CreateKey(1.5, 0.05, 0.02, 0.25, isCall: false);
+        double[] original = new double[Times.Length];
+        double[] resolved = new double[Times.Length];
+        double[] scratch = new double[Times.Length];
+
+        Assert.True(cache.TrySeed(first, Times, 100.0, original));
+        Assert.True(cache.TrySeed(second, Times, 100.0, scratch));
+        Assert.True(cache.TrySeed(third, Times, 100.0, scratch));
+
+        Assert.Equal(2, cache.Count);
+        Assert.Equal(1, cache.Evictions);
+
+        // The evicted bucket is solved again, from its centre, to the same seed
+        Assert.True(cache.TrySeed(first, Times, 100.0, resolved));
+        Assert.Equal(4, cache.Misses);
+        Assert.Equal(original, resolved);
+    }
+
+    [Fact]
+    public void TrySeed_DoubleBoundaryBucket_HasNoSeed()
+    {
+        CRBC001A cache = new CRBC001A();
+        BoundaryCacheKey key = cache.CreateKey(0.5, 0.01, 0.05, 0.25, isCall: true);
+        double[] seeded = new double[Times.Length];
+
+        Assert.False(cache.TrySeed(key, Times, 100.0, seeded));
+        Assert.False(cache.TrySeed(key, Times, 100.0, seeded));
+        Assert.Equal(1, cache.Misses);
+        Assert.Equal(1, cache.Hits);
+    }
+
+    // ========== Engine Warm-Starts ==========
+
+    [Theory]
+    [InlineData(SpectralScheme.Fast)]
+    [InlineData(SpectralScheme.Accurate)]
+    [InlineData(SpectralScheme.HighPrecision)]
+    public void Price_SeededSolve_DoesNotDependOnHistory(SpectralScheme scheme)
+    {
+        CRBC001A forwardCache = new CRBC001A();
+        CRBC001A reverseCache = new CRBC001A();
+        CREN004A forward = new CREN004A(scheme, forwardCache);
+        CREN004A reverse = new CREN004A(scheme, reverseCache);
+
+        double[] forwardPrices = new double[10];
+        double[] reversePrices = new double[10];
+
+        for (int day = 0; day < 10; day++)
+        {
+            forwardPrices[day] = forward.Price(100.0, 100.0, 1.0 - (day / 365.0), 0.05, 0.02, 0.20 + (0.001 * day), OptionType.Put);
+        }
+
+        for (int day = 9; day >= 0; day--)
+        {
+            reversePrices[day] = reverse.Price(100.0, 100.0, 1.0 - (day / 365.0), 0.05, 0.02, 0.20 + (0.001 * day), OptionType.Put);
+        }
+
+        Assert.Equal(forwardPrices, reversePrices);
+        Assert.Equal(10, forwardCache.Hits + forwardCache.Misses);
+    }
+
+    [Fact]
+    public void Price_ConsecutiveDays_WarmStartIsCloserToConvergedBoundary()
+    {
+        CRBC001A cache = new CRBC001A();
+        CREN004A warm = new CREN004A(12, 2, boundaryCache: cache);
+        CREN004A cold = new CREN004A(12, 2);
+        CREN004A converged = new CREN004A(12, 10);
+
+        double warmError = 0.0;
+        double coldError = 0.0;
+
+        for (int day = 0; day < 10; day++)
+        {
+            double tau = 0.5 - (day / 365.0);
+            double reference = converged.Price(100.0, 100.0, tau, 0.05, 0.01, 0.30, OptionType.Put);
+            double warmPrice = warm.Price(100.0, 100.0, tau, 0.05, 0.01, 0.30, OptionType.Put);
+            double coldPrice = cold.Price(100.0, 100.0, tau, 0.05, 0.01, 0.30, OptionType.Put);
+
+            warmError = System.Math.Max(warmError, System.Math.Abs(warmPrice - reference));
+            coldError = System.Math.Max(coldError, System.Math.Abs(coldPrice - reference));
+        }
+
+        Assert.True(warmError < coldError, $"Warm error {warmError} should be below cold error {coldError}");
+        Assert.InRange(cache.Misses, 1, 2);
+        Assert.Equal(10, cache.Hits + cache.Misses);
+    }
+}
@@ -313,6 +313,76 @@ public class CREN002ATests
         Assert.True(theta <= 0.1, $"Call theta {theta} should typically be negative or small");
     }
 
+    [Theory]
+    [InlineData(100.0, 100.0, 0.25, OptionType.Put)]
+    [InlineData(100.0, 100.0, 0.25, OptionType.Call)]
+    [InlineData(90.0, 100.0, 1.0, OptionType.Put)]
+    public void PriceWithGreeks_MatchesBumpAndReprice(double spot, double strike, double T, OptionType type)
+    {
+        double r = 0.05;
+        double q = 0.02;
+        double sigma = 0.30;
+
+        FdGridGreeks grid = _engine.PriceWithGreeks(spot, strike, T, r, q, sigma, type);
+
+        // Price comes from the same solve, so it must match exactly
+        Assert.Equal(_engine.Price(spot, strike, T, r, q, sigma, type), grid.Price);
+
+        double delta = _engine.Delta(spot, strike, T, r, q, sigma, type);
+        double gamma = _engine.Gamma(spot, strike, T, r, q, sigma, type);
+        double theta = _engine.Theta(spot, strike, T, r, q, sigma, type);
+        double vega = _engine.Vega(spot, strike, T, r, q, sigma, type);
+        double rho = _engine.Rho(spot, strike, T, r, q, sigma, type);
+
+        Assert.True(System.Math.Abs(grid.Delta - delta) < 0.005, $"Grid delta {grid.Delta} vs bump {delta}");
+        Assert.True(System.Math.Abs(grid.Gamma - gamma) < 0.05 * gamma, $"Grid gamma {grid.Gamma} vs bump {gamma}");
+        Assert.True(System.Math.Abs(grid.Theta - theta) < 0.02 * System.Math.Abs(theta), $"Grid theta {grid.Theta} vs bump {theta}");
+        Assert.True(System.Math.Abs(grid.Vega - vega) < 0.01 * vega, $"Grid vega {grid.Vega} vs bump {vega}");
+        Assert.True(System.Math.Abs(grid.Rho - rho) < 0.01 * System.Math.Abs(rho), $"Grid rho {grid.Rho} vs bump {rho}");
+    }
+
+    #endregion
+
+    #region Batch Pricing Tests
+
+    [Fact]
+    public void PriceBatch_MatchesScalarPrices()
+    {
+        // Nine options: two full lane groups, one scalar remainder, one expired option
+        double[] spots = { 90.0, 95.0, 100.0, 105.0, 110.0, 100.0, 100.0, 120.0, 85.0 };
+        double[] strikes = { 100.0, 100.0, 100.0, 100.0, 100.0, 90.0, 110.0, 100.0, 100.0 };
+        double[] taus = { 0.25, 0.5, 1.0, 0.75, 0.1, 0.0, 2.0, 0.5, 0.3 };
+        double[] rates = { 0.05, 0.03, -0.005, 0.01, 0.05, 0.05, 0.02, 0.04, -0.01 };
+        double[] yields = { 0.02, 0.0, -0.01, 0.03, 0.01, 0.02, 0.05, 0.0, -0.02 };
+        double[] vols = { 0.2, 0.3, 0.25, 0.4, 0.15, 0.2, 0.35, 0.5, 0.22 };
+        OptionType[] types =
+        {
+            OptionType.Put, OptionType.Call, OptionType.Put, OptionType.Call, OptionType.Put,
+            OptionType.Call, OptionType.Put, OptionType.Call, OptionType.Put
+        };
+        double[] prices = new double[spots.Length];
+
+        _engine.PriceBatch(spots, strikes, taus, rates, yields, vols, types, prices);
+
+        for (int i = 0; i < spots.Length; i++)
+        {
+            double expected = _engine.Price(spots[i], strikes[i], taus[i], rates[i], yields[i], vols[i], types[i]);
+            Assert.Equal(expected, prices[i], 12);
+        }
+    }
+
+    [Fact]
+    public void PriceBatch_MismatchedSpans_Throws()
+    {
+        double[] three = { 100.0, 100.0, 100.0 };
+        double[] two = { 0.5, 0.5 };
+        OptionType[] types = { OptionType.Put, OptionType.Put, OptionType.Put };
+        double[] prices = new double[3];
+
+        Assert.Throws<ArgumentException>(() =>
+            _engine.PriceBatch(three, three, two, three, three, three, types, prices));
+    }
+
     #endregion
 
     #region Edge Cases
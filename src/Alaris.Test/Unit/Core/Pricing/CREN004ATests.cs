@@ -154,6 +154,55 @@ public class CREN004ATests
         Assert.True(vega > -0.01, $"Vega should be positive, got {vega}");
     }
 
+    [Theory]
+    [InlineData(100.0, 100.0, 0.5, 0.05, 0.02, 0.25, OptionType.Put)]
+    [InlineData(90.0, 100.0, 1.0, 0.05, 0.00, 0.30, OptionType.Put)]
+    [InlineData(100.0, 100.0, 1.0, 0.06, 0.03, 0.25, OptionType.Call)]
+    public void PriceWithGreeks_MatchesBumpAndReprice(
+        double spot, double strike, double tau, double r, double q, double sigma, OptionType optionType)
+    {
+        SpectralGreeks greeks = _accurateEngine.PriceWithGreeks(spot, strike, tau, r, q, sigma, optionType);
+        double price = _accurateEngine.Price(spot, strike, tau, r, q, sigma, optionType);
+
+        double hs = spot * 1e-3;
+        double hv = 1e-5;
+        double ht = 1e-6;
+        double hr = 1e-6;
+        double up = _accurateEngine.Price(spot + hs, strike, tau, r, q, sigma, optionType);
+        double down = _accurateEngine.Price(spot - hs, strike, tau, r, q, sigma, optionType);
+        double delta = (up - down) / (2.0 * hs);
+        double gamma = (up - (2.0 * price) + down) / (hs * hs);
+        double vega = (_accurateEngine.Price(spot, strike, tau, r, q, sigma + hv, optionType)
+                     - _accurateEngine.Price(spot, strike, tau, r, q, sigma - hv, optionType)) / (2.0 * hv);
+        double theta = (_accurateEngine.Price(spot, strike, tau - ht, r, q, sigma, optionType)
+                      - _accurateEngine.Price(spot, strike, tau + ht, r, q, sigma, optionType)) / (2.0 * ht);
+        double rho = (_accurateEngine.Price(spot, strike, tau, r + hr, q, sigma, optionType)
+                    - _accurateEngine.Price(spot, strike, tau, r - hr, q, sigma, optionType)) / (2.0 * hr);
+
+        Assert.Equal(price, greeks.Price);
+        Assert.True(System.Math.Abs(greeks.Delta - delta) < 1e-3, $"Delta {greeks.Delta} vs bumped {delta}");
+        Assert.True(System.Math.Abs(greeks.Gamma - gamma) < 1e-3, $"Gamma {greeks.Gamma} vs bumped {gamma}");
+        Assert.True(System.Math.Abs(greeks.Vega - vega) < 1e-2, $"Vega {greeks.Vega} vs bumped {vega}");
+        Assert.True(System.Math.Abs(greeks.Theta - theta) < 1e-2, $"Theta {greeks.Theta} vs bumped {theta}");
+        Assert.True(System.Math.Abs(greeks.Rho - rho) < 1e-2, $"Rho {greeks.Rho} vs bumped {rho}");
+    }
+
+    [Theory]
+    [InlineData(95.0, 100.0, 1.0, 0.05, 0.02, 0.15, OptionType.Put)]
+    [InlineData(100.0, 100.0, 0.5, 0.05, 0.02, 0.15, OptionType.Put)]
+    [InlineData(100.0, 100.0, 0.1, 0.05, 0.02, 0.30, OptionType.Call)]
+    public void PriceWithGreeks_GaussLegendreSchemes_PriceIsBitIdentical(
+        double spot, double strike, double tau, double r, double q, double sigma, OptionType optionType)
+    {
+        foreach (CREN004A engine in new[] { _fastEngine, _accurateEngine })
+        {
+            double price = engine.Price(spot, strike, tau, r, q, sigma, optionType);
+            SpectralGreeks greeks = engine.PriceWithGreeks(spot, strike, tau, r, q, sigma, optionType);
+
+            Assert.Equal(price, greeks.Price);
+        }
+    }
+
     // ========== Scheme Comparison Tests ==========
 
     [Theory]
@@ -169,6 +218,63 @@ public class CREN004ATests
         Assert.True(relativeDiff < 0.05, $"Fast {fastPrice:F4} and Accurate {accuratePrice:F4} differ by {relativeDiff:P2}");
     }
 
+    // ========== Strike Chain Tests ==========
+
+    [Theory]
+    [InlineData(0.05, 0.02, OptionType.Put)]
+    [InlineData(0.05, 0.02, OptionType.Call)]
+    [InlineData(-0.01, -0.02, OptionType.Put)]  // Double-boundary fallback
+    public void PriceChain_MatchesSingleStrikePrices(double r, double q, OptionType optionType)
+    {
+        double[] strikes = { 80.0, 90.0, 95.0, 100.0, 105.0, 110.0, 125.0 };
+        double[] prices = new double[strikes.Length];
+
+        _accurateEngine.PriceChain(100.0, strikes, 0.5, r, q, 0.25, optionType, prices);
+
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            double single = _accurateEngine.Price(100.0, strikes[i], 0.5, r, q, 0.25, optionType);
+            Assert.True(System.Math.Abs(prices[i] - single) < 1e-10,
+                $"Strike {strikes[i]}: chain {prices[i]} vs single {single}");
+        }
+    }
+
+    [Fact]
+    public void PriceChain_MismatchedSpans_Throws()
+    {
+        double[] strikes = { 95.0, 100.0 };
+        double[] prices = new double[1];
+
+        Assert.Throws<ArgumentException>(() =>
+            _accurateEngine.PriceChain(100.0, strikes, 0.5, 0.05, 0.02, 0.25, OptionType.Put, prices));
+    }
+
+    // ========== Allocation Tests ==========
+
+    [Theory]
+    [InlineData(SpectralScheme.Fast)]
+    [InlineData(SpectralScheme.Accurate)]
+    public void Price_SteadyState_DoesNotAllocate(SpectralScheme scheme)
+    {
+        CREN004A engine = new CREN004A(scheme);
+        double[] strikes = { 90.0, 100.0, 110.0 };
+        double[] prices = new double[strikes.Length];
+
+        // Warm up the per-thread workspace and JIT
+        engine.Price(100.0, 100.0, 0.5, 0.05, 0.02, 0.25, OptionType.Put);
+        engine.PriceChain(100.0, strikes, 0.5, 0.05, 0.02, 0.25, OptionType.Put, prices);
+
+        long before = GC.GetAllocatedBytesForCurrentThread();
+        for (int i = 0; i < 50; i++)
+        {
+            engine.Price(100.0, 90.0 + i, 0.5, 0.05, 0.02, 0.25, OptionType.Put);
+        }
+        engine.PriceChain(100.0, strikes, 0.5, 0.05, 0.02, 0.25, OptionType.Put, prices);
+        long allocated = GC.GetAllocatedBytesForCurrentThread() - before;
+
+        Assert.True(allocated < 1024, $"Steady-state pricing allocated {allocated} bytes");
+    }
+
     // ========== Edge Cases ==========
 
     [Fact]
@@ -0,0 +1,210 @@
+// CRIV001ATests.cs - Unit tests for the American implied-volatility solver
+// Component ID: CRIV001A Tests
+
+using System;
+using Xunit;
+using Alaris.Core.Math;
+using Alaris.Core.Options;
+using Alaris.Core.Pricing;
+
+namespace Alaris.Test.Unit.Core.Pricing;
+
+/// <summary>
+/// Unit tests for the de-Americanization plus Newton implied-volatility solver.
+/// </summary>
+public class CRIV001ATests
+{
+    // Quotes come from the solver's own scheme, so a round trip isolates the inversion
+    private readonly CREN004A _referenceEngine = new CREN004A();
+
+    // ========== Round-Trip Tests ==========
+
+    [Theory]
+    [InlineData(100.0, 100.0, 0.5, 0.05, 0.01, 0.25, OptionType.Put)]
+    [InlineData(100.0, 90.0, 0.25, 0.05, 0.01, 0.30, OptionType.Put)]
+    [InlineData(100.0, 110.0, 1.0, 0.05, 0.01, 0.22, OptionType.Call)]
+    [InlineData(100.0, 95.0, 0.1, 0.03, 0.02, 0.40, OptionType.Call)]
+    public void ImpliedVolatility_RecoversPricingVolatility(
+        double spot, double strike, double tau, double r, double q, double sigma, OptionType optionType)
+    {
+        double price = _referenceEngine.Price(spot, strike, tau, r, q, sigma, optionType);
+        CRIV001A solver = new CRIV001A();
+
+        double iv = solver.ImpliedVolatility(spot, strike, tau, r, q, price, optionType);
+
+        Assert.True(System.Math.Abs(iv - sigma) < 1e-3, $"IV {iv} should recover {sigma}");
+    }
+
+    [Fact]
+    public void ImpliedVolatility_AmericanPut_ExceedsEuropeanInversion()
+    {
+        // The early-exercise premium must not be read as extra volatility
+        double price = _referenceEngine.Price(100.0, 110.0, 1.0, 0.08, 0.0, 0.25, OptionType.Put);
+        CRIV001A solver = new CRIV001A();
+
+        double american = solver.ImpliedVolatility(100.0, 110.0, 1.0, 0.08, 0.0, price, OptionType.Put);
+        double european = CRMF001A.BSImpliedVolatility(100.0, 110.0, 1.0, 0.08, 0.0, price, false);
+
+        Assert.True(System.Math.Abs(american - 0.25) < 1e-3, $"American IV {american} should recover 0.25");
+        Assert.True(european > american, $"European inversion {european} should overstate {american}");
+    }
+
+    [Fact]
+    public void ImpliedVolatility_SameQuoteTwice_ReturnsSameVolatility()
+    {
+        double price = _referenceEngine.Price(100.0, 95.0, 0.75, 0.05, 0.01, 0.35, OptionType.Put);
+        CRIV001A solver = new CRIV001A();
+
+        double first = solver.ImpliedVolatility(100.0, 95.0, 0.75, 0.05, 0.01, price, OptionType.Put);
+        double second = solver.ImpliedVolatility(100.0, 95.0, 0.75, 0.05, 0.01, price, OptionType.Put);
+
+        Assert.Null(solver.BoundaryCache);
+        Assert.Equal(first, second);
+    }
+
+    [Fact]
+    public void ImpliedVolatility_NewtonStepsExhausted_FallsBackToBracketedSolve()
+    {
+        // Without Newton steps the de-Americanized guess is left a few basis points off
+        double price = _referenceEngine.Price(100.0, 110.0, 1.0, 0.08, 0.0, 0.25, OptionType.Put);
+        CRIV001A solver = new CRIV001A(maxNewtonSteps: 0);
+
+        double iv = solver.ImpliedVolatility(100.0, 110.0, 1.0, 0.08, 0.0, price, OptionType.Put);
+        double residual = _referenceEngine.Price(100.0, 110.0, 1.0, 0.08, 0.0, iv, OptionType.Put) - price;
+
+        Assert.True(System.Math.Abs(residual) < CRIV001A.DefaultTolerance, $"IV {iv} leaves residual {residual}");
+    }
+
+    // ========== Chain Tests ==========
+
+    [Fact]
+    public void ImpliedVolatilities_Chain_MatchesSingleQuotes()
+    {
+        double[] strikes = { 85.0, 95.0, 100.0, 105.0, 115.0, 100.0 };
+        double[] taus = { 0.25, 0.25, 0.5, 0.5, 1.0, 1.0 };
+        OptionType[] types =
+        {
+            OptionType.Put, OptionType.Put, OptionType.Put,
+            OptionType.Call, OptionType.Call, OptionType.Call
+        };
+        // A cached solver seeds from canonical boundaries, so its quotes must too
+        CREN004A seededEngine = new CREN004A(SpectralScheme.Accurate, new CRBC001A());
+        double[] prices = new double[strikes.Length];
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            prices[i] = seededEngine.Price(100.0, strikes[i], taus[i], 0.05, 0.01, 0.28, types[i]);
+        }
+
+        CRIV001A solver = new CRIV001A(boundaryCache: new CRBC001A());
+        double[] ivs = new double[strikes.Length];
+        solver.ImpliedVolatilities(100.0, 0.05, 0.01, strikes, taus, types, prices, ivs);
+
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            Assert.True(System.Math.Abs(ivs[i] - 0.28) < 1e-3, $"Quote {i}: IV {ivs[i]} should recover 0.28");
+        }
+
+        Assert.True(solver.BoundaryCache!.Hits > 0,
+            "Chain solves should warm-start from the shared boundary cache");
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            double single = solver.ImpliedVolatility(100.0, strikes[i], taus[i], 0.05, 0.01, prices[i], types[i]);
+            Assert.True(System.Math.Abs(ivs[i] - single) < 1e-4, $"Quote {i}: chain IV {ivs[i]} vs single {single}");
+        }
+    }
+
+    [Fact]
+    public void ImpliedVolatilities_SkewedChain_ConfirmsEveryQuoteOnFullSolve()
+    {
+        // One boundary per expiry is shared by strikes whose volatilities are far apart
+        double[] strikes = { 70.0, 80.0, 90.0, 100.0, 110.0, 120.0, 130.0 };
+        double[] taus = new double[strikes.Length];
+        OptionType[] types = new OptionType[strikes.Length];
+        double[] sigmas = new double[strikes.Length];
+        double[] prices = new double[strikes.Length];
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            double moneyness = (strikes[i] - 100.0) / 100.0;
+            taus[i] = 0.5;
+            types[i] = OptionType.Put;
+            sigmas[i] = 0.22 + (1.2 * moneyness * moneyness) - (0.1 * moneyness);
+            prices[i] = _referenceEngine.Price(100.0, strikes[i], 0.5, 0.05, 0.01, sigmas[i], OptionType.Put);
+        }
+
+        CRIV001A solver = new CRIV001A();
+        double[] ivs = new double[strikes.Length];
+        solver.ImpliedVolatilities(100.0, 0.05, 0.01, strikes, taus, types, prices, ivs);
+
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            double residual = _referenceEngine.Price(100.0, strikes[i], 0.5, 0.05, 0.01, ivs[i], OptionType.Put) - prices[i];
+            Assert.True(System.Math.Abs(residual) < CRIV001A.DefaultTolerance, $"Quote {i}: IV {ivs[i]} leaves residual {residual}");
+            Assert.True(System.Math.Abs(ivs[i] - sigmas[i]) < 1e-3, $"Quote {i}: IV {ivs[i]} should recover {sigmas[i]}");
+        }
+    }
+
+    [Fact]
+    public void ImpliedVolatilities_ReversedChain_IsIdentical()
+    {
+        double[] strikes = { 85.0, 95.0, 100.0, 105.0, 115.0, 100.0, 90.0 };
+        double[] taus = { 0.25, 0.25, 0.5, 0.5, 1.0, 1.0, 0.25 };
+        OptionType[] types =
+        {
+            OptionType.Put, OptionType.Put, OptionType.Put,
+            OptionType.Call, OptionType.Call, OptionType.Call, OptionType.Put
+        };
+        double[] prices = new double[strikes.Length];
+        for (int i = 0; i < strikes.Length; i++)
+        {
+            prices[i] = _referenceEngine.Price(100.0, strikes[i], taus[i], 0.05, 0.01, 0.24 + (0.01 * i), types[i]);
+        }
+
+        CRIV001A solver = new CRIV001A();
+        double[] forward = new double[strikes.Length];
+        double[] reversed = new double[strikes.Length];
+        solver.ImpliedVolatilities(100.0, 0.05, 0.01, strikes, taus, types, prices, forward);
+
+        double[] reversedStrikes = (double[])strikes.Clone();
+        double[] reversedTaus = (double[])taus.Clone();
+        OptionType[] reversedTypes = (OptionType[])types.Clone();
+        double[] reversedPrices = (double[])prices.Clone();
+        Array.Reverse(reversedStrikes);
+        Array.Reverse(reversedTaus);
+        Array.Reverse(reversedTypes);
+        Array.Reverse(reversedPrices);
+        solver.ImpliedVolatilities(100.0, 0.05, 0.01, reversedStrikes, reversedTaus, reversedTypes, reversedPrices, reversed);
+        Array.Reverse(reversed);
+
+        Assert.Equal(forward, reversed);
+    }
+
+    [Fact]
+    public void ImpliedVolatilities_MismatchedSpans_Throws()
+    {
+        CRIV001A solver = new CRIV001A();
+        double[] strikes = { 95.0, 105.0 };
+        double[] taus = { 0.5 };
+        OptionType[] types = { OptionType.Put, OptionType.Call };
+        double[] prices = { 3.0, 3.0 };
+        double[] ivs = new double[2];
+
+        Assert.Throws<ArgumentException>(() =>
+            solver.ImpliedVolatilities(100.0, 0.05, 0.01, strikes, taus, types, prices, ivs));
+    }
+
+    // ========== Unsolvable Quote Tests ==========
+
+    [Theory]
+    [InlineData(100.0, 120.0, 0.5, 19.0, OptionType.Put)]  // Below exercise value
+    [InlineData(100.0, 120.0, 0.5, 20.0, OptionType.Put)]  // At exercise value
+    [InlineData(100.0, 100.0, 0.5, -1.0, OptionType.Call)] // Non-positive price
+    public void ImpliedVolatility_UnidentifiableQuote_ReturnsNaN(
+        double spot, double strike, double tau, double price, OptionType optionType)
+    {
+        CRIV001A solver = new CRIV001A();
+
+        double iv = solver.ImpliedVolatility(spot, strike, tau, 0.05, 0.01, price, optionType);
+
+        Assert.True(double.IsNaN(iv), $"Unidentifiable quote should give NaN, got {iv}");
+    }
+}
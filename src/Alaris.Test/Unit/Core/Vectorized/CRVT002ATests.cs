@@ -0,0 +1,185 @@
+// CRVT002ATests.cs - Tests for the AVX2/AVX-512 vector transcendentals
+// Component ID: CRVT002A Tests
+
+using System;
+using System.Runtime.Intrinsics;
+using System.Runtime.Intrinsics.X86;
+using Xunit;
+using Alaris.Core.Math;
+using Alaris.Core.Vectorized;
+
+namespace Alaris.Test.Unit.Core.Vectorized;
+
+/// <summary>
+/// Unit tests for CRVT002A vector math and the CRVT001A batch Greeks built on it.
+/// </summary>
+/// <remarks>
+/// The Vector512 functions fall back to two Vector256 halves without AVX-512F, so these
+/// tests exercise whichever path the host dispatches to.
+/// </remarks>
+public class CRVT002ATests
+{
+    // Abramowitz-Stegun 7.1.26 maximum absolute error
+    private const double ErfBound = 1.5e-7;
+
+    // ========== Dispatch Tests ==========
+
+    [Fact]
+    public void ActivePath_MatchesHardwareSupport()
+    {
+        SimdPath expected = Avx512F.IsSupported && Vector512.IsHardwareAccelerated
+            ? SimdPath.Avx512
+            : Avx2.IsSupported ? SimdPath.Avx2 : SimdPath.Scalar;
+
+        Assert.Equal(expected, CRVT002A.ActivePath);
+    }
+
+    // ========== Accuracy Tests ==========
+
+    [Fact]
+    public void VectorErf512_StaysWithinApproximationBound()
+    {
+        for (int i = 0; i <= 600; i++)
+        {
+            double x = -3.0 + (0.01 * i);
+            double actual = CRVT002A.VectorErf512(Vector512.Create(x)).GetElement(i % 8);
+            double expected = ReferenceErf(x);
+
+            Assert.True(System.Math.Abs(actual - expected) <= ErfBound,
+                $"erf({x}): expected {expected}, got {actual}");
+        }
+    }
+
+    [Fact]
+    public void VectorErf256_StaysWithinApproximationBound()
+    {
+        if (!CRVT002A.IsAvx2Supported)
+        {
+            return;
+        }
+
+        for (int i = 0; i <= 600; i++)
+        {
+            double x = -3.0 + (0.01 * i);
+            double actual = CRVT002A.VectorErf256(Vector256.Create(x)).GetElement(i % 4);
+            double expected = ReferenceErf(x);
+
+            Assert.True(System.Math.Abs(actual - expected) <= ErfBound,
+                $"erf({x}): expected {expected}, got {actual}");
+        }
+    }
+
+    [Fact]
+    public void VectorExp512_MatchesMathExp()
+    {
+        for (int i = 0; i <= 1400; i++)
+        {
+            double x = -700.0 + i;
+            double actual = CRVT002A.VectorExp512(Vector512.Create(x)).GetElement(i % 8);
+            double expected = System.Math.Exp(x);
+
+            Assert.True(System.Math.Abs((actual / expected) - 1.0) < 1e-13,
+                $"exp({x}): expected {expected}, got {actual}");
+        }
+    }
+
+    [Fact]
+    public void VectorLog512_MatchesMathLog()
+    {
+        for (int i = 0; i <= 600; i++)
+        {
+            double x = System.Math.Exp(-30.0 + (0.1 * i));
+            double actual = CRVT002A.VectorLog512(Vector512.Create(x)).GetElement(i % 8);
+            double expected = System.Math.Log(x);
+
+            Assert.True(System.Math.Abs(actual - expected) < 1e-13,
+                $"log({x}): expected {expected}, got {actual}");
+        }
+    }
+
+    [Fact]
+    public void VectorNormalCDF512_MatchesVector256()
+    {
+        if (!CRVT002A.IsAvx2Supported)
+        {
+            return;
+        }
+
+        for (int i = 0; i <= 240; i++)
+        {
+            double x = -6.0 + (0.05 * i);
+            double wide = CRVT002A.VectorNormalCDF512(Vector512.Create(x)).GetElement(7);
+            double narrow = CRVT002A.VectorNormalCDF256(Vector256.Create(x)).GetElement(0);
+
+            Assert.True(System.Math.Abs(wide - narrow) < 1e-15,
+                $"N({x}): Vector512 {wide} should match Vector256 {narrow}");
+        }
+    }
+
+    // ========== Batch Greeks Tests ==========
+
+    [Fact]
+    public void CRVT001A_MixedLaneWidths_MatchScalarBlackScholes()
+    {
+        // 8 + 4 + 3: one AVX-512 group, one AVX2 group, a scalar remainder
+        const int count = 15;
+        const double r = 0.04;
+        const double q = 0.015;
+        double[] spots = new double[count];
+        double[] strikes = new double[count];
+        double[] taus = new double[count];
+        double[] sigmas = new double[count];
+        bool[] isCalls = new bool[count];
+
+        for (int i = 0; i < count; i++)
+        {
+            spots[i] = 100.0;
+            strikes[i] = 75.0 + (3.5 * i);
+            taus[i] = 0.05 + (0.2 * (i % 6));
+            sigmas[i] = 0.15 + (0.04 * (i % 5));
+            isCalls[i] = i % 3 != 0;
+        }
+
+        double[] prices = new double[count];
+        double[] deltas = new double[count];
+        double[] vegas = new double[count];
+        double[] gammas = new double[count];
+        CRVT001A.ComputePricesBatch(spots, strikes, taus, sigmas, r, q, isCalls, prices);
+        CRVT001A.ComputeDeltasBatch(spots, strikes, taus, sigmas, r, q, isCalls, deltas);
+        CRVT001A.ComputeVegasBatch(spots, strikes, taus, sigmas, r, q, vegas);
+        CRVT001A.ComputeGammasBatch(spots, strikes, taus, sigmas, r, q, gammas);
+
+        for (int i = 0; i < count; i++)
+        {
+            double price = CRMF001A.BSPrice(spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
+            double delta = CRMF001A.BSDelta(spots[i], strikes[i], taus[i], sigmas[i], r, q, isCalls[i]);
+            double vega = CRMF001A.BSVega(spots[i], strikes[i], taus[i], sigmas[i], r, q);
+            double gamma = CRMF001A.BSGamma(spots[i], strikes[i], taus[i], sigmas[i], r, q);
+
+            Assert.True(System.Math.Abs(prices[i] - price) < 1e-9, $"Price[{i}]: expected {price}, got {prices[i]}");
+            Assert.True(System.Math.Abs(deltas[i] - delta) < 1e-9, $"Delta[{i}]: expected {delta}, got {deltas[i]}");
+            Assert.True(System.Math.Abs(vegas[i] - vega) < 1e-9, $"Vega[{i}]: expected {vega}, got {vegas[i]}");
+            Assert.True(System.Math.Abs(gammas[i] - gamma) < 1e-9, $"Gamma[{i}]: expected {gamma}, got {gammas[i]}");
+        }
+    }
+
+    // ========== Helpers ==========
+
+    /// <summary>
+    /// erf(x) = 2/√π · e^(-x²) · Σ 2ⁿx^(2n+1) / (1·3·…·(2n+1)); every term is positive,
+    /// so the sum carries no cancellation error.
+    /// </summary>
+    private static double ReferenceErf(double x)
+    {
+        double term = x;
+        double sum = x;
+        double xSquared2 = 2.0 * x * x;
+        for (int n = 1; n < 200 && System.Math.Abs(term) > 1e-18 * System.Math.Abs(sum); n++)
+        {
+            term *= xSquared2 / ((2 * n) + 1);
+            sum += term;
+        }
+
+        return 2.0 / System.Math.Sqrt(System.Math.PI) * System.Math.Exp(-x * x) * sum;
+    }
+}
@@ -0,0 +1,142 @@
+// TSUN055A.cs - Unit tests for STPR010A fused chain Greeks kernel
+
+using System;
+using Alaris.Core.Math;
+using Alaris.Strategy.Core.Numerical;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STPR010A option chain Greeks kernel.
+/// Component ID: TSUN055A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Fused SIMD Greeks match the scalar CRMF001A Black-Scholes Greeks
+/// - Chain lengths that are not multiples of the lane width are handled
+/// - Long chains are processed without heap allocation
+/// </remarks>
+public sealed class TSUN055A
+{
+    private const double Spot = 100.0;
+    private const double Rate = 0.04;
+    private const double DividendYield = 0.015;
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(7)]
+    [InlineData(64)]
+    [InlineData(301)]
+    public void ComputeChainGreeks_MatchesScalarBlackScholes(int count)
+    {
+        // Arrange
+        (double[] strikes, double[] taus, double[] sigmas, bool[] isCalls) = CreateChain(count);
+        double[] prices = new double[count];
+        double[] deltas = new double[count];
+        double[] gammas = new double[count];
+        double[] vegas = new double[count];
+        double[] thetas = new double[count];
+        double[] rhos = new double[count];
+
+        // Act
+        STPR010A.ComputeChainGreeks(
+            Spot, strikes, taus, sigmas, Rate, DividendYield, isCalls,
+            prices, deltas, gammas, vegas, thetas, rhos);
+
+        // Assert
+        for (int i = 0; i < count; i++)
+        {
+            double k = strikes[i];
+            double tau = taus[i];
+            double sigma = sigmas[i];
+            bool isCall = isCalls[i];
+
+            AssertClose(CRMF001A.BSPrice(Spot, k, tau, sigma, Rate, DividendYield, isCall), prices[i], 1e-9, "Price", i);
+            AssertClose(CRMF001A.BSDelta(Spot, k, tau, sigma, Rate, DividendYield, isCall), deltas[i], 1e-9, "Delta", i);
+            AssertClose(CRMF001A.BSGamma(Spot, k, tau, sigma, Rate, DividendYield), gammas[i], 1e-9, "Gamma", i);
+            AssertClose(CRMF001A.BSVega(Spot, k, tau, sigma, Rate, DividendYield), vegas[i], 1e-9, "Vega", i);
+            AssertClose(CRMF001A.BSTheta(Spot, k, tau, sigma, Rate, DividendYield, isCall), thetas[i], 1e-9, "Theta", i);
+
+            // Rho against a central difference in the rate
+            const double h = 1e-5;
+            double rho = (CRMF001A.BSPrice(Spot, k, tau, sigma, Rate + h, DividendYield, isCall)
+                - CRMF001A.BSPrice(Spot, k, tau, sigma, Rate - h, DividendYield, isCall)) / (2 * h);
+            AssertClose(rho, rhos[i], 1e-2, "Rho", i);
+        }
+    }
+
+    [Fact]
+    public void ComputeChainGreeks_Results_ReportThetaPerDay()
+    {
+        // Arrange
+        (double[] strikes, double[] taus, double[] sigmas, bool[] isCalls) = CreateChain(9);
+        STPR010A.GreeksResult[] results = new STPR010A.GreeksResult[9];
+
+        // Act
+        STPR010A.ComputeChainGreeks(Spot, strikes, taus, sigmas, Rate, DividendYield, isCalls, results);
+
+        // Assert
+        for (int i = 0; i < results.Length; i++)
+        {
+            double annualTheta = CRMF001A.BSTheta(Spot, strikes[i], taus[i], sigmas[i], Rate, DividendYield, isCalls[i]);
+            AssertClose(annualTheta / 252.0, results[i].Theta, 1e-9, "Theta", i);
+            AssertClose(CRMF001A.BSPrice(Spot, strikes[i], taus[i], sigmas[i], Rate, DividendYield, isCalls[i]),
+                results[i].Price, 1e-9, "Price", i);
+        }
+    }
+
+    [Fact]
+    public void ComputeChainGreeks_LongChain_DoesNotAllocate()
+    {
+        // Arrange: longer than the old 256-contract stack limit
+        const int count = 1000;
+        (double[] strikes, double[] taus, double[] sigmas, bool[] isCalls) = CreateChain(count);
+        STPR010A.GreeksResult[] results = new STPR010A.GreeksResult[count];
+        STPR010A.ComputeChainGreeks(Spot, strikes, taus, sigmas, Rate, DividendYield, isCalls, results);
+
+        // Act
+        long before = GC.GetAllocatedBytesForCurrentThread();
+        STPR010A.ComputeChainGreeks(Spot, strikes, taus, sigmas, Rate, DividendYield, isCalls, results);
+        long allocated = GC.GetAllocatedBytesForCurrentThread() - before;
+
+        // Assert
+        Assert.Equal(0, allocated);
+    }
+
+    [Fact]
+    public void ComputeChainGreeks_MismatchedOutputs_Throws()
+    {
+        (double[] strikes, double[] taus, double[] sigmas, bool[] isCalls) = CreateChain(8);
+        double[] outputs = new double[8];
+        double[] shortOutput = new double[7];
+
+        Assert.Throws<ArgumentException>(() => STPR010A.ComputeChainGreeks(
+            Spot, strikes, taus, sigmas, Rate, DividendYield, isCalls,
+            outputs, outputs, outputs, outputs, outputs, shortOutput));
+    }
+
+    private static (double[] Strikes, double[] Taus, double[] Sigmas, bool[] IsCalls) CreateChain(int count)
+    {
+        double[] strikes = new double[count];
+        double[] taus = new double[count];
+        double[] sigmas = new double[count];
+        bool[] isCalls = new bool[count];
+
+        for (int i = 0; i < count; i++)
+        {
+            strikes[i] = 70.0 + (60.0 * i / System.Math.Max(count - 1, 1));
+            taus[i] = 0.05 + (0.25 * (i % 8));
+            sigmas[i] = 0.15 + (0.05 * (i % 6));
+            isCalls[i] = i % 3 != 0;
+        }
+
+        return (strikes, taus, sigmas, isCalls);
+    }
+
+    private static void AssertClose(double expected, double actual, double tolerance, string greek, int index)
+    {
+        Assert.True(System.Math.Abs(expected - actual) <= tolerance * System.Math.Max(1.0, System.Math.Abs(expected)),
+            $"{greek}[{index}]: expected {expected}, got {actual}");
+    }
+}
@@ -0,0 +1,146 @@
+// TSUN056A.cs - Unit tests for STPR003A COS slice pricing of the Heston model
+
+using System;
+using System.Collections.Generic;
+using Alaris.Strategy.Core;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STPR003A Heston slice pricer.
+/// Component ID: TSUN056A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - COS slice prices match the per-strike characteristic function integration
+/// - Slice calls and puts satisfy put-call parity
+/// - Slice implied volatilities match the per-strike Heston implied volatility
+/// - Calibration recovers the parameters that generated a multi-expiry surface
+/// </remarks>
+public sealed class TSUN056A
+{
+    private const double Spot = 100.0;
+
+    private static readonly double[] s_strikes =
+    {
+        70.0, 75.0, 80.0, 85.0, 90.0, 95.0, 100.0, 105.0, 110.0, 115.0, 120.0, 125.0, 130.0
+    };
+
+    [Theory]
+    [InlineData(5.0 / 252.0)]
+    [InlineData(30.0 / 252.0)]
+    [InlineData(0.5)]
+    [InlineData(2.0)]
+    public void ComputeSlicePrices_MatchesPerStrikeIntegration(double timeToExpiry)
+    {
+        // Arrange
+        HestonParameters parameters = HestonParameters.DefaultEquity;
+        bool[] isCalls = new bool[s_strikes.Length];
+        for (int i = 0; i < isCalls.Length; i++)
+        {
+            isCalls[i] = s_strikes[i] >= Spot;
+        }
+
+        double[] prices = new double[s_strikes.Length];
+
+        // Act
+        STPR003A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, parameters, isCalls, prices);
+
+        // Assert
+        for (int i = 0; i < s_strikes.Length; i++)
+        {
+            double expected = STPR003A.ComputePrice(Spot, s_strikes[i], timeToExpiry, parameters, isCalls[i]);
+            Assert.True(System.Math.Abs(expected - prices[i]) < 1e-6,
+                $"Strike {s_strikes[i]}: expected {expected}, got {prices[i]}");
+        }
+    }
+
+    [Fact]
+    public void ComputeSlicePrices_SatisfiesPutCallParity()
+    {
+        // Arrange
+        HestonParameters parameters = HestonParameters.HighVolRegime;
+        const double timeToExpiry = 0.25;
+        bool[] calls = new bool[s_strikes.Length];
+        bool[] puts = new bool[s_strikes.Length];
+        Array.Fill(calls, true);
+        double[] callPrices = new double[s_strikes.Length];
+        double[] putPrices = new double[s_strikes.Length];
+
+        // Act
+        STPR003A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, parameters, calls, callPrices);
+        STPR003A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, parameters, puts, putPrices);
+
+        // Assert
+        double forward = Spot * System.Math.Exp(-parameters.DividendYield * timeToExpiry);
+        double discount = System.Math.Exp(-parameters.RiskFreeRate * timeToExpiry);
+        for (int i = 0; i < s_strikes.Length; i++)
+        {
+            double parity = callPrices[i] - putPrices[i] - (forward - (s_strikes[i] * discount));
+            Assert.True(System.Math.Abs(parity) < 1e-10, $"Strike {s_strikes[i]}: parity gap {parity}");
+        }
+    }
+
+    [Fact]
+    public void ComputeSmile_MatchesPerStrikeImpliedVolatility()
+    {
+        // Arrange
+        STIV001A model = new STIV001A(HestonParameters.DefaultEquity);
+        const double timeToExpiry = 30.0 / 252.0;
+
+        // Act
+        (double Strike, double TheoreticalIV)[] smile = model.ComputeSmile(Spot, s_strikes, timeToExpiry);
+
+        // Assert
+        for (int i = 0; i < smile.Length; i++)
+        {
+            double expected = model.ComputeTheoreticalIV(Spot, s_strikes[i], timeToExpiry);
+            Assert.True(System.Math.Abs(expected - smile[i].TheoreticalIV) < 1e-4,
+                $"Strike {s_strikes[i]}: expected IV {expected}, got {smile[i].TheoreticalIV}");
+        }
+    }
+
+    [Fact]
+    public void Calibrate_RecoversSurfaceParameters()
+    {
+        // Arrange: a surface generated by known parameters across four expiries
+        HestonParameters truth = new HestonParameters
+        {
+            V0 = 0.05,
+            Theta = 0.06,
+            Kappa = 2.5,
+            SigmaV = 0.4,
+            Rho = -0.6,
+            RiskFreeRate = 0.04,
+            DividendYield = 0.01
+        };
+        STIV001A model = new STIV001A(truth);
+        List<(double Strike, int DTE, double MarketIV)> marketData = new List<(double Strike, int DTE, double MarketIV)>();
+        foreach (int dte in new[] { 10, 30, 60, 120 })
+        {
+            foreach ((double strike, double iv) in model.ComputeSmile(Spot, s_strikes[2..11], dte / 252.0))
+            {
+                marketData.Add((strike, dte, iv));
+            }
+        }
+
+        // Act
+        HestonParameters fitted = STIV001A.Calibrate(
+            Spot, marketData, truth.RiskFreeRate, truth.DividendYield, HestonCalibrationObjective.ImpliedVolatility);
+
+        // Assert
+        Assert.True(System.Math.Abs(fitted.V0 - truth.V0) < 1e-3, $"V0 {fitted.V0}");
+        Assert.True(System.Math.Abs(fitted.Rho - truth.Rho) < 0.05, $"Rho {fitted.Rho}");
+    }
+
+    [Fact]
+    public void ComputeSlicePrices_MismatchedOutput_Throws()
+    {
+        bool[] isCalls = new bool[s_strikes.Length];
+        double[] prices = new double[s_strikes.Length - 1];
+
+        Assert.Throws<ArgumentException>(() => STPR003A.ComputeSlicePrices(
+            Spot, s_strikes, 0.5, HestonParameters.DefaultEquity, isCalls, prices));
+    }
+}
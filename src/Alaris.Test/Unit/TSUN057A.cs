@@ -0,0 +1,148 @@
+// TSUN057A.cs - Unit tests for analytic-gradient Heston calibration
+
+using System;
+using System.Collections.Generic;
+using Alaris.Strategy.Core;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for STPR003A price gradients and STIV001A price-based calibration.
+/// Component ID: TSUN057A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Analytic slice price gradients match central differences of the slice prices
+/// - Price and vega-weighted price calibration recover the generating parameters
+/// - Gradient output of the wrong length is rejected
+/// </remarks>
+public sealed class TSUN057A
+{
+    private const double Spot = 100.0;
+
+    private static readonly double[] s_strikes =
+    {
+        80.0, 85.0, 90.0, 95.0, 100.0, 105.0, 110.0, 115.0, 120.0
+    };
+
+    private static readonly HestonParameters s_truth = new HestonParameters
+    {
+        V0 = 0.05,
+        Theta = 0.06,
+        Kappa = 2.5,
+        SigmaV = 0.4,
+        Rho = -0.6,
+        RiskFreeRate = 0.04,
+        DividendYield = 0.01
+    };
+
+    [Theory]
+    [InlineData(5.0 / 252.0)]
+    [InlineData(0.25)]
+    [InlineData(2.0)]
+    public void ComputeSlicePriceGradients_MatchesFiniteDifferences(double timeToExpiry)
+    {
+        // Arrange
+        int count = s_strikes.Length;
+        bool[] isCalls = CreateOtmFlags();
+        double[] prices = new double[count];
+        double[] expectedPrices = new double[count];
+        double[] gradients = new double[count * STPR003A.GradientParameterCount];
+        double[] x = { s_truth.V0, s_truth.Theta, s_truth.Kappa, s_truth.SigmaV, s_truth.Rho };
+
+        // Act
+        STPR003A.ComputeSlicePriceGradients(Spot, s_strikes, timeToExpiry, s_truth, isCalls, prices, gradients);
+        STPR003A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, s_truth, isCalls, expectedPrices);
+
+        // Assert
+        for (int i = 0; i < count; i++)
+        {
+            Assert.True(System.Math.Abs(expectedPrices[i] - prices[i]) < 1e-12,
+                $"Strike {s_strikes[i]}: price {prices[i]} differs from {expectedPrices[i]}");
+        }
+
+        for (int p = 0; p < STPR003A.GradientParameterCount; p++)
+        {
+            double h = 1e-5 * System.Math.Max(1.0, System.Math.Abs(x[p]));
+            double[] up = (double[])x.Clone();
+            double[] down = (double[])x.Clone();
+            up[p] += h;
+            down[p] -= h;
+
+            double[] upPrices = new double[count];
+            double[] downPrices = new double[count];
+            STPR003A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, Create(up), isCalls, upPrices);
+            STPR003A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, Create(down), isCalls, downPrices);
+
+            for (int i = 0; i < count; i++)
+            {
+                double expected = (upPrices[i] - downPrices[i]) / (2 * h);
+                double actual = gradients[(i * STPR003A.GradientParameterCount) + p];
+                Assert.True(System.Math.Abs(expected - actual) < 1e-5 * System.Math.Max(1.0, System.Math.Abs(expected)),
+                    $"Strike {s_strikes[i]}, parameter {p}: expected {expected}, got {actual}");
+            }
+        }
+    }
+
+    [Theory]
+    [InlineData(HestonCalibrationObjective.Price)]
+    [InlineData(HestonCalibrationObjective.VegaWeightedPrice)]
+    public void Calibrate_PriceObjective_RecoversSurfaceParameters(HestonCalibrationObjective objective)
+    {
+        // Arrange: a surface generated by known parameters across four expiries
+        STIV001A model = new STIV001A(s_truth);
+        List<(double Strike, int DTE, double MarketIV)> marketData = new List<(double Strike, int DTE, double MarketIV)>();
+        foreach (int dte in new[] { 10, 30, 60, 120 })
+        {
+            foreach ((double strike, double iv) in model.ComputeSmile(Spot, s_strikes, dte / 252.0))
+            {
+                marketData.Add((strike, dte, iv));
+            }
+        }
+
+        // Act
+        HestonParameters fitted = STIV001A.Calibrate(
+            Spot, marketData, s_truth.RiskFreeRate, s_truth.DividendYield, objective);
+
+        // Assert
+        Assert.True(System.Math.Abs(fitted.V0 - s_truth.V0) < 1e-3, $"V0 {fitted.V0}");
+        Assert.True(System.Math.Abs(fitted.Rho - s_truth.Rho) < 0.05, $"Rho {fitted.Rho}");
+    }
+
+    [Fact]
+    public void ComputeSlicePriceGradients_WrongGradientLength_Throws()
+    {
+        bool[] isCalls = CreateOtmFlags();
+        double[] prices = new double[s_strikes.Length];
+        double[] gradients = new double[s_strikes.Length];
+
+        Assert.Throws<ArgumentException>(() => STPR003A.ComputeSlicePriceGradients(
+            Spot, s_strikes, 0.5, s_truth, isCalls, prices, gradients));
+    }
+
+    private static bool[] CreateOtmFlags()
+    {
+        bool[] isCalls = new bool[s_strikes.Length];
+        for (int i = 0; i < isCalls.Length; i++)
+        {
+            isCalls[i] = s_strikes[i] >= Spot;
+        }
+
+        return isCalls;
+    }
+
+    private static HestonParameters Create(double[] x)
+    {
+        return new HestonParameters
+        {
+            V0 = x[0],
+            Theta = x[1],
+            Kappa = x[2],
+            SigmaV = x[3],
+            Rho = x[4],
+            RiskFreeRate = s_truth.RiskFreeRate,
+            DividendYield = s_truth.DividendYield
+        };
+    }
+}
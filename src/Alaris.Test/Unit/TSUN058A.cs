@@ -0,0 +1,173 @@
+// TSUN058A.cs - Unit tests for STIV011A warm-start calibration store
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using Alaris.Strategy.Core;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STIV011A calibration store.
+/// Component ID: TSUN058A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - A stored fit that still prices today's surface is refined by LM alone, never made worse
+/// - A stale fit seeds the optimizer, which converges to the new surface
+/// - The store round-trips through its session-folder file
+/// </remarks>
+public sealed class TSUN058A
+{
+    private const double Spot = 100.0;
+    private const double Rate = 0.04;
+    private const double DividendYield = 0.01;
+
+    private static readonly double[] s_strikes = { 80.0, 85.0, 90.0, 95.0, 100.0, 105.0, 110.0, 115.0, 120.0 };
+
+    [Fact]
+    public void CalibrateHeston_UnchangedSurface_RefinesStoredFit()
+    {
+        // Arrange
+        STIV011A store = new STIV011A();
+        List<(double Strike, int DTE, double MarketIV)> surface = CreateSurface(0.05);
+        HestonParameters first = store.CalibrateHeston("AAPL", Spot, surface, Rate, DividendYield);
+        Assert.True(store.TryGetHeston("AAPL", out CalibrationSeed<HestonParameters>? stored));
+
+        // Act
+        HestonParameters second = store.CalibrateHeston("aapl", Spot, surface, Rate, DividendYield);
+
+        // Assert
+        Assert.Equal(1, store.ColdStarts);
+        Assert.Equal(1, store.ReuseHits);
+        Assert.Equal(0, store.WarmStarts);
+        Assert.True(store.TryGetHeston("AAPL", out CalibrationSeed<HestonParameters>? refined));
+        Assert.True(refined!.Rmse <= stored!.Rmse, $"RMSE {refined.Rmse} vs stored {stored.Rmse}");
+        Assert.True(System.Math.Abs(first.V0 - second.V0) < 1e-3, $"V0 {first.V0} -> {second.V0}");
+        Assert.True(System.Math.Abs(first.Rho - second.Rho) < 1e-2, $"Rho {first.Rho} -> {second.Rho}");
+    }
+
+    [Fact]
+    public void CalibrateKou_UnchangedSurface_RefinesStoredFit()
+    {
+        // Arrange
+        STIV011A store = new STIV011A();
+        List<(double Strike, int DTE, double MarketIV)> surface = CreateKouSurface();
+        store.CalibrateKou("AAPL", Spot, surface, Rate, DividendYield);
+        Assert.True(store.TryGetKou("AAPL", out CalibrationSeed<KouParameters>? stored));
+
+        // Act
+        store.CalibrateKou("AAPL", Spot, surface, Rate, DividendYield);
+
+        // Assert
+        Assert.Equal(1, store.ColdStarts);
+        Assert.Equal(1, store.ReuseHits);
+        Assert.True(store.TryGetKou("AAPL", out CalibrationSeed<KouParameters>? refined));
+        Assert.True(refined!.Rmse <= stored!.Rmse, $"RMSE {refined.Rmse} vs stored {stored.Rmse}");
+    }
+
+    [Fact]
+    public void CalibrateHeston_ShiftedSurface_WarmStartsFromStoredFit()
+    {
+        // Arrange
+        STIV011A store = new STIV011A();
+        store.CalibrateHeston("AAPL", Spot, CreateSurface(0.05), Rate, DividendYield);
+
+        // Act: a 0.05 -> 0.08 jump in instantaneous variance is far outside the reuse tolerance
+        HestonParameters fitted = store.CalibrateHeston("AAPL", Spot, CreateSurface(0.08), Rate, DividendYield);
+
+        // Assert
+        Assert.Equal(1, store.WarmStarts);
+        Assert.Equal(0, store.ReuseHits);
+        Assert.True(System.Math.Abs(fitted.V0 - 0.08) < 1e-3, $"V0 {fitted.V0}");
+        Assert.True(store.TryGetHeston("AAPL", out CalibrationSeed<HestonParameters>? seed));
+        Assert.True(seed!.Rmse < store.ReuseTolerance, $"RMSE {seed.Rmse}");
+    }
+
+    [Fact]
+    public void Save_ReloadedStore_ReusesPersistedFit()
+    {
+        // Arrange
+        string directory = Path.Combine(Path.GetTempPath(), "TSUN058A_" + Guid.NewGuid().ToString("N"));
+        Directory.CreateDirectory(directory);
+        try
+        {
+            List<(double Strike, int DTE, double MarketIV)> surface = CreateSurface(0.05);
+            STIV011A store = new STIV011A(directory);
+            HestonParameters fitted = store.CalibrateHeston("MSFT", Spot, surface, Rate, DividendYield);
+            store.Save();
+
+            // Act
+            STIV011A reloaded = new STIV011A(directory);
+            HestonParameters reused = reloaded.CalibrateHeston("MSFT", Spot, surface, Rate, DividendYield);
+
+            // Assert
+            Assert.Equal(1, reloaded.SymbolCount);
+            Assert.Equal(1, reloaded.ReuseHits);
+            Assert.True(System.Math.Abs(fitted.Kappa - reused.Kappa) < 0.1, $"Kappa {fitted.Kappa} -> {reused.Kappa}");
+        }
+        finally
+        {
+            Directory.Delete(directory, recursive: true);
+        }
+    }
+
+    [Fact]
+    public void Save_WithoutPersistenceDirectory_Throws()
+    {
+        STIV011A store = new STIV011A();
+
+        Assert.Throws<InvalidOperationException>(() => store.Save());
+    }
+
+    private static List<(double Strike, int DTE, double MarketIV)> CreateSurface(double v0)
+    {
+        STIV001A model = new STIV001A(new HestonParameters
+        {
+            V0 = v0,
+            Theta = 0.06,
+            Kappa = 2.5,
+            SigmaV = 0.4,
+            Rho = -0.6,
+            RiskFreeRate = Rate,
+            DividendYield = DividendYield
+        });
+
+        List<(double Strike, int DTE, double MarketIV)> surface = new List<(double Strike, int DTE, double MarketIV)>();
+        foreach (int dte in new[] { 10, 30, 60, 120 })
+        {
+            foreach ((double strike, double iv) in model.ComputeSmile(Spot, s_strikes, dte / 252.0))
+            {
+                surface.Add((strike, dte, iv));
+            }
+        }
+
+        return surface;
+    }
+
+    private static List<(double Strike, int DTE, double MarketIV)> CreateKouSurface()
+    {
+        STIV002A model = new STIV002A(new KouParameters
+        {
+            Sigma = 0.2,
+            Lambda = 3.0,
+            P = 0.4,
+            Eta1 = 10.0,
+            Eta2 = 5.0,
+            RiskFreeRate = Rate,
+            DividendYield = DividendYield
+        });
+
+        List<(double Strike, int DTE, double MarketIV)> surface = new List<(double Strike, int DTE, double MarketIV)>();
+        foreach (int dte in new[] { 10, 30, 60, 120 })
+        {
+            foreach ((double strike, double iv) in model.ComputeSmile(Spot, s_strikes, dte / 252.0))
+            {
+                surface.Add((strike, dte, iv));
+            }
+        }
+
+        return surface;
+    }
+}
@@ -0,0 +1,125 @@
+// TSUN059A.cs - Unit tests for STPR005A Differential Evolution optimizer
+
+using System;
+using Alaris.Strategy.Core.Numerical;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STPR005A Differential Evolution optimizer.
+/// Component ID: TSUN059A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - A fixed seed gives identical results for serial and parallel fitness evaluation
+/// - The optimizer locates the Rosenbrock minimum
+/// - Diversity collapse terminates the search early
+/// - A seeded initial guess is kept in the population
+/// </remarks>
+public sealed class TSUN059A
+{
+    private static readonly double[] s_lowerBounds = { -5.0, -5.0, -5.0, -5.0 };
+    private static readonly double[] s_upperBounds = { 5.0, 5.0, 5.0, 5.0 };
+
+    [Fact]
+    public void Minimize_FixedSeed_IsIndependentOfParallelism()
+    {
+        // Arrange
+        STPR005A serial = new STPR005A { RandomSeed = 42, MaxGenerations = 200, MaxDegreeOfParallelism = 1 };
+        STPR005A parallel = new STPR005A { RandomSeed = 42, MaxGenerations = 200, MaxDegreeOfParallelism = 4 };
+
+        // Act
+        OptimizationResult serialResult = serial.Minimize(Rosenbrock, s_lowerBounds, s_upperBounds);
+        OptimizationResult parallelResult = parallel.Minimize(Rosenbrock, s_lowerBounds, s_upperBounds);
+
+        // Assert
+        Assert.Equal(serialResult.Iterations, parallelResult.Iterations);
+        Assert.Equal(serialResult.OptimalValue, parallelResult.OptimalValue);
+        Assert.Equal(serialResult.OptimalParameters, parallelResult.OptimalParameters);
+    }
+
+    [Fact]
+    public void Minimize_Rosenbrock_FindsGlobalMinimum()
+    {
+        // Arrange
+        STPR005A optimizer = new STPR005A { RandomSeed = 7, MaxGenerations = 2000 };
+
+        // Act
+        OptimizationResult result = optimizer.Minimize(Rosenbrock, s_lowerBounds, s_upperBounds);
+
+        // Assert
+        Assert.True(result.OptimalValue < 1e-4, $"Objective {result.OptimalValue}");
+        foreach (double x in result.OptimalParameters)
+        {
+            Assert.True(Math.Abs(x - 1.0) < 0.05, $"Parameter {x}");
+        }
+    }
+
+    [Fact]
+    public void Minimize_DiversityCollapse_TerminatesEarly()
+    {
+        // Arrange: a flat objective never trips the fitness-spread test
+        STPR005A optimizer = new STPR005A
+        {
+            RandomSeed = 3,
+            MaxGenerations = 5000,
+            Tolerance = 0.0,
+            DiversityTolerance = 1e-3
+        };
+
+        // Act
+        OptimizationResult result = optimizer.Minimize(Sphere, s_lowerBounds, s_upperBounds);
+
+        // Assert
+        Assert.Equal(OptimizationStatus.ParameterConvergence, result.Status);
+        Assert.True(result.Iterations < 5000, $"Iterations {result.Iterations}");
+        Assert.True(result.OptimalValue < 1e-4, $"Objective {result.OptimalValue}");
+    }
+
+    [Fact]
+    public void Minimize_InitialGuessAtOptimum_IsRetained()
+    {
+        // Arrange
+        STPR005A optimizer = new STPR005A { RandomSeed = 11, MaxGenerations = 1 };
+        double[] guess = { 0.0, 0.0, 0.0, 0.0 };
+
+        // Act
+        OptimizationResult result = optimizer.Minimize(Sphere, s_lowerBounds, s_upperBounds, guess);
+
+        // Assert
+        Assert.Equal(0.0, result.OptimalValue);
+    }
+
+    [Fact]
+    public void Minimize_PopulationTooSmall_Throws()
+    {
+        STPR005A optimizer = new STPR005A { PopulationSize = 3 };
+
+        Assert.Throws<ArgumentException>(() => optimizer.Minimize(Sphere, s_lowerBounds, s_upperBounds));
+    }
+
+    private static double Rosenbrock(double[] x)
+    {
+        double sum = 0.0;
+        for (int i = 0; i < x.Length - 1; i++)
+        {
+            double a = x[i + 1] - (x[i] * x[i]);
+            double b = 1.0 - x[i];
+            sum += (100.0 * a * a) + (b * b);
+        }
+
+        return sum;
+    }
+
+    private static double Sphere(double[] x)
+    {
+        double sum = 0.0;
+        for (int i = 0; i < x.Length; i++)
+        {
+            sum += x[i] * x[i];
+        }
+
+        return sum;
+    }
+}
@@ -0,0 +1,124 @@
+// TSUN060A.cs - Unit tests for vector-valued integration in STPR002B/STPR002C
+
+using System;
+using System.Numerics;
+using Alaris.Strategy.Core.Numerical;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STPR002B/STPR002C vector-valued integrators.
+/// Component ID: TSUN060A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Each component of a vector integral matches its scalar integral
+/// - Integrands wider than the stack buffer are handled
+/// - Complex integration evaluates the integrand once per node
+/// </remarks>
+public sealed class TSUN060A
+{
+    [Fact]
+    public void IntegrateToInfinity_Vector_MatchesClosedForms()
+    {
+        // Arrange: integral of exp(-c x) cos(x) over [0, inf) is c / (c^2 + 1)
+        double[] decays = { 0.5, 1.0, 2.0 };
+        double[] results = new double[decays.Length];
+
+        // Act
+        STPR002C.IntegrateToInfinity(
+            (x, values) =>
+            {
+                for (int k = 0; k < decays.Length; k++)
+                {
+                    values[k] = Math.Exp(-decays[k] * x) * Math.Cos(x);
+                }
+            },
+            0.0,
+            results);
+
+        // Assert
+        for (int k = 0; k < decays.Length; k++)
+        {
+            double expected = decays[k] / ((decays[k] * decays[k]) + 1.0);
+            Assert.True(Math.Abs(expected - results[k]) < 1e-8,
+                $"Component {k}: expected {expected}, got {results[k]}");
+        }
+    }
+
+    [Fact]
+    public void Integrate_WideVector_MatchesScalarIntegration()
+    {
+        // Arrange: more components than the stack buffer holds
+        const int count = 40;
+        double[] results = new double[count];
+
+        // Act
+        STPR002B.Integrate(
+            (x, values) =>
+            {
+                for (int k = 0; k < values.Length; k++)
+                {
+                    values[k] = Math.Pow(x, k % 5) * Math.Sin((k + 1) * x);
+                }
+            },
+            0.0,
+            2.0,
+            results);
+
+        // Assert
+        for (int k = 0; k < count; k++)
+        {
+            int power = k % 5;
+            int frequency = k + 1;
+            double expected = STPR002B.Integrate(x => Math.Pow(x, power) * Math.Sin(frequency * x), 0.0, 2.0);
+            Assert.True(Math.Abs(expected - results[k]) < 1e-12,
+                $"Component {k}: expected {expected}, got {results[k]}");
+        }
+    }
+
+    [Fact]
+    public void IntegrateComplexToInfinity_EvaluatesIntegrandOncePerNode()
+    {
+        // Arrange: integral of exp((-0.1 + i) x) over [0, inf) is 1 / (0.1 - i)
+        int evaluations = 0;
+        Complex Integrand(double x)
+        {
+            evaluations++;
+            return Complex.Exp(new Complex(-0.1, 1.0) * x);
+        }
+
+        // Act
+        (Complex value, double _) = STPR002B.IntegrateComplexToInfinity(Integrand, 0.0);
+
+        // Assert: as many calls as quadrature nodes visited by the two-component vector integral
+        int nodes = 0;
+        double[] parts = new double[2];
+        STPR002B.IntegrateToInfinity(
+            (x, values) =>
+            {
+                nodes++;
+                Complex z = Complex.Exp(new Complex(-0.1, 1.0) * x);
+                values[0] = z.Real;
+                values[1] = z.Imaginary;
+            },
+            0.0,
+            parts);
+
+        Complex expected = 1.0 / new Complex(0.1, -1.0);
+        Assert.True(Complex.Abs(expected - value) < 1e-7, $"Expected {expected}, got {value}");
+        Assert.Equal(nodes, evaluations);
+    }
+
+    [Fact]
+    public void IntegrateToInfinity_EmptyResults_ReturnsWithoutEvaluating()
+    {
+        int evaluations = 0;
+
+        double error = STPR002B.IntegrateToInfinity((x, values) => evaluations++, 0.0, Span<double>.Empty);
+
+        Assert.Equal(0.0, error);
+        Assert.Equal(0, evaluations);
+    }
+}
@@ -0,0 +1,211 @@
+// TSUN061A.cs - Unit tests for concurrent STIV003A model selection
+
+using System;
+using System.Collections.Generic;
+using Alaris.Strategy.Core;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for concurrent candidate evaluation in STIV003A.
+/// Component ID: TSUN061A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Every candidate is evaluated and reported in candidate order by default
+/// - A dominant fit cancels the remaining candidates and is selected
+/// - An exhausted latency budget still returns a selectable evaluation
+/// - A selectable result arriving after the budget cancels the slower candidates
+/// - Candidates still pending at the cancel are reported cancelled, however they finish
+/// </remarks>
+public sealed class TSUN061A
+{
+    private const double Spot = 100.0;
+    private const double BaseVolatility = 0.20;
+
+    [Fact]
+    public void SelectBestModel_DefaultConfig_EvaluatesEveryCandidate()
+    {
+        // Arrange
+        STIV003A selector = new STIV003A();
+        ModelSelectionContext context = CreateContext();
+
+        // Act
+        ModelSelectionResult result = selector.SelectBestModel(context);
+
+        // Assert: no-earnings candidates in order
+        Assert.Equal(3, result.Evaluations.Count);
+        Assert.Equal(RecommendedModel.Heston, result.Evaluations[0].ModelType);
+        Assert.Equal(RecommendedModel.Kou, result.Evaluations[1].ModelType);
+        Assert.Equal(RecommendedModel.BlackScholes, result.Evaluations[2].ModelType);
+
+        double expectedMse = 0.0;
+        foreach ((double _, int _, double iv) in context.MarketIVs!)
+        {
+            expectedMse += (BaseVolatility - iv) * (BaseVolatility - iv);
+        }
+
+        expectedMse /= context.MarketIVs!.Count;
+
+        foreach (ModelEvaluation evaluation in result.Evaluations)
+        {
+            Assert.False(evaluation.Cancelled, $"{evaluation.ModelType} was cancelled");
+            Assert.True(evaluation.EvaluationTime >= TimeSpan.Zero);
+        }
+
+        Assert.True(result.Evaluations[0].FitMetrics.RMSE < 1e-3, $"Heston RMSE {result.Evaluations[0].FitMetrics.RMSE}");
+        Assert.True(Math.Abs(result.Evaluations[2].FitMetrics.MSE - expectedMse) < 1e-15);
+        Assert.True(result.Evaluations[2].FitMetrics.VegaWeightedRMSE > 0);
+    }
+
+    [Fact]
+    public void SelectBestModel_DominantFit_CancelsRemainingCandidates()
+    {
+        // Arrange: the blend fits a flat smile and finishes long before the Heston slices
+        STIV003A selector = new STIV003A(new RegimeModelConfig { DominantFitRmse = 1e-3 });
+        ModelSelectionContext context = CreatePostEarningsFlatContext();
+
+        // Act
+        ModelSelectionResult result = selector.SelectBestModel(context);
+
+        // Assert
+        Assert.Equal(STTM002AType.PostEarningsTransition, result.Regime.RegimeType);
+        Assert.False(result.BestEvaluation.Cancelled);
+        Assert.True(result.BestEvaluation.FitMetrics.RMSE <= 1e-3, $"Selected RMSE {result.BestEvaluation.FitMetrics.RMSE}");
+        Assert.Equal(RecommendedModel.Heston, result.Evaluations[1].ModelType);
+        Assert.True(result.Evaluations[1].Cancelled, "Heston should be cancelled by the dominant fit");
+        foreach (ModelEvaluation evaluation in result.Evaluations)
+        {
+            if (evaluation.Cancelled)
+            {
+                Assert.Equal(double.MaxValue, evaluation.CompositeScore);
+            }
+        }
+    }
+
+    [Fact]
+    public void SelectBestModel_ExhaustedBudget_SelectsCompletedCandidate()
+    {
+        // Arrange
+        STIV003A selector = new STIV003A(new RegimeModelConfig { SelectionLatencyBudget = TimeSpan.Zero });
+        ModelSelectionContext context = CreateContext();
+
+        // Act
+        ModelSelectionResult result = selector.SelectBestModel(context);
+
+        // Assert
+        Assert.Equal(3, result.Evaluations.Count);
+        Assert.False(result.BestEvaluation.Cancelled);
+        Assert.True(result.SelectionTime > TimeSpan.Zero);
+    }
+
+    [Fact]
+    public void SelectBestModel_SelectableAfterBudget_CancelsSlowerCandidates()
+    {
+        // Arrange: nothing finishes within a zero budget; the blend finishes soon after it,
+        // well before the Heston slices, and no fit threshold is set
+        STIV003A selector = new STIV003A(new RegimeModelConfig { SelectionLatencyBudget = TimeSpan.Zero });
+        ModelSelectionContext context = CreatePostEarningsFlatContext();
+
+        // Act
+        ModelSelectionResult result = selector.SelectBestModel(context);
+
+        // Assert: the first selectable result after the budget stops the slower candidates
+        Assert.False(result.BestEvaluation.Cancelled);
+        Assert.Equal(RecommendedModel.Heston, result.Evaluations[1].ModelType);
+        Assert.True(result.Evaluations[1].Cancelled, "Heston should be cancelled once a selectable result arrives");
+        Assert.Equal(double.MaxValue, result.Evaluations[1].CompositeScore);
+    }
+
+    [Fact]
+    public void SelectBestModel_CancelOnFirstSelectable_ReportsLaterCompletionsAsCancelled()
+    {
+        // Arrange: any fit dominates, so the first selectable result cancels the rest. Black-Scholes
+        // has no cancellation checkpoint and usually finishes after the cancel regardless.
+        STIV003A selector = new STIV003A(new RegimeModelConfig { DominantFitRmse = 1.0 });
+        ModelSelectionContext context = CreateContext();
+
+        for (int run = 0; run < 20; run++)
+        {
+            // Act
+            ModelSelectionResult result = selector.SelectBestModel(context);
+
+            // Assert: only the result taken before the cancel can be selectable
+            int selectable = 0;
+            foreach (ModelEvaluation evaluation in result.Evaluations)
+            {
+                if (!evaluation.Cancelled && evaluation.MartingaleValid)
+                {
+                    selectable++;
+                    Assert.Same(result.BestEvaluation, evaluation);
+                }
+
+                if (evaluation.Cancelled)
+                {
+                    Assert.Equal(double.MaxValue, evaluation.CompositeScore);
+                }
+            }
+
+            Assert.Equal(1, selectable);
+        }
+    }
+
+    /// <summary>
+    /// A post-earnings chain quoted near flat at the base volatility, with enough expiries that
+    /// Heston, priced one expiry slice at a time, runs long after the constant-IV blend.
+    /// </summary>
+    private static ModelSelectionContext CreatePostEarningsFlatContext()
+    {
+        List<(double Strike, int DTE, double IV)> marketIVs = new List<(double Strike, int DTE, double IV)>();
+        for (int dte = 10; dte <= 400; dte += 10)
+        {
+            for (double strike = 80.0; strike <= 120.0; strike += 5.0)
+            {
+                marketIVs.Add((strike, dte, BaseVolatility + (0.0005 * Math.Sin(marketIVs.Count))));
+            }
+        }
+
+        HestonParameters heston = HestonParameters.DefaultEquity;
+        return new ModelSelectionContext
+        {
+            Spot = Spot,
+            BaseVolatility = BaseVolatility,
+            RiskFreeRate = heston.RiskFreeRate,
+            DividendYield = heston.DividendYield,
+            TimeParams = STTM004A.Create(new DateTime(2024, 1, 15), new DateTime(2024, 2, 16), new DateTime(2024, 1, 12)),
+            HestonParams = heston,
+            KouParams = KouParameters.DefaultEquity,
+            MarketIVs = marketIVs
+        };
+    }
+
+    private static ModelSelectionContext CreateContext()
+    {
+        HestonParameters heston = HestonParameters.DefaultEquity;
+        STIV001A model = new STIV001A(heston);
+        double[] strikes = { 85.0, 90.0, 95.0, 100.0, 105.0, 110.0, 115.0 };
+
+        List<(double Strike, int DTE, double IV)> marketIVs = new List<(double Strike, int DTE, double IV)>();
+        foreach (int dte in new[] { 20, 40, 60 })
+        {
+            foreach ((double strike, double iv) in model.ComputeSmile(Spot, strikes, dte / 252.0))
+            {
+                // Small quote noise so no model fits exactly
+                marketIVs.Add((strike, dte, iv + (0.0005 * Math.Sin(marketIVs.Count))));
+            }
+        }
+
+        return new ModelSelectionContext
+        {
+            Spot = Spot,
+            BaseVolatility = BaseVolatility,
+            RiskFreeRate = heston.RiskFreeRate,
+            DividendYield = heston.DividendYield,
+            TimeParams = STTM004A.Create(new DateTime(2024, 1, 15), new DateTime(2024, 2, 16)),
+            HestonParams = heston,
+            KouParams = KouParameters.DefaultEquity,
+            MarketIVs = marketIVs
+        };
+    }
+}
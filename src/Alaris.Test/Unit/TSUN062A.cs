@@ -0,0 +1,154 @@
+// TSUN062A.cs - Unit tests for STPR006A closed-form and COS slice pricing of the Kou model
+
+using System;
+using Alaris.Strategy.Core;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STPR006A Kou pricers.
+/// Component ID: TSUN062A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - The closed-form Hh series matches the COS slice across expiries and jump regimes
+/// - Heavy upward jump tails (eta1 close to 1) price consistently
+/// - Without jumps the series reduces to Black-Scholes
+/// - Slice calls and puts satisfy put-call parity
+/// - Slice implied volatilities match the per-strike Kou implied volatility
+/// </remarks>
+public sealed class TSUN062A
+{
+    private const double Spot = 100.0;
+
+    private static readonly double[] s_strikes =
+    {
+        60.0, 70.0, 80.0, 85.0, 90.0, 95.0, 100.0, 105.0, 110.0, 115.0, 120.0, 130.0, 150.0
+    };
+
+    [Theory]
+    [InlineData(0.20, 3.0, 0.4, 10.0, 5.0, 5.0 / 252.0)]
+    [InlineData(0.20, 3.0, 0.4, 10.0, 5.0, 0.5)]
+    [InlineData(0.15, 10.0, 0.3, 4.0, 3.0, 30.0 / 252.0)]
+    [InlineData(0.15, 10.0, 0.3, 4.0, 3.0, 2.0)]
+    [InlineData(0.30, 1.0, 0.4, 1.5, 1.2, 0.25)]
+    [InlineData(0.05, 2.0, 0.5, 20.0, 15.0, 1.0)]
+    public void ComputePrice_MatchesSlicePrices(
+        double sigma, double lambda, double p, double eta1, double eta2, double timeToExpiry)
+    {
+        // Arrange
+        KouParameters parameters = new KouParameters
+        {
+            Sigma = sigma,
+            Lambda = lambda,
+            P = p,
+            Eta1 = eta1,
+            Eta2 = eta2,
+            RiskFreeRate = 0.04,
+            DividendYield = 0.01
+        };
+        bool[] isCalls = new bool[s_strikes.Length];
+        for (int i = 0; i < isCalls.Length; i++)
+        {
+            isCalls[i] = s_strikes[i] >= Spot;
+        }
+
+        double[] prices = new double[s_strikes.Length];
+
+        // Act
+        STPR006A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, parameters, isCalls, prices);
+
+        // Assert
+        for (int i = 0; i < s_strikes.Length; i++)
+        {
+            double series = STPR006A.ComputePrice(Spot, s_strikes[i], timeToExpiry, parameters, isCalls[i]);
+            Assert.True(System.Math.Abs(series - prices[i]) < 1e-7,
+                $"Strike {s_strikes[i]}: series {series}, COS {prices[i]}");
+        }
+    }
+
+    [Fact]
+    public void ComputePrice_WithoutJumps_MatchesBlackScholes()
+    {
+        // Arrange
+        KouParameters parameters = new KouParameters
+        {
+            Sigma = 0.25,
+            Lambda = 0.0,
+            P = 0.4,
+            Eta1 = 10.0,
+            Eta2 = 5.0,
+            RiskFreeRate = 0.05,
+            DividendYield = 0.02
+        };
+        const double timeToExpiry = 0.5;
+
+        foreach (double strike in s_strikes)
+        {
+            // Act
+            double kou = STPR006A.ComputePrice(Spot, strike, timeToExpiry, parameters, isCall: true);
+            double blackScholes = Alaris.Core.Math.CRMF001A.BSPrice(
+                Spot, strike, timeToExpiry, parameters.Sigma, parameters.RiskFreeRate, parameters.DividendYield, true);
+
+            // Assert: within the 1.5e-7 accuracy of the CRMF001A normal CDF
+            Assert.True(System.Math.Abs(kou - blackScholes) < 1e-4,
+                $"Strike {strike}: Kou {kou}, Black-Scholes {blackScholes}");
+        }
+    }
+
+    [Fact]
+    public void ComputeSlicePrices_SatisfiesPutCallParity()
+    {
+        // Arrange
+        KouParameters parameters = KouParameters.DefaultEquity;
+        const double timeToExpiry = 0.25;
+        bool[] calls = new bool[s_strikes.Length];
+        bool[] puts = new bool[s_strikes.Length];
+        Array.Fill(calls, true);
+        double[] callPrices = new double[s_strikes.Length];
+        double[] putPrices = new double[s_strikes.Length];
+
+        // Act
+        STPR006A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, parameters, calls, callPrices);
+        STPR006A.ComputeSlicePrices(Spot, s_strikes, timeToExpiry, parameters, puts, putPrices);
+
+        // Assert
+        double forward = Spot * System.Math.Exp(-parameters.DividendYield * timeToExpiry);
+        double discount = System.Math.Exp(-parameters.RiskFreeRate * timeToExpiry);
+        for (int i = 0; i < s_strikes.Length; i++)
+        {
+            double parity = callPrices[i] - putPrices[i] - (forward - (s_strikes[i] * discount));
+            Assert.True(System.Math.Abs(parity) < 1e-10, $"Strike {s_strikes[i]}: parity gap {parity}");
+        }
+    }
+
+    [Fact]
+    public void ComputeSmile_MatchesPerStrikeImpliedVolatility()
+    {
+        // Arrange
+        STIV002A model = new STIV002A(KouParameters.DefaultEquity);
+        const double timeToExpiry = 30.0 / 252.0;
+
+        // Act
+        (double Strike, double TheoreticalIV)[] smile = model.ComputeSmile(Spot, s_strikes, timeToExpiry);
+
+        // Assert
+        for (int i = 0; i < smile.Length; i++)
+        {
+            double expected = model.ComputeTheoreticalIV(Spot, s_strikes[i], timeToExpiry);
+            Assert.True(System.Math.Abs(expected - smile[i].TheoreticalIV) < 1e-5,
+                $"Strike {s_strikes[i]}: expected IV {expected}, got {smile[i].TheoreticalIV}");
+        }
+    }
+
+    [Fact]
+    public void ComputeSlicePrices_MismatchedOutput_Throws()
+    {
+        bool[] isCalls = new bool[s_strikes.Length];
+        double[] prices = new double[s_strikes.Length - 1];
+
+        Assert.Throws<ArgumentException>(() => STPR006A.ComputeSlicePrices(
+            Spot, s_strikes, 0.5, KouParameters.DefaultEquity, isCalls, prices));
+    }
+}
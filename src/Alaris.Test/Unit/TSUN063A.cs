@@ -0,0 +1,158 @@
+// TSUN063A.cs - Unit tests for the generated Gauss and Chebyshev tables behind CRGQ001A and CRCH001A
+
+using System;
+using Alaris.Core.Math;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the generated quadrature and Chebyshev tables.
+/// Component ID: TSUN063A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Gauss-Legendre rules integrate every monomial up to degree 2n-1 exactly
+/// - Gauss-Laguerre and Gauss-Hermite rules reproduce the low-order moments
+/// - Chebyshev cosines and barycentric weights match their closed forms
+/// - Array-returning accessors copy the same values the span accessors expose
+/// - Orders beyond the tables are rejected
+/// </remarks>
+public sealed class TSUN063A
+{
+    [Theory]
+    [InlineData(1)]
+    [InlineData(5)]
+    [InlineData(16)]
+    [InlineData(32)]
+    [InlineData(64)]
+    public void GaussLegendre_IntegratesMonomialsExactly(int n)
+    {
+        ReadOnlySpan<double> nodes = CRGQ001A.GaussLegendreNodes(n);
+        ReadOnlySpan<double> weights = CRGQ001A.GaussLegendreWeights(n);
+
+        for (int degree = 0; degree <= System.Math.Min((2 * n) - 1, 20); degree++)
+        {
+            double sum = 0.0;
+            for (int i = 0; i < n; i++)
+            {
+                sum += weights[i] * System.Math.Pow(nodes[i], degree);
+            }
+
+            double expected = degree % 2 == 0 ? 2.0 / (degree + 1) : 0.0;
+            Assert.True(System.Math.Abs(sum - expected) < 1e-13, $"n={n}, degree {degree}: {sum} vs {expected}");
+        }
+    }
+
+    [Theory]
+    [InlineData(4)]
+    [InlineData(16)]
+    [InlineData(32)]
+    public void GaussLaguerre_ReproducesFactorialMoments(int n)
+    {
+        ReadOnlySpan<double> nodes = CRGQ001A.GaussLaguerreNodes(n);
+        ReadOnlySpan<double> weights = CRGQ001A.GaussLaguerreWeights(n);
+
+        double factorial = 1.0;
+        for (int k = 0; k < System.Math.Min(2 * n, 8); k++)
+        {
+            if (k > 0)
+            {
+                factorial *= k;
+            }
+
+            double sum = 0.0;
+            for (int i = 0; i < n; i++)
+            {
+                sum += weights[i] * System.Math.Pow(nodes[i], k);
+            }
+
+            Assert.True(System.Math.Abs(sum - factorial) < 1e-10 * factorial, $"n={n}, k={k}: {sum} vs {factorial}");
+        }
+    }
+
+    [Theory]
+    [InlineData(3)]
+    [InlineData(10)]
+    [InlineData(32)]
+    public void GaussHermite_ReproducesGaussianMoments(int n)
+    {
+        ReadOnlySpan<double> nodes = CRGQ001A.GaussHermiteNodes(n);
+        ReadOnlySpan<double> weights = CRGQ001A.GaussHermiteWeights(n);
+
+        // ∫ x^(2m) e^(-x²) dx = Γ(m + ½) = √π·(2m-1)!!/2^m
+        double expected = System.Math.Sqrt(System.Math.PI);
+        for (int m = 0; (2 * m) < System.Math.Min(2 * n, 8); m++)
+        {
+            if (m > 0)
+            {
+                expected *= (2.0 * m - 1.0) / 2.0;
+            }
+
+            double even = 0.0;
+            double odd = 0.0;
+            for (int i = 0; i < n; i++)
+            {
+                even += weights[i] * System.Math.Pow(nodes[i], 2 * m);
+                odd += weights[i] * System.Math.Pow(nodes[i], (2 * m) + 1);
+            }
+
+            Assert.True(System.Math.Abs(even - expected) < 1e-12, $"n={n}, m={m}: {even} vs {expected}");
+            Assert.True(System.Math.Abs(odd) < 1e-12, $"n={n}, odd moment {2 * m + 1}: {odd}");
+        }
+    }
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(8)]
+    [InlineData(24)]
+    [InlineData(64)]
+    public void ChebyshevTables_MatchClosedForms(int n)
+    {
+        ReadOnlySpan<double> cosines = CRCH001A.ChebyshevCosines(n);
+        ReadOnlySpan<double> weights = CRCH001A.ChebyshevBarycentricWeights(n);
+
+        for (int k = 0; k < n; k++)
+        {
+            double theta = (2.0 * k + 1.0) * System.Math.PI / (2.0 * n);
+            double weight = (k % 2 == 0 ? 1.0 : -1.0) * System.Math.Sin(theta);
+            Assert.Equal(System.Math.Cos(theta), cosines[n - 1 - k], 15);
+            Assert.Equal(weight, weights[k], 15);
+        }
+
+        if (n >= 2)
+        {
+            ReadOnlySpan<double> lobatto = CRCH001A.ChebyshevLobattoCosines(n);
+            for (int k = 0; k < n; k++)
+            {
+                Assert.Equal(System.Math.Cos(k * System.Math.PI / (n - 1)), lobatto[n - 1 - k], 15);
+            }
+        }
+    }
+
+    [Fact]
+    public void ArrayAccessors_CopyTableValues()
+    {
+        (double[] nodes, double[] weights) = CRGQ001A.GaussLegendre(12);
+        Assert.True(nodes.AsSpan().SequenceEqual(CRGQ001A.GaussLegendreNodes(12)));
+        Assert.True(weights.AsSpan().SequenceEqual(CRGQ001A.GaussLegendreWeights(12)));
+
+        // Mutating a copy must not leak into the shared tables
+        nodes[0] = 42.0;
+        Assert.NotEqual(42.0, CRGQ001A.GaussLegendreNodes(12)[0]);
+
+        double[] chebyshev = CRCH001A.ChebyshevNodes(12, -1.0, 1.0);
+        Assert.True(chebyshev.AsSpan().SequenceEqual(CRCH001A.ChebyshevCosines(12)));
+        Assert.True(CRCH001A.BarycentricWeights(12).AsSpan().SequenceEqual(CRCH001A.ChebyshevBarycentricWeights(12)));
+    }
+
+    [Fact]
+    public void Accessors_BeyondTables_Throw()
+    {
+        Assert.Throws<ArgumentOutOfRangeException>(() => CRGQ001A.GaussLegendreNodes(65).Length);
+        Assert.Throws<ArgumentOutOfRangeException>(() => CRGQ001A.GaussLaguerreWeights(33).Length);
+        Assert.Throws<ArgumentOutOfRangeException>(() => CRGQ001A.GaussHermiteNodes(0).Length);
+        Assert.Throws<ArgumentOutOfRangeException>(() => CRCH001A.ChebyshevCosines(65).Length);
+        Assert.Throws<ArgumentOutOfRangeException>(() => CRCH001A.ChebyshevLobattoCosines(1).Length);
+    }
+}
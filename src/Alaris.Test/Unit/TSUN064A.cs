@@ -0,0 +1,122 @@
+// TSUN064A.cs - Unit tests for the table-backed tanh-sinh integrator in CRGQ001A
+
+using System;
+using System.Threading.Tasks;
+using Alaris.Core.Math;
+using Alaris.Core.Options;
+using Alaris.Core.Pricing;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for CRGQ001A tanh-sinh quadrature over the shared CRGQ003A node table.
+/// Component ID: TSUN064A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Endpoint-singular and smooth integrals reach their closed forms
+/// - Deep refinement levels keep every node of the level
+/// - The batched overload reaches every component's closed form, singular ones included
+/// - Concurrent first use of the table yields identical results
+/// - HighPrecision spectral pricing agrees with Gauss-Legendre integration at the same node count
+/// </remarks>
+public sealed class TSUN064A
+{
+    [Fact]
+    public void TanhSinhIntegrate_EndpointSingularity_MatchesClosedForm()
+    {
+        // ∫_{-1}^{1} 1/√(1-x²) dx = π
+        double result = CRGQ001A.TanhSinhIntegrate(x => 1.0 / System.Math.Sqrt(1.0 - (x * x)), -1.0, 1.0);
+
+        Assert.True(System.Math.Abs(result - System.Math.PI) < 1e-7, $"Got {result}");
+    }
+
+    [Fact]
+    public void TanhSinhIntegrate_Smooth_MatchesClosedForm()
+    {
+        double result = CRGQ001A.TanhSinhIntegrate(System.Math.Exp, 0.0, 1.0, 1e-14, 12);
+
+        Assert.True(System.Math.Abs(result - (System.Math.E - 1.0)) < 1e-14, $"Got {result}");
+    }
+
+    [Fact]
+    public void TanhSinhIntegrate_DeepLevels_KeepConverging()
+    {
+        // A kink at 0.3 keeps the rule refining well past ten levels
+        static double Kinked(double x) => System.Math.Exp(-x) * (x < 0.3 ? 1.0 : 1.0 + ((x - 0.3) * (x - 0.3)));
+        double exact = (1.0 - System.Math.Exp(-1.0))
+            + (System.Math.Exp(-0.3) * (2.0 - (System.Math.Exp(-0.7) * (0.49 + 1.4 + 2.0))));
+
+        for (int levels = 10; levels <= 14; levels++)
+        {
+            double result = CRGQ001A.TanhSinhIntegrate(Kinked, 0.0, 1.0, 1e-12, levels);
+            Assert.True(System.Math.Abs(result - exact) < 1e-8, $"{levels} levels: {result} vs {exact}");
+        }
+    }
+
+    [Fact]
+    public void TanhSinhIntegrate_Batch_MatchesClosedFormsPerComponent()
+    {
+        Func<double, double>[] functions =
+        {
+            System.Math.Exp,
+            x => 1.0 / System.Math.Sqrt(x),
+            x => System.Math.Cos(3.0 * x),
+        };
+        double[] results = new double[functions.Length];
+
+        CRGQ001A.TanhSinhIntegrate(
+            (x, values) =>
+            {
+                for (int j = 0; j < functions.Length; j++)
+                {
+                    values[j] = functions[j](x);
+                }
+            },
+            0.0, 1.0, results);
+
+        Assert.True(System.Math.Abs(results[0] - (System.Math.E - 1.0)) < 1e-9, $"exp: {results[0]}");
+        Assert.True(System.Math.Abs(results[1] - 2.0) < 1e-8, $"1/sqrt: {results[1]}");
+        Assert.True(System.Math.Abs(results[2] - (System.Math.Sin(3.0) / 3.0)) < 1e-9, $"cos: {results[2]}");
+    }
+
+    [Fact]
+    public void TanhSinhIntegrate_Batch_EmptyResults_ReturnsWithoutEvaluating()
+    {
+        int calls = 0;
+
+        CRGQ001A.TanhSinhIntegrate((x, values) => calls++, 0.0, 1.0, Span<double>.Empty);
+
+        Assert.Equal(0, calls);
+    }
+
+    [Fact]
+    public void TanhSinhIntegrate_ConcurrentCallers_AgreeWithSerial()
+    {
+        double expected = CRGQ001A.TanhSinhIntegrate(x => System.Math.Log(x), 0.0, 1.0, 1e-12, 12);
+        double[] results = new double[16];
+
+        Parallel.For(0, results.Length, i =>
+            results[i] = CRGQ001A.TanhSinhIntegrate(x => System.Math.Log(x), 0.0, 1.0, 1e-12, 12));
+
+        Assert.All(results, result => Assert.Equal(expected, result));
+    }
+
+    [Theory]
+    [InlineData(90.0, 0.02, OptionType.Put)]
+    [InlineData(110.0, 0.02, OptionType.Put)]
+    [InlineData(110.0, 0.06, OptionType.Put)]
+    [InlineData(100.0, 0.06, OptionType.Call)]
+    public void HighPrecisionScheme_AgreesWithGaussLegendreAtSameNodes(double strike, double dividendYield, OptionType optionType)
+    {
+        // HighPrecision collocates on 24 nodes with 4 fixed-point passes; only the integrator differs
+        CREN004A highPrecision = new CREN004A(SpectralScheme.HighPrecision);
+        CREN004A gaussLegendre = new CREN004A(24, 4);
+
+        double reference = gaussLegendre.Price(100.0, strike, 1.0, 0.05, dividendYield, 0.25, optionType);
+        double price = highPrecision.Price(100.0, strike, 1.0, 0.05, dividendYield, 0.25, optionType);
+
+        Assert.True(System.Math.Abs(price - reference) < 1e-4, $"Tanh-sinh {price}, Gauss-Legendre {reference}");
+    }
+}
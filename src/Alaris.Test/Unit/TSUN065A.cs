@@ -0,0 +1,120 @@
+// TSUN065A.cs - Unit tests for the CRCH001A DCT coefficient transforms and batched Clenshaw evaluation
+
+using System;
+using Alaris.Core.Math;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for CRCH001A coefficient transforms and series evaluation.
+/// Component ID: TSUN065A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - First-kind coefficients reproduce barycentric interpolation, on FFT and direct sizes
+/// - Lobatto coefficients match the direct DCT-I sum, on FFT and direct sizes
+/// - Batched Clenshaw evaluation agrees bit for bit with the scalar overload
+/// - Undersized coefficient and destination spans are rejected
+/// </remarks>
+public sealed class TSUN065A
+{
+    private static double Smooth(double x) => System.Math.Exp(x) * System.Math.Sin(3.0 * x);
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(5)]
+    [InlineData(8)]
+    [InlineData(12)]
+    [InlineData(16)]
+    [InlineData(64)]
+    public void NodeValuesToCoefficients_MatchesBarycentricInterpolation(int n)
+    {
+        double[] nodes = CRCH001A.ChebyshevNodes(n, -1.0, 1.0);
+        double[] values = new double[n];
+        for (int i = 0; i < n; i++)
+        {
+            values[i] = Smooth(nodes[i]);
+        }
+
+        double[] coefficients = new double[n + 1];
+        CRCH001A.NodeValuesToCoefficients(values, coefficients);
+
+        Assert.Equal(0.0, coefficients[n]);
+        for (double x = -1.0; x <= 1.0; x += 0.05)
+        {
+            double expected = CRCH001A.Interpolate(nodes, values, x);
+            double series = CRCH001A.EvaluateSeries(coefficients, x);
+            Assert.True(System.Math.Abs(series - expected) < 1e-13, $"n={n}, x={x}: {series} vs {expected}");
+        }
+    }
+
+    [Theory]
+    [InlineData(2)]
+    [InlineData(7)]
+    [InlineData(9)]
+    [InlineData(20)]
+    [InlineData(33)]
+    [InlineData(65)]
+    public void ValuesToCoefficients_MatchesDirectDctI(int n)
+    {
+        int m = n - 1;
+        double[] values = new double[n];
+        for (int j = 0; j < n; j++)
+        {
+            values[j] = Smooth(System.Math.Cos(j * System.Math.PI / m));
+        }
+
+        double[] coefficients = CRCH001A.ValuesToCoefficients(values);
+
+        for (int k = 0; k < n; k++)
+        {
+            double sum = 0.5 * (values[0] + ((k % 2 == 0 ? 1.0 : -1.0) * values[m]));
+            for (int j = 1; j < m; j++)
+            {
+                sum += values[j] * System.Math.Cos(j * k * System.Math.PI / m);
+            }
+
+            double expected = 2.0 * sum / m;
+            Assert.True(System.Math.Abs(coefficients[k] - expected) < 1e-13, $"n={n}, k={k}: {coefficients[k]} vs {expected}");
+        }
+    }
+
+    [Theory]
+    [InlineData(1)]
+    [InlineData(2)]
+    [InlineData(17)]
+    public void EvaluateSeries_Batch_MatchesScalarExactly(int terms)
+    {
+        double[] coefficients = new double[terms];
+        for (int k = 0; k < terms; k++)
+        {
+            coefficients[k] = 1.0 / (k + 1.5);
+        }
+
+        // 13 points leave a scalar tail after the four-wide lanes
+        double[] points = new double[13];
+        for (int i = 0; i < points.Length; i++)
+        {
+            points[i] = -1.0 + (2.0 * i / (points.Length - 1));
+        }
+
+        double[] results = new double[points.Length];
+        CRCH001A.EvaluateSeries(coefficients, points, results);
+
+        for (int i = 0; i < points.Length; i++)
+        {
+            Assert.Equal(CRCH001A.EvaluateSeries(coefficients, points[i]), results[i]);
+        }
+    }
+
+    [Fact]
+    public void Transforms_UndersizedSpans_Throw()
+    {
+        double[] values = new double[8];
+
+        Assert.Throws<ArgumentException>(() => CRCH001A.NodeValuesToCoefficients(values, new double[8]));
+        Assert.Throws<ArgumentException>(() => CRCH001A.ValuesToCoefficients(values, new double[7]));
+        Assert.Throws<ArgumentException>(() => CRCH001A.EvaluateSeries(values, new double[4], new double[3]));
+    }
+}
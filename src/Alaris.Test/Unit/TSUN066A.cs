@@ -0,0 +1,178 @@
+// TSUN066A.cs - Unit tests for the DTiv001A session implied-volatility history
+
+using System;
+using System.Collections.Generic;
+using System.Threading.Tasks;
+using Alaris.Infrastructure.Data;
+using Alaris.Infrastructure.Data.Model;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the DTiv001A per-contract implied-volatility store.
+/// Component ID: TSUN066A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Range queries return one leg's observations in date order, whatever the recording order
+/// - Re-recording a day replaces its observations; empty chains still mark the day
+/// - Missing vendor volatilities stay unresolved until the caller stores a solved value
+/// - Eviction drops old days and expired contracts
+/// - Concurrent recording of different days keeps every observation
+/// </remarks>
+public sealed class TSUN066A
+{
+    private static readonly DateTime Expiry = new DateTime(2024, 3, 15);
+
+    [Fact]
+    public void GetRange_ReturnsLegInDateOrder()
+    {
+        DTiv001A history = new DTiv001A();
+        DateTime[] days = { new DateTime(2024, 2, 5), new DateTime(2024, 2, 1), new DateTime(2024, 2, 3) };
+        foreach (DateTime day in days)
+        {
+            history.Record("AAPL", Chain(day, 0.20m + (day.Day / 100m)), day, 0.05m, 0.01m);
+        }
+
+        List<IvObservation> observations = new List<IvObservation>();
+        int count = history.GetRange(Key(100m), new DateTime(2024, 2, 2), new DateTime(2024, 2, 5), observations);
+
+        Assert.Equal(2, count);
+        Assert.Equal(new DateTime(2024, 2, 3), observations[0].Date);
+        Assert.Equal(new DateTime(2024, 2, 5), observations[1].Date);
+        Assert.Equal(0.25, observations[1].ImpliedVolatility, 12);
+        Assert.True(observations[1].IsResolved);
+    }
+
+    [Fact]
+    public void Record_SameDay_ReplacesObservations()
+    {
+        DTiv001A history = new DTiv001A();
+        DateTime day = new DateTime(2024, 2, 1);
+        history.Record("AAPL", Chain(day, 0.20m), day, 0.05m, 0.01m);
+        history.Record("AAPL", Chain(day, 0.30m), day, 0.04m, 0.02m);
+
+        List<IvObservation> observations = new List<IvObservation>();
+        history.GetRange(Key(100m), day, day, observations);
+
+        Assert.Single(observations);
+        Assert.Equal(0.30, observations[0].ImpliedVolatility, 12);
+        Assert.True(history.TryGetDay("AAPL", day, out IvDayContext context));
+        Assert.Equal(0.04m, context.RiskFreeRate);
+    }
+
+    [Fact]
+    public void Record_EmptyChain_MarksDay()
+    {
+        DTiv001A history = new DTiv001A();
+        DateTime day = new DateTime(2024, 2, 1);
+        OptionChainSnapshot empty = new OptionChainSnapshot
+        {
+            Symbol = "AAPL",
+            SpotPrice = 0m,
+            Timestamp = day,
+            Contracts = Array.Empty<OptionContract>()
+        };
+
+        history.Record("AAPL", empty, day.AddHours(9.5), 0m, 0m);
+
+        Assert.True(history.HasDay("AAPL", day));
+        Assert.False(history.HasDay("AAPL", day.AddDays(1)));
+        Assert.Equal(0, history.SeriesCount);
+    }
+
+    [Fact]
+    public void SetImpliedVolatility_ResolvesMissingVendorValue()
+    {
+        DTiv001A history = new DTiv001A();
+        DateTime day = new DateTime(2024, 2, 1);
+        history.Record("AAPL", Chain(day, null), day, 0.05m, 0.01m);
+
+        List<IvObservation> before = new List<IvObservation>();
+        history.GetRange(Key(100m), day, day, before);
+        Assert.False(before[0].IsResolved);
+        Assert.True(double.IsNaN(before[0].ImpliedVolatility));
+        Assert.Equal(2.5m, before[0].Mid);
+
+        Assert.True(history.SetImpliedVolatility(Key(100m), day, 0.27));
+        Assert.False(history.SetImpliedVolatility(Key(100m), day.AddDays(1), 0.27));
+
+        List<IvObservation> after = new List<IvObservation>();
+        history.GetRange(Key(100m), day, day, after);
+        Assert.True(after[0].IsResolved);
+        Assert.Equal(0.27, after[0].ImpliedVolatility);
+    }
+
+    [Fact]
+    public void Evict_DropsOldDaysAndExpiredContracts()
+    {
+        DTiv001A history = new DTiv001A();
+        for (DateTime day = new DateTime(2024, 2, 1); day <= new DateTime(2024, 2, 10); day = day.AddDays(1))
+        {
+            history.Record("AAPL", Chain(day, 0.20m), day, 0.05m, 0.01m);
+        }
+
+        history.Evict(new DateTime(2024, 2, 6));
+
+        List<IvObservation> observations = new List<IvObservation>();
+        history.GetRange(Key(100m), DateTime.MinValue, DateTime.MaxValue, observations);
+        Assert.Equal(5, observations.Count);
+        Assert.False(history.HasDay("AAPL", new DateTime(2024, 2, 5)));
+        Assert.True(history.HasDay("AAPL", new DateTime(2024, 2, 6)));
+
+        history.Evict(Expiry.AddDays(1));
+        Assert.Equal(0, history.SeriesCount);
+    }
+
+    [Fact]
+    public void Record_ConcurrentDays_KeepsEveryObservation()
+    {
+        DTiv001A history = new DTiv001A();
+        DateTime first = new DateTime(2024, 1, 1);
+
+        Parallel.For(0, 60, i =>
+        {
+            DateTime day = first.AddDays(i);
+            history.Record("AAPL", Chain(day, 0.20m), day, 0.05m, 0.01m);
+        });
+
+        List<IvObservation> observations = new List<IvObservation>();
+        history.GetRange(Key(105m), first, first.AddDays(59), observations);
+        Assert.Equal(60, observations.Count);
+        for (int i = 1; i < observations.Count; i++)
+        {
+            Assert.True(observations[i].Date > observations[i - 1].Date);
+        }
+    }
+
+    private static IvSeriesKey Key(decimal strike) => new IvSeriesKey("AAPL", Expiry, strike, OptionRight.Call);
+
+    private static OptionChainSnapshot Chain(DateTime day, decimal? impliedVolatility)
+    {
+        List<OptionContract> contracts = new List<OptionContract>();
+        foreach (decimal strike in new[] { 95m, 100m, 105m })
+        {
+            contracts.Add(new OptionContract
+            {
+                UnderlyingSymbol = "AAPL",
+                OptionSymbol = $"AAPL240315C{strike:000}",
+                Strike = strike,
+                Expiration = Expiry,
+                Right = OptionRight.Call,
+                Bid = 2.4m,
+                Ask = 2.6m,
+                ImpliedVolatility = impliedVolatility,
+                Timestamp = day
+            });
+        }
+
+        return new OptionChainSnapshot
+        {
+            Symbol = "AAPL",
+            SpotPrice = 100m,
+            Timestamp = day,
+            Contracts = contracts
+        };
+    }
+}
@@ -0,0 +1,148 @@
+// TSUN067A.cs - Unit tests for the DTch002A bounded single-flight cache
+
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using Alaris.Infrastructure.Data;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the DTch002A least-recently-used cache.
+/// Component ID: TSUN067A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Hits refresh recency, so the least recently used entry is evicted first
+/// - The estimated-size bound evicts entries but always keeps the newest one
+/// - Concurrent lookups of a loading key share one load
+/// - Failed loads are not cached
+/// - Invalidation drops entries and keeps abandoned loads out of the cache
+/// - Clear resets entries and counters
+/// </remarks>
+public sealed class TSUN067A
+{
+    [Fact]
+    public async Task GetOrAddAsync_EvictsLeastRecentlyUsed()
+    {
+        DTch002A<int, string> cache = new DTch002A<int, string>(2, long.MaxValue, static _ => 1);
+
+        await cache.GetOrAddAsync(1, Load);
+        await cache.GetOrAddAsync(2, Load);
+        await cache.GetOrAddAsync(1, Load);
+        await cache.GetOrAddAsync(3, Load);
+
+        Assert.Equal(2, cache.Count);
+        Assert.Equal(1, cache.Hits);
+        Assert.Equal(3, cache.Misses);
+        Assert.Equal(1, cache.Evictions);
+
+        // Key 2 was least recently used, so it has to load again; key 1 is still cached
+        await cache.GetOrAddAsync(1, Load);
+        Assert.Equal(2, cache.Hits);
+        await cache.GetOrAddAsync(2, Load);
+        Assert.Equal(4, cache.Misses);
+    }
+
+    [Fact]
+    public async Task GetOrAddAsync_WeightBound_KeepsNewestEntry()
+    {
+        DTch002A<int, string> cache = new DTch002A<int, string>(10, 100, static value => value.Length);
+
+        await cache.GetOrAddAsync(1, (_, _) => Task.FromResult(new string('a', 40)));
+        await cache.GetOrAddAsync(2, (_, _) => Task.FromResult(new string('b', 40)));
+        Assert.Equal(80, cache.Weight);
+
+        await cache.GetOrAddAsync(3, (_, _) => Task.FromResult(new string('c', 40)));
+        Assert.Equal(2, cache.Count);
+        Assert.Equal(80, cache.Weight);
+
+        await cache.GetOrAddAsync(4, (_, _) => Task.FromResult(new string('d', 500)));
+        Assert.Equal(1, cache.Count);
+        Assert.Equal(500, cache.Weight);
+        Assert.Equal(3, cache.Evictions);
+    }
+
+    [Fact]
+    public async Task GetOrAddAsync_ConcurrentLookups_ShareOneLoad()
+    {
+        DTch002A<int, string> cache = new DTch002A<int, string>(4, long.MaxValue, static _ => 1);
+        TaskCompletionSource<string> gate = new TaskCompletionSource<string>(TaskCreationOptions.RunContinuationsAsynchronously);
+        int loads = 0;
+
+        Task<string>[] lookups = new Task<string>[8];
+        for (int i = 0; i < lookups.Length; i++)
+        {
+            lookups[i] = cache.GetOrAddAsync(7, (_, _) =>
+            {
+                Interlocked.Increment(ref loads);
+                return gate.Task;
+            });
+        }
+
+        gate.SetResult("seven");
+        string[] results = await Task.WhenAll(lookups);
+
+        Assert.Equal(1, loads);
+        Assert.All(results, result => Assert.Equal("seven", result));
+        Assert.Equal(1, cache.Misses);
+        Assert.Equal(7, cache.Coalesced);
+        Assert.Equal(1, cache.Count);
+    }
+
+    [Fact]
+    public async Task GetOrAddAsync_FailedLoad_IsNotCached()
+    {
+        DTch002A<int, string> cache = new DTch002A<int, string>(4, long.MaxValue, static _ => 1);
+
+        await Assert.ThrowsAsync<InvalidOperationException>(() =>
+            cache.GetOrAddAsync(1, (_, _) => Task.FromException<string>(new InvalidOperationException("no data"))));
+
+        Assert.Equal(0, cache.Count);
+        Assert.Equal("1", await cache.GetOrAddAsync(1, Load));
+        Assert.Equal(2, cache.Misses);
+    }
+
+    [Fact]
+    public async Task Invalidate_DropsEntriesAndAbandonsLoads()
+    {
+        DTch002A<int, string> cache = new DTch002A<int, string>(8, long.MaxValue, static _ => 1);
+        await cache.GetOrAddAsync(1, Load);
+        await cache.GetOrAddAsync(2, Load);
+
+        TaskCompletionSource<string> gate = new TaskCompletionSource<string>(TaskCreationOptions.RunContinuationsAsynchronously);
+        Task<string> pending = cache.GetOrAddAsync(3, (_, _) => gate.Task);
+
+        Assert.Equal(1, cache.Invalidate(key => key != 2));
+
+        gate.SetResult("stale");
+        Assert.Equal("stale", await pending);
+        Assert.Equal(1, cache.Count);
+
+        // The abandoned load was not cached, so the key loads afresh
+        Assert.Equal("3", await cache.GetOrAddAsync(3, Load));
+    }
+
+    [Fact]
+    public async Task Clear_ResetsEntriesAndCounters()
+    {
+        DTch002A<int, string> cache = new DTch002A<int, string>(1, long.MaxValue, static _ => 1);
+        await cache.GetOrAddAsync(1, Load);
+        await cache.GetOrAddAsync(1, Load);
+        await cache.GetOrAddAsync(2, Load);
+
+        cache.Clear();
+
+        Assert.Equal(0, cache.Count);
+        Assert.Equal(0, cache.Weight);
+        Assert.Equal(0, cache.Hits);
+        Assert.Equal(0, cache.Misses);
+        Assert.Equal(0, cache.Evictions);
+    }
+
+    private static Task<string> Load(int key, CancellationToken cancellationToken)
+    {
+        return Task.FromResult(key.ToString(System.Globalization.CultureInfo.InvariantCulture));
+    }
+}
@@ -0,0 +1,151 @@
+// TSUN068A.cs - Unit tests for the STCR008A sliding-window Yang-Zhang estimator
+
+using System;
+using System.Collections.Generic;
+using Alaris.Strategy.Bridge;
+using Alaris.Strategy.Core;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STCR008A rolling Yang-Zhang window and the STCR003A rolling series.
+/// Component ID: TSUN068A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Every full window matches the two-pass STCR003A estimate
+/// - The rolling series matches a per-window recomputation
+/// - Popping the oldest returns leaves the estimate of the remaining suffix
+/// - Long streams do not drift from the two-pass estimate
+/// - Empty windows, short windows and undersized window lengths are rejected
+/// </remarks>
+public sealed class TSUN068A
+{
+    private const double Tolerance = 1e-12;
+
+    [Theory]
+    [InlineData(2)]
+    [InlineData(5)]
+    [InlineData(30)]
+    public void Push_FullWindows_MatchTwoPassEstimate(int window)
+    {
+        List<PriceBar> bars = GenerateBars(120, 11);
+        STCR003A estimator = new STCR003A();
+        STCR008A rollingWindow = new STCR008A(window);
+
+        for (int i = 0; i < bars.Count; i++)
+        {
+            rollingWindow.Push(bars[i]);
+            Assert.Equal(Math.Min(i, window), rollingWindow.Count);
+            if (!rollingWindow.IsFull)
+            {
+                continue;
+            }
+
+            double expected = estimator.Calculate(bars.GetRange(0, i + 1), window);
+            AssertClose(expected, rollingWindow.GetVolatility());
+        }
+    }
+
+    [Fact]
+    public void CalculateRolling_MatchesPerWindowEstimate()
+    {
+        List<PriceBar> bars = GenerateBars(90, 3);
+        STCR003A estimator = new STCR003A();
+
+        IReadOnlyList<(DateTime Date, double Volatility)> series = estimator.CalculateRolling(bars, 20, annualized: false);
+
+        Assert.Equal(70, series.Count);
+        for (int i = 0; i < series.Count; i++)
+        {
+            Assert.Equal(bars[i + 20].Date, series[i].Date);
+            AssertClose(estimator.Calculate(bars.GetRange(i, 21), 20, annualized: false), series[i].Volatility);
+        }
+    }
+
+    [Fact]
+    public void Pop_LeavesEstimateOfRemainingReturns()
+    {
+        List<PriceBar> bars = GenerateBars(41, 5);
+        STCR003A estimator = new STCR003A();
+        STCR008A rollingWindow = new STCR008A(40);
+        foreach (PriceBar bar in bars)
+        {
+            rollingWindow.Push(bar);
+        }
+
+        while (rollingWindow.Count > 2)
+        {
+            rollingWindow.Pop();
+            int count = rollingWindow.Count;
+            double expected = estimator.Calculate(bars.GetRange(bars.Count - count - 1, count + 1), count);
+            AssertClose(expected, rollingWindow.GetVolatility());
+        }
+    }
+
+    [Fact]
+    public void Push_LongStream_DoesNotDrift()
+    {
+        List<PriceBar> bars = GenerateBars(20_000, 17);
+        STCR008A rollingWindow = new STCR008A(30);
+        foreach (PriceBar bar in bars)
+        {
+            rollingWindow.Push(bar);
+        }
+
+        double expected = new STCR003A().Calculate(bars.GetRange(bars.Count - 31, 31), 30);
+        AssertClose(expected, rollingWindow.GetVolatility());
+    }
+
+    [Fact]
+    public void InvalidUse_Throws()
+    {
+        Assert.Throws<ArgumentException>(() => new STCR008A(1));
+
+        STCR008A rollingWindow = new STCR008A(5);
+        Assert.Throws<InvalidOperationException>(() => rollingWindow.Pop());
+
+        List<PriceBar> bars = GenerateBars(2, 1);
+        rollingWindow.Push(bars[0]);
+        rollingWindow.Push(bars[1]);
+        Assert.Throws<InvalidOperationException>(() => rollingWindow.Variance);
+
+        rollingWindow.Reset();
+        Assert.Equal(0, rollingWindow.Count);
+        Assert.Throws<InvalidOperationException>(() => rollingWindow.Pop());
+    }
+
+    private static void AssertClose(double expected, double actual)
+    {
+        Assert.True(Math.Abs(actual - expected) <= Tolerance * Math.Abs(expected), $"{actual} vs {expected}");
+    }
+
+    private static List<PriceBar> GenerateBars(int count, int seed)
+    {
+        Random random = new Random(seed);
+        List<PriceBar> bars = new List<PriceBar>(count);
+        double close = 100.0;
+        DateTime date = new DateTime(2020, 1, 1);
+
+        for (int i = 0; i < count; i++)
+        {
+            double open = close * Math.Exp(0.005 * ((2.0 * random.NextDouble()) - 1.0));
+            close = open * Math.Exp(0.02 * ((2.0 * random.NextDouble()) - 1.0));
+            double high = Math.Max(open, close) * (1.0 + (0.01 * random.NextDouble()));
+            double low = Math.Min(open, close) * (1.0 - (0.01 * random.NextDouble()));
+
+            bars.Add(new PriceBar
+            {
+                Date = date.AddDays(i),
+                Open = open,
+                High = high,
+                Low = low,
+                Close = close,
+                Volume = 1_000_000
+            });
+        }
+
+        return bars;
+    }
+}
@@ -0,0 +1,135 @@
+// TSUN069A.cs - Unit tests for the STKF002A cross-sectional Kalman volatility filter
+
+using System;
+using Alaris.Strategy.Core;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STKF002A universe-level Kalman filter.
+/// Component ID: TSUN069A
+/// </summary>
+/// <remarks>
+/// Tests validate:
+/// - Every symbol tracks a per-symbol STKF001A bit for bit, in vector lanes and the scalar tail
+/// - NaN measurements take the predict-only path and keep the last diagnostics
+/// - Per-symbol parameters and resets apply to their own lane only
+/// - Mismatched input lengths are rejected
+/// </remarks>
+public sealed class TSUN069A
+{
+    private static readonly KalmanParameters[] Parameters =
+    {
+        KalmanParameters.Default,
+        KalmanParameters.EarningsEvent,
+        KalmanParameters.HighFrequency
+    };
+
+    [Theory]
+    [InlineData(4)]
+    [InlineData(13)]
+    [InlineData(64)]
+    public void UpdateAll_MatchesPerSymbolFilter(int count)
+    {
+        STKF002A universe = new STKF002A(count);
+        STKF001A[] filters = new STKF001A[count];
+        for (int s = 0; s < count; s++)
+        {
+            KalmanParameters parameters = Parameters[s % Parameters.Length];
+            filters[s] = new STKF001A(parameters);
+            universe.SetParameters(s, parameters);
+            universe.Reset(s, 0.20, 0.01);
+        }
+
+        Random random = new Random(count);
+        double[] measurements = new double[count];
+        int[] sampleSizes = new int[count];
+
+        for (int day = 0; day < 40; day++)
+        {
+            for (int s = 0; s < count; s++)
+            {
+                // Roughly one symbol in five misses its measurement on a given day
+                bool skip = random.NextDouble() < 0.2;
+                measurements[s] = skip ? double.NaN : 0.1 + (0.4 * random.NextDouble());
+                sampleSizes[s] = 10 + random.Next(30);
+
+                if (skip)
+                {
+                    filters[s].SkipMeasurement();
+                }
+                else
+                {
+                    filters[s].Update(measurements[s], sampleSizes[s]);
+                }
+            }
+
+            universe.UpdateAll(measurements, sampleSizes);
+
+            for (int s = 0; s < count; s++)
+            {
+                KalmanVolatilityEstimate expected = filters[s].CurrentEstimate;
+                KalmanVolatilityEstimate actual = universe.GetEstimate(s);
+
+                Assert.Equal(expected.Volatility, universe.Volatility[s]);
+                Assert.Equal(expected.VolatilityDrift, universe.VolatilityDrift[s]);
+                Assert.Equal(expected.Variance, universe.Variance[s]);
+                Assert.Equal(expected.YangZhangRaw, actual.YangZhangRaw);
+                Assert.Equal(expected.KalmanGain, actual.KalmanGain);
+                Assert.Equal(expected.Innovation, actual.Innovation);
+                Assert.Equal(filters[s].UpdateCount, universe.GetUpdateCount(s));
+            }
+        }
+    }
+
+    [Fact]
+    public void UpdateAll_NaNMeasurement_PredictsOnly()
+    {
+        STKF002A universe = new STKF002A(5);
+        universe.UpdateAll(new[] { 0.3, 0.3, 0.3, 0.3, 0.3 }, new[] { 30, 30, 30, 30, 30 });
+        KalmanVolatilityEstimate before = universe.GetEstimate(2);
+
+        universe.UpdateAll(
+            new[] { 0.3, 0.3, double.NaN, 0.3, double.NaN },
+            new[] { 30, 30, 30, 30, 30 });
+
+        KalmanVolatilityEstimate after = universe.GetEstimate(2);
+        Assert.True(after.Variance > before.Variance);
+        Assert.Equal(before.KalmanGain, after.KalmanGain);
+        Assert.Equal(before.Innovation, after.Innovation);
+        Assert.Equal(1, universe.GetUpdateCount(2));
+        Assert.Equal(2, universe.GetUpdateCount(1));
+        Assert.Equal(1, universe.GetUpdateCount(4));
+        Assert.Equal(2, universe.GetUpdateCount(3));
+    }
+
+    [Fact]
+    public void Reset_AppliesToOneSymbol()
+    {
+        STKF002A universe = new STKF002A(8);
+        double[] measurements = new double[8];
+        Array.Fill(measurements, 0.35);
+        int[] sampleSizes = new int[8];
+        Array.Fill(sampleSizes, 30);
+        universe.UpdateAll(measurements, sampleSizes);
+
+        universe.SetParameters(6, KalmanParameters.EarningsEvent);
+        universe.Reset(6, 0.5, 0.1);
+
+        Assert.Equal(0.5, universe.Volatility[6]);
+        Assert.Equal(0.01, universe.Variance[6], 15);
+        Assert.Equal(0, universe.GetUpdateCount(6));
+        Assert.Equal(universe.Volatility[5], universe.Volatility[7]);
+        Assert.Equal(1, universe.GetUpdateCount(7));
+    }
+
+    [Fact]
+    public void UpdateAll_LengthMismatch_Throws()
+    {
+        STKF002A universe = new STKF002A(6);
+
+        Assert.Throws<ArgumentException>(() => universe.UpdateAll(new double[5], new int[6]));
+        Assert.Throws<ArgumentException>(() => universe.UpdateAll(new double[6], new int[7]));
+    }
+}
@@ -0,0 +1,114 @@
+// TSUN070A.cs - Unit tests for reproducible concurrent implied-volatility inversion
+
+using System;
+using System.Collections.Generic;
+using System.Threading.Tasks;
+using Alaris.Core.Options;
+using Alaris.Core.Pricing;
+using Alaris.Core.Time;
+using Alaris.Strategy.Bridge;
+using Alaris.Strategy.Model;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the pricing path the daily evaluation runs concurrently.
+/// Component ID: TSUN070A
+/// </summary>
+/// <remarks>
+/// The daily evaluation inverts history quotes for every symbol on one long-lived
+/// STBR001A, with the degree of parallelism taken from configuration. Tests validate:
+/// - One day's inversions are bit-identical at parallelism 1 and 8
+/// - Results do not depend on the order in which quotes are solved
+/// </remarks>
+public sealed class TSUN070A
+{
+    private static readonly CRTM005A ValuationDate = new CRTM005A(15, CRTM005AMonth.January, 2024);
+
+    [Fact]
+    public void CalculateImpliedVolatility_Parallelism1And8_AreIdentical()
+    {
+        List<(STDT003A Parameters, double Mid)> quotes = CreateDay();
+        using STBR001A bridge = new STBR001A();
+
+        double[] serial = SolveDay(bridge, quotes, 1, reverse: false);
+        double[] parallel = SolveDay(bridge, quotes, 8, reverse: false);
+
+        Assert.Equal(serial, parallel);
+        Assert.All(serial, iv => Assert.True(double.IsFinite(iv) && iv > 0, $"IV {iv}"));
+    }
+
+    [Fact]
+    public void CalculateImpliedVolatility_ReversedOrder_IsIdentical()
+    {
+        List<(STDT003A Parameters, double Mid)> quotes = CreateDay();
+        using STBR001A bridge = new STBR001A();
+
+        double[] forward = SolveDay(bridge, quotes, 1, reverse: false);
+        double[] reversed = SolveDay(bridge, quotes, 1, reverse: true);
+
+        Assert.Equal(forward, reversed);
+    }
+
+    private static double[] SolveDay(
+        STBR001A bridge,
+        List<(STDT003A Parameters, double Mid)> quotes,
+        int parallelism,
+        bool reverse)
+    {
+        double[] result = new double[quotes.Count];
+        Parallel.For(
+            0,
+            quotes.Count,
+            new ParallelOptions { MaxDegreeOfParallelism = parallelism },
+            j =>
+            {
+                int i = reverse ? quotes.Count - 1 - j : j;
+                result[i] = bridge.CalculateImpliedVolatility(quotes[i].Mid, quotes[i].Parameters)
+                    .GetAwaiter().GetResult();
+            });
+
+        return result;
+    }
+
+    /// <summary>
+    /// A day of history quotes across symbols, strikes and expiries, priced at nearby
+    /// volatilities so successive solves fall in the same or adjacent buckets.
+    /// </summary>
+    private static List<(STDT003A Parameters, double Mid)> CreateDay()
+    {
+        CREN004A engine = new CREN004A();
+        List<(STDT003A Parameters, double Mid)> quotes = new List<(STDT003A Parameters, double Mid)>();
+
+        foreach (double spot in new[] { 48.0, 100.0, 215.0 })
+        {
+            foreach (int days in new[] { 30, 58, 93 })
+            {
+                foreach (double moneyness in new[] { 0.9, 0.95, 1.0, 1.05, 1.1 })
+                {
+                    double strike = Math.Round(spot * moneyness);
+                    double sigma = 0.22 + (0.04 * (1.0 - moneyness)) + (0.0005 * days);
+                    OptionType right = moneyness < 1.0 ? OptionType.Put : OptionType.Call;
+
+                    STDT003A parameters = new STDT003A
+                    {
+                        UnderlyingPrice = spot,
+                        Strike = strike,
+                        Expiry = ValuationDate.AddDays(days),
+                        ImpliedVolatility = sigma,
+                        RiskFreeRate = 0.05,
+                        DividendYield = 0.01,
+                        OptionType = right,
+                        ValuationDate = ValuationDate
+                    };
+
+                    double mid = engine.Price(spot, strike, parameters.TimeToExpiry(), 0.05, 0.01, sigma, right);
+                    quotes.Add((parameters, mid));
+                }
+            }
+        }
+
+        return quotes;
+    }
+}
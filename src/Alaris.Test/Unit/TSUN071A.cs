@@ -0,0 +1,124 @@
+// TSUN071A.cs - Unit tests for the analytic-Jacobian Levenberg-Marquardt path
+
+using System;
+using Alaris.Strategy.Core.Numerical;
+using Xunit;
+
+namespace Alaris.Test.Unit;
+
+/// <summary>
+/// Unit tests for the STPR004A Levenberg-Marquardt optimizer.
+/// Component ID: TSUN071A
+/// </summary>
+/// <remarks>
+/// Heston calibration hands STPR004A an analytic Jacobian; every other caller relies on
+/// central differences. Tests validate:
+/// - Both paths converge to the same optimum on a curve fit with noisy observations
+/// - Both paths converge to the same optimum on the Rosenbrock problem
+/// </remarks>
+public sealed class TSUN071A
+{
+    private static readonly double[] s_times = { 0.0, 0.25, 0.5, 1.0, 1.5, 2.0, 3.0, 4.0, 6.0, 8.0 };
+    private static readonly double[] s_exponentialStart = { 1.0, 0.3, 0.0 };
+    private static readonly double[] s_rosenbrockStart = { -1.2, 1.0 };
+
+    [Fact]
+    public void Minimize_ExponentialFit_AnalyticAndFiniteDifferenceAgree()
+    {
+        // Arrange: y = a exp(-b t) + c with a fixed, zero-mean perturbation
+        double[] observed = new double[s_times.Length];
+        for (int i = 0; i < s_times.Length; i++)
+        {
+            double noise = (i % 2 == 0 ? 1.0 : -1.0) * 0.01 * (1 + (i % 3));
+            observed[i] = (2.0 * Math.Exp(-0.7 * s_times[i])) + 0.5 + noise;
+        }
+
+        double[] Residuals(double[] x)
+        {
+            double[] residuals = new double[s_times.Length];
+            for (int i = 0; i < s_times.Length; i++)
+            {
+                residuals[i] = (x[0] * Math.Exp(-x[1] * s_times[i])) + x[2] - observed[i];
+            }
+
+            return residuals;
+        }
+
+        (double[] Residuals, double[,] Jacobian) Evaluate(double[] x)
+        {
+            double[,] jacobian = new double[s_times.Length, 3];
+            for (int i = 0; i < s_times.Length; i++)
+            {
+                double decay = Math.Exp(-x[1] * s_times[i]);
+                jacobian[i, 0] = decay;
+                jacobian[i, 1] = -x[0] * s_times[i] * decay;
+                jacobian[i, 2] = 1.0;
+            }
+
+            return (Residuals(x), jacobian);
+        }
+
+        // Act
+        (OptimizationResult analytic, OptimizationResult finiteDifference) =
+            MinimizeBoth(Residuals, Evaluate, s_exponentialStart);
+
+        // Assert
+        AssertSameOptimum(analytic, finiteDifference, 1e-5);
+        Assert.True(Math.Abs(analytic.OptimalParameters[1] - 0.7) < 0.05, $"b {analytic.OptimalParameters[1]}");
+    }
+
+    [Fact]
+    public void Minimize_Rosenbrock_AnalyticAndFiniteDifferenceAgree()
+    {
+        // Arrange: r = (10 (y - x²), 1 - x), minimum at (1, 1)
+        double[] Residuals(double[] x) => new[] { 10.0 * (x[1] - (x[0] * x[0])), 1.0 - x[0] };
+
+        (double[] Residuals, double[,] Jacobian) Evaluate(double[] x)
+        {
+            double[,] jacobian = { { -20.0 * x[0], 10.0 }, { -1.0, 0.0 } };
+            return (Residuals(x), jacobian);
+        }
+
+        // Act
+        (OptimizationResult analytic, OptimizationResult finiteDifference) =
+            MinimizeBoth(Residuals, Evaluate, s_rosenbrockStart);
+
+        // Assert
+        AssertSameOptimum(analytic, finiteDifference, 1e-5);
+        Assert.True(Math.Abs(analytic.OptimalParameters[0] - 1.0) < 1e-5, $"x {analytic.OptimalParameters[0]}");
+        Assert.True(Math.Abs(analytic.OptimalParameters[1] - 1.0) < 1e-5, $"y {analytic.OptimalParameters[1]}");
+    }
+
+    private static (OptimizationResult Analytic, OptimizationResult FiniteDifference) MinimizeBoth(
+        Func<double[], double[]> residuals,
+        Func<double[], (double[] Residuals, double[,] Jacobian)> evaluate,
+        double[] start)
+    {
+        STPR004A optimizer = new STPR004A
+        {
+            MaxIterations = 500,
+            ParameterTolerance = 1e-12,
+            ObjectiveTolerance = 1e-12
+        };
+
+        OptimizationResult analytic = optimizer.Minimize(evaluate, (double[])start.Clone());
+        OptimizationResult finiteDifference = optimizer.Minimize(residuals, (double[])start.Clone());
+        return (analytic, finiteDifference);
+    }
+
+    private static void AssertSameOptimum(OptimizationResult analytic, OptimizationResult finiteDifference, double tolerance)
+    {
+        Assert.True(analytic.Converged, $"Analytic path stopped with {analytic.Status}");
+        Assert.True(finiteDifference.Converged, $"Finite-difference path stopped with {finiteDifference.Status}");
+        Assert.Equal(analytic.OptimalParameters.Count, finiteDifference.OptimalParameters.Count);
+
+        for (int i = 0; i < analytic.OptimalParameters.Count; i++)
+        {
+            double a = analytic.OptimalParameters[i];
+            double f = finiteDifference.OptimalParameters[i];
+            Assert.True(Math.Abs(a - f) < tolerance, $"Parameter {i}: analytic {a} vs finite difference {f}");
+        }
+
+        Assert.True(Math.Abs(analytic.RMSE - finiteDifference.RMSE) < tolerance, $"RMSE {analytic.RMSE} vs {finiteDifference.RMSE}");
+    }
+}